@@ -1,7 +1,7 @@
 TARGET = FISEditor
 TEMPLATE = app
 
-QT += core gui widgets multimedia #opengl?
+QT += core gui widgets multimedia concurrent #opengl?
 
 CONFIG += c++17 #console? (console output), static? (static binary)
 
@@ -13,29 +13,44 @@ SOURCES += \
     src/Application.cc \
     src/EditorHelpers.cc \
     src/Database/EditorAction.cc \
+    src/Database/EditorAnimationClock.cc \
+    src/Database/EditorAtlas.cc \
     src/Database/EditorBattleScene.cc \
     src/Database/EditorCategory.cc \
+    src/Database/EditorConvoPath.cc \
     src/Database/EditorEvent.cc \
     src/Database/EditorEventSet.cc \
+    src/Database/EditorImageScan.cc \
+    src/Database/EditorImageStore.cc \
     src/Database/EditorItem.cc \
+    src/Database/EditorJournal.cc \
+    src/Database/EditorListModel.cc \
     src/Database/EditorLock.cc \
     src/Database/EditorMap.cc \
+    src/Database/EditorMapClipboard.cc \
+    src/Database/EditorMapHover.cc \
     src/Database/EditorMapIO.cc \
     src/Database/EditorMapItem.cc \
     src/Database/EditorMapNPC.cc \
     src/Database/EditorMapPerson.cc \
+    src/Database/EditorMapReach.cc \
     src/Database/EditorMapThing.cc \
     src/Database/EditorMatrix.cc \
     src/Database/EditorNPCPath.cc \
     src/Database/EditorParty.cc \
+    src/Database/EditorPathGrid.cc \
     src/Database/EditorPerson.cc \
+    src/Database/EditorProjectDiff.cc \
+    src/Database/EditorReachability.cc \
     src/Database/EditorSkill.cc \
     src/Database/EditorSkillset.cc \
     src/Database/EditorSound.cc \
+    src/Database/EditorSoundCache.cc \
     src/Database/EditorSoundDb.cc \
     src/Database/EditorSprite.cc \
     src/Database/EditorTile.cc \
     src/Database/EditorTileSprite.cc \
+    src/Database/EditorUsageIndex.cc \
     src/Database/GameDatabase.cc \
     src/Dialog/ConvoDialog.cc \
     src/Dialog/EventDialog.cc \
@@ -48,9 +63,11 @@ SOURCES += \
     src/Dialog/MatrixDialog.cc \
     src/Dialog/NodeDialog.cc \
     src/Dialog/PersonDialog.cc \
+    src/Dialog/SheetDialog.cc \
     src/Dialog/SpriteDialog.cc \
     src/Dialog/ThingDialog.cc \
     src/View/BattleSceneView.cc \
+    src/View/ConvoTreeModel.cc \
     src/View/EventSetView.cc \
     src/View/EventView.cc \
     src/View/GameView.cc \
@@ -110,30 +127,45 @@ HEADERS += \
     include/EditorEnumDb.h \
     include/EditorHelpers.h \
     include/Database/EditorAction.h \
+    include/Database/EditorAnimationClock.h \
+    include/Database/EditorAtlas.h \
     include/Database/EditorBattleScene.h \
     include/Database/EditorCategory.h \
+    include/Database/EditorConvoPath.h \
     include/Database/EditorEvent.h \
     include/Database/EditorEventSet.h \
+    include/Database/EditorImageScan.h \
+    include/Database/EditorImageStore.h \
     include/Database/EditorItem.h \
+    include/Database/EditorJournal.h \
+    include/Database/EditorListModel.h \
     include/Database/EditorLock.h \
     include/Database/EditorMap.h \
+    include/Database/EditorMapClipboard.h \
+    include/Database/EditorMapHover.h \
     include/Database/EditorMapIO.h \
     include/Database/EditorMapItem.h \
     include/Database/EditorMapNPC.h \
     include/Database/EditorMapPerson.h \
+    include/Database/EditorMapReach.h \
     include/Database/EditorMapThing.h \
     include/Database/EditorMatrix.h \
     include/Database/EditorNPCPath.h \
     include/Database/EditorParty.h \
+    include/Database/EditorPathGrid.h \
     include/Database/EditorPerson.h \
+    include/Database/EditorProjectDiff.h \
+    include/Database/EditorReachability.h \
     include/Database/EditorSkill.h \
     include/Database/EditorSkillset.h \
     include/Database/EditorSound.h \
+    include/Database/EditorSoundCache.h \
     include/Database/EditorSoundDb.h \
     include/Database/EditorSprite.h \
     include/Database/EditorTemplate.h \
     include/Database/EditorTile.h \
     include/Database/EditorTileSprite.h \
+    include/Database/EditorUsageIndex.h \
     include/Database/GameDatabase.h \
     include/Dialog/ConvoDialog.h \
     include/Dialog/EventDialog.h \
@@ -146,9 +178,11 @@ HEADERS += \
     include/Dialog/MatrixDialog.h \
     include/Dialog/NodeDialog.h \
     include/Dialog/PersonDialog.h \
+    include/Dialog/SheetDialog.h \
     include/Dialog/SpriteDialog.h \
     include/Dialog/ThingDialog.h \
     include/View/BattleSceneView.h \
+    include/View/ConvoTreeModel.h \
     include/View/EventSetView.h \
     include/View/EventView.h \
     include/View/GameView.h \
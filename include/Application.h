@@ -33,6 +33,8 @@
 #include <QTreeView>
 #include <QDesktopWidget>
 
+#include "Database/EditorAtlas.h"
+#include "Database/EditorProjectDiff.h"
 #include "Database/GameDatabase.h"
 #include "FileHandler.h"
 #include "View/MapView.h"
@@ -54,8 +56,12 @@ public:
 
 private:
   /* Actions */
+  QAction* action_atlas;
+  QAction* action_compare;
+  QAction* action_duplicates;
   QAction* action_export;
   QAction* action_load;
+  QAction* action_merge;
   QAction* action_new;
   QAction* action_play;
   QAction* action_recent;
@@ -74,6 +80,8 @@ private:
   QAction* action_passN;
   QAction* action_passS;
   QAction* action_passW;
+  QAction* action_regioncopy;
+  QAction* action_stamp;
 
   /* Brush and Menu Tabs */
   QToolBar* bar_brush;
@@ -117,12 +125,22 @@ private:
   /* Load application */
   void loadApp(QString filename);
 
+  /* Loads a save file into the game database, with progress */
+  bool loadFile(QString filename, bool skip_core = false);
+
+  /* Recovers the unsaved edits of the last session from the edit journals */
+  void recover();
+
   /* Save application */
   void saveApp();
 
   /* Sets up the Top Menu */
   void setupTopMenu();
 
+  /* Lists the changes or conflicts of the project diff */
+  void showDiffEntries(QString title, QString label,
+                       const EditorProjectDiff &project_diff);
+
 /*============================================================================
  * PROTECTED FUNCTIONS
  *===========================================================================*/
@@ -138,6 +156,9 @@ protected:
  * SLOTS
  *===========================================================================*/
 public slots:
+  /* Compares two versions of a project */
+  void compareProjects();
+
   /* Disables control for when in editing view with map */
   void disableControl(bool disabled);
 
@@ -150,6 +171,9 @@ public slots:
   /* Load action */
   void load();
 
+  /* Merges two versions of a project from their common base */
+  void mergeProjects();
+
   /* New game */
   bool newGame();
 
@@ -179,6 +203,8 @@ public slots:
   void setCursorEraser(bool checked);
   void setCursorFill(bool checked);
   void setCursorMove(bool checked);
+  void setCursorRegionCopy(bool checked);
+  void setCursorStamp(bool checked);
 
   /* Sets To Equipment */
   //void setEquipment(EditorEquipment* equipment);
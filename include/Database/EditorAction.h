@@ -17,6 +17,7 @@
 #include <QVBoxLayout>
 #include <QHBoxLayout>
 #include <QGridLayout>
+#include <QShowEvent>
 
 #include "Database/EditorTemplate.h"
 #include "EditorHelpers.h"
@@ -44,6 +45,9 @@ private:
   QString name;
   QString full_name;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Testing string (May be removed) */
   QString test_string;
 
@@ -265,12 +269,24 @@ protected:
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorAction &source);
 
+  /* Creates interface layout */
+  void createLayout();
+
+  /* Reads the UI objects into the working action */
+  void readWorkingInfo();
+
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
 /*============================================================================
  * SIGNALS
  *===========================================================================*/
 signals:
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -362,7 +378,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the object data */
   virtual void save(FileHandler* fh, bool game_only = false);
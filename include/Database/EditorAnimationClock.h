@@ -0,0 +1,81 @@
+/*******************************************************************************
+ * Class Name: EditorAnimationClock
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: The one clock that all animated previews are timed from. It
+ *              only ticks while at least one preview holds it, and every tick
+ *              carries the same time, so all sprites on a view stay in step.
+ ******************************************************************************/
+#ifndef EDITORANIMATIONCLOCK_H
+#define EDITORANIMATIONCLOCK_H
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QTimer>
+
+/* Editor Animation Clock Class */
+class EditorAnimationClock : public QObject
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  EditorAnimationClock(QObject* parent = nullptr);
+
+  /* Destructor Function */
+  ~EditorAnimationClock();
+
+  /*------------------- Constants -----------------------*/
+  const static int kTICK_INTERVAL; /* Time between ticks, in ms */
+
+private:
+  /* Time since the clock was created */
+  QElapsedTimer elapsed;
+
+  /* Number of previews holding the clock */
+  int holders;
+
+  /* The tick timer */
+  QTimer timer;
+
+  /* The shared clock */
+  static EditorAnimationClock* shared_clock;
+
+/*============================================================================
+ * SIGNALS
+ *===========================================================================*/
+signals:
+  /* The clock ticked, with the time in ms */
+  void tick(qint64 time);
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+public slots:
+  /* Timer trigger */
+  void timerTick();
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Holds the clock, starting it if not running */
+  void acquire();
+
+  /* Returns the time of the clock, in ms */
+  qint64 getTime() const;
+
+  /* Returns if the clock is running */
+  bool isRunning() const;
+
+  /* Releases the clock, stopping it if no longer held */
+  void release();
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the shared clock */
+  static EditorAnimationClock* getShared();
+};
+
+#endif // EDITORANIMATIONCLOCK_H
@@ -0,0 +1,140 @@
+/*******************************************************************************
+ * Class Name: EditorAtlas
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Texture atlas for game exports. Packs the images the project
+ *              uses into a few atlas pages, rendered in parallel, and writes a
+ *              manifest of where each image went. While exporting, the saved
+ *              image paths are region paths into the pages. The pages and
+ *              manifest are reused by the next export if no image changed.
+ *              Lay-overs and backgrounds scroll and tile, so they are not
+ *              packed and keep their own paths.
+ ******************************************************************************/
+#ifndef EDITORATLAS_H
+#define EDITORATLAS_H
+
+#include <QDateTime>
+#include <QDir>
+#include <QEventLoop>
+#include <QFile>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
+#include <QImageReader>
+#include <QPainter>
+#include <QProgressDialog>
+#include <QRect>
+#include <QStringList>
+#include <QVector>
+#include <QXmlStreamReader>
+#include <QXmlStreamWriter>
+#include <QtConcurrent>
+#include <algorithm>
+
+#include "Database/EditorImageStore.h"
+#include "EditorHelpers.h"
+
+/* Struct for where a single image is packed in the atlas */
+struct EditorAtlasEntry
+{
+  qint64 modified; /* Modified time of the image file, in ms since epoch */
+  int page; /* Page index, or -1 if too big or unreadable to pack */
+  QRect rect;
+  qint64 size; /* Size of the image file, in bytes */
+};
+
+/* Struct for a single atlas page and the images packed into it */
+struct EditorAtlasPage
+{
+  QString file;
+  QVector<QPair<QString,QRect>> images;
+  QSize size;
+};
+
+/* Editor Atlas Class */
+class EditorAtlas
+{
+public:
+  /* Constructor Function */
+  EditorAtlas(QString dir = "");
+
+  /* Destructor Function */
+  ~EditorAtlas();
+
+  /*------------------- Constants -----------------------*/
+  const static QString kMANIFEST; /* File name of the manifest, in the dir */
+  const static int kMANIFEST_VERSION; /* Version of the manifest format */
+  const static int kPADDING; /* Space between packed images, in pixels */
+  const static int kPAGE_SIZE; /* Max width and height of a page, in pixels */
+  const static int kPROGRESS_DELAY; /* Delay before showing progress, in ms */
+
+private:
+  /* The directory of the pages and manifest */
+  QString dir;
+
+  /* The images, packed or left off the pages, by full image file path */
+  QHash<QString, EditorAtlasEntry> entries;
+
+  /* The page files, by page index */
+  QStringList pages;
+
+  /* The atlas the export is saving paths into. Null if not exporting */
+  static EditorAtlas* exporting;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Returns if the pack is of exactly the files, as they are on disk now */
+  bool isCurrent(const QStringList &files) const;
+
+  /* Loads the manifest of the last pack */
+  bool loadManifest();
+
+  /* Packs the files into pages, filling the entries */
+  QVector<EditorAtlasPage> pack(const QStringList &files);
+
+  /* Renders and writes a page. Safe off the GUI thread */
+  static bool renderPage(const EditorAtlasPage &page);
+
+  /* Saves the manifest of the pack */
+  bool saveManifest() const;
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Starts saving exported image paths into the atlas */
+  void beginExport();
+
+  /* Packs the images into the atlas, reusing the last pack if unchanged */
+  bool build(QStringList paths, QWidget* parent = nullptr);
+
+  /* Clears the pack */
+  void clear();
+
+  /* Stops saving exported image paths into the atlas */
+  void endExport();
+
+  /* Returns the number of packed images */
+  int getImageCount() const;
+
+  /* Returns the number of pages */
+  int getPageCount() const;
+
+  /* Returns the atlas region path of the image. Empty if not packed */
+  QString getPath(QString path) const;
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the path to save for the image, into the atlas if exporting */
+  static QString getExportPath(QString path);
+
+  /* Returns if an export is saving image paths into an atlas */
+  static bool isExporting();
+};
+
+#endif // EDITORATLAS_H
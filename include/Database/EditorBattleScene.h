@@ -7,7 +7,9 @@
 #ifndef EDITORBATTLESCENE_H
 #define EDITORBATTLESCENE_H
 
+#include <QHash>
 #include <QString>
+#include <QStringList>
 
 #include "Database/EditorTemplate.h"
 #include "EditorHelpers.h"
@@ -64,6 +66,9 @@ public:
   /* Returns the ID of the scene */
   virtual int getID() const;
 
+  /* Returns the image files used by the background and lay overs */
+  QStringList getLayPaths() const;
+
   /* Returns the midlay(s) LayOver struct */
   LayOver getMidlay(int index) const;
   LayOver* getMidlayRef(int index);
@@ -95,7 +100,10 @@ public:
   bool isChanged();
 
   /* Loads the object data */
-  bool load(XmlData data, int index);
+  bool load(XmlData &data, int index);
+
+  /* Replaces the background and lay over image files that are in the remap */
+  int remapLayPaths(const QHash<QString,QString> &remap);
 
   /* Saves the object data */
   void save(FileHandler* fh, bool game_only = false);
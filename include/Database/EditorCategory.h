@@ -14,6 +14,7 @@
 #include <QLabel>
 #include <QLineEdit>
 #include <QPushButton>
+#include <QShowEvent>
 #include <QSpinBox>
 #include <QTextEdit>
 #include <QVBoxLayout>
@@ -81,6 +82,9 @@ private:
   /* Editor ID */
   int id;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Skill Set information */
   int set_id;
   int set_id_base;
@@ -109,6 +113,9 @@ protected:
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
 /*============================================================================
  * SIGNALS
  *===========================================================================*/
@@ -116,6 +123,9 @@ signals:
   /* Name changed within category widget signal */
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -154,7 +164,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
 
   /* Resets the working set trigger */
   void resetWorking();
@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Class Name: EditorConvoPath
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The path to a conversation entry, as the rows of the base index
+ *              (4.5.4). Odd steps are the place in a straight run and even
+ *              steps the option picked. Kept as integers so it can be compared
+ *              and hashed without parsing; the string form is only for display.
+ ******************************************************************************/
+#ifndef EDITORCONVOPATH_H
+#define EDITORCONVOPATH_H
+
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "Event/Conversation/ConversationEntryIndex.h"
+
+/* Editor Convo Path Class */
+class EditorConvoPath
+{
+public:
+  /* Constructor Function */
+  EditorConvoPath();
+
+  /* Constructor Function - with base index string (4.5.4) */
+  EditorConvoPath(QString base_index);
+
+  /* Destructor Function */
+  ~EditorConvoPath();
+
+private:
+  /* The base index steps, each 1 or more */
+  QVector<int> steps;
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Appends a step to the end of the path */
+  void append(int step);
+
+  /* Returns the base index string (4.5.4) - for display */
+  QString getBaseIndex() const;
+
+  /* Returns the game entry index (1.1.1.1.5.1.1.1.1) */
+  core::ConversationEntryIndex getEntryIndex() const;
+
+  /* Returns the expanded steps, as used by the game entry index */
+  QVector<int> getExpanded() const;
+
+  /* Returns the path of the entry after this one in the same run */
+  EditorConvoPath getNext() const;
+
+  /* Returns the path of the entry before this one, or the parent if first */
+  EditorConvoPath getPrevious() const;
+
+  /* Returns the steps of the path */
+  QVector<int> getSteps() const;
+
+  /* Returns if the path is empty */
+  bool isEmpty() const;
+
+  /* Returns if the path is to an option */
+  bool isOption() const;
+
+  /* Returns if the path is to the first entry of the conversation */
+  bool isStart() const;
+
+  /* Returns the last step. 0 if empty */
+  int last() const;
+
+/*============================================================================
+ * OPERATOR FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Equality operators */
+  bool operator==(const EditorConvoPath &other) const;
+  bool operator!=(const EditorConvoPath &other) const;
+};
+
+/* Hash function, for conversation entry lookup */
+uint qHash(const EditorConvoPath &path, uint seed = 0);
+
+#endif // EDITORCONVOPATH_H
@@ -9,11 +9,13 @@
 #ifndef EDITOREVENT_H
 #define EDITOREVENT_H
 
+#include <QHash>
 #include <QMap>
 #include <QPair>
 #include <QStringList>
 #include <QVector>
 
+#include "Database/EditorConvoPath.h"
 #include "Event/Conversation/ConversationEntry.h"
 #include "Event/Conversation/ConversationEntryIndex.h"
 #include "Event/Event.h"
@@ -52,6 +54,9 @@ public:
   ~EditorEvent();
 
 private:
+  /* Resolved conversation entries by path. Cleared on any tree change */
+  QHash<EditorConvoPath, core::ConversationEntry*> convo_cache;
+
   /* The event to be edited by this class */
   core::Event* event;
 
@@ -64,9 +69,6 @@ private:
  * PRIVATE FUNCTIONS
  *===========================================================================*/
 private:
-  /* Converts the conversation index to usable form */
-  core::ConversationEntryIndex convertConversationIndex(QString index);
-
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorEvent &source);
 
@@ -84,10 +86,10 @@ private:
  *===========================================================================*/
 public:
   /* Deletes conversation element */
-  void deleteConversation(QString index);
+  void deleteConversation(const EditorConvoPath &path);
 
-  /* Returns an individual conversation, based on the index */
-  core::ConversationEntry* getConversation(QString index);
+  /* Returns an individual conversation, based on the path */
+  core::ConversationEntry* getConversation(const EditorConvoPath &path);
   core::ConversationEntry* getConversationStart();
 
   /* Returns the event */
@@ -196,19 +198,21 @@ public:
   int getUnlockViewTime();
 
   /* Insert the conversation entry at the index address. Fails if invalid point */
-  bool insertConversation(QString index, core::ConversationEntry& entry);
+  bool insertConversation(const EditorConvoPath &path,
+                          core::ConversationEntry& entry);
 
   /* Returns if the event is a one shot trigger */
   bool isOneShot();
 
   /* Loads the event data */
-  void load(core::XmlData data, int index);
+  void load(core::XmlData &data, int index);
 
   /* Saves the event data */
   void save(core::XmlWriter* writer, QString wrapper = "event", bool write_wrapper = true);
 
   /* Sets the conversation entry at the index */
-  bool setConversation(QString index, core::ConversationEntry& entry);
+  bool setConversation(const EditorConvoPath &path,
+                       core::ConversationEntry& entry);
 
   /* Sets the event */
   void setEvent(core::Event* event);
@@ -314,8 +318,8 @@ public:
   static QString classToText(core::EventType classification,
                              QString prefix = "Event: ", bool one_shot = false);
 
-  /* Using the base index, the conversation could be an option (convert true) */
-  static bool couldBeOption(QString base_index, int child_count);
+  /* Using the path, the conversation could be an option (convert true) */
+  static bool couldBeOption(const EditorConvoPath &path, int child_count);
 };
 
 #endif // EDITOREVENT_H
@@ -14,6 +14,7 @@
 
 #include "Database/EditorEvent.h"
 #include "Database/EditorLock.h"
+#include "EditorHelpers.h"
 #include "Foundation/AccessOperation.h"
 
 class EditorEventSet
@@ -89,7 +90,7 @@ public:
   bool isEmpty() const;
 
   /* Loads the event data */
-  void load(core::XmlData data, int index);
+  void load(core::XmlData &data, int index);
 
   /* Saves the event data */
   void save(core::XmlWriter* writer, QString wrapper = "eventset", bool write_wrapper = true,
@@ -0,0 +1,58 @@
+/*******************************************************************************
+ * Class Name: EditorImageScan
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Finds image files with identical pixels, so the references to
+ *              them can be remapped to one canonical file. The images are
+ *              decoded and hashed on the thread pool, apart from the image
+ *              store, so a scan of the whole sprite tree does not fill it.
+ ******************************************************************************/
+#ifndef EDITORIMAGESCAN_H
+#define EDITORIMAGESCAN_H
+
+#include <QCryptographicHash>
+#include <QDirIterator>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
+#include <QProgressDialog>
+#include <QStringList>
+#include <QtConcurrent>
+#include <algorithm>
+
+#include "Database/EditorImageStore.h"
+
+/* Editor Image Scan Class */
+class EditorImageScan
+{
+public:
+  /*------------------- Constants -----------------------*/
+  const static int kPROGRESS_DELAY; /* Delay before showing progress, in ms */
+
+/*============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Returns the hash of the decoded pixels of the image file */
+  static QByteArray hashImage(const QString &path);
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the groups of files with identical pixels, canonical first */
+  static QList<QStringList> findDuplicates(QStringList paths,
+                                           QStringList referenced,
+                                           QWidget* parent = nullptr,
+                                           bool* cancelled = nullptr);
+
+  /* Returns all the image files under the directory */
+  static QStringList getImageFiles(QString dir);
+
+  /* Returns the canonical file of each duplicate, by duplicate */
+  static QHash<QString,QString> getRemap(QList<QStringList> groups);
+};
+
+#endif // EDITORIMAGESCAN_H
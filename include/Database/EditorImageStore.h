@@ -0,0 +1,161 @@
+/*******************************************************************************
+ * Class Name: EditorImageStore
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Shared store of the decoded sprite frame images, by file path.
+ *              Sprites that use the same file share the one image, and sets of
+ *              files (such as a matrix import or a project load) can be
+ *              decoded up front on the thread pool, so the sprites are only
+ *              attached on the GUI thread. Region paths ("file#x,y,w,h")
+ *              reference a cell of a sprite sheet, sharing the sheet pixels.
+ *              Region paths are editor only: game exports write each region
+ *              out as its own image file and save that path (see
+ *              saveRegion()). Editor saves keep the region paths.
+ ******************************************************************************/
+#ifndef EDITORIMAGESTORE_H
+#define EDITORIMAGESTORE_H
+
+#include <QCache>
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QEvent>
+#include <QEventLoop>
+#include <QFileInfo>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QImage>
+#include <QMutex>
+#include <QMutexLocker>
+#include <QProgressDialog>
+#include <QRect>
+#include <QSet>
+#include <QStringList>
+#include <QWidget>
+#include <QtConcurrent>
+
+/* Struct for a single decoded image in the store */
+struct EditorImageEntry
+{
+  QImage image;
+  QDateTime modified;
+};
+
+/* Blocks user input, except to the progress dialog, while it exists. Installed
+ * for a local event loop so input cannot re-enter the code that started it */
+class EditorInputBlock : public QObject
+{
+public:
+  EditorInputBlock(QWidget* allowed = nullptr);
+  ~EditorInputBlock();
+
+protected:
+  bool eventFilter(QObject* watched, QEvent* event);
+
+private:
+  /* The widget (and its children) still given input. Null for none */
+  QWidget* allowed;
+};
+
+/* Editor Image Store Class */
+class EditorImageStore
+{
+public:
+  /* Constructor Function */
+  EditorImageStore();
+
+  /* Destructor Function */
+  ~EditorImageStore();
+
+  /*------------------- Constants -----------------------*/
+  const static int kCACHE_KB; /* Max size of the stored images, in KB */
+  const static int kPROGRESS_DELAY; /* Delay before showing progress, in ms */
+  const static QChar kREGION_SEPARATOR; /* Splits file and region in a path */
+
+private:
+  /* Paths requested while deferred, decoded at the end */
+  QSet<QString> deferred;
+  bool deferring;
+
+  /* The decoded images, by path */
+  QCache<QString, EditorImageEntry> images;
+
+  /* The regions that could not be written out by saveRegion(), until taken */
+  QStringList failed_regions;
+
+  /* The deferred decodes, held outside the cache until released */
+  QHash<QString, EditorImageEntry> pinned;
+
+  /* Lock for the images and pins, shared with the decode threads */
+  mutable QMutex images_lock;
+
+  /* The shared store */
+  static EditorImageStore* shared_store;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Decodes the paths on the thread pool, updating the dialog */
+  bool decodeAll(QStringList paths, QProgressDialog* dialog, bool pin = false);
+
+  /* Returns the stored image, if current. Null image if not */
+  QImage findImage(const QString &path, const QDateTime &modified) const;
+
+  /* Returns a view of the region of the sheet, sharing its pixels */
+  static QImage getRegion(const QImage &sheet, QRect rect);
+
+  /* Decodes the image and stores it, pinned if set */
+  QImage loadImage(const QString &path, bool pin = false);
+
+  /* Releases the sheet held by a region view */
+  static void releaseRegion(void* sheet);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Starts deferring the decode of images not stored */
+  void beginDeferred();
+
+  /* Clears all stored images */
+  void clear();
+
+  /* Stops deferring and decodes all deferred images on the thread pool.
+   * They stay pinned until releasePinned() */
+  bool endDeferred(QProgressDialog* dialog = nullptr);
+
+  /* Returns the image of the path, decoding or deferring it if not stored */
+  QImage getImage(QString path, bool* pending = nullptr);
+
+  /* Decodes all paths not stored on the thread pool, with progress */
+  bool loadImages(QStringList paths, QWidget* parent = nullptr,
+                  QString label = "Loading images...");
+
+  /* Releases the images pinned by endDeferred() to the cache */
+  void releasePinned();
+
+  /* Writes the region out as its own image file. False if it could not be */
+  bool saveRegion(QString path, QString* file);
+
+  /* Returns and clears the regions that could not be written out */
+  QStringList takeFailedRegions();
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the region path of the rect in the sheet file */
+  static QString getRegionPath(QString path, QRect rect);
+
+  /* Returns the shared store */
+  static EditorImageStore* getShared();
+
+  /* Returns if the path references a region of a sheet */
+  static bool isRegionPath(QString path);
+
+  /* Splits a region path into the sheet file and the region rect */
+  static QString splitRegionPath(QString path, QRect* rect = nullptr);
+};
+
+#endif // EDITORIMAGESTORE_H
@@ -17,6 +17,7 @@
 #include <QLineEdit>
 #include <QPushButton>
 #include <QRadioButton>
+#include <QShowEvent>
 #include <QSpinBox>
 #include <QTextEdit>
 #include <QVBoxLayout>
@@ -85,6 +86,9 @@ private:
   /* Protected flag */
   bool is_protected;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Item data */
   Item item_base;
   Item item_curr;
@@ -143,6 +147,9 @@ protected:
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
   /* Updates connected widgets with enabled and disabled statuses */
   void updateConnected();
 
@@ -156,6 +163,9 @@ signals:
   /* Name changed within item widget signal */
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -200,6 +210,9 @@ public:
   /* Returns the ID of the item */
   virtual int getID() const;
 
+  /* Returns the image files of the sprites saved for the game */
+  QStringList getImagePaths();
+
   /* Returns the mass of the item */
   int getMass();
 
@@ -210,7 +223,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
 
   /* Resets the working set trigger */
   void resetWorking();
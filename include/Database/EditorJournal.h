@@ -0,0 +1,183 @@
+/*******************************************************************************
+ * Class Name: EditorJournal
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: Append-only binary journal of the edits made since the project
+ *              was last saved (or started). Each edit is appended as it is
+ *              made, so the work since the last save can be recovered after a
+ *              crash by loading the save and replaying the journal. Appends
+ *              are synced to disk together, shortly after a burst of edits,
+ *              so painting does not wait on the disk for each tile. Records
+ *              that are replaced by later ones are folded out when the journal
+ *              grows, so it stays near the size of the changes, not the edits.
+ *              Each saved project has its own journal, so editors open on
+ *              different projects do not share one.
+ ******************************************************************************/
+#ifndef EDITORJOURNAL_H
+#define EDITORJOURNAL_H
+
+#include <QByteArray>
+#include <QCryptographicHash>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QPoint>
+#include <QRect>
+#include <QSaveFile>
+#include <QStringList>
+#include <QTimer>
+#include <QVector>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "EditorEnumDb.h"
+#include "EditorHelpers.h"
+
+/* Struct for a single edit in the journal */
+struct EditorJournalRecord
+{
+  EditorEnumDb::JournalRecord type;
+
+  /* The map and sub-map IDs, for thing and tile records */
+  int map_id;
+  int sub_id;
+
+  /* The thing class (ThingBase), instance ID and base ID, for thing records */
+  int kind;
+  int id;
+  int base_id;
+
+  /* The thing location, for thing add and move records */
+  QPoint pos;
+
+  /* The tile range, for tile records */
+  QRect rect;
+
+  /* The tile states or the core object data */
+  QByteArray data;
+};
+
+/* Editor Journal Class */
+class EditorJournal : public QObject
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  EditorJournal(QObject* parent = nullptr);
+
+  /* Destructor Function */
+  ~EditorJournal();
+
+  /*------------------- Constants -----------------------*/
+  const static qint64 kCOMPACT_SIZE; /* Journal size to start compacting at */
+  const static quint32 kMAGIC; /* Identifies a journal file */
+  const static int kSYNC_DELAY; /* Wait after an append to sync, in ms */
+  const static quint16 kVERSION; /* Version of the journal format */
+
+private:
+  /* The saved project the journal applies to. Empty if never saved */
+  QString base_path;
+  qint64 base_modified;
+
+  /* Size of the journal after the last compaction, in bytes */
+  qint64 compact_size;
+
+  /* The journal file, open while recording */
+  QFile file;
+
+  /* Syncs the appends since the last sync to disk, once it times out */
+  QTimer sync_timer;
+
+  /* The shared journal */
+  static EditorJournal* shared_journal;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Appends the record to the journal, compacting it if grown */
+  void append(const EditorJournalRecord &record);
+
+  /* Flushes the file and syncs it to disk */
+  static bool syncFile(QFile* file);
+
+  /* Folds the records that are replaced by later records out of the set */
+  static QList<EditorJournalRecord> compactRecords(
+                                         QList<EditorJournalRecord> records);
+
+  /* Encodes and decodes a record */
+  static QByteArray packRecord(const EditorJournalRecord &record);
+  static bool unpackRecord(const QByteArray &bytes,
+                           EditorJournalRecord* record);
+
+  /* Writes the journal header and the records to the device */
+  bool writeJournal(QIODevice* device,
+                    const QList<EditorJournalRecord> &records) const;
+
+  /* Writes a single framed record to the device */
+  static bool writeRecord(QIODevice* device, const EditorJournalRecord &record);
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+public slots:
+  /* Syncs the appended records to disk */
+  void sync();
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Appends the edits by type */
+  void appendCore(const QByteArray &data);
+  void appendThing(EditorEnumDb::JournalRecord type, int map_id, int sub_id,
+                   int kind, int id, int base_id = -1, QPoint pos = QPoint());
+  void appendTiles(int map_id, int sub_id, QRect rect,
+                   const QByteArray &states);
+
+  /* Stops recording and removes the journal */
+  void close();
+
+  /* Folds the replaced records out of the journal */
+  bool compact();
+
+  /* Returns the saved project the journal applies to */
+  QString getBasePath() const;
+
+  /* Returns if edits are being recorded */
+  bool isRecording() const;
+
+  /* Starts a new journal for the saved project, with the starting records */
+  bool open(QString base_path, QList<EditorJournalRecord> records =
+                                               QList<EditorJournalRecord>());
+
+  /* Reads a journal left on disk. False if none or its project changed */
+  bool read(QString path, QString* base_path,
+            QList<EditorJournalRecord>* records) const;
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the journal files left on disk, newest first */
+  static QStringList getJournalFiles();
+
+  /* Returns the journal file path of the saved project */
+  static QString getJournalPath(QString base_path);
+
+  /* Returns the scratch file path of the saved project, for object data */
+  static QString getScratchPath(QString base_path);
+
+  /* Returns the shared journal */
+  static EditorJournal* getShared();
+};
+
+#endif // EDITORJOURNAL_H
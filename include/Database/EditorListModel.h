@@ -0,0 +1,104 @@
+/*******************************************************************************
+ * Class Name: EditorListModel
+ * Date Created: October 19, 2026
+ * Inheritance: QAbstractListModel
+ * Description: A list of game objects keyed by ID, shown as "ID: name". One
+ *              shared model exists per object category, filled by the game
+ *              database, so every combo box binds to the same rows. New lists
+ *              are merged in by ID, so only changed rows are signalled.
+ ******************************************************************************/
+#ifndef EDITORLISTMODEL_H
+#define EDITORLISTMODEL_H
+
+#include <QAbstractListModel>
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QSet>
+#include <QStringList>
+
+#include "EditorEnumDb.h"
+
+/* Struct for a single object in the list */
+struct EditorListEntry
+{
+  int id;
+  QString name;
+  QString text;
+};
+
+/* Editor List Model Class */
+class EditorListModel : public QAbstractListModel
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  EditorListModel(QObject* parent = nullptr);
+
+  /* Destructor Function */
+  ~EditorListModel();
+
+  /* Data roles */
+  const static int kID_ROLE;
+  const static int kNAME_ROLE;
+
+  /* ID of entries with none, such as the "None" row */
+  const static int kNO_ID;
+
+private:
+  /* The entries, in display order */
+  QList<EditorListEntry> entries;
+
+  /* The row of each ID */
+  QHash<int, int> rows;
+
+  /* The shared models, by category */
+  static QMap<EditorEnumDb::ListType, EditorListModel*> shared_models;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Updates the row lookup for the range of rows */
+  void updateRows(int first, int last);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the data of the index for the role */
+  QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+  /* Returns the ID of the row. kNO_ID if out of range */
+  int getID(int row) const;
+
+  /* Returns the display strings of all rows */
+  QList<QString> getList() const;
+
+  /* Returns the name of the ID. Empty if not found */
+  QString getName(int id) const;
+
+  /* Returns the row of the ID. -1 if not found */
+  int getRow(int id) const;
+
+  /* Returns the number of rows */
+  int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+  /* Merges in the new entries, signalling only the rows that changed */
+  void setEntries(QList<EditorListEntry> new_entries);
+
+  /* Merges in the "ID: name" strings */
+  void setList(QList<QString> list);
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the shared model of the category */
+  static EditorListModel* getShared(EditorEnumDb::ListType type);
+
+  /* Parses an "ID: name" string into an entry */
+  static EditorListEntry parseEntry(QString text);
+};
+
+#endif // EDITORLISTMODEL_H
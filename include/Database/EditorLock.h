@@ -67,7 +67,7 @@ public:
   bool isPermanent();
 
   /* Loads the lock data */
-  void load(core::XmlData data, int index);
+  void load(core::XmlData &data, int index);
 
   /* Saves the lock data */
   void save(core::XmlWriter* writer, QString wrapper = "lock", bool write_wrapper = true,
@@ -9,6 +9,7 @@
 
 #include <QDialog>
 #include <QGridLayout>
+#include <QHash>
 #include <QLabel>
 #include <QLineEdit>
 #include <QMap>
@@ -16,15 +17,31 @@
 #include <QObject>
 #include <QProgressDialog>
 #include <QPushButton>
+#include <QRect>
+#include <QRegion>
 #include <QString>
+#include <QTimer>
 #include <QVector>
 
 #include "Database/EditorEvent.h"
+#include "Database/EditorJournal.h"
+#include "Database/EditorMapHover.h"
+#include "Database/EditorMapReach.h"
+#include "Database/EditorPathGrid.h"
+#include "Database/EditorReachability.h"
 #include "Database/EditorTile.h"
+#include "Database/EditorUsageIndex.h"
 #include "EditorEnumDb.h"
 #include "EditorHelpers.h"
 #include "FileHandler.h"
 
+/* Struct for a tile chunk shared copy-on-write between sub-maps */
+struct SubMapInfo;
+struct TileChunkShare
+{
+  QList<SubMapInfo*> maps;
+};
+
 /* Struct for sub map info storage */
 struct SubMapInfo
 {
@@ -34,6 +51,9 @@ struct SubMapInfo
   QVector<QVector<EditorTile*>> tiles;
   EditorNPCPath* path_top;
 
+  /* Copy-on-write chunk shares of the tiles (empty or NULL if not shared) */
+  QVector<TileChunkShare*> chunks;
+
   /* Things and children */
   QVector<EditorMapIO*> ios;
   QVector<EditorMapItem*> items;
@@ -52,6 +72,14 @@ struct SubMapInfo
 
   /* Editor control variables */
   QPointF center_point;
+
+  /* Index of the tiles with animated sprites, for the animated preview */
+  QVector<QPoint> animated_tiles;
+  bool animated_valid;
+
+  /* Index of the tiles with enter or exit events, for the reachability */
+  QVector<QPoint> event_tiles;
+  bool event_valid;
 };
 
 class EditorMap : public QObject, public EditorTemplate
@@ -77,6 +105,9 @@ private:
   HoverInfo active_info;
   SubMapInfo* active_submap;
 
+  /* The hover preview overlay for the active sub-map */
+  EditorMapHover* hover_item;
+
   /* The base map things */
   QVector<EditorMapIO*> base_ios;
   QVector<EditorMapItem*> base_items;
@@ -90,25 +121,39 @@ private:
   /* The map set ID */
   int id;
 
+  /* Tiles changed since the last journal record, by sub-map ID */
+  QHash<int,QRegion> journal_tiles;
+
   /* The name of the map set */
   QString name;
 
-  /* Reference tile - contains information stored in tiles */
-  EditorTile ref_tile;
-
   /* The map sprites */
   QVector<EditorSprite*> sprites;
 
+  /* The packed passability of the active sub-map and the npc path checks */
+  QHash<EditorNPCPath*, PathCheck> path_checks;
+  EditorPathGrid path_grid;
+  bool path_notify;
+
+  /* The reachability of the active sub-map, its overlay and start tile */
+  EditorReachability reach;
+  EditorMapReach* reach_item;
+  QPoint reach_start;
+
   /* The set of sub-maps */
   QVector<SubMapInfo*> sub_maps;
 
   /* Rendering tile icons */
   TileIcons* tile_icons;
 
+  /* Visibility status of layers, grid, passability and events in all tiles */
+  VisibilityInfo visible_info;
+
   /* Visibility status of path */
   bool visible_path;
 
   /*------------------- Constants -----------------------*/
+  const static int kCHUNK_SIZE; /* Tile width and height of a shared chunk */
   const static int kUNSET_ID; /* The unset ID */
 
 /*============================================================================
@@ -131,6 +176,12 @@ protected:
   bool addPerson(EditorMapPerson* person, SubMapInfo* map = NULL,
                  bool existing = true);
 
+  /* Adds the teleport targets and event exits of the event */
+  void addReachEvent(core::Event* event, QPoint source,
+                     QList<QPoint>* targets, QList<QPoint>* exits);
+  void addReachEvents(EditorEventSet* set, QPoint source,
+                      QList<QPoint>* targets, QList<QPoint>* exits);
+
   /* Attempts to add thing to the current sub-map */
   bool addThing(EditorMapThing* thing, SubMapInfo* map = NULL,
                 bool existing = true);
@@ -145,14 +196,50 @@ protected:
   void addTileSpriteData(FileHandler* fh, QProgressDialog* save_dialog,
                          QList<QList<QPoint>> data_set);
 
+  /* Adds the game object references of the event, set, IO and thing */
+  void addUsageEvent(core::Event* event, QString where,
+                     QList<EditorUsage>* usages);
+  void addUsageEvents(EditorEventSet* set, QString where,
+                      QList<EditorUsage>* usages,
+                      EditorEventSet* base_set = nullptr);
+  void addUsageIO(EditorMapIO* io, QString where, QList<EditorUsage>* usages);
+  void addUsageThing(EditorMapThing* thing, QString where,
+                     QList<EditorUsage>* usages);
+
   /* Clear map data */
   void clearAll();
 
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorMap &source);
 
+  /* Creates a copy of a tile, without things */
+  EditorTile* copyTile(EditorTile* source, int x, int y);
+
+  /* Detaches a shared tile chunk from the sub-map, prior to modification */
+  void detachChunk(SubMapInfo* map, int index);
+
+  /* Returns the tile rect of the chunk index */
+  QRect getChunkRect(SubMapInfo* map, int index);
+
+  /* Returns the tile layers recorded in the edit journal */
+  static QVector<EditorEnumDb::Layer> getJournalLayers(bool passability);
+
+  /* Returns the thing by internal type */
+  EditorMapThing* getThingGeneric(ThingBase type, int id, int sub_map = -1);
+
+  /* Records thing instance edits in the edit journal */
+  void journalRemove(ThingBase type, int id);
+  void journalThing(EditorEnumDb::JournalRecord type, EditorMapThing* thing);
+
   /* Loads sub-map info */
-  void loadSubMap(SubMapInfo* map, XmlData data, int index);
+  void loadSubMap(SubMapInfo* map, XmlData &data, int index);
+
+  /* Marks the passability of the sub-map tiles as changed */
+  void markPassChanged(SubMapInfo* map);
+  void markPassChanged(SubMapInfo* map, int x, int y, int w = 1, int h = 1);
+
+  /* Moves the thing to a new location, putting it back if it does not fit */
+  bool moveThing(EditorMapThing* thing, int x, int y, SubMapInfo* map);
 
   /* Re-color NPC paths (triggered on add) */
   void recolorNPCPaths(SubMapInfo* map);
@@ -165,6 +252,12 @@ protected:
   void recursiveFill(int x, int y, EditorEnumDb::Layer layer,
                      EditorSprite* target, SubMapInfo* map);
 
+  /* Re-reads the changed tiles of the active sub-map passability */
+  void refreshPathGrid();
+
+  /* Releases the sub-map tiles, leaving any shared chunks to the others */
+  void releaseTiles(SubMapInfo* map, bool delete_tiles = true);
+
   /* Resizes sub-maps */
   bool resizeMap(SubMapInfo* map, int width, int height);
 
@@ -175,8 +268,11 @@ protected:
   /* Sets the hover thing, based on the passed in rect */
   bool setHoverThing(EditorMapThing* thing);
 
-  /* Updates the tiles that contain the hover information struct */
-  bool updateHoverThing(bool unset = false);
+  /* Shares the tiles of one sub-map with another, copy-on-write */
+  void shareTiles(SubMapInfo* source, SubMapInfo* dest);
+
+  /* Updates the hover preview overlay from the hover information struct */
+  void updateHover();
 
   /* Updates the given tile range within the sub-map */
   void updateTiles(SubMapInfo* map, int x, int y, int w, int h);
@@ -207,6 +303,9 @@ signals:
   void npcPathAdd(EditorNPCPath* path);
   void npcPathRemove(EditorNPCPath* path);
 
+  /* Tile passability changed on the active sub-map - npc paths to re-check */
+  void passabilityChanged();
+
   /* Person instant changed */
   void personInstanceChanged(QString name_list);
 
@@ -216,13 +315,25 @@ signals:
   /* Thing instant changed */
   void thingInstanceChanged(QString name_list);
 
+  /* Tile visibility changed - requires a repaint */
+  void visibilityChanged();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
 public slots:
+  /* Records the tiles changed since the last call in the edit journal */
+  void journalTiles();
+
   /* Hover path changed */
   void npcHoverPathChanged(EditorNPCPath* path);
 
+  /* Re-arms the passability notify and signals the passability changed */
+  void passabilityNotify();
+
+  /* Floods the active sub-map and updates the reachability overlay */
+  void updateReach();
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -240,11 +351,20 @@ public:
   /* Ctrl + click trigger in map */
   void ctrlClickTrigger();
 
+  /* Detaches shared tiles in the range, before they are modified */
+  void detachTiles(SubMapInfo* map, int x, int y, int w = 1, int h = 1);
+
+  /* Returns the index of the tiles with animated sprites in the sub-map */
+  QVector<QPoint> getAnimatedTiles(SubMapInfo* map);
+
   /* Battle scene core access information */
   int getBattleScene(int index);
   int getBattleSceneCount();
   QVector<int> getBattleScenes();
 
+  /* Returns the index of the tiles with enter or exit events in the sub-map */
+  QVector<QPoint> getEventTiles(SubMapInfo* map);
+
   /* Returns current references for lists in map */
   int getCurrentIOIndex();
   int getCurrentItemIndex();
@@ -255,8 +375,9 @@ public:
   int getCurrentSpriteIndex();
   int getCurrentThingIndex();
 
-  /* Returns the hover information */
+  /* Returns the hover information and the hover preview overlay */
   HoverInfo* getHoverInfo();
+  EditorMapHover* getHoverItem();
 
   /* Returns the ID of the map set */
   virtual int getID() const;
@@ -282,6 +403,12 @@ public:
                              bool shortened = false);
   QVector<EditorMapItem*> getItems(int sub_map = -1);
 
+  /* Returns the image files of the map sprites and base thing matrices */
+  QStringList getImagePaths();
+
+  /* Returns the image files used by the lay overs of all sub-maps */
+  QStringList getLayPaths();
+
   /* Returns the stored map information */
   SubMapInfo* getMap(int id);
   SubMapInfo* getMapByIndex(int index);
@@ -298,6 +425,9 @@ public:
   virtual QString getName() const;
   virtual QString getNameList();
 
+  /* Returns the check of the npc path against the active sub-map */
+  PathCheck getPathCheck(EditorMapNPC* npc);
+
   /* Returns available IDs in the set. Useful for when creating a new one */
   int getNextIOID(bool from_sub = false);
   int getNextItemID(bool from_sub = false);
@@ -326,6 +456,9 @@ public:
   SubMapInfo* getPersonSub(EditorMapPerson* ref);
   QVector<EditorMapPerson*> getPersons(int sub_map = -1);
 
+  /* Returns the reachability overlay item for the active sub-map */
+  EditorMapReach* getReachItem();
+
   /* Returns the number of things that will be saved */
   int getSaveCount(int sub_index = -1);
 
@@ -351,6 +484,12 @@ public:
   /* Returns the tile icons */
   TileIcons* getTileIcons();
 
+  /* Returns every game object reference in the map, for the usage index */
+  QList<EditorUsage> getUsages();
+
+  /* Returns the visibility information */
+  VisibilityInfo* getVisibilityInfo();
+
   /* Returns if a new thing (or children) is possible to be created */
   bool isSpaceForIO(bool instance = false);
   bool isSpaceForItem(bool instance = false);
@@ -359,7 +498,19 @@ public:
   bool isSpaceForThing(bool instance = false);
 
   /* Loads the map */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
+
+  /* Replaces the lay over image files that are in the remap */
+  int remapLayPaths(const QHash<QString,QString> &remap);
+
+  /* Replays a tile or thing record of the edit journal */
+  bool replayJournal(const EditorJournalRecord &record);
+
+  /* Resets the index of the animated tiles, to be rebuilt when next used */
+  void resetAnimatedTiles(SubMapInfo* map = nullptr);
+
+  /* Resets the index of the event tiles, to be rebuilt when next used */
+  void resetEventTiles(SubMapInfo* map = nullptr);
 
   /* Resizes sub-maps */
   bool resizeMap(int index, int width, int height);
@@ -368,6 +519,9 @@ public:
   void save(FileHandler* fh, QProgressDialog* save_dialog,
             bool game_only = false, int sub_index = -1);
 
+  /* Sets the animation clock time painted by the animated preview */
+  void setAnimationTime(qint64 time);
+
   /* Sets the battle scene reference ID for the core base */
   bool setBattleScene(int index, int id, bool insert = false);
 
@@ -421,6 +575,9 @@ public:
   /* Sets a person in the map */
   int setPerson(EditorMapPerson* person, int sub_map = -1);
 
+  /* Sets the tile the reachability of the active sub-map floods from */
+  void setReachStart(int x, int y);
+
   /* Sets a sprite */
   int setSprite(EditorSprite* sprite);
 
@@ -433,15 +590,17 @@ public:
   /* Sets layer visibility */
   void setVisibility(EditorEnumDb::Layer layer, bool visible);
 
-  /* Set grid and passability visibility */
+  /* Set animation, grid, passability and reachability visibility */
+  void setVisibilityAnimate(bool);
   void setVisibilityEvents(bool);
   void setVisibilityGrid(bool);
   void setVisibilityPass(bool);
+  void setVisibilityReach(bool);
 
   /* Sets visibility of npc paths */
   void setVisibilityPaths(bool visible);
 
-  /* Sets the visibility of all sub-maps based on reference internal tile */
+  /* Sets the visibility of all sub-map paths based on the map visibility */
   void setVisibilityRef();
 
   /* Thing processing for updating with the new data */
@@ -458,6 +617,10 @@ public:
 
   /* Update all tiles */
   void updateAll();
+
+  /* Updates the event tile index and reachability after a tile event edit */
+  void updateEventTile(int x, int y);
+
   void updateLays();
 
   /* Updates tiles related to person reference */
@@ -0,0 +1,116 @@
+/*******************************************************************************
+ * Class Name: EditorMapClipboard
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: A region clipboard for the map editor. Captures all sprite
+ *              layers and the passability of a rectangle of tiles as packed
+ *              planes and stamps it back into any sub-map. The item itself
+ *              is the translucent paste preview, drawn from one cached
+ *              composite image instead of through the tile hover paints.
+ ******************************************************************************/
+#ifndef EDITORMAPCLIPBOARD_H
+#define EDITORMAPCLIPBOARD_H
+
+#include <QGraphicsItem>
+#include <QHash>
+#include <QImage>
+#include <QMap>
+#include <QPainter>
+#include <QPointer>
+#include <QRect>
+#include <QVector>
+
+#include "Database/EditorMap.h"
+#include "EditorEnumDb.h"
+#include "EditorHelpers.h"
+
+/* Editor Map Clipboard Class */
+class EditorMapClipboard : public QGraphicsItem
+{
+public:
+  /* Constructor Function */
+  EditorMapClipboard();
+
+  /* Destructor Function */
+  virtual ~EditorMapClipboard();
+
+  /* Control functions */
+  enum { Type_ClipboardRender = UserType + 3};
+  int type() const { return Type_ClipboardRender; }
+
+private:
+  /* Region size, in tiles */
+  int height;
+  int width;
+
+  /* Passability planes: one byte per tile for each passable layer (0-15) */
+  QVector<QVector<quint8>> planes_pass;
+
+  /* Sprite planes: one entry per tile for each sprite layer (ID + 1, 0 = none)*/
+  QVector<QVector<quint16>> planes_sprite;
+
+  /* Cached composite of all sprite layers, used for the preview */
+  QImage preview;
+
+  /* Source map and sprite signatures, for remapping IDs across maps. The
+   * map is guarded, so a deleted map is never taken for the source */
+  QPointer<EditorMap> source_map;
+  QHash<int, QString> source_sprites;
+
+  /*------------------- Constants -----------------------*/
+  const static int kNUM_PASS_LAYERS;    /* Number of passability layers */
+  const static int kNUM_SPRITE_LAYERS;  /* Number of sprite layers */
+  const static EditorEnumDb::Layer kPASS_LAYERS[]; /* Passable layer set */
+  const static float kPREVIEW_ALPHA;    /* Opacity of the paste preview */
+  const static int kPREVIEW_MAX;        /* Max pixel side of the composite */
+  const static EditorEnumDb::Layer kSPRITE_LAYERS[]; /* Sprite layer set */
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Builds the cached composite preview image from the sprite planes */
+  void buildPreview();
+
+  /* Returns the sprite ID mapping from the source map into the target map */
+  QHash<int, EditorSprite*> getSpriteMapping(EditorMap* map);
+
+  /* Returns the unique frame signature of a sprite, used for matching */
+  static QString getSpriteSignature(EditorSprite* sprite);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the bounding rectangle of the paste preview */
+  QRectF boundingRect() const;
+
+  /* Clears the clipboard */
+  void clear();
+
+  /* Copies a region of the sub-map into the clipboard */
+  bool copy(EditorMap* map, SubMapInfo* sub_map, QRect region);
+
+  /* Returns the region size, in tiles */
+  int getHeight() const;
+  int getWidth() const;
+
+  /* Returns if the clipboard holds no region */
+  bool isEmpty() const;
+
+  /* Painting function for the paste preview */
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+             QWidget* widget = NULL);
+
+  /* Pastes the region into the sub-map with the top left at the x, y tile */
+  int paste(EditorMap* map, SubMapInfo* sub_map, int x, int y,
+            bool stamp = true);
+
+  /* Moves the preview to the top left x, y tile */
+  void setPreviewTile(int x, int y);
+
+  /* Returns an empty shape, so the preview never intercepts the tile hover */
+  QPainterPath shape() const;
+};
+
+#endif // EDITORMAPCLIPBOARD_H
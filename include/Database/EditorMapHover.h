@@ -0,0 +1,86 @@
+/*******************************************************************************
+ * Class Name: EditorMapHover
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: The hover preview overlay for the map editor. Paints the sprite
+ *              or thing about to be placed, the eraser and placement tint and
+ *              the selected thing border above the tiles. Only its own bound
+ *              is repainted as the cursor moves, so tiles do not need to know
+ *              about the hover state.
+ ******************************************************************************/
+#ifndef EDITORMAPHOVER_H
+#define EDITORMAPHOVER_H
+
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QRect>
+
+#include "Database/EditorTile.h"
+#include "EditorEnumDb.h"
+#include "EditorHelpers.h"
+
+struct SubMapInfo;
+
+/* Editor Map Hover Class */
+class EditorMapHover : public QGraphicsItem
+{
+public:
+  /* Constructor Function */
+  EditorMapHover(HoverInfo* info = NULL, VisibilityInfo* visibility = NULL);
+
+  /* Destructor Function */
+  virtual ~EditorMapHover();
+
+  /* Control functions */
+  enum { Type_HoverRender = UserType + 4};
+  int type() const { return Type_HoverRender; }
+
+private:
+  /* The hover and visibility information - from editor map */
+  HoverInfo* hover_info;
+  VisibilityInfo* visibility_info;
+
+  /* The tile region covered by the overlay, in tiles */
+  QRect region;
+
+  /* The sub-map being hovered */
+  SubMapInfo* sub_map;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Returns the tile region of the hover footprint, clipped to the sub-map */
+  QRect getHoverRegion();
+
+  /* Returns the thing being previewed under the cursor, if any */
+  EditorMapThing* getHoverThing();
+
+  /* Returns if the tile at the render depth blocks the previewed thing */
+  bool isBlocked(EditorTile* tile, EditorMapThing* thing, int depth);
+
+  /* Returns if the active sprite is being previewed under the cursor */
+  bool isHoverSprite();
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the bounding rectangle of the hover region */
+  QRectF boundingRect() const;
+
+  /* Painting function for the hover preview */
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+             QWidget* widget = NULL);
+
+  /* Sets the sub-map being hovered */
+  void setSubMap(SubMapInfo* map);
+
+  /* Returns an empty shape, so the overlay never intercepts the tile hover */
+  QPainterPath shape() const;
+
+  /* Recalculates the covered region and repaints it */
+  void updateHover();
+};
+
+#endif // EDITORMAPHOVER_H
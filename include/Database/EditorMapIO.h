@@ -128,7 +128,7 @@ public:
   bool isBaseLock() const;
 
   /* Loads the io data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the io data */
   virtual void save(FileHandler* fh, bool game_only = false);
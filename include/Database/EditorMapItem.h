@@ -66,7 +66,7 @@ public:
   bool isWalkover();
 
   /* Loads the item data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the item data */
   virtual void save(FileHandler* fh, bool game_only = false);
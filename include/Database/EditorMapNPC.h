@@ -63,7 +63,7 @@ public:
   EditorNPCPath* getPath();
 
   /* Loads the npc data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the npc data */
   virtual void save(FileHandler* fh, bool game_only = false);
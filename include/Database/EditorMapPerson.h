@@ -105,7 +105,7 @@ public:
   bool isBaseSpeed() const;
 
   /* Loads the person data */
-  virtual void load(core::XmlData data, int index);
+  virtual void load(core::XmlData &data, int index);
 
   /* Saves the person data */
   virtual void save(core::XmlWriter* writer, bool game_only = false);
@@ -0,0 +1,61 @@
+/*******************************************************************************
+ * Class Name: EditorMapReach
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: The reachability overlay for the map editor. Tints the walkable
+ *              tiles of the active sub-map that can not be walked to and marks
+ *              the event tiles that lead nowhere or can never be used.
+ ******************************************************************************/
+#ifndef EDITORMAPREACH_H
+#define EDITORMAPREACH_H
+
+#include <QGraphicsItem>
+#include <QPainter>
+#include <QStyleOptionGraphicsItem>
+
+#include "Database/EditorReachability.h"
+#include "Database/EditorTile.h"
+#include "EditorHelpers.h"
+
+/* Editor Map Reach Class */
+class EditorMapReach : public QGraphicsItem
+{
+public:
+  /* Constructor Function */
+  EditorMapReach(EditorReachability* reach = NULL,
+                 VisibilityInfo* visibility = NULL);
+
+  /* Destructor Function */
+  virtual ~EditorMapReach();
+
+  /* Control functions */
+  enum { Type_ReachRender = UserType + 5};
+  int type() const { return Type_ReachRender; }
+
+private:
+  /* The reachability analysis and visibility info - from editor map */
+  EditorReachability* reach;
+  VisibilityInfo* visibility_info;
+
+  /* The tile size of the covered region */
+  QSize region;
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the bounding rectangle of the analyzed sub-map */
+  QRectF boundingRect() const;
+
+  /* Painting function for the reachability overlay */
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
+             QWidget* widget = NULL);
+
+  /* Returns an empty shape, so the overlay never intercepts the tile hover */
+  QPainterPath shape() const;
+
+  /* Recalculates the covered region and repaints it */
+  void updateReach();
+};
+
+#endif // EDITORMAPREACH_H
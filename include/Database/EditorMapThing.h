@@ -126,7 +126,7 @@ public:
   bool isVisible() const;
 
   /* Loads the thing data */
-  virtual void load(core::XmlData data, int index);
+  virtual void load(core::XmlData &data, int index);
 
   /* Paint a sprite in the thing */
   bool paint(QPainter* painter, QRect rect, int offset_x = 0, int offset_y = 0);
@@ -8,15 +8,50 @@
 #ifndef EDITORMATRIX_H
 #define EDITORMATRIX_H
 
+#include <QCache>
 #include <QFileDialog>
+#include <QFutureWatcher>
 #include <QGraphicsScene>
 #include <QGraphicsSceneMouseEvent>
+#include <QHash>
 #include <QVector>
+#include <QtConcurrent>
 
 #include "Database/EditorTileSprite.h"
 #include "EditorEnumDb.h"
 #include "Parser/FilePath.h"
 
+/* Struct for a single tile frame in a matrix snapshot */
+struct EditorSnapshotCell
+{
+  int x;
+  int y;
+  FrameRender frame;
+};
+
+/* Struct for all the data to render a matrix snapshot, apart from the scene */
+struct EditorSnapshotJob
+{
+  QColor background;
+  QVector<EditorSnapshotCell> cells;
+  int height;
+  int tile_size;
+  int tiles_h;
+  int tiles_w;
+  int width;
+};
+
+/* Struct for the cell layout of a sprite sheet, sliced into a matrix */
+struct EditorSheetLayout
+{
+  int cell_height;
+  int cell_width;
+  int frames;
+  bool frames_down;
+  int tiles_h;
+  int tiles_w;
+};
+
 class EditorMatrix : public QGraphicsScene
 {
   Q_OBJECT
@@ -53,6 +88,12 @@ private:
   /* Right clicked sprite */
   EditorTileSprite* rightclick_sprite;
 
+  /* Snapshot renders running in the background, by snapshot key */
+  QHash<QFutureWatcher<QImage>*, QString> snapshot_jobs;
+
+  /* Rendered snapshots, by snapshot key (content version, size and frame) */
+  static QCache<QString, QPixmap> snapshots;
+
   /* The rendering tile icons */
   TileIcons* tile_icons;
 
@@ -61,6 +102,9 @@ private:
   bool visible_passability;
   bool visible_render;
 
+  /*------------------- Constants -----------------------*/
+  const static int kSNAPSHOT_CACHE_KB; /* Max size of cached snapshots, KB */
+
 /*============================================================================
  * PRIVATE FUNCTIONS
  *===========================================================================*/
@@ -77,6 +121,18 @@ private:
   /* Decrements the render depth on the active tile */
   bool decrementDepthOnActive(bool min = false);
 
+  /* Returns the snapshot render data and its cache key */
+  EditorSnapshotJob getSnapshotJob(int width, int height, int frame,
+                                   QString* key);
+
+  /* Returns the snapshot cache key */
+  static QString getSnapshotKey(quint64 version, int width, int height,
+                                int frame);
+
+  /* Returns the region of a tile frame in a sprite sheet */
+  static QRect getSheetRect(QSize sheet, EditorSheetLayout layout, int frame,
+                            int x, int y);
+
   /* Gets the first valid sprite */
   EditorTileSprite* getValidSprite();
 
@@ -89,6 +145,9 @@ private:
   /* Removes the frames from the selected active sprite */
   void removeFramesOnActive();
 
+  /* Renders the snapshot from the tile data. Safe off the GUI thread */
+  static QImage renderSnapshot(EditorSnapshotJob job);
+
   /* Size manipulation on matrix */
   bool setNewOrigin(int x, int y);
   bool setNewSize(int width, int height);
@@ -118,6 +177,9 @@ signals:
   /* Triggers the right click on the matrix */
   void rightClick(EditorTileSprite* clicked);
 
+  /* A background snapshot render finished */
+  void snapshotReady();
+
 /*============================================================================
  * PUBLIC SLOT FUNCTIONS
  *===========================================================================*/
@@ -128,6 +190,13 @@ public slots:
   /* Matrix place sprite trigger */
   void matrixPlace(QString result_path, bool hflip, bool vflip);
 
+  /* Sheet place sprite trigger */
+  void sheetPlace(QString sheet_path, EditorSheetLayout layout, bool hflip,
+                  bool vflip);
+
+  /* Background snapshot render finished trigger */
+  void snapshotFinished();
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -140,6 +209,11 @@ public:
                bool hflip = false, bool vflip = false, bool reset = false,
                bool clear_modified = false);
 
+  /* Adds a sprite sheet, sliced by the layout, to the Editor Matrix */
+  bool addSheet(QString sheet_path, EditorSheetLayout layout, int x = 0,
+                int y = 0, bool hflip = false, bool vflip = false,
+                bool reset = false, bool clear_modified = false);
+
   /* Cleans the scene. Used for when adding or removing from view */
   void cleanScene(bool just_hover = false);
 
@@ -153,17 +227,30 @@ public:
   /* Returns the active frame index */
   int getActiveFrameIndex();
 
+  /* Returns the animation frame time of the matrix, in ms */
+  int getAnimationTime();
+
+  /* Returns the content version, derived from all rendered tile data */
+  quint64 getContentVersion();
+
+  /* Returns the snapshots of the first frames, rendered now if not cached */
+  QVector<QPixmap> getFrameSnapshots(int count, int width = -1,
+                                     int height = -1);
+
   /* Returns the height of the matrix */
   int getHeight() const;
 
+  /* Returns the frame image files of all sprites in the matrix */
+  QStringList getPaths();
+
   /* Returns the render depth at the x and y location in the matrix */
   int getRenderDepth(int x, int y);
 
   /* Returns the right clicked sprite */
   EditorTileSprite* getRightClicked();
 
-  /* Returns a snapshot of the scene */
-  QPixmap getSnapshot(int width = -1, int height = -1);
+  /* Returns a snapshot of the matrix, rendered now if not cached */
+  QPixmap getSnapshot(int width = -1, int height = -1, int frame = -1);
 
   /* Returns the editor sprite at the x and y location in the matrix */
   EditorTileSprite* getSprite(int x, int y);
@@ -185,7 +272,7 @@ public:
   void increaseWidth(int count = 1);
 
   /* Loads the matrix data */
-  void load(core::XmlData data, int index);
+  void load(core::XmlData &data, int index);
 
   /* Paint a single sprite in the matrix */
   bool paint(QPainter* painter, QRect rect, int offset_x = 0, int offset_y = 0,
@@ -200,6 +287,9 @@ public:
   /* Removes all sprites */
   void removeAll();
 
+  /* Returns the cached snapshot, or starts a background render of it */
+  QPixmap requestSnapshot(int width = -1, int height = -1, int frame = -1);
+
   /* Saves the matrix data */
   void save(core::XmlWriter* writer, bool game_only = false, bool no_render = false);
   void saveRender(core::XmlWriter* writer);
@@ -231,6 +321,13 @@ public:
 public:
   /* The copy operator */
   EditorMatrix& operator= (const EditorMatrix &source);
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the number of frames of the layout that fit in the sheet */
+  static int getSheetFrames(QSize sheet, EditorSheetLayout layout);
 };
 
 #endif // EDITORMATRIX_H
@@ -9,15 +9,26 @@
 
 #include <QColor>
 #include <QGraphicsObject>
+#include <QHash>
 #include <QList>
 #include <QPainter>
+#include <QPair>
 #include <QRectF>
+#include <QStyleOptionGraphicsItem>
+#include <QVector>
 
 #include "EditorEnumDb.h"
 #include "EditorHelpers.h"
 #include "FileHandler.h"
 #include "Game/Map/MapNPC.h"
 
+/* Struct for the cached geometry of a single rendered path node */
+struct PathNodeRender
+{
+  QRect rect;
+  QVector<QRect> borders;
+};
+
 /* Editor NPC Path Class */
 class EditorNPCPath : public QGraphicsObject
 {
@@ -40,6 +51,14 @@ public:
   enum HoverState {NO_HOVER, GENERAL, ON_NODE, ON_PATH};
 
 private:
+  /* Cached geometry - rebuilt on the next use after a node change */
+  mutable QRect cache_bound;
+  mutable QHash<QPair<int,int>, QPair<int,int>> cache_hover;
+  mutable QVector<QPair<QRect,bool>> cache_lines; /* true if border rect */
+  mutable QList<PathNodeRender> cache_nodes;
+  mutable QPainterPath cache_shape;
+  mutable bool cache_valid;
+
   /* Color of path */
   int color_a;
   int color_b;
@@ -98,21 +117,32 @@ private:
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorNPCPath &source);
 
+  /* Corner geometry function */
+  void buildCorner(int x, int y, Direction enter, Direction exit) const;
+
+  /* Geometry rebuild function, for all cached rects, shape and hover index */
+  void buildGeometry() const;
+
+  /* Hover index function, for the path tiles between two nodes */
+  void buildHoverIndex(const Path* prev, const Path* curr, int index) const;
+
+  /* Line geometry functions */
+  void buildLine(int x1, int y1, int x2, int y2) const;
+  void buildLines(const Path* curr, const Path* next) const;
+
+  /* Node geometry function */
+  PathNodeRender buildNode(const Path* prev, const Path* curr,
+                           const Path* next, int node_num = -2) const;
+
   /* Get hover color */
   QColor getHoverColor(bool hover_node = false);
 
-  /* Corner paint function */
-  void paintCorner(QPainter* painter, int x, int y,
-                   Direction enter, Direction exit, QColor color);
-
-  /* Line paint function */
-  void paintLine(QPainter* painter, int x1, int y1, int x2, int y2,
-                 QColor color);
-  void paintLines(QPainter* painter, Path* curr, Path* next, QColor color);
+  /* Invalidates the cached geometry, on a change to the path structure */
+  void invalidateGeometry();
 
   /* Node paint function */
-  void paintNode(QPainter* painter, Path* prev, Path* curr, Path* next,
-                 QColor color, int node_num = -2);
+  void paintNode(QPainter* painter, const PathNodeRender& node,
+                 const QRectF& exposed, QColor color, int node_num = -2);
 
   /* Unsets all indexes modifying the path structure */
   void unsetAllIndexes();
@@ -212,10 +242,10 @@ public:
   bool isVisibleEdit();
 
   /* Loads the path data */
-  bool load(XmlData data, int index);
+  bool load(XmlData &data, int index);
 
   /* Painting function for Path Wrapper - virtual */
-  void paint(QPainter* painter, const QStyleOptionGraphicsItem*,
+  void paint(QPainter* painter, const QStyleOptionGraphicsItem* option,
              QWidget*);
 
   /* Saves the path data */
@@ -8,10 +8,12 @@
 #define EDITORPARTY_H
 
 #include <QInputDialog>
+#include <QShowEvent>
 #include <QWidget>
 
 #include "Database/EditorPerson.h"
 #include "Database/EditorTemplate.h"
+#include "Database/EditorUsageIndex.h"
 #include "EditorHelpers.h"
 #include "Game/Player/Party.h"
 
@@ -50,6 +52,9 @@ private:
   /* Editor ID */
   int id;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Item Information */
   QMap<int,int> item_set;
   QMap<int,int> item_set_base;
@@ -96,6 +101,9 @@ protected:
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
   /* Sort Person Set */
   void sortPersons();
 
@@ -110,6 +118,12 @@ signals:
   /* Name changed within player widget signal */
   void nameChange(QString);
 
+  /* Saved items or persons changed signal, for the usage index */
+  void usageChange(int id);
+
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -151,8 +165,11 @@ public:
   /* Returns the name of the party for listing */
   virtual QString getNameList();
 
+  /* Returns the saved item and person references, for the usage index */
+  QList<EditorUsage> getUsages();
+
   /* Loads the object data */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
 
   /* Resets the working set trigger */
   void resetWorking();
@@ -0,0 +1,151 @@
+/*******************************************************************************
+ * Class Name: EditorPathGrid
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A packed passability grid of a sub-map, used to validate and
+ *              time npc paths. Each tile keeps the exit passability of all
+ *              static layers (base, lower, thing, IO and person) as a 4 bit
+ *              number. Tiles are only re-read once they are marked dirty, so
+ *              an edit only costs the tiles it touched.
+ ******************************************************************************/
+#ifndef EDITORPATHGRID_H
+#define EDITORPATHGRID_H
+
+#include <QList>
+#include <QPoint>
+#include <QRect>
+#include <QVector>
+
+#include "Database/EditorNPCPath.h"
+#include "Database/EditorTile.h"
+
+struct SubMapInfo;
+
+/* Struct for the check of a single walk between two path nodes */
+struct PathSegmentCheck
+{
+  /* Node indexes of the walk. -1 is the start node */
+  int from;
+  int to;
+
+  /* The first tile that could not be entered, if blocked */
+  bool blocked;
+  QPoint block_tile;
+
+  /* Tiles walked and the shortest walk around a block (-1 if none) */
+  int detour;
+  int steps;
+};
+
+/* Struct for the check of a full npc path */
+struct PathCheck
+{
+  /* The walks, in the order the npc takes them */
+  QList<PathSegmentCheck> segments;
+  int blocked_count;
+
+  /* Time for one full cycle of the path, in ms. -1 if not timed */
+  int cycle_ms;
+
+  /* Tiles read to make the check */
+  QRect bound;
+
+  /* The route the check was made on */
+  int ms_per_tile;
+  QList<Path> nodes;
+  Path start_node;
+  MapNPC::NodeState state;
+};
+
+/* Editor Path Grid Class */
+class EditorPathGrid
+{
+public:
+  /* Constructor Function */
+  EditorPathGrid();
+
+  /* Destructor Function */
+  ~EditorPathGrid();
+
+private:
+  /* Packed exit passability per tile, column major. Bit 4 is dirty */
+  QVector<uint8_t> cells;
+
+  /* Bound of the dirty tiles */
+  QRect dirty_rect;
+
+  /* Grid size, in tiles */
+  int height;
+  int width;
+
+  /* The sub-map being read */
+  SubMapInfo* map;
+
+  /* Rebuild the full grid on the next refresh */
+  bool rebuild;
+
+  /*------------------- Constants -----------------------*/
+  const static uint8_t kDIRTY; /* The dirty bit of a cell */
+  const static uint8_t kPASS_MASK; /* The passability bits of a cell */
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Checks the walk between two nodes of the check and adds it */
+  void addSegment(PathCheck &check, int from, int to, bool reverse = false);
+
+  /* Returns the direction bit of the cell, matching the passability num */
+  static uint8_t getDirectionBit(Direction dir);
+
+  /* Returns the tile list of the walk between two nodes */
+  QList<QPoint> getWalk(const Path &from, const Path &to);
+
+  /* Returns if the two nodes are at the same place with the same settings */
+  static bool isSameNode(const Path &a, const Path &b);
+
+  /* Reads the passability of a single tile from the sub-map */
+  uint8_t readTile(int x, int y);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns if the move out of the tile in the direction is possible */
+  bool canMove(int x, int y, Direction dir);
+
+  /* Checks the path and times the cycle */
+  PathCheck checkPath(EditorNPCPath* path, int ms_per_tile);
+
+  /* Checks the walk between two nodes */
+  PathSegmentCheck checkSegment(const Path &from, const Path &to,
+                                bool reverse, QRect* bound = NULL);
+
+  /* A* search between two tiles. Returns the number of steps or -1 */
+  int findPath(QPoint start, QPoint end, QRect* bound = NULL);
+
+  /* Returns the grid height, in tiles */
+  int getHeight();
+
+  /* Returns the sub-map being read */
+  SubMapInfo* getSubMap();
+
+  /* Returns the grid width, in tiles */
+  int getWidth();
+
+  /* Returns if the check was made on the same route */
+  static bool isSameRoute(const PathCheck &check, EditorNPCPath* path,
+                          int ms_per_tile);
+
+  /* Marks tiles to be re-read on the next refresh */
+  void markDirty();
+  void markDirty(int x, int y, int w = 1, int h = 1);
+
+  /* Re-reads the dirty tiles. Returns the bound of the tiles that changed */
+  QRect refresh();
+
+  /* Sets the sub-map to read. The grid is rebuilt on the next refresh */
+  void setSubMap(SubMapInfo* map);
+};
+
+#endif // EDITORPATHGRID_H
@@ -7,6 +7,7 @@
 #ifndef EDITORPERSON_H
 #define EDITORPERSON_H
 
+#include <QShowEvent>
 #include <QWidget>
 
 #include "Database/EditorCategory.h"
@@ -64,6 +65,9 @@ private:
   /* Editor ID */
   int id;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Item information */
   QVector<int> item_ids;
   QVector<int> item_ids_base;
@@ -133,6 +137,9 @@ protected:
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
   /* Update used working item list */
   void updateUsedItems();
 
@@ -143,6 +150,9 @@ signals:
   /* Name changed within person widget signal */
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -195,6 +205,9 @@ public:
   /* Returns the ID of the person */
   virtual int getID() const;
 
+  /* Returns the image files of the sprites saved for the game */
+  QStringList getImagePaths();
+
   /* Returns the name of the person */
   virtual QString getName() const;
 
@@ -202,7 +215,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
 
   /* Resets the working set trigger */
   void resetWorking();
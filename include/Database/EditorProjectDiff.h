@@ -0,0 +1,186 @@
+/*******************************************************************************
+ * Class Name: EditorProjectDiff
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Structural diff and three-way merge of saved projects (.usv).
+ *              Each version is read into its objects (core objects, map
+ *              bases, sub-maps and thing instances, by ID) and the tile
+ *              planes of its sub-maps. Tile planes are held in chunks that
+ *              are hashed on load, so only the chunks whose hashes differ
+ *              are compared tile by tile.
+ ******************************************************************************/
+#ifndef EDITORPROJECTDIFF_H
+#define EDITORPROJECTDIFF_H
+
+#include <QEventLoop>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QPoint>
+#include <QProgressDialog>
+#include <QSet>
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+#include <algorithm>
+
+#include "EditorHelpers.h"
+#include "FileHandler.h"
+
+/* Struct for a chunk of a tile plane. Each cell is the layer sprite ID + 1
+ * (0 for none), shifted over the 4 bit passability number */
+struct EditorDiffChunk
+{
+  QVector<quint32> cells;
+  quint64 hash;
+};
+
+/* Struct for an object of a project: its field values, in file order */
+struct EditorDiffObject
+{
+  QStringList order;
+  QHash<QString,QString> fields;
+};
+
+/* Struct for a project version, read for the diff */
+struct EditorDiffProject
+{
+  QString path;
+  bool valid;
+
+  /* The objects, by key, in file order */
+  QStringList order;
+  QHash<QString,EditorDiffObject> objects;
+
+  /* The tile plane chunks, by chunk index, by sub-map key */
+  QHash<QString,QHash<quint32,EditorDiffChunk>> planes;
+};
+
+/* Struct for a single difference or merge conflict */
+struct EditorDiffEntry
+{
+  /* The object (or sub-map, for tiles) key and the field (or tile) */
+  QString object;
+  QString field;
+
+  /* The values in each version. Base is empty for a two-way diff */
+  QString base;
+  QString ours;
+  QString theirs;
+};
+
+/* Editor Project Diff Class */
+class EditorProjectDiff
+{
+public:
+  /* Constructor Function */
+  EditorProjectDiff();
+
+  /* Destructor Function */
+  ~EditorProjectDiff();
+
+  /*------------------- Constants -----------------------*/
+  const static int kCHUNK_SIZE; /* Tile width and height of a plane chunk */
+  const static int kLAYERS; /* Number of tile layers in each cell */
+  const static int kMAX_ENTRIES; /* Max changes or conflicts kept to list */
+  const static QString kMISSING; /* Listed value of a missing object/field */
+  const static int kPROGRESS_DELAY; /* Delay before showing progress, in ms */
+
+private:
+  /* The listed changes (diff) or conflicts (merge) and the full count */
+  QList<EditorDiffEntry> entries;
+  int entry_count;
+
+  /* The merged project */
+  EditorDiffProject merged;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Adds a change or conflict, listing it if under the max */
+  void addEntry(QString object, QString field, QString base, QString ours,
+                QString theirs);
+
+  /* Compares the tile planes of the two projects */
+  void diffPlanes(const EditorDiffProject &ours,
+                  const EditorDiffProject &theirs);
+
+  /* Reads the project versions on the thread pool */
+  bool loadAll(QStringList paths, QList<EditorDiffProject>* projects,
+               QWidget* parent);
+
+  /* Merges an object changed in both projects, field by field */
+  EditorDiffObject mergeFields(QString key, const EditorDiffObject &base,
+                               const EditorDiffObject &ours,
+                               const EditorDiffObject &theirs);
+
+  /* Merges the tile planes of the three projects */
+  void mergePlanes(const EditorDiffProject &base,
+                   const EditorDiffProject &ours,
+                   const EditorDiffProject &theirs);
+
+/*============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Adds a line of the save file into the object or tile plane it is of */
+  static void addLine(EditorDiffProject* project, XmlData &data);
+
+  /* Returns the cell value listed in an entry */
+  static QString getCellString(quint32 cell);
+
+  /* Returns the chunk, or the empty chunk if the plane does not have it */
+  static const EditorDiffChunk &getChunk(
+                              const QHash<quint32,EditorDiffChunk> &plane,
+                              quint32 index);
+
+  /* Returns the layer element of the cell layer */
+  static QString getLayerSegment(int layer);
+
+  /* Returns the 64-bit hash of the chunk cells */
+  static quint64 hashChunk(const QVector<quint32> &cells);
+
+  /* Reads the project file */
+  static EditorDiffProject loadProject(const QString &path);
+
+  /* Merges the order of the keys of two versions, keeping only the kept */
+  static QStringList mergeOrder(const QStringList &ours,
+                                const QStringList &theirs,
+                                const QSet<QString> &kept);
+
+  /* Writes a line, opening and closing elements from the open set */
+  static void writeLine(FileHandler* fh, QStringList* open,
+                        QStringList segments, QString value);
+
+  /* Writes the tile plane into the open sub-map element */
+  static void writePlane(FileHandler* fh, QStringList* open, QString key,
+                         const QHash<quint32,EditorDiffChunk> &plane);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Compares our project to theirs */
+  bool diff(QString ours_path, QString theirs_path,
+            QWidget* parent = nullptr);
+
+  /* Returns the listed changes or conflicts, and the number of them */
+  QList<EditorDiffEntry> getEntries() const;
+  int getEntryCount() const;
+
+  /* Merges our and their changes since the common base project */
+  bool merge(QString base_path, QString ours_path, QString theirs_path,
+             QWidget* parent = nullptr);
+
+  /* Saves the merged project */
+  bool saveMerge(QString path) const;
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the entry as a line of text, for listing */
+  static QString getEntryString(const EditorDiffEntry &entry);
+};
+
+#endif // EDITORPROJECTDIFF_H
@@ -0,0 +1,100 @@
+/*******************************************************************************
+ * Class Name: EditorReachability
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Bit packed reachability analysis of a sub-map. The moves that
+ *              are possible out of every tile are packed into one bit plane
+ *              per direction, 64 tiles to a word, and the flood from the start
+ *              tiles is spread a full row of words at a time. Walkable tiles
+ *              that the flood never gets to are unreachable.
+ ******************************************************************************/
+#ifndef EDITORREACHABILITY_H
+#define EDITORREACHABILITY_H
+
+#include <QList>
+#include <QPoint>
+#include <QVector>
+
+#include "Database/EditorPathGrid.h"
+
+/* Editor Reachability Class */
+class EditorReachability
+{
+public:
+  /* Constructor Function */
+  EditorReachability();
+
+  /* Destructor Function */
+  ~EditorReachability();
+
+private:
+  /* Event tiles that lead nowhere or can never be used */
+  QList<QPoint> dead_ends;
+
+  /* Move bit planes, row major. Bit set if the move out of the tile is open */
+  QVector<quint64> move_east;
+  QVector<quint64> move_north;
+  QVector<quint64> move_south;
+  QVector<quint64> move_west;
+
+  /* Tiles reached by the last flood */
+  QVector<quint64> reached;
+
+  /* Tiles that can be entered or left in any direction */
+  QVector<quint64> walkable;
+
+  /* Plane size. Words is the number of words per row */
+  int height;
+  int width;
+  int words;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Spreads the reached tiles of the row east and west, across words */
+  bool fillRow(int y);
+
+  /* Returns if the bit of the tile is set in the plane */
+  bool isSet(const QVector<quint64> &plane, int x, int y) const;
+
+  /* Spreads the vertical moves into the row from the row next to it */
+  bool spreadRow(int y, int from_y, const QVector<quint64> &moves);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Builds the move planes from the passability grid. Refresh it first */
+  void build(EditorPathGrid* grid);
+
+  /* Returns if any move out of the tile is open */
+  bool canLeave(int x, int y) const;
+
+  /* Clears the planes and the flood */
+  void clear();
+
+  /* Floods from the start tiles, marking every tile that can be walked to */
+  void flood(QList<QPoint> starts);
+
+  /* Returns the event tiles that lead nowhere or can never be used */
+  QList<QPoint> getDeadEnds() const;
+
+  /* Returns the plane size, in tiles */
+  int getHeight() const;
+  int getWidth() const;
+
+  /* Returns the number of walkable tiles the flood did not reach */
+  int getUnreachableCount() const;
+
+  /* Returns if the tile was reached by the last flood */
+  bool isReached(int x, int y) const;
+
+  /* Returns if the tile is walkable but was not reached */
+  bool isUnreachable(int x, int y) const;
+
+  /* Sets the event tiles that lead nowhere or can never be used */
+  void setDeadEnds(QList<QPoint> tiles);
+};
+
+#endif // EDITORREACHABILITY_H
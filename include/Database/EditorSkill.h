@@ -18,6 +18,7 @@
 #include <QGroupBox>
 #include <QCheckBox>
 #include <QFormLayout>
+#include <QShowEvent>
 
 #include "Database/EditorAction.h"
 #include "Database/EditorTemplate.h"
@@ -48,6 +49,8 @@ private:
 
   /* Editor ID */
   int id;
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
   /* Editor name */
   QString name;
   /* Testing string (May be removed) */
@@ -104,12 +107,27 @@ protected:
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorSkill &source);
 
+  /* Creates interface layout */
+  void createLayout();
+
+  /* Returns the scope drop down index. -1 if not listed */
+  int getScopeIndex(ActionScope scope);
+
+  /* Reads the UI objects into the working skill */
+  void readWorkingInfo();
+
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
 /*============================================================================
  * SIGNALS
  *===========================================================================*/
 signals:
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -159,6 +177,9 @@ public:
   /* Returns the ID of the skill */
   virtual int getID() const;
 
+  /* Returns the image files of the sprites saved for the game */
+  QStringList getImagePaths();
+
   /* Returns the name of the skill */
   virtual QString getName() const;
 
@@ -166,7 +187,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the object data */
   virtual void save(FileHandler* fh, bool game_only = false);
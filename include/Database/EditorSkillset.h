@@ -14,6 +14,7 @@
 #include <QLabel>
 #include <QGridLayout>
 #include <QPushButton>
+#include <QShowEvent>
 
 #include "Database/EditorSkill.h"
 #include "Database/EditorTemplate.h"
@@ -43,6 +44,9 @@ private:
   QString name_base;
   QString name_curr;
 
+  /* Widget layout status - only created on the first show */
+  bool layout_created;
+
   /* Buttons */
   QPushButton* btn_add;
   QPushButton* btn_remove;
@@ -69,9 +73,15 @@ protected:
   /* Get skill pointer, based on ID */
   EditorSkill* getByID(int id);
 
+  /* Creates interface layout */
+  void createLayout();
+
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Creates the widget layout on the first show */
+  void showEvent(QShowEvent* event);
+
   /* Get Skill string */
   QString skillString(EditorSkill* skill, int lvl = -1);
 
@@ -81,6 +91,9 @@ protected:
 signals:
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -117,7 +130,7 @@ public:
   virtual QString getNameList();
 
   /* Loads the object data */
-  virtual void load(XmlData data, int index);
+  virtual void load(XmlData &data, int index);
 
   /* Saves the object data */
   virtual void save(FileHandler* fh, bool game_only = false);
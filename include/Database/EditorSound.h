@@ -63,6 +63,9 @@ public:
   /* Returns the sound reference file name: trimmed */
   QString getFileName() const;
 
+  /* Returns the sound reference file name: full path */
+  QString getFileNameFull() const;
+
   /* Returns the ID of the sound */
   virtual int getID() const;
 
@@ -80,7 +83,7 @@ public:
   bool isNameLocked();
 
   /* Loads the object data */
-  bool load(XmlData data, int index);
+  bool load(XmlData &data, int index);
 
   /* Saves the object data */
   void save(FileHandler* fh, bool game_only = false, QString type = "sound");
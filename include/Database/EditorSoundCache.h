@@ -0,0 +1,177 @@
+/*******************************************************************************
+ * Class Name: EditorSoundCache
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: Analysis of the sound and music files, decoded once each in the
+ *              background. Keeps the length, loudness and a downsampled
+ *              waveform of every file (stored on disk between sessions) and
+ *              the decoded samples of short files, so they play instantly.
+ ******************************************************************************/
+#ifndef EDITORSOUNDCACHE_H
+#define EDITORSOUNDCACHE_H
+
+#include <QAudioBuffer>
+#include <QAudioDecoder>
+#include <QAudioFormat>
+#include <QCache>
+#include <QDataStream>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QFileInfo>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStandardPaths>
+#include <QStringList>
+#include <QVector>
+#include <QtEndian>
+#include <QtMath>
+#include <cstring>
+
+/* Struct for the analysis of a single sound file */
+struct EditorSoundInfo
+{
+  /* Length, in milliseconds. -1 if the file could not be decoded */
+  qint64 duration;
+
+  /* File stamp, to check the analysis is still current */
+  QDateTime modified;
+  qint64 size;
+
+  /* Loudness, from 0 to 1 */
+  float peak;
+  float rms;
+
+  /* Downsampled peak envelope, from 0 to 255 */
+  QVector<quint8> waveform;
+};
+
+/* Struct for the decoded samples of a short sound file */
+struct EditorSoundPcm
+{
+  QByteArray data;
+  QAudioFormat format;
+};
+
+/* Editor Sound Cache Class */
+class EditorSoundCache : public QObject
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  EditorSoundCache(QObject* parent = nullptr);
+
+  /* Destructor Function */
+  ~EditorSoundCache();
+
+  /*------------------- Constants -----------------------*/
+  const static int kCACHE_VERSION; /* Version of the disk cache format */
+  const static int kPCM_CACHE_BYTES; /* Max bytes of decoded samples kept */
+  const static int kPCM_MAX_LENGTH; /* Max length of kept samples, in ms */
+  const static int kWAVE_BLOCK; /* Length of each wave block, in ms */
+  const static int kWAVE_POINTS; /* Number of points in the waveform */
+
+private:
+  /* The background decoder */
+  QAudioDecoder decoder;
+
+  /* The file being decoded and its running totals */
+  QVector<float> decode_blocks;
+  QString decode_file;
+  qint64 decode_frames;
+  EditorSoundInfo decode_info;
+  QByteArray decode_pcm;
+  QAudioFormat decode_pcm_format;
+  bool decode_pcm_keep;
+  int decode_rate;
+  qint64 decode_samples;
+  double decode_square_sum;
+
+  /* The peak of the wave block being decoded */
+  qint64 block_frames;
+  float block_peak;
+
+  /* Analysis of each file, by full path */
+  QHash<QString, EditorSoundInfo> infos;
+  bool infos_changed;
+
+  /* Decoded samples of the short files, by full path */
+  QCache<QString, EditorSoundPcm> pcms;
+  QSet<QString> pcms_failed;
+
+  /* Files waiting to be decoded */
+  QStringList queue;
+
+  /* The shared cache */
+  static EditorSoundCache* shared_cache;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Starts decoding the next file in the queue */
+  void decodeNext();
+
+  /* Completes the file being decoded */
+  void finishDecode(bool success);
+
+  /* Returns the path of the disk cache */
+  static QString getCachePath();
+
+  /* Returns if the info matches the file on disk */
+  static bool isCurrent(const QString &file, const EditorSoundInfo &info);
+
+  /* Loads the disk cache */
+  void loadCache();
+
+  /* Reads a single sample, from -1 to 1 */
+  static float readSample(const char* data, const QAudioFormat &format);
+
+  /* Saves the disk cache */
+  void saveCache();
+
+/*============================================================================
+ * SIGNALS
+ *===========================================================================*/
+signals:
+  /* The analysis of the file is ready */
+  void infoReady(QString file);
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+public slots:
+  /* Decoder triggers */
+  void decoderBufferReady();
+  void decoderError(QAudioDecoder::Error error);
+  void decoderFinished();
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Queues the file to be decoded, if not already */
+  void analyze(QString file);
+
+  /* Returns the analysis of the file. Queues it if missing or stale */
+  bool getInfo(QString file, EditorSoundInfo* info = nullptr);
+
+  /* Returns the decoded samples of the short file. Null if not kept */
+  const EditorSoundPcm* getPcm(QString file);
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the length and loudness as a display string */
+  static QString getInfoString(const EditorSoundInfo &info);
+
+  /* Returns the length as a "m:ss.s" string */
+  static QString getLengthString(qint64 duration);
+
+  /* Returns the shared cache */
+  static EditorSoundCache* getShared();
+};
+
+#endif // EDITORSOUNDCACHE_H
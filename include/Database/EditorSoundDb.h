@@ -81,6 +81,9 @@ protected:
   EditorSound* getMusic(int id, bool create = true);
   EditorSound* getSound(int id, bool create = true);
 
+  /* Loads a list item with the name and length of the chunk */
+  void loadItem(QListWidgetItem* item, EditorSound* chunk);
+
   /* Loads list with applicable information */
   void loadList(QListWidget* list, QVector<EditorSound*>* chunks,
                 EditorSound* current = nullptr);
@@ -100,6 +103,9 @@ signals:
   void changedMusicList();
   void changedSoundList();
 
+  /* Working sound data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -123,6 +129,9 @@ public slots:
   void listSoundReserveChanged(int index);
   void listSoundReserveDouble(QListWidgetItem*);
 
+  /* Sound analysis of a file is ready */
+  void soundInfoReady(QString file);
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -137,8 +146,11 @@ public:
   /* Returns total save count resource */
   int getSaveCount();
 
+  /* Returns the ID of the selected music or sound. -1 if none */
+  int getSelectedID(bool* is_music = nullptr);
+
   /* Loads the object data */
-  void load(XmlData data, int index);
+  void load(XmlData &data, int index);
 
   /* Resets the working set trigger */
   void resetWorking();
@@ -7,9 +7,13 @@
 #ifndef EDITORSPRITE_H
 #define EDITORSPRITE_H
 
+#include <QHash>
 #include <QObject>
 #include <QPainter>
+#include <QSet>
 
+#include "Database/EditorAtlas.h"
+#include "Database/EditorImageStore.h"
 #include "Database/EditorTemplate.h"
 #include "EditorEnumDb.h"
 #include "EditorHelpers.h"
@@ -22,6 +26,7 @@ struct FrameInfo
 {
   QString path;
   QImage image;
+  bool pending; /* Image decode deferred to the image store */
 
   bool hflip;
   bool vflip;
@@ -30,6 +35,22 @@ struct FrameInfo
   bool rotate270;
 };
 
+/* Struct for a frame and its sprite mods, to render apart from the sprite */
+struct FrameRender
+{
+  QImage image;
+
+  bool hflip;
+  bool vflip;
+  qreal angle;
+
+  int brightness;
+  int color_b;
+  int color_g;
+  int color_r;
+  qreal opacity; /* 0 to 1 */
+};
+
 class EditorSprite : public QObject, public EditorTemplate
 {
   Q_OBJECT
@@ -59,6 +80,9 @@ private:
   /* Frame information */
   QVector<FrameInfo> frame_info;
 
+  /* All constructed sprites, for project wide path queries */
+  static QSet<EditorSprite*> live_sprites;
+
   /*------------------- Constants -----------------------*/
   const static float kREF_RGB; /* The max reference RGB value */
 
@@ -72,6 +96,9 @@ protected:
   /* Get frame mods */
   QString getFrameMods(int index);
 
+  /* Attaches the image of a frame deferred at load */
+  void resolveFrame(int index);
+
   /* Returns a transformed image */
   QPixmap transformPixmap(int index, int w, int h, bool shadow = false,
                           QColor shadow_color = QColor(0, 0, 0));
@@ -183,9 +210,15 @@ public:
   /* Returns the active frame index */
   int getActiveFrameIndex();
 
+  /* Returns the frame index the animation shows at the clock time */
+  int getAnimationFrame(qint64 time);
+
   /* Sets the frame angle of a given frame */
   int getFrameAngle(int frame_num);
 
+  /* Gets the frame image and sprite mods, for rendering */
+  FrameRender getFrameRender(int frame_num);
+
   /* Gets the frames horizontal flip of a given frame */
   bool getHorizontalFlip(int frame_num);
 
@@ -207,8 +240,11 @@ public:
   /* Gets the sprite path */
   QString getPath(int frame_num);
 
-  /* Gets the simplified path set */
-  QList<QPair<QString,QString>> getPathSet();
+  /* Gets the simplified path set. Game only writes sheet regions to files */
+  QList<QPair<QString,QString>> getPathSet(bool game_only = false);
+
+  /* Gets the frame image files, with sheet regions as their sheet file */
+  QStringList getPaths() const;
 
   /* Returns the modified pixmap */
   QPixmap getPixmap(int index, int w, int h);
@@ -228,8 +264,11 @@ public:
   /* Returns true if all frames in the sprite are not valid paths (null imgs) */
   bool isAllNull();
 
+  /* Returns true if the sprite animates (multiple frames and a frame time) */
+  bool isAnimated();
+
   /* Loads the sprite data */
-  void load(core::XmlData data, int index);
+  void load(core::XmlData &data, int index);
 
   /* Paint the base sprite */
   bool paint(QPainter* painter, QRect rect, bool shadow = false,
@@ -241,6 +280,9 @@ public:
   bool paint(int index, QPainter* painter, int x, int y, int w, int h,
              bool shadow = false, QColor shadow_color = QColor(0, 0, 0, 204));
 
+  /* Replaces the frame paths that are in the remap */
+  int remapPaths(const QHash<QString,QString> &remap);
+
   /* Saves the sprite data */
   void save(core::XmlWriter* writer, bool game_only = false, bool core_only = false,
             QString element = "");
@@ -260,6 +302,24 @@ public:
   /* Sets the reference sound ID */
   void setSoundID(int id);
 
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns the frame image files used by all constructed sprites */
+  static QStringList getLivePaths();
+
+  /* Replaces the frame paths in the remap, in all constructed sprites */
+  static int remapLivePaths(const QHash<QString,QString> &remap);
+
+  /* Renders the frame with its sprite mods. Safe off the GUI thread */
+  static QImage renderFrame(const FrameRender &frame, int w, int h,
+                            bool shadow = false,
+                            QColor shadow_color = QColor(0, 0, 0));
+
+  /* Attaches the deferred frame images, in all constructed sprites */
+  static void resolveLiveFrames();
+
 /*============================================================================
  * OPERATOR FUNCTIONS
  *===========================================================================*/
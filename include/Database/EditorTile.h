@@ -48,12 +48,26 @@ struct HoverInfo
   QRect selected_thing;
 };
 
+/* Struct for map level visibility, shared by all tiles and read on paint */
+struct VisibilityInfo
+{
+  bool layers[EditorEnumDb::NO_LAYER];
+
+  bool events;
+  bool grid;
+  bool passability;
+  bool reachability;
+
+  /* Animated preview, painted at the animation clock time (in ms) */
+  bool animate;
+  qint64 animate_time;
+};
+
 /* Struct for frame option storage */
 struct TileRenderInfo
 {
   EditorSprite* sprite;
   EditorMapThing* thing;
-  bool visible;
 };
 
 /* Editor Tile Class */
@@ -74,11 +88,6 @@ public:
   int type() const { return Type_TileRender; }
 
 private:
-  /* Is the item hovered */
-  HoverInfo* hover_info;
-  bool hovered;
-  bool hovered_invalid;
-
   /* Editor Sprite layers */
   TileRenderInfo layer_base;
   TileRenderInfo layer_enhancer;
@@ -102,10 +111,8 @@ private:
   /* The rendering tile icons */
   TileIcons* tile_icons;
 
-  /* Visibility painting control */
-  bool visible_events;
-  bool visible_grid;
-  bool visible_passability;
+  /* Visibility painting control - from editor map */
+  VisibilityInfo* visibility_info;
 
   /* Positions and depths for the tiles on the map grid */
   int x_pos, y_pos;
@@ -116,6 +123,21 @@ public:
   const static uint8_t kMAX_ITEMS; /* The max number of items stored */
   const static uint8_t kUPPER_COUNT_MAX; /* The max number of upper layers */
 
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Returns the sprites painted on the tile, for the animated preview */
+  QList<EditorSprite*> getRenderSprites();
+
+  /* Returns the frame of the thing to paint on the tile */
+  int getThingFrame(EditorMapThing* thing, int offset_x, int offset_y,
+                    qint64 time);
+
+  /* Returns the sprite of the thing at the offset in its matrix */
+  EditorSprite* getThingSprite(EditorMapThing* thing, int offset_x,
+                               int offset_y);
+
 /*============================================================================
  * PROTECTED FUNCTIONS
  *===========================================================================*/
@@ -123,15 +145,6 @@ protected:
   /* Copy function, to be called by a copy or equal operator constructor */
   void copySelf(const EditorTile &source);
 
-  /* Determine if hovering sprite or thing in tile */
-  bool isHoverIO();
-  bool isHoverItem();
-  bool isHoverMove();
-  bool isHoverNPC();
-  bool isHoverPerson();
-  bool isHoverSprite();
-  bool isHoverThing();
-
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -152,9 +165,6 @@ public:
   /* Gets the tile for editing */
   Tile* getGameTile();
 
-  /* Gets the hover information */
-  HoverInfo* getHoverInfo();
-
   /* Returns the map io pointer at the given render depth and all ios */
   EditorMapIO* getIO(int render_level);
   QVector<EditorMapIO*> getIOs();
@@ -206,21 +216,25 @@ public:
 
   /* Returns layer visibility */
   bool getVisibility(EditorEnumDb::Layer layer);
-  bool getVisibilityIO(int render_level);
-  bool getVisibilityItems();
-  bool getVisibilityNPC(int render_level);
-  bool getVisibilityPerson(int render_level);
-  bool getVisibilityThing(int render_level);
 
   /* Returns grid/pass/events visibility */
   bool getVisibilityEvents();
   bool getVisibilityGrid();
   bool getVisibilityPass();
 
+  /* Returns the visibility information */
+  VisibilityInfo* getVisibilityInfo();
+
   /* Returns X and Y, in tile set */
   int getX();
   int getY();
 
+  /* Returns true if any sprite painted on the tile animates */
+  bool isAnimated();
+
+  /* Returns true if the painted frames differ between the two clock times */
+  bool isAnimationChanged(qint64 from_time, qint64 to_time);
+
   /* Is tile events set */
   bool isEventEnterSet() const;
   bool isEventExitSet() const;
@@ -230,7 +244,6 @@ public:
              QWidget* widget = NULL);
 
   /* Function to place a current sprite on the maps active layer */
-  bool place();
   bool place(EditorEnumDb::Layer layer, EditorSprite* sprite,
              bool load = false);
 
@@ -238,14 +251,6 @@ public:
   void setEventEnter(EditorEventSet set);
   void setEventExit(EditorEventSet set);
 
-  /* Sets the hover state */
-  void setHover(bool hover, bool hover_invalid = false);
-
-  /* Sets the hover information - from editor map */
-  void setHoverInfo(HoverInfo* new_info);
-  void setHoverInfo(bool hover, bool hover_invalid = false,
-                    HoverInfo* new_info = NULL);
-
   /* Sets the io sprite pointer, stored within the class */
   bool setIO(EditorMapIO* io);
 
@@ -267,27 +272,8 @@ public:
   /* Sets the rendering tile icons */
   void setTileIcons(TileIcons* icons);
 
-  /* Sets the various layer visibilities */
-  void setVisibility(EditorEnumDb::Layer layer, bool visible);
-  void setVisibilityBase(bool);
-  void setVisibilityEnhancer(bool);
-  void setVisibilityIO(bool visible);
-  bool setVisibilityIO(int render_level, bool visible);
-  void setVisibilityItems(bool visible);
-  bool setVisibilityLower(int, bool);
-  void setVisibilityNPC(bool visible);
-  bool setVisibilityNPC(int render_level, bool visible);
-  void setVisibilityPerson(bool visible);
-  bool setVisibilityPerson(int render_level, bool visible);
-  void setVisibilityThing(bool visible);
-  bool setVisibilityThing(int render_level, bool visible);
-  bool setVisibilityUpper(int, bool);
-
-  /* Sets the grid/pass/events visibility */
-  void setVisibilityEvents(bool);
-  void setVisibilityGrid(bool);
-  void setVisibilityPass(bool);
-  void setVisibilityTile(EditorTile* ref);
+  /* Sets the visibility information - from editor map */
+  void setVisibilityInfo(VisibilityInfo* new_info);
 
   /* Function for removing a sprite from the maps active layer */
   void unplace(EditorEnumDb::Layer layer);
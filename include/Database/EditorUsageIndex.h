@@ -0,0 +1,75 @@
+/*******************************************************************************
+ * Class Name: EditorUsageIndex
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Reverse reference index of the game objects (items, maps,
+ *              sounds, etc) to the referrers that use them (maps and parties).
+ *              Each referrer is replaced on its own when it changes, so the
+ *              index never needs to search the other referrers to stay current.
+ ******************************************************************************/
+#ifndef EDITORUSAGEINDEX_H
+#define EDITORUSAGEINDEX_H
+
+#include <QHash>
+#include <QList>
+#include <QMap>
+#include <QPair>
+#include <QStringList>
+
+#include "EditorEnumDb.h"
+
+/* Struct for a single reference to a game object */
+struct EditorUsage
+{
+  EditorEnumDb::UsageType type;
+  int id;
+  QString where;
+};
+
+/* Editor Usage Index Class */
+class EditorUsageIndex
+{
+public:
+  /* Constructor Function */
+  EditorUsageIndex();
+
+  /* Destructor Function */
+  ~EditorUsageIndex();
+
+private:
+  /* The display name of each referrer, by view and ID */
+  QHash<QPair<int,int>, QString> names;
+
+  /* The references of each referrer, by view and ID */
+  QHash<QPair<int,int>, QList<EditorUsage>> references;
+
+  /* The places each object is used, by type and ID then referrer */
+  QHash<QPair<int,int>, QMap<QPair<int,int>, QStringList>> users;
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Clears all referrers */
+  void clear();
+
+  /* Returns the IDs of the referrers in the view that use the object */
+  QList<int> getReferrers(EditorEnumDb::UsageType type, int id,
+                          EditorEnumDb::ViewMode view) const;
+
+  /* Returns the places the object is used, as "referrer - where" strings */
+  QStringList getUsage(EditorEnumDb::UsageType type, int id,
+                       int map_id = -1) const;
+
+  /* Returns if the object is used anywhere */
+  bool isUsed(EditorEnumDb::UsageType type, int id) const;
+
+  /* Removes the referrer and all of its references */
+  void removeReferrer(EditorEnumDb::ViewMode view, int id);
+
+  /* Replaces the references of the referrer */
+  void setReferrer(EditorEnumDb::ViewMode view, int id, QString name,
+                   QList<EditorUsage> usages);
+};
+
+#endif // EDITORUSAGEINDEX_H
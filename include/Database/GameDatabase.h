@@ -7,12 +7,15 @@
 #ifndef GAMEDATABASE_H
 #define GAMEDATABASE_H
 
+#include <QCryptographicHash>
 #include <QInputDialog>
 #include <QLabel>
 #include <QListWidget>
 #include <QMessageBox>
 #include <QProgressDialog>
 #include <QPushButton>
+#include <QSet>
+#include <QTimer>
 #include <QVBoxLayout>
 #include <QVector>
 #include <QWidget>
@@ -22,13 +25,18 @@
 //#include "Database/EditorBubby.h"
 #include "Database/EditorCategory.h"
 //#include "Database/EditorEquipment.h"
+#include "Database/EditorImageScan.h"
+#include "Database/EditorImageStore.h"
 #include "Database/EditorItem.h"
+#include "Database/EditorJournal.h"
+#include "Database/EditorListModel.h"
 #include "Database/EditorMap.h"
 #include "Database/EditorParty.h"
 #include "Database/EditorPerson.h"
 #include "Database/EditorSkillset.h"
 #include "Database/EditorSkill.h"
 #include "Database/EditorSoundDb.h"
+#include "Database/EditorUsageIndex.h"
 #include "EditorEnumDb.h"
 #include "FileHandler.h"
 
@@ -48,6 +56,7 @@ private:
   QPushButton* button_duplicate;
   QPushButton* button_import;
   QPushButton* button_new;
+  QPushButton* button_usage;
 
   /* Currently selected object */
   EditorAction* current_action;
@@ -78,22 +87,35 @@ private:
   QVector<EditorSkillset*> data_skillset;
   EditorSoundDb* data_sounds;
 
+  /* Checksum of the last core checkpoint and its delay, for the journal */
+  QByteArray journal_core;
+  QTimer journal_timer;
+
   /* Layout */
   QVBoxLayout* layout;
 
   /* The map modifying dialog */
   QDialog* mapsize_dialog;
 
+  /* Maps with base items to sync to the game items on the next open */
+  QSet<int> maps_item_sync;
+
   /* Right click menu on bottom list */
   QMenu* rightclick_menu;
 
   /* The tile icons */
   TileIcons tile_icons;
 
+  /* Reverse reference index of game objects to the maps and parties */
+  EditorUsageIndex usage_index;
+
   /* List Widgets */
   QListWidget* view_bottom;
   QListWidget* view_top;
 
+  /*------------------- Constants -----------------------*/
+  const static int kJOURNAL_DELAY; /* Wait after a change to checkpoint, ms */
+
 /*============================================================================
  * PRIVATE FUNCTIONS
  *===========================================================================*/
@@ -135,19 +157,22 @@ private:
   bool isObjectProtected();
 
   /* Called to load object data */
-  void loadAction(XmlData data, int index);
-  void loadBattleScene(XmlData data, int index);
-  void loadClass(XmlData data, int index);
-  void loadItem(XmlData data, int index);
-  void loadParty(XmlData data, int index);
-  void loadPerson(XmlData data, int index);
-  void loadRace(XmlData data, int index);
-  void loadSkill(XmlData data, int index);
-  void loadSkillSet(XmlData data, int index);
+  void loadAction(XmlData &data, int index);
+  void loadBattleScene(XmlData &data, int index);
+  void loadClass(XmlData &data, int index);
+  void loadItem(XmlData &data, int index);
+  void loadParty(XmlData &data, int index);
+  void loadPerson(XmlData &data, int index);
+  void loadRace(XmlData &data, int index);
+  void loadSkill(XmlData &data, int index);
+  void loadSkillSet(XmlData &data, int index);
 
   /* Called upon load finish - for clean up */
   void loadFinish();
 
+  /* Writes the core objects, within the game data */
+  void saveCore(FileHandler* fh, QProgressDialog* dialog, bool game_only);
+
   /* Update calls for objects (to fill in information required from others) */
   void updateClasses();
   void updateItems();
@@ -156,6 +181,10 @@ private:
   void updateSkills();
   void updateSkillSets();
 
+  /* Replaces the references of the map or party in the usage index */
+  void updateUsage(EditorMap* map);
+  void updateUsage(EditorParty* party);
+
 /*============================================================================
  * PROTECTED FUNCTIONS
  *===========================================================================*/
@@ -203,6 +232,9 @@ public slots:
   /* Duplicates a selected resource -> duplicate */
   void duplicateResource();
 
+  /* Finds duplicate images and remaps references to them -> file menu */
+  void findDuplicateImages();
+
   /* Imports a resource */
   void importResource();
 
@@ -210,6 +242,12 @@ public slots:
   void itemDataChange(int id = -1);
   void itemDataChange(ItemData);
 
+  /* Schedules a core checkpoint in the edit journal -> object changes */
+  void journalChange();
+
+  /* Checkpoints the core objects in the edit journal -> journal timer */
+  void journalCore();
+
   /* Right click list menu on bottom list */
   void listMenuRequested(const QPoint & pos);
 
@@ -220,6 +258,9 @@ public slots:
   /* Triggers on double click of the bottom list -> updates view */
   void modifySelection(QListWidgetItem* item);
 
+  /* Party saved with changed items or persons -> updates usage index */
+  void partyUsageChange(int id);
+
   /* Renames the selected map */
   void renameMap();
 
@@ -229,6 +270,9 @@ public slots:
   /* Triggered by save all button */
   void saveAll();
 
+  /* Shows where the selected object is used -> where used button */
+  void showUsage();
+
   /* Updates the bottom list -> when a name changes */
   void updateBottomListName(QString str);
 
@@ -260,21 +304,35 @@ public:
   /* Get current map */
   EditorMap* getCurrentMap();
 
+  /* Returns the image files a game export writes, for the atlas */
+  QStringList getExportPaths();
+
+  /* Returns every image path used by the project */
+  QStringList getImagePaths();
+
   /* Returns the sound database, for connection */
   EditorSoundDb* getSoundDatabase();
 
-  /* Load the game */
-  void load(FileHandler* fh, QProgressDialog* dialog);
+  /* Load the game. Skipping core only loads the maps */
+  void load(FileHandler* fh, QProgressDialog* dialog, bool skip_core = false);
 
   /* Modifies the bottom list with the passed in index */
   void modifyBottomList(int index);
 
+  /* Replays the map records of the edit journal */
+  int replayJournal(QList<EditorJournalRecord> records);
+
   /* Save the game */
   void save(FileHandler* fh, QProgressDialog* dialog, bool game_only = false,
             bool selected_map = false, int sub_index = -1);
 
   /* The widget preferred size */
   QSize sizeHint() const;
+
+  /* Starts and stops recording edits in the edit journal */
+  bool startJournal(QString base_path, QList<EditorJournalRecord> records =
+                                               QList<EditorJournalRecord>());
+  void stopJournal();
 };
 
 #endif // GAMEDATABASE_H
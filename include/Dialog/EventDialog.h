@@ -159,12 +159,10 @@ public:
 
   /* Sets the list of objects, used for event creation */
   void setListItems(QList<QString> items);
-  void setListMaps(QList<QString> maps);
   void setListMapThings(QList<QString> things,
                         QList<QPair<QString,QString>> ios,
                         QList<QString> items, QList<QString> persons,
                         QList<QString> npcs);
-  void setListSounds(QList<QString> sounds);
   void setListSubmaps(QList<QString> sub_maps);
 
   /* Sets the event set */
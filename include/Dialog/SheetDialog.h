@@ -0,0 +1,120 @@
+/*******************************************************************************
+ * Class Name: SheetDialog
+ * Date Created: October 19, 2026
+ * Inheritance: QDialog
+ * Description: The sprite sheet dialog, which handles slicing a single sprite
+ *              sheet into the frames of a matrix, by cell size and frame
+ *              layout. The slices reference the one decoded sheet. Used for
+ *              matrix placing of files outside the Univursa naming convention.
+ ******************************************************************************/
+#ifndef SHEETDIALOG_H
+#define SHEETDIALOG_H
+
+#include <QComboBox>
+#include <QDialog>
+#include <QGridLayout>
+#include <QLabel>
+#include <QPushButton>
+#include <QSpinBox>
+
+#include "Database/EditorMatrix.h"
+
+class SheetDialog : public QDialog
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  SheetDialog(QString path = "", QWidget* parent = NULL);
+
+  /* Destructor Function */
+  ~SheetDialog();
+
+private:
+  /* Buttons for frame control */
+  QPushButton* button_flip_h;
+  QPushButton* button_flip_v;
+  QPushButton* button_prev;
+  QPushButton* button_next;
+
+  /* Combo box with the frame order in the sheet */
+  QComboBox* cbox_order;
+
+  /* The frame number */
+  int frame_num;
+
+  /* The initial filename and path that instatiated the dialog */
+  QString initial_filename;
+  QString initial_path;
+
+  /* Labels used for display */
+  QLabel* lbl_frame_num;
+  QLabel* lbl_result;
+  QLabel* lbl_scene;
+
+  /* The view matrix */
+  EditorMatrix matrix;
+
+  /* The size of the sheet image */
+  QSize sheet_size;
+
+  /* Spinners with the cell size, tiles per frame and number of frames */
+  QSpinBox* spin_cell_h;
+  QSpinBox* spin_cell_w;
+  QSpinBox* spin_frames;
+  QSpinBox* spin_tiles_h;
+  QSpinBox* spin_tiles_w;
+
+  /*------------------- Constants -----------------------*/
+  const static int kSCENE_SIZE; /* Render size of the scene */
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Creates the dialog */
+  void createDialog();
+
+  /* Updates the frame count limit and the frame buttons */
+  void updateFrames();
+
+  /* Updates the scene view */
+  void updateScene();
+
+/*============================================================================
+ * SIGNALS
+ *===========================================================================*/
+signals:
+  /* Finished processing signal */
+  void sheetPlace(QString sheet_path, EditorSheetLayout layout, bool hflip,
+                  bool vflip);
+
+/*============================================================================
+ * PUBLIC SLOT FUNCTIONS
+ *===========================================================================*/
+public slots:
+  /* Button triggers */
+  void buttonCancel();
+  void buttonFlip();
+  void buttonNextFrame();
+  void buttonOk();
+  void buttonPreviousFrame();
+
+  /* One of the layout edit objects changed */
+  void editObjectChanged(int);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Is the matrix being flipped horizontally or vertically? */
+  bool isFlipHorizontal();
+  bool isFlipVertical();
+
+  /* Returns the cell layout of the sheet */
+  EditorSheetLayout getLayout();
+
+  /* Returns the path of the sheet */
+  QString getSheetPath();
+};
+
+#endif // SHEETDIALOG_H
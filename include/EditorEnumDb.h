@@ -24,11 +24,20 @@ public:
 
   /* Enum for cursor mode */
   enum CursorMode {BASIC,ERASER,MOVE,BLOCKPLACE,FILL,PASS_ALL,
-                   PASS_N,PASS_E,PASS_S,PASS_W,NO_CURSOR};
+                   PASS_N,PASS_E,PASS_S,PASS_W,REGION_COPY,REGION_STAMP,
+                   NO_CURSOR};
 
   /* Enum for type of FrameView */
   enum FrameViewType {FRAME,HEAD,TAIL,MIDPOINT,VIEWONLY};
 
+  /* Edit journal record types - the values are written to the journal */
+  enum JournalRecord {JOURNAL_CORE = 0,
+                      JOURNAL_THING_ADD = 1,
+                      JOURNAL_THING_MOVE = 2,
+                      JOURNAL_THING_REMOVE = 3,
+                      JOURNAL_TILES = 4
+                     };
+
   /* Enum for the tile layers */
   enum Layer {BASE = 0,
               ENHANCER = 1,
@@ -50,6 +59,9 @@ public:
               NO_LAYER = 17
              };
 
+  /* Shared list model categories */
+  enum ListType {ITEM_LIST, MAP_LIST, SOUND_LIST};
+
   /* Map edit mode */
   enum MapEditMode {NORMAL_EDIT = 0,
                     PATH_EDIT = 1,
@@ -80,6 +92,10 @@ public:
                     THING_RENDER_PLUS, THING_RENDER_MINUS,
                     THING_PASS_ALL};
 
+  /* Referenced object types - where used index */
+  enum UsageType {USE_BATTLESCENE, USE_ITEM, USE_MAP, USE_MUSIC, USE_PERSON,
+                  USE_SOUND, USE_THING};
+
   /* Enum For View Mode - game database */
   enum ViewMode {MAPVIEW = 0,
                  BLANKVIEW1 = 1,
@@ -97,5 +113,25 @@ public:
                  AUDIOVIEW = 13,
                  BATTLESCENEVIEW = 14
                 };
+
+  /* Interned element tags of the save file - load dispatch */
+  enum XmlTag {XML_NONE, XML_ACTION, XML_ACTIVE, XML_ACTIVETIME, XML_ANIMATION,
+               XML_APP, XML_BASE, XML_BATTLESCENE, XML_BRIGHTNESS, XML_CLASS,
+               XML_COLOR_B, XML_COLOR_G, XML_COLOR_R, XML_CORE, XML_CORE_ID,
+               XML_DELAY, XML_DESCRIPTION, XML_ENHANCER, XML_ENTER,
+               XML_ENTERSET, XML_EVENT, XML_EVENTSET, XML_EXIT, XML_EXITSET,
+               XML_FORCEDINTERACTION, XML_FORWARD, XML_GAME, XML_GAME_ID,
+               XML_HEIGHT, XML_IMAGE, XML_ITEM, XML_LOCK, XML_LOCKEVENT,
+               XML_LOWER, XML_MAIN, XML_MAP, XML_MAPIO, XML_MAPITEM,
+               XML_MAPNPC, XML_MAPPERSON, XML_MAPTHING, XML_MUSIC, XML_NAME,
+               XML_NODE, XML_NODESTATE, XML_OPACITY, XML_OVERLAY, XML_PARTY,
+               XML_PASSABILITY, XML_PATH, XML_PERSON, XML_RACE,
+               XML_RENDERMATRIX, XML_ROTATION, XML_SECTION, XML_SKILL,
+               XML_SKILLSET, XML_SOUND, XML_SOUND_ID, XML_SPRITE,
+               XML_SPRITE_ID, XML_SPRITES, XML_STARTNODE, XML_STARTPOINT,
+               XML_TILEEVENT, XML_TRACKMAX, XML_TRACKMIN, XML_TRACKRUN,
+               XML_TRACKING, XML_UNDERLAY, XML_UNLOCKEVENT, XML_UNLOCKPARSE,
+               XML_UPPER, XML_VISIBLE, XML_WEATHER, XML_WIDTH, XML_X,
+               XML_XYFLIP, XML_Y};
 };
 #endif // EDITORENUMDB_H
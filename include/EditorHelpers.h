@@ -10,11 +10,15 @@
 
 #include <QComboBox>
 #include <QDir>
+#include <QHash>
 #include <QListView>
+#include <QMap>
+#include <QPainter>
 #include <QPixmap>
 #include <QPointF>
 #include <QRectF>
 #include <QString>
+#include <string>
 
 #include "EditorEnumDb.h"
 
@@ -30,6 +34,9 @@ struct TileIcons
   QPixmap* nopassE;
   QPixmap* nopassS;
   QPixmap* nopassW;
+
+  /* Precomposed sheets of all 16 passability states, keyed by pixel size */
+  QMap<int, QPixmap> pass_sheets;
 };
 
 class EditorHelpers
@@ -82,6 +89,9 @@ public:
   /* Returns the project directory, based on the location of the editor */
   static QString getProjectDir();
 
+  /* Returns the full path of a path trimmed to the project directory */
+  static QString getProjectPath(QString path);
+
   /* Returns the sprite directory, based on the location of the editor */
   static QString getSpriteDir();
 
@@ -91,6 +101,9 @@ public:
   /* Returns the valid file split */
   static QList<QString> getValidFileSplit(QString file, bool* base = NULL);
 
+  /* Returns the interned tag of the save file element. XML_NONE if unknown */
+  static EditorEnumDb::XmlTag getXmlTag(const std::string &element);
+
   /* Returns the index of the passed in integer compared to a list of strings
    * with the string namelist format ('000: blah blah') */
   static int indexOf(int id, QList<QString> list);
@@ -103,6 +116,10 @@ public:
   static QList<QPair<QString,QString>> optimizePoints(
                                              QList<QList<QPoint>> orig_set);
 
+  /* Paints the passability state from the precomposed icon sheet */
+  static void paintPassability(QPainter* painter, TileIcons* icons,
+                               const QRect &bound, int passability_num);
+
   /* Rectilinear split */
   static QList<QPair<QString, QString>> rectilinearSplit(
                                                        QList<QPoint> point_set);
@@ -120,6 +120,9 @@ signals:
   /* Name changed within scene widget signal */
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
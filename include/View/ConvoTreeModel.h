@@ -0,0 +1,135 @@
+/*******************************************************************************
+ * Class Name: ConvoTreeModel
+ * Date Created: October 19, 2026
+ * Inheritance: QAbstractItemModel
+ * Description: The item model of the conversation tree in the event view. The
+ *              tree mirrors the conversation, with straight runs kept at one
+ *              level and options nested below the entry that offers them.
+ *              Children are only read from the conversation once their parent
+ *              is expanded and edits are merged into the loaded nodes, so only
+ *              the rows that changed are inserted, removed or repainted.
+ ******************************************************************************/
+#ifndef CONVOTREEMODEL_H
+#define CONVOTREEMODEL_H
+
+#include <QAbstractItemModel>
+#include <QList>
+#include <QStringList>
+
+#include "Database/EditorEvent.h"
+
+/* Struct for a single loaded node of the tree */
+struct ConvoNode
+{
+  /* The conversation entry - refreshed on every merge */
+  Conversation* convo;
+  bool option;
+
+  /* The display text of the entry */
+  QString text;
+
+  /* Tree position. Children are only valid once fetched */
+  QList<ConvoNode*> children;
+  bool fetched;
+  bool has_children;
+  ConvoNode* parent;
+  int row;
+};
+
+/* Struct for a conversation entry at a tree position, prior to merging */
+struct ConvoEntry
+{
+  Conversation* convo;
+  bool option;
+};
+
+/* Convo Tree Model Class */
+class ConvoTreeModel : public QAbstractItemModel
+{
+  Q_OBJECT
+public:
+  /* Constructor Function */
+  ConvoTreeModel(QObject* parent = nullptr);
+
+  /* Destructor Function */
+  ~ConvoTreeModel();
+
+private:
+  /* The hidden root node - its children are the top level */
+  ConvoNode* root;
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+private:
+  /* Creates a node for the entry. Its children are read on expand */
+  ConvoNode* createNode(const ConvoEntry &entry, ConvoNode* parent, int row);
+
+  /* Deletes the node and all loaded children */
+  void deleteNode(ConvoNode* node);
+
+  /* Returns the entries shown below the node */
+  static QList<ConvoEntry> getChildEntries(Conversation* convo, bool option);
+
+  /* Returns the node of the model index. The root if invalid */
+  ConvoNode* getNode(const QModelIndex &index) const;
+
+  /* Returns the display text of the entry */
+  static QString getText(const ConvoEntry &entry);
+
+  /* Returns the entries of the straight run starting at the entry */
+  static QList<ConvoEntry> getRun(Conversation* convo);
+
+  /* Merges the new entries into the loaded children of the node */
+  void mergeNode(ConvoNode* node, const QModelIndex &index,
+                 QList<ConvoEntry> entries);
+
+  /* Updates the node to the new entry */
+  void setNodeEntry(ConvoNode* node, const ConvoEntry &entry);
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+public:
+  /* Returns if more children can be read for the parent */
+  bool canFetchMore(const QModelIndex &parent) const;
+
+  /* Returns the number of columns. Always one */
+  int columnCount(const QModelIndex &parent = QModelIndex()) const;
+
+  /* Returns the display data of the index */
+  QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+
+  /* Reads the children of the parent */
+  void fetchMore(const QModelIndex &parent);
+
+  /* Returns the number of children of the index, fetched or not */
+  int getChildTotal(const QModelIndex &index) const;
+
+  /* Returns the conversation entry of the index */
+  Conversation* getConvo(const QModelIndex &index) const;
+
+  /* Returns the model index of the path, fetching as needed */
+  QModelIndex getIndex(const EditorConvoPath &path);
+
+  /* Returns the conversation path of the model index */
+  EditorConvoPath getPath(const QModelIndex &index) const;
+
+  /* Returns if the parent has children, fetched or not */
+  bool hasChildren(const QModelIndex &parent = QModelIndex()) const;
+
+  /* Returns the model index of the row below the parent */
+  QModelIndex index(int row, int column,
+                    const QModelIndex &parent = QModelIndex()) const;
+
+  /* Returns the parent of the model index */
+  QModelIndex parent(const QModelIndex &index) const;
+
+  /* Returns the number of fetched children of the parent */
+  int rowCount(const QModelIndex &parent = QModelIndex()) const;
+
+  /* Sets the conversation, merging it into the loaded tree */
+  void setConversation(Conversation* convo);
+};
+
+#endif // CONVOTREEMODEL_H
@@ -28,12 +28,14 @@ class ConvoDialog;
 #include <QSpinBox>
 #include <QStackedWidget>
 #include <QTextEdit>
-#include <QTreeWidget>
+#include <QTreeView>
 #include <QVBoxLayout>
 
 #include "Database/EditorEvent.h"
+#include "Database/EditorListModel.h"
 #include "EditorEnumDb.h"
 #include "EditorHelpers.h"
+#include "View/ConvoTreeModel.h"
 
 class EventView : public QFrame
 {
@@ -72,8 +74,9 @@ private:
   /* Sound selection widget */
   QComboBox* combo_sound;
 
-  /* The conversation event - convo tree */
-  QTreeWidget* convo_tree;
+  /* The conversation event - convo tree and its model */
+  ConvoTreeModel* convo_model;
+  QTreeView* convo_tree;
 
   /* Game database */
   //GameDatabase* database;
@@ -91,17 +94,19 @@ private:
   EventClassifier limiter;
 
   /* The list of objects used in possible events */
-  QList<QString> list_items;
-  QList<QString> list_maps;
   QList<QPair<QString,QString>> list_map_ios;
   QList<QString> list_map_items;
   QList<QString> list_map_npcs;
   QList<QString> list_map_persons;
   QList<QString> list_map_things;
-  QList<QString> list_sounds;
   QList<QString> list_submaps;
   //QList<QString> list_things_no_io;
 
+  /* The shared models of game objects used in possible events */
+  EditorListModel* model_items;
+  EditorListModel* model_maps;
+  EditorListModel* model_sounds;
+
   /* Switch maps event - map name view box */
   QComboBox* map_name;
 
@@ -156,7 +161,7 @@ private:
   QCheckBox* prop_visible_val;
 
   /* Right click menu on conversation dialog */
-  QString rightclick_index;
+  EditorConvoPath rightclick_path;
   QMenu* rightclick_menu;
 
   /* Take item event control widgets */
@@ -222,11 +227,11 @@ private:
   /* Edit event trigger to spawn the event pop-up */
   void editEvent(Event* edit_event = nullptr);
 
-  /* Returns the convesation item, based on the index, of the tree widget */
-  QTreeWidgetItem* getConvo(QString base_index);
+  /* Returns the convesation model index, based on the path */
+  QModelIndex getConvo(const EditorConvoPath &path);
 
-  /* Returns the conversation index of the tree widget */
-  QString getConvoIndex(QTreeWidgetItem* ref, QTreeWidgetItem* parent = NULL);
+  /* Returns the conversation path of the model index */
+  EditorConvoPath getConvoPath(const QModelIndex &ref);
 
   /* Tile select main call */
   void selectTileMain();
@@ -234,10 +239,6 @@ private:
   /* Set layout data */
   void setLayoutData();
 
-  /* Update conversation data */
-  void updateConvoTree(Conversation* ref, QTreeWidgetItem* parent,
-                       bool option = false);
-
   /* Update data lists */
   void updateListProperty(const QString& type_text);
   void updateListProperty(const ThingBase& type);
@@ -285,7 +286,7 @@ public slots:
   void changedSound(const QString & text);
 
   /* Conversation item double clicked trigger */
-  void convoDoubleClick(QTreeWidgetItem*, int);
+  void convoDoubleClick(QModelIndex);
 
   /* The convo menu requested - on right click */
   void convoMenuRequested(QPoint point);
@@ -344,8 +345,8 @@ public slots:
   void propertyVisibleMod(int state);
   void propertyVisibleVal(int state);
 
-  /* Resize the QTreeWidget for the items */
-  void resizeTree(QTreeWidgetItem*);
+  /* Resize the convo tree for the items */
+  void resizeTree(QModelIndex);
 
   /* The right click slots, for conversation */
   void rightClickDelete();
@@ -426,8 +427,6 @@ public:
   void setEvent(EditorEvent* event);
 
   /* Sets the list of objects, used for event creation */
-  void setListItems(QList<QString> items);
-  void setListMaps(QList<QString> maps);
   void setListMapIOs(QList<QPair<QString,QString>> ios);
   void setListMapItems(QList<QString> items);
   void setListMapNPCs(QList<QString> npcs);
@@ -437,7 +436,6 @@ public:
                         QList<QPair<QString,QString>> ios,
                         QList<QString> items, QList<QString> persons,
                         QList<QString> npcs);
-  void setListSounds(QList<QString> sounds);
   void setListSubmaps(QList<QString> sub_maps);
 
   /* Updates the event */
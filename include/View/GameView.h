@@ -69,6 +69,9 @@ signals:
   /* Emits upon name change to game object */
   void nameChange(QString);
 
+  /* Emits upon a game object saved back to its base */
+  void dataSaved();
+
   /* Updated data to pass into map database */
   void updatedBattleScenes(QList<QPair<int,QString>> scenes);
   void updatedItems(QList<QString> items);
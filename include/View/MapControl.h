@@ -30,6 +30,9 @@ public:
   ~MapControl();
 
 private:
+  /* Animated preview button */
+  QPushButton* animate_toggle;
+
   /* Bottom delete button */
   QPushButton* button_delete;
   QPushButton* button_duplicate;
@@ -56,6 +59,9 @@ private:
   /* Top passability visible button */
   QPushButton* passability_toggle;
 
+  /* Reachability overlay visible button */
+  QPushButton* reach_toggle;
+
   /* Right click menu on bottom list */
   QAction* rename_map;
   QMenu* rightclick_menu;
@@ -130,6 +136,9 @@ public slots:
   /* Select the sub-map, by double click */
   void selectSubMap(QListWidgetItem* item);
 
+  /* Toggles the animated preview */
+  void toggleAnimate(bool visible);
+
   /* Toggles the event notifier visibility */
   void toggleEvents(bool visible);
 
@@ -139,6 +148,9 @@ public slots:
   /* Toggles the passability */
   void togglePassability(bool visible);
 
+  /* Toggles the reachability overlay */
+  void toggleReach(bool visible);
+
   /* Update map row on bottom list */
   void updateBottomRow(int current_row);
 
@@ -153,6 +165,9 @@ public:
   SubMapInfo* getCurrentMap();
   int getCurrentMapIndex();
 
+  /* Returns animated preview toggle status */
+  bool getAnimateToggle();
+
   /* Returns event notifier toggle status */
   bool getEventsToggle();
 
@@ -165,6 +180,9 @@ public:
   /* Returns passability status */
   bool getPassabilityToggle();
 
+  /* Returns reachability overlay status */
+  bool getReachToggle();
+
   /* Returns the selected layer in the top list */
   EditorEnumDb::Layer getSelectedLayer();
 
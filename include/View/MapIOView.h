@@ -129,6 +129,9 @@ public slots:
   /* Refreshes the editor IO list in the view */
   void updateList();
 
+  /* Updates the snapshot of the selected IO */
+  void updateSnapshot();
+
   /* Updates the IO sidebar */
   void updateIOs();
 
@@ -127,6 +127,9 @@ public slots:
   /* Refreshes the editor item list in the view */
   void updateList();
 
+  /* Updates the snapshot of the selected item */
+  void updateSnapshot();
+
   /* Updates the item sidebar */
   void updateItems();
 
@@ -41,6 +41,9 @@ private:
   QLabel* lbl_name;
   QLabel* lbl_size;
 
+  /* Label for the path check of the selected npc instance */
+  QLabel* lbl_path;
+
   /* The person dialog for editing the npcs */
   PersonDialog* npc_dialog;
 
@@ -68,6 +71,9 @@ private:
   /* Opens the npc editing dialog */
   void editNPC(EditorMapNPC* sub_npc = NULL);
 
+  /* Returns the readable text of a npc path check */
+  QString getPathCheckText(PathCheck check);
+
   /* Refreshes the info in the lower half of the widget */
   void updateInfo();
 
@@ -132,9 +138,15 @@ public slots:
   /* Refreshes the editor npc list in the view */
   void updateList();
 
+  /* Updates the snapshot of the selected npc */
+  void updateSnapshot();
+
   /* Updates the npc sidebar */
   void updateNPCs();
 
+  /* Re-checks the instance paths and marks the blocked ones */
+  void updatePathChecks();
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
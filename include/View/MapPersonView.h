@@ -129,6 +129,9 @@ public slots:
   /* Refreshes the editor person list in the view */
   void updateList();
 
+  /* Updates the snapshot of the selected person */
+  void updateSnapshot();
+
   /* Updates the person sidebar */
   void updatePersons();
 
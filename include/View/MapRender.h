@@ -19,7 +19,9 @@
 #include <QScrollBar>
 #include <QWidget>
 
+#include "Database/EditorAnimationClock.h"
 #include "Database/EditorMap.h"
+#include "Database/EditorMapClipboard.h"
 #include "EnumDb.h"
 
 class MapRender : public QGraphicsScene
@@ -37,10 +39,21 @@ private:
   /* Active Hover tile */
   //EditorTile* active_tile;
 
+  /* Animated preview - holds the shared clock while set */
+  bool animating;
+  qint64 animate_time;
+
   /* Block data */
   QPointF block_origin;
   bool block_erase;
 
+  /* The region clipboard and the tile the current stamp drag started on */
+  EditorMapClipboard* clipboard;
+  QPoint stamp_origin;
+
+  /* If the current click or drag changed the tile sprites */
+  bool sprites_edited;
+
   /* Cursor type */
   //EditorEnumDb::CursorMode cursor_mode;
 
@@ -63,6 +76,9 @@ private:
  * PRIVATE FUNCTIONS
  *===========================================================================*/
 private:
+  /* Returns if a trigger with the active cursor and layer changes sprites */
+  bool isSpriteEdit();
+
   /* Menu adding for tile click */
   bool menuIOs(EditorTile* t, QMenu* menu);
   bool menuItems(EditorTile* t, QMenu* menu);
@@ -78,9 +94,15 @@ private:
   void pathClickLeft(int x, int y);
   void pathClickRight(int x, int y);
 
+  /* Stamps the clipboard at the tile, if on the stamp grid of the drag */
+  void stampClipboard(int x, int y, bool single);
+
   /* Right click menu initialize */
   void tileClickInit();
 
+  /* Holds or releases the animation clock to match the map visibility */
+  void updateAnimation();
+
 /*============================================================================
  * PROTECTED FUNCTIONS
  *===========================================================================*/
@@ -123,6 +145,9 @@ signals:
  * PUBLIC SLOT FUNCTIONS
  *===========================================================================*/
 public slots:
+  /* Animation clock tick - repaints the tiles with a changed frame */
+  void animationTick(qint64 time);
+
   /* NPC Path Add/Remove control */
   void npcPathAdd(EditorNPCPath* path);
   void npcPathRemove(EditorNPCPath* path);
@@ -130,6 +155,12 @@ public slots:
   /* Path edit trigger */
   void pathEditTrigger(EditorNPCPath* path);
 
+  /* Floods the reachability from the hover tile */
+  void reachStart();
+
+  /* Resets the animated tile index of the rendering sub-map */
+  void resetAnimatedTiles();
+
   /* Select a tile trigger */
   void selectTile();
 
@@ -214,8 +245,14 @@ public:
   int getMapHeight();
   int getMapWidth();
 
+  /* Sets the region clipboard used by the copy and stamp cursors */
+  void setClipboard(EditorMapClipboard* clipboard);
+
   /* Sets the map being edited */
   void setMapEditor(EditorMap* editor);
+
+  /* Updates the position and visibility of the clipboard preview */
+  void updateClipboardPreview();
 };
 
 #endif // MAPRENDER_H
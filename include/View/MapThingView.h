@@ -129,6 +129,9 @@ public slots:
   /* Refreshes the editor thing list in the view */
   void updateList();
 
+  /* Updates the snapshot of the selected thing */
+  void updateSnapshot();
+
   /* Updates the thing sidebar */
   void updateThings();
 
@@ -29,6 +29,7 @@
 #include <QSizePolicy>
 
 #include "Database/EditorMap.h"
+#include "Database/EditorMapClipboard.h"
 #include "Dialog/EventDialog.h"
 #include "EditorEnumDb.h"
 #include "View/MapRender.h"
@@ -68,6 +69,9 @@ private:
   bool event_external;
   EditorTile* event_tile;
 
+  /* Region clipboard - shared across all maps */
+  EditorMapClipboard* map_clipboard;
+
   /* Map Control pointer - right portion */
   MapControl* map_control;
 
@@ -10,6 +10,8 @@
 
 #include <QFileDialog>
 #include <QFrame>
+#include <QGraphicsPixmapItem>
+#include <QGraphicsScene>
 #include <QGraphicsView>
 #include <QGridLayout>
 #include <QInputDialog>
@@ -19,6 +21,7 @@
 
 #include "Database/EditorMatrix.h"
 #include "Dialog/MatrixDialog.h"
+#include "Dialog/SheetDialog.h"
 #include "Dialog/SpriteDialog.h"
 
 class MatrixView : public QFrame
@@ -86,12 +89,24 @@ private:
   bool playing;
   QTimer* playing_timer;
 
+  /* Playback - one composite per frame, shown in its own scene */
+  QVector<QPixmap> playing_frames;
+  int playing_index;
+  QGraphicsPixmapItem* playing_item;
+  QGraphicsScene* playing_scene;
+
   /* Right click menu on matrix */
   QMenu* rightclick_menu;
 
+  /* The sprite sheet initiation dialog */
+  SheetDialog* sheet_dialog;
+
   /* The sprite dialog for editing */
   SpriteDialog* sprite_dialog;
 
+  /*------------------- Constants -----------------------*/
+  const static int kPLAY_INTERVAL; /* Frame time if the matrix has none, ms */
+
 /*============================================================================
  * PRIVATE FUNCTIONS
  *===========================================================================*/
@@ -8,6 +8,9 @@
 #ifndef SOUNDVIEW_H
 #define SOUNDVIEW_H
 
+#include <QAudioDeviceInfo>
+#include <QAudioOutput>
+#include <QBuffer>
 #include <QFileDialog>
 #include <QGridLayout>
 #include <QInputDialog>
@@ -15,6 +18,8 @@
 #include <QLineEdit>
 #include <QMediaPlayer>
 #include <QMessageBox>
+#include <QPainter>
+#include <QPixmap>
 #include <QPushButton>
 #include <QSlider>
 #include <QSpinBox>
@@ -22,6 +27,7 @@
 #include <QWidget>
 
 #include "Database/EditorSound.h"
+#include "Database/EditorSoundCache.h"
 
 class SoundView : public QWidget
 {
@@ -54,7 +60,13 @@ private:
   /* Label Widgets - just for displaying text */
   QLabel* lbl_file_name;
   QLabel* lbl_id_num;
+  QLabel* lbl_info;
   QLabel* lbl_vol_value;
+  QLabel* lbl_wave;
+
+  /* Decoded sample output, for short cached sounds */
+  QBuffer pcm_buffer;
+  QAudioOutput* pcm_output;
 
   /* Player Widget */
   QMediaPlayer player;
@@ -79,6 +91,8 @@ private:
 
   /*------------------- Constants -----------------------*/
   const static int kFADE_INTERVAL; /* The fade interval, in milliseconds */
+  const static int kWAVE_HEIGHT; /* The waveform strip height, in pixels */
+  const static int kWAVE_WIDTH; /* The waveform strip width, in pixels */
 
 /*============================================================================
  * PROTECTED FUNCTIONS
@@ -96,9 +110,21 @@ protected:
   /* Loads working info into UI objects */
   void loadWorkingInfo();
 
+  /* Starts playing audio, from the cached samples if available */
+  void play();
+
+  /* Handles the end of a play, repeating if relevant */
+  void playEnded();
+
+  /* Sets the play volume, as a percent */
+  void setPlayerVolume(int volume);
+
   /* Stops playing audio, if relevant */
   void stop();
 
+  /* Updates the sound info and waveform strip from the cache */
+  void updateWaveform();
+
 /*============================================================================
  * SIGNALS
  *===========================================================================*/
@@ -106,6 +132,9 @@ signals:
   /* Name changed within sound widget signal */
   void nameChange(QString);
 
+  /* Working data saved back to the base signal */
+  void dataSaved();
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -123,11 +152,17 @@ public slots:
   /* Name Text Changed */
   void changedName(QString);
 
+  /* Sample output triggers */
+  void outputStateChanged(QAudio::State state);
+
   /* Player triggers */
   void playerFadeIn();
   void playerRepeat();
   void playerStateChanged(QMediaPlayer::State state);
 
+  /* Sound analysis of a file is ready */
+  void soundInfoReady(QString file);
+
   /* Volume Value Changed */
   void volumeChanged(int volume);
 
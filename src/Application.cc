@@ -70,6 +70,7 @@ Application::Application(QWidget* parent)
   /* Connections between game view and game database */
   connect(game_view,SIGNAL(nameChange(QString)),game_database,
           SLOT(updateBottomListName(QString)));
+  connect(game_view, SIGNAL(dataSaved()), game_database, SLOT(journalChange()));
 
   connect(game_view, SIGNAL(updateBattleSceneObjects()),
           game_database, SLOT(updateBattleSceneObjects()));
@@ -116,6 +117,9 @@ Application::Application(QWidget* parent)
 
   setStyleSheet("QMainWindow::separator { background: rgb(153, 153, 153); \
                                           width: 1px; height: 1px; }");
+
+  /* Recover the last session, if it did not close cleanly */
+  recover();
 }
 
 /*
@@ -163,7 +167,23 @@ QProgressDialog* Application::createProgressDialog(int total_count,
 /* Export application to run in Univursa */
 void Application::exportGame(QString filename)
 {
-  /* Start file write */
+  /* Pack the images the export writes into the atlas, beside the export
+   * name. Lays and backgrounds scroll and tile, so they keep their own files */
+  EditorAtlas atlas(EditorHelpers::getProjectDir() + "/atlas/" +
+                    QFileInfo(filename).completeBaseName());
+  if(action_atlas->isChecked())
+  {
+    if(!atlas.build(game_database->getExportPaths(), this))
+    {
+      QMessageBox::warning(this, "Export to Game",
+                           "The image atlas was not built. Export stopped");
+      return;
+    }
+    atlas.beginExport();
+  }
+
+  /* Start file write, with no regions left over from a previous export */
+  EditorImageStore::getShared()->takeFailedRegions();
   FileHandler fh(filename.toStdString(), true, true);
   fh.start();
 
@@ -180,7 +200,17 @@ void Application::exportGame(QString filename)
 
   /* Finish the file write */
   fh.stop();
+  atlas.endExport();
   delete progress_dialog;
+
+  /* Sheet regions the game cannot open, since they were not written out */
+  QStringList failed = EditorImageStore::getShared()->takeFailedRegions();
+  if(!failed.isEmpty())
+    QMessageBox::warning(this, "Export to Game",
+                         QString::number(failed.size()) +
+                         " sheet region(s) could not be written out as image "
+                         "files and will not load in the game:\n" +
+                         failed.mid(0, 10).join("\n"));
 }
 
 /* Load application */
@@ -189,25 +219,102 @@ void Application::loadApp(QString filename)
   if(newGame())
   {
     file_name = filename;
-    FileHandler fh(file_name.toStdString(), false, true);
-    bool success = fh.start();
+    loadFile(file_name);
+
+    /* Record the edits made to the loaded save */
+    game_database->startJournal(file_name);
+  }
+}
 
-    /* Get count */
-    int count = fh.getCount();
+/* Loads a save file into the game database. Skipping core only loads maps */
+bool Application::loadFile(QString filename, bool skip_core)
+{
+  FileHandler fh(filename.toStdString(), false, true);
+  bool success = fh.start();
 
-    /* Create progress dialog */
-    QProgressDialog* progress_dialog = createProgressDialog(count, "Loading",
-                                                            "Loading Game...");
+  /* Get count */
+  int count = fh.getCount();
 
-    /* Load the info into the game database */
-    if(success)
-      game_database->load(&fh, progress_dialog);
-    progress_dialog->setValue(count);
+  /* Create progress dialog */
+  QProgressDialog* progress_dialog = createProgressDialog(count, "Loading",
+                                                          "Loading Game...");
 
-    /* Finish the file read */
-    fh.stop();
-    delete progress_dialog;
+  /* Load the info into the game database */
+  if(success)
+    game_database->load(&fh, progress_dialog, skip_core);
+  progress_dialog->setValue(count);
+
+  /* Finish the file read */
+  fh.stop();
+  delete progress_dialog;
+  return success;
+}
+
+/* Recovers the unsaved edits of the last session from the edit journals */
+void Application::recover()
+{
+  QStringList journals = EditorJournal::getJournalFiles();
+  for(int i = 0; i < journals.size(); i++)
+  {
+    QString base_path;
+    QList<EditorJournalRecord> records;
+    if(!EditorJournal::getShared()->read(journals[i], &base_path, &records) ||
+       records.size() == 0)
+    {
+      QFile::remove(journals[i]);
+      continue;
+    }
+
+    QString message = "The editor did not close cleanly. Recover the " +
+                      QString::number(records.size()) + " unsaved edits";
+    if(!base_path.isEmpty())
+      message += " to " + QFileInfo(base_path).fileName();
+    message += "?";
+
+    if(QMessageBox::question(this, "Recover Edits", message,
+                             QMessageBox::Yes | QMessageBox::No) ==
+       QMessageBox::Yes)
+    {
+      game_database->deleteAll();
+      game_database->createStartObjects();
+
+      /* The last core checkpoint replaces the core of the save */
+      QByteArray core;
+      for(int j = 0; j < records.size(); j++)
+        if(records[j].type == EditorEnumDb::JOURNAL_CORE)
+          core = records[j].data;
+      if(!core.isEmpty())
+      {
+        QString scratch = EditorJournal::getScratchPath(base_path);
+        QFile file(scratch);
+        if(file.open(QIODevice::WriteOnly) &&
+           file.write(core) == core.size())
+        {
+          file.close();
+          loadFile(scratch);
+        }
+        else
+        {
+          core.clear();
+        }
+      }
+
+      /* Then the maps of the save, and the map edits */
+      if(!base_path.isEmpty())
+        loadFile(base_path, !core.isEmpty());
+      game_database->replayJournal(records);
+
+      /* Keep recording, from the recovered edits */
+      file_name = base_path;
+      game_database->startJournal(base_path, records);
+      return;
+    }
+
+    /* Declined, so the edits are dropped */
+    QFile::remove(journals[i]);
   }
+
+  game_database->startJournal("");
 }
 
 /* Save application */
@@ -231,6 +338,9 @@ void Application::saveApp()
   /* Finish the file write */
   fh.stop();
   delete progress_dialog;
+
+  /* The saved edits no longer need recovery */
+  game_database->startJournal(file_name);
 }
 
 /*
@@ -259,6 +369,12 @@ void Application::setupTopMenu()
   action_export = new QAction("&Export to Game", this);
   action_export->setIcon(QIcon(":/images/icons/32_export.png"));
   action_export->setShortcut(QKeySequence(Qt::CTRL + Qt::Key_E));
+  action_atlas = new QAction("Export Images to &Atlas", this);
+  action_atlas->setCheckable(true);
+  action_atlas->setChecked(false);
+  action_duplicates = new QAction("Find &Duplicate Images", this);
+  action_compare = new QAction("&Compare Project Versions...", this);
+  action_merge = new QAction("&Merge Project Versions...", this);
   QAction* quit_action = new QAction("&Quit",this);
 
   /* Sets up file menu itself */
@@ -270,6 +386,11 @@ void Application::setupTopMenu()
   file_menu->addAction(action_save);
   file_menu->addAction(action_saveas);
   file_menu->addAction(action_export);
+  file_menu->addAction(action_atlas);
+  file_menu->addSeparator();
+  file_menu->addAction(action_duplicates);
+  file_menu->addAction(action_compare);
+  file_menu->addAction(action_merge);
   file_menu->addSeparator();
   file_menu->addAction(quit_action);
 
@@ -289,10 +410,10 @@ void Application::setupTopMenu()
   cut_action->setDisabled(true);
   QAction* copy_action = new QAction("&Copy",this);
   copy_action->setIcon(QIcon(":/images/icons/32_copy.png"));
-  copy_action->setDisabled(true);
+  copy_action->setShortcut(QKeySequence::Copy);
   QAction* paste_action = new QAction("&Paste",this);
   paste_action->setIcon(QIcon(":/images/icons/32_paste.png"));
-  paste_action->setDisabled(true);
+  paste_action->setShortcut(QKeySequence::Paste);
   QAction* findreplace_action = new QAction("&Find/Replace",this);
   findreplace_action->setDisabled(true);
 
@@ -342,6 +463,12 @@ void Application::setupTopMenu()
   action_passW = new QAction("&Passability West", cursor_group);
   action_passW->setCheckable(true);
   action_passW->setIcon(QIcon(":/images/icons/32_passW.png"));
+  action_regioncopy = new QAction("&Region Copy", cursor_group);
+  action_regioncopy->setCheckable(true);
+  action_regioncopy->setIcon(QIcon(":/images/icons/32_copy.png"));
+  action_stamp = new QAction("&Stamp", cursor_group);
+  action_stamp->setCheckable(true);
+  action_stamp->setIcon(QIcon(":/images/icons/32_paste.png"));
   menu_cursor = menuBar()->addMenu("&Cursor Modes");
 
   /* Sets up the menu toolbars */
@@ -370,6 +497,10 @@ void Application::setupTopMenu()
   connect(action_save, SIGNAL(triggered()), this, SLOT(save()));
   connect(action_saveas, SIGNAL(triggered()), this, SLOT(saveAs()));
   connect(action_export, SIGNAL(triggered()), this, SLOT(exportTo()));
+  connect(action_duplicates, SIGNAL(triggered()),
+          game_database, SLOT(findDuplicateImages()));
+  connect(action_compare, SIGNAL(triggered()), this, SLOT(compareProjects()));
+  connect(action_merge, SIGNAL(triggered()), this, SLOT(mergeProjects()));
 
   /* Sets up the brushes toolbar */
   bar_brush = new QToolBar("Brushes", this);
@@ -383,6 +514,8 @@ void Application::setupTopMenu()
   bar_brush->addAction(action_passE);
   bar_brush->addAction(action_passS);
   bar_brush->addAction(action_passW);
+  bar_brush->addAction(action_regioncopy);
+  bar_brush->addAction(action_stamp);
   addToolBar(Qt::TopToolBarArea,bar_brush);
   menu_cursor->addAction(action_basic);
   menu_cursor->addAction(action_eraser);
@@ -394,6 +527,8 @@ void Application::setupTopMenu()
   menu_cursor->addAction(action_passE);
   menu_cursor->addAction(action_passS);
   menu_cursor->addAction(action_passW);
+  menu_cursor->addAction(action_regioncopy);
+  menu_cursor->addAction(action_stamp);
   bar_brush->setFloatable(false);
   bar_brush->setMovable(false);
   connect(action_basic,SIGNAL(toggled(bool)),this,SLOT(setCursorBasic(bool)));
@@ -412,6 +547,12 @@ void Application::setupTopMenu()
           this, SLOT(setPassSouthCursor(bool)));
   connect(action_passW, SIGNAL(toggled(bool)),
           this, SLOT(setPassWestCursor(bool)));
+  connect(action_regioncopy, SIGNAL(toggled(bool)),
+          this, SLOT(setCursorRegionCopy(bool)));
+  connect(action_stamp, SIGNAL(toggled(bool)),
+          this, SLOT(setCursorStamp(bool)));
+  connect(copy_action, SIGNAL(triggered()), action_regioncopy, SLOT(trigger()));
+  connect(paste_action, SIGNAL(triggered()), action_stamp, SLOT(trigger()));
 
   /* Set up the map control bar */
   action_zoom_in = new QAction("&Zoom In", this);
@@ -433,18 +574,82 @@ void Application::setupTopMenu()
   connect(action_play, SIGNAL(triggered()), this, SLOT(play()));
 }
 
+/* Lists the changes or conflicts of the project diff */
+void Application::showDiffEntries(QString title, QString label,
+                                  const EditorProjectDiff &project_diff)
+{
+  QList<EditorDiffEntry> entries = project_diff.getEntries();
+  if(entries.size() < project_diff.getEntryCount())
+    label += " (first " + QString::number(entries.size()) + " listed)";
+
+  /* Create the panel */
+  QDialog diff_dialog(this);
+  diff_dialog.setWindowTitle(title);
+  QVBoxLayout* diff_layout = new QVBoxLayout(&diff_dialog);
+  QLabel* lbl_diff = new QLabel(label, &diff_dialog);
+  diff_layout->addWidget(lbl_diff);
+  QListWidget* list_diff = new QListWidget(&diff_dialog);
+  for(int i = 0; i < entries.size(); i++)
+    list_diff->addItem(EditorProjectDiff::getEntryString(entries[i]));
+  list_diff->setMinimumWidth(600);
+  diff_layout->addWidget(list_diff);
+  QPushButton* btn_close = new QPushButton("Close", &diff_dialog);
+  connect(btn_close, SIGNAL(clicked()), &diff_dialog, SLOT(accept()));
+  diff_layout->addWidget(btn_close);
+  diff_dialog.exec();
+}
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
 
+/* Compares two versions of a project */
+void Application::compareProjects()
+{
+  QString dir = EditorHelpers::getSpriteDir() + "/../../Editor/saves";
+  QString ours = QFileDialog::getOpenFileName(this, "Compare Project Version",
+                                              dir,
+                                              tr("Univursa Saves (*.usv)"));
+  if(ours == "")
+    return;
+  QString theirs = QFileDialog::getOpenFileName(this, "Compare To Version",
+                                                dir,
+                                                tr("Univursa Saves (*.usv)"));
+  if(theirs == "")
+    return;
+
+  EditorProjectDiff project_diff;
+  if(!project_diff.diff(ours, theirs, this))
+  {
+    QMessageBox::warning(this, "Compare Project Versions",
+                         "The project versions could not be read");
+  }
+  else if(project_diff.getEntryCount() == 0)
+  {
+    QMessageBox::information(this, "Compare Project Versions",
+                             "The project versions are the same");
+  }
+  else
+  {
+    showDiffEntries("Compare Project Versions",
+                    QString::number(project_diff.getEntryCount()) +
+                    " changes from " + QFileInfo(ours).fileName() + " to " +
+                    QFileInfo(theirs).fileName(), project_diff);
+  }
+}
+
 /* Disables control for when in editing view with map */
 void Application::disableControl(bool disabled)
 {
   game_db_dock->setDisabled(disabled);
 
   bar_brush->setDisabled(disabled);
+  action_atlas->setDisabled(disabled);
+  action_compare->setDisabled(disabled);
+  action_duplicates->setDisabled(disabled);
   action_export->setDisabled(disabled);
   action_load->setDisabled(disabled);
+  action_merge->setDisabled(disabled);
   action_new->setDisabled(disabled);
   action_play->setDisabled(disabled);
   action_recent->setDisabled(disabled);
@@ -544,6 +749,54 @@ void Application::load()
     loadApp(file);
 }
 
+/* Merges two versions of a project from their common base */
+void Application::mergeProjects()
+{
+  QString dir = EditorHelpers::getSpriteDir() + "/../../Editor/saves";
+  QString base = QFileDialog::getOpenFileName(this, "Merge: Base Version", dir,
+                                              tr("Univursa Saves (*.usv)"));
+  if(base == "")
+    return;
+  QString ours = QFileDialog::getOpenFileName(this, "Merge: Our Version",
+                                              dir,
+                                              tr("Univursa Saves (*.usv)"));
+  if(ours == "")
+    return;
+  QString theirs = QFileDialog::getOpenFileName(this, "Merge: Their Version",
+                                                dir,
+                                                tr("Univursa Saves (*.usv)"));
+  if(theirs == "")
+    return;
+
+  /* Conflicts must be resolved in the versions first */
+  EditorProjectDiff project_diff;
+  if(!project_diff.merge(base, ours, theirs, this))
+  {
+    QMessageBox::warning(this, "Merge Project Versions",
+                         "The project versions could not be read");
+    return;
+  }
+  if(project_diff.getEntryCount() > 0)
+  {
+    showDiffEntries("Merge Project Versions",
+                    QString::number(project_diff.getEntryCount()) +
+                    " conflicts. Nothing was merged", project_diff);
+    return;
+  }
+
+  QString file = QFileDialog::getSaveFileName(this, "Save Merged Project As",
+                                              dir,
+                                              tr("Univursa Saves (*.usv)"));
+  if(file != "")
+  {
+    if(!file.endsWith(".usv"))
+      file += ".usv";
+    if(!project_diff.saveMerge(file))
+      QMessageBox::warning(this, "Merge Project Versions",
+                           "The merged project could not be saved");
+  }
+}
+
 /* New game */
 bool Application::newGame()
 {
@@ -552,9 +805,11 @@ bool Application::newGame()
                  QMessageBox::Yes | QMessageBox::No);
   if(reply == QMessageBox::Yes)
   {
+    game_database->stopJournal();
     game_database->deleteAll();
     game_database->createStartObjects();
     file_name = "";
+    game_database->startJournal("");
     return true;
   }
   return false;
@@ -763,6 +1018,30 @@ void Application::setCursorMove(bool checked)
     game_view->getMapView()->setCursorMode(EditorEnumDb::MOVE);
 }
 
+/*
+ * Description: Sets to region copy cursor mode
+ *
+ * Inputs: bool checked - true if button triggered on
+ * Output: none
+ */
+void Application::setCursorRegionCopy(bool checked)
+{
+  if(checked)
+    game_view->getMapView()->setCursorMode(EditorEnumDb::REGION_COPY);
+}
+
+/*
+ * Description: Sets to region stamp cursor mode
+ *
+ * Inputs: bool checked - true if button triggered on
+ * Output: none
+ */
+void Application::setCursorStamp(bool checked)
+{
+  if(checked)
+    game_view->getMapView()->setCursorMode(EditorEnumDb::REGION_STAMP);
+}
+
 /*
  * Description: Sets the equipment
  */
@@ -1005,5 +1284,7 @@ void Application::closeEvent(QCloseEvent *event)
   else
     event->ignore();
 */
+  /* Closed cleanly, so the edit journal is not needed for recovery */
+  game_database->stopJournal();
   event->accept();
 }
@@ -17,6 +17,74 @@
  * Inputs: QWidget* parent - the parent widget. Default to NULL
  */
 EditorAction::EditorAction(QWidget *parent) : QWidget(parent)
+{
+  /* Layout - created on the first show */
+  layout_created = false;
+
+  /* Set up the base action with just a damage call */
+  setBaseAction(Action("0,DAMAGE,,,,,AMOUNT.0,AMOUNT.0,,100"));
+
+  /* Set name */
+  name = "";
+}
+
+/*
+ * Description: Second constructor function, with ID and name parameters.
+ *
+ * Inputs: int id - the id of the action
+ *         QString name - the name of the action
+ *         QWidget* parent - the parent widget. Default to NULL
+ */
+EditorAction::EditorAction(int id, QString name, QWidget* parent)
+            : EditorAction(parent)
+{
+  setID(id);
+  setName(name);
+}
+
+/*
+ * Description: Copy constructor. Calls the blank constructor and then copies
+ *              the data from the source.
+ *
+ * Inputs: const EditorAction &source - the source object to copy
+ */
+EditorAction::EditorAction(const EditorAction &source) : EditorAction()
+{
+  copySelf(source);
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorAction::~EditorAction()
+{
+}
+
+/*============================================================================
+ * PROTECTED FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Copies all data from source editor object to this editor
+ *              object.
+ *
+ * Inputs: EditorAction &source - the source to copy from
+ * Output: none
+ */
+void EditorAction::copySelf(const EditorAction &source)
+{
+  name = source.name;
+  full_name = source.full_name;
+  setBaseAction(source.base);
+}
+
+/*
+ * Description: Creates the action layout with QT functional widgets.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAction::createLayout()
 {
   /* Main Layout */
   main_layout = new QHBoxLayout(this);
@@ -387,128 +455,18 @@ EditorAction::EditorAction(QWidget *parent) : QWidget(parent)
   buttons_layout->addWidget(reset_button);
   buttons_layout->addWidget(save_button);
   right_layout->addLayout(buttons_layout);
-
-  /* Set up the base action with just a damage call */
-  setBaseAction(Action("0,DAMAGE,,,,,AMOUNT.0,AMOUNT.0,,100"));
-
-  /* Set name */
-  name = "";
-}
-
-/*
- * Description: Second constructor function, with ID and name parameters.
- *
- * Inputs: int id - the id of the action
- *         QString name - the name of the action
- *         QWidget* parent - the parent widget. Default to NULL
- */
-EditorAction::EditorAction(int id, QString name, QWidget* parent)
-            : EditorAction(parent)
-{
-  setID(id);
-  setName(name);
-}
-
-/*
- * Description: Copy constructor. Calls the blank constructor and then copies
- *              the data from the source.
- *
- * Inputs: const EditorAction &source - the source object to copy
- */
-EditorAction::EditorAction(const EditorAction &source) : EditorAction()
-{
-  copySelf(source);
-}
-
-/*
- * Description: Destructor function
- */
-EditorAction::~EditorAction()
-{
-}
-
-/*============================================================================
- * PROTECTED FUNCTIONS
- *===========================================================================*/
-
-/*
- * Description: Copies all data from source editor object to this editor
- *              object.
- *
- * Inputs: EditorAction &source - the source to copy from
- * Output: none
- */
-void EditorAction::copySelf(const EditorAction &source)
-{
-  name = source.name;
-  full_name = source.full_name;
-  setBaseAction(source.base);
-}
-
-/*============================================================================
- * PUBLIC SLOT FUNCTIONS
- *===========================================================================*/
-
-/*
- * Description: Returns the ailment enum.
- *
- * Inputs: none
- * Output: Infliction - enum that represents the ailment
- */
-Infliction EditorAction::getAilment() const
-{
-  return working.getAilment();
 }
 
 /*
- * Description: Returns the base value of the action.
- *
- * Inputs: none
- * Output: int - the base value of the action
- */
-int EditorAction::getBase() const
-{
-  return working.getBase();
-}
-
-/*
- * Description: Returns the base action.
+ * Description: Reads all the GUI element contents back into the working
+ *              action. Only valid once the layout is created.
  *
  * Inputs: none
- * Output: Action - the base action
- */
-Action EditorAction::getBaseAction()
-{
-  return base;
-}
-
-/*
- * Description: Returns the chance of the action being processed.
- *
- * Inputs: none
- * Output: float - the float percentage chance
- */
-float EditorAction::getChance() const
-{
-  return working.getChance();
-}
-
-/*
- * Description: Returns the revised action with the class changes.
- *
- * Inputs: none
- * Output: Action - the working action
+ * Output: none
  */
-Action EditorAction::getEditedAction()
+void EditorAction::readWorkingInfo()
 {
-  QString full_name = "";
   name = name_edit->text();
-  if(working.getID() < 10)
-    full_name.append("0");
-  full_name.append(QString::number(working.getID()));
-  full_name.append(" : ");
-  full_name.append(name);
-  emit nameChange(full_name);
 
   working.setBaseValue(value_edit->text().toInt(),
                        action_flags_base_pc->isChecked());
@@ -565,7 +523,6 @@ Action EditorAction::getEditedAction()
   working.setActionFlag(ActionFlags::FLIP_ATTR,
                         action_flags_alterflip->isChecked() ||
                         action_flags_assignflip->isChecked());
-  working.setActionFlag(ActionFlags::VALID, true);
 
   if(ailment_poison->isChecked())
     working.setAilment(Infliction::POISON);
@@ -774,10 +731,100 @@ Action EditorAction::getEditedAction()
 //    working.setAttributeTarget(Attribute::MANN);
 //  else if(target_flags_NOAT->isChecked())
 //    working.setAttributeTarget(Attribute::NONE);
+}
+
+/*
+ * Description: Creates the widget layout the first time the action is shown,
+ *              so actions that are never opened hold no widgets.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorAction::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    loadWorkingInfo();
+    updateLayouts();
+  }
+  QWidget::showEvent(event);
+}
+
+/*============================================================================
+ * PUBLIC SLOT FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the ailment enum.
+ *
+ * Inputs: none
+ * Output: Infliction - enum that represents the ailment
+ */
+Infliction EditorAction::getAilment() const
+{
+  return working.getAilment();
+}
 
+/*
+ * Description: Returns the base value of the action.
+ *
+ * Inputs: none
+ * Output: int - the base value of the action
+ */
+int EditorAction::getBase() const
+{
+  return working.getBase();
+}
+
+/*
+ * Description: Returns the base action.
+ *
+ * Inputs: none
+ * Output: Action - the base action
+ */
+Action EditorAction::getBaseAction()
+{
+  return base;
+}
+
+/*
+ * Description: Returns the chance of the action being processed.
+ *
+ * Inputs: none
+ * Output: float - the float percentage chance
+ */
+float EditorAction::getChance() const
+{
+  return working.getChance();
+}
+
+/*
+ * Description: Returns the revised action with the class changes.
+ *
+ * Inputs: none
+ * Output: Action - the working action
+ */
+Action EditorAction::getEditedAction()
+{
+  /* Read the widgets, only if created */
+  if(layout_created)
+    readWorkingInfo();
+
+  QString full_name = "";
+  if(working.getID() < 10)
+    full_name.append("0");
+  full_name.append(QString::number(working.getID()));
+  full_name.append(" : ");
+  full_name.append(name);
+  emit nameChange(full_name);
+
+  working.setActionFlag(ActionFlags::VALID, true);
   base = working;
   outputString();
   loadWorkingInfo();
+  emit dataSaved();
   return base;
 }
 
@@ -856,6 +903,9 @@ Action EditorAction::getWorkingAction()
  */
 void EditorAction::loadWorkingInfo()
 {
+  if(!layout_created)
+    return;
+
   name_edit->setText(name);
   value_edit->setText(QString::number(working.getBase()));
   chance_edit->setText(QString::number(working.getChance()));
@@ -1371,7 +1421,8 @@ void EditorAction::setNameAndID(QString str)
 {
   base.setID(str.split(" : ").at(0).toInt());
   name = str.split(" : ").at(1);
-  name_edit->setText(name);
+  if(layout_created)
+    name_edit->setText(name);
   setWorkingAction(base);
 }
 
@@ -1396,6 +1447,9 @@ void EditorAction::setWorkingAction(Action a)
  */
 void EditorAction::updateLayouts()
 {
+  if(!layout_created)
+    return;
+
   if(action_flags_inflict->isChecked())
   {
     minduration_edit->setDisabled(false);
@@ -1509,11 +1563,11 @@ QString EditorAction::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorAction::load(XmlData data, int index)
+void EditorAction::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "action")
@@ -1591,7 +1645,7 @@ void EditorAction::setID(int id)
 void EditorAction::setName(QString name, bool update)
 {
   this->name = name;
-  if(update)
+  if(update && layout_created)
     name_edit->setText(name);
   setWorkingAction(base);
 }
@@ -0,0 +1,133 @@
+/*******************************************************************************
+ * Class Name: EditorAnimationClock
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: The one clock that all animated previews are timed from. It
+ *              only ticks while at least one preview holds it, and every tick
+ *              carries the same time, so all sprites on a view stay in step.
+ ******************************************************************************/
+#include "Database/EditorAnimationClock.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorAnimationClock::kTICK_INTERVAL = 25;
+
+/* Static Implementation */
+EditorAnimationClock* EditorAnimationClock::shared_clock = nullptr;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The clock is not held, so not ticking.
+ *
+ * Inputs: QObject* parent - the parent object
+ */
+EditorAnimationClock::EditorAnimationClock(QObject* parent) : QObject(parent)
+{
+  holders = 0;
+  elapsed.start();
+
+  timer.setInterval(kTICK_INTERVAL);
+  timer.setSingleShot(false);
+  timer.setTimerType(Qt::PreciseTimer);
+  connect(&timer, SIGNAL(timeout()), this, SLOT(timerTick()));
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorAnimationClock::~EditorAnimationClock()
+{
+  timer.stop();
+}
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+
+/*
+ * Description: Emits the tick with the clock time. Connected to the timer.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAnimationClock::timerTick()
+{
+  emit tick(getTime());
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Holds the clock for a preview. The first holder starts it.
+ *              Each call must be matched by a release().
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAnimationClock::acquire()
+{
+  holders++;
+  if(holders == 1)
+    timer.start();
+}
+
+/*
+ * Description: Returns the time of the clock. It runs from creation, whether
+ *              ticking or not, so frames computed from it are continuous.
+ *
+ * Inputs: none
+ * Output: qint64 - the time, in ms
+ */
+qint64 EditorAnimationClock::getTime() const
+{
+  return elapsed.elapsed();
+}
+
+/*
+ * Description: Returns if the clock is ticking (held by any preview).
+ *
+ * Inputs: none
+ * Output: bool - true if ticking
+ */
+bool EditorAnimationClock::isRunning() const
+{
+  return timer.isActive();
+}
+
+/*
+ * Description: Releases a hold on the clock. The last holder stops it.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAnimationClock::release()
+{
+  if(holders > 0)
+  {
+    holders--;
+    if(holders == 0)
+      timer.stop();
+  }
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the shared clock. Created on the first call and kept
+ *              for the life of the application.
+ *
+ * Inputs: none
+ * Output: EditorAnimationClock* - the shared clock
+ */
+EditorAnimationClock* EditorAnimationClock::getShared()
+{
+  if(shared_clock == nullptr)
+    shared_clock = new EditorAnimationClock();
+  return shared_clock;
+}
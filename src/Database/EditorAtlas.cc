@@ -0,0 +1,525 @@
+/*******************************************************************************
+ * Class Name: EditorAtlas
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Texture atlas for game exports. Packs the images the project
+ *              uses into a few atlas pages, rendered in parallel, and writes a
+ *              manifest of where each image went. While exporting, the saved
+ *              image paths are region paths into the pages. The pages and
+ *              manifest are reused by the next export if no image changed.
+ *              Lay-overs and backgrounds scroll and tile, so they are not
+ *              packed and keep their own paths.
+ ******************************************************************************/
+#include "Database/EditorAtlas.h"
+
+/* Constant Implementation - see header file for descriptions */
+const QString EditorAtlas::kMANIFEST = "manifest.xml";
+const int EditorAtlas::kMANIFEST_VERSION = 1;
+const int EditorAtlas::kPADDING = 2;
+const int EditorAtlas::kPAGE_SIZE = 2048;
+const int EditorAtlas::kPROGRESS_DELAY = 500;
+
+/* Static Implementation */
+EditorAtlas* EditorAtlas::exporting = nullptr;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The atlas is empty until built.
+ *
+ * Inputs: QString dir - the directory of the pages and manifest
+ */
+EditorAtlas::EditorAtlas(QString dir)
+{
+  this->dir = QDir::toNativeSeparators(dir);
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorAtlas::~EditorAtlas()
+{
+  endExport();
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns if the pack is of exactly the files, with the same
+ *              size and modified time on disk as when packed, and all the
+ *              pages still exist. Files left off the pages are in the entries
+ *              too, so an image too big to pack does not force a repack.
+ *
+ * Inputs: const QStringList &files - the image files to pack
+ * Output: bool - true if the pack is current
+ */
+bool EditorAtlas::isCurrent(const QStringList &files) const
+{
+  if(entries.isEmpty() || entries.size() != files.size())
+    return false;
+
+  for(int i = 0; i < files.size(); i++)
+  {
+    auto it = entries.find(files[i]);
+    if(it == entries.end())
+      return false;
+
+    QFileInfo info(files[i]);
+    if(info.size() != it.value().size ||
+       info.lastModified().toMSecsSinceEpoch() != it.value().modified)
+      return false;
+  }
+
+  for(int i = 0; i < pages.size(); i++)
+    if(!QFileInfo(pages[i]).isFile())
+      return false;
+
+  return true;
+}
+
+/*
+ * Description: Loads the manifest of the last pack in the directory. The
+ *              pack is cleared if it is missing or not readable.
+ *
+ * Inputs: none
+ * Output: bool - true if loaded
+ */
+bool EditorAtlas::loadManifest()
+{
+  clear();
+
+  QFile file(dir + QDir::separator() + kMANIFEST);
+  if(!file.open(QIODevice::ReadOnly))
+    return false;
+
+  QXmlStreamReader xml(&file);
+  while(!xml.atEnd() && !xml.hasError())
+  {
+    if(xml.readNextStartElement())
+    {
+      QXmlStreamAttributes att = xml.attributes();
+      if(xml.name() == "atlas")
+      {
+        if(att.value("version").toInt() != kMANIFEST_VERSION)
+          break;
+      }
+      else if(xml.name() == "page")
+      {
+        int index = att.value("index").toInt();
+        while(pages.size() <= index)
+          pages.push_back("");
+        pages[index] = EditorHelpers::getProjectPath(
+                                              att.value("path").toString());
+      }
+      else if(xml.name() == "image")
+      {
+        EditorAtlasEntry entry;
+        entry.modified = att.value("modified").toLongLong();
+        entry.page = att.value("page").toInt();
+        entry.rect = QRect(att.value("x").toInt(), att.value("y").toInt(),
+                           att.value("w").toInt(), att.value("h").toInt());
+        entry.size = att.value("size").toLongLong();
+        entries.insert(EditorHelpers::getProjectPath(
+                                         att.value("path").toString()), entry);
+      }
+    }
+  }
+
+  /* Any error or reference to a missing page invalidates the pack */
+  bool valid = !xml.hasError() && !entries.isEmpty() && !pages.contains("");
+  for(auto it = entries.begin(); valid && it != entries.end(); it++)
+    valid = (it.value().page >= -1 && it.value().page < pages.size());
+  if(!valid)
+    clear();
+
+  return valid;
+}
+
+/*
+ * Description: Packs the files into pages, shelf by shelf from the tallest
+ *              image down, starting a new page when one fills. Only the image
+ *              headers are read. Images that do not fit on a page are left
+ *              out, so they are exported by their own path, but still get an
+ *              entry on page -1 with their stamps for the reuse check.
+ *
+ * Inputs: const QStringList &files - the image files to pack
+ * Output: QVector<EditorAtlasPage> - the pages to render
+ */
+QVector<EditorAtlasPage> EditorAtlas::pack(const QStringList &files)
+{
+  QVector<EditorAtlasPage> page_set;
+
+  /* Sizes of the images that fit, tallest first */
+  QVector<QPair<QString,QSize>> sizes;
+  for(int i = 0; i < files.size(); i++)
+  {
+    QSize size = QImageReader(files[i]).size();
+    if(size.isValid() && !size.isEmpty() &&
+       size.width() <= kPAGE_SIZE && size.height() <= kPAGE_SIZE)
+    {
+      sizes.push_back(qMakePair(files[i], size));
+    }
+    else
+    {
+      QFileInfo info(files[i]);
+      EditorAtlasEntry entry;
+      entry.modified = info.lastModified().toMSecsSinceEpoch();
+      entry.page = -1;
+      entry.size = info.size();
+      entries.insert(files[i], entry);
+    }
+  }
+  std::stable_sort(sizes.begin(), sizes.end(),
+                   [](const QPair<QString,QSize> &a,
+                      const QPair<QString,QSize> &b)
+  {
+    if(a.second.height() != b.second.height())
+      return a.second.height() > b.second.height();
+    return a.second.width() > b.second.width();
+  });
+
+  /* Fill the shelves */
+  EditorAtlasPage page;
+  int shelf_height = 0;
+  int x = 0;
+  int y = 0;
+  for(int i = 0; i < sizes.size(); i++)
+  {
+    QSize size = sizes[i].second;
+    if(x + size.width() > kPAGE_SIZE)
+    {
+      x = 0;
+      y += shelf_height + kPADDING;
+      shelf_height = 0;
+    }
+    if(y + size.height() > kPAGE_SIZE)
+    {
+      page_set.push_back(page);
+      page = EditorAtlasPage();
+      x = 0;
+      y = 0;
+      shelf_height = 0;
+    }
+
+    QRect rect(QPoint(x, y), size);
+    page.images.push_back(qMakePair(sizes[i].first, rect));
+    page.size = page.size.expandedTo(QSize(rect.right() + 1,
+                                           rect.bottom() + 1));
+    x += size.width() + kPADDING;
+    shelf_height = qMax(shelf_height, size.height());
+  }
+  if(!page.images.isEmpty())
+    page_set.push_back(page);
+
+  /* Name the pages and record where each image went */
+  for(int i = 0; i < page_set.size(); i++)
+  {
+    page_set[i].file = dir + QDir::separator() + "page_" +
+                       QString::number(i).rightJustified(2, '0') + ".png";
+    pages.push_back(page_set[i].file);
+
+    for(int j = 0; j < page_set[i].images.size(); j++)
+    {
+      QFileInfo info(page_set[i].images[j].first);
+      EditorAtlasEntry entry;
+      entry.modified = info.lastModified().toMSecsSinceEpoch();
+      entry.page = i;
+      entry.rect = page_set[i].images[j].second;
+      entry.size = info.size();
+      entries.insert(page_set[i].images[j].first, entry);
+    }
+  }
+
+  return page_set;
+}
+
+/*
+ * Description: Renders the images of the page onto a transparent image and
+ *              writes it as a png. Each call decodes its own images and uses
+ *              no shared state, so pages can render on the thread pool.
+ *
+ * Inputs: const EditorAtlasPage &page - the page to render
+ * Output: bool - true if every image decoded and the page was written
+ */
+bool EditorAtlas::renderPage(const EditorAtlasPage &page)
+{
+  bool success = true;
+
+  QImage image(page.size, QImage::Format_ARGB32);
+  image.fill(Qt::transparent);
+
+  QPainter painter(&image);
+  painter.setCompositionMode(QPainter::CompositionMode_Source);
+  for(int i = 0; i < page.images.size(); i++)
+  {
+    QImage source(page.images[i].first);
+    if(source.isNull())
+      success = false;
+    else
+      painter.drawImage(page.images[i].second.topLeft(), source);
+  }
+  painter.end();
+
+  return success && image.save(page.file, "PNG");
+}
+
+/*
+ * Description: Saves the manifest of the pack in the directory. The page and
+ *              image paths are trimmed to the project directory, as in the
+ *              exported game file, and each image records its atlas page and
+ *              rect with the file size and modified time it was packed at.
+ *              Images left off the pages are on page -1 with an empty rect.
+ *
+ * Inputs: none
+ * Output: bool - true if saved
+ */
+bool EditorAtlas::saveManifest() const
+{
+  QFile file(dir + QDir::separator() + kMANIFEST);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    return false;
+
+  QXmlStreamWriter xml(&file);
+  xml.setAutoFormatting(true);
+  xml.writeStartDocument();
+  xml.writeStartElement("atlas");
+  xml.writeAttribute("version", QString::number(kMANIFEST_VERSION));
+
+  for(int i = 0; i < pages.size(); i++)
+  {
+    QSize size = QImageReader(pages[i]).size();
+    xml.writeStartElement("page");
+    xml.writeAttribute("index", QString::number(i));
+    xml.writeAttribute("path", EditorHelpers::trimPath(pages[i]));
+    xml.writeAttribute("w", QString::number(size.width()));
+    xml.writeAttribute("h", QString::number(size.height()));
+    xml.writeEndElement();
+  }
+
+  QStringList files = entries.keys();
+  files.sort();
+  for(int i = 0; i < files.size(); i++)
+  {
+    const EditorAtlasEntry &entry = entries[files[i]];
+    xml.writeStartElement("image");
+    xml.writeAttribute("path", EditorHelpers::trimPath(files[i]));
+    xml.writeAttribute("page", QString::number(entry.page));
+    xml.writeAttribute("x", QString::number(entry.rect.x()));
+    xml.writeAttribute("y", QString::number(entry.rect.y()));
+    xml.writeAttribute("w", QString::number(entry.rect.width()));
+    xml.writeAttribute("h", QString::number(entry.rect.height()));
+    xml.writeAttribute("size", QString::number(entry.size));
+    xml.writeAttribute("modified", QString::number(entry.modified));
+    xml.writeEndElement();
+  }
+
+  xml.writeEndElement();
+  xml.writeEndDocument();
+
+  return !xml.hasError() && file.error() == QFileDevice::NoError;
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Starts saving exported image paths into this atlas, through
+ *              getExportPath(). Must be matched by an endExport().
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAtlas::beginExport()
+{
+  exporting = this;
+}
+
+/*
+ * Description: Packs the images into the atlas. The paths are reduced to the
+ *              existing image files, once each (regions pack their whole
+ *              sheet). If the last pack in the directory is of the same files,
+ *              unchanged on disk, it is reused. Otherwise the files are packed
+ *              and the pages rendered concurrently on the global thread pool,
+ *              with a cancellable progress dialog shown if it runs longer than
+ *              kPROGRESS_DELAY, then the manifest is saved.
+ *
+ * Inputs: QStringList paths - the image paths to pack
+ *         QWidget* parent - the parent of the progress dialog
+ * Output: bool - true if built. False if cancelled or failed
+ */
+bool EditorAtlas::build(QStringList paths, QWidget* parent)
+{
+  /* Only pack each existing file once, leaving out the atlas pages */
+  QStringList files;
+  for(int i = 0; i < paths.size(); i++)
+    paths[i] = EditorHelpers::getProjectPath(
+                                 EditorImageStore::splitRegionPath(paths[i]));
+  paths.removeDuplicates();
+  for(int i = 0; i < paths.size(); i++)
+    if(QFileInfo(paths[i]).isFile() &&
+       !paths[i].startsWith(dir + QDir::separator()))
+      files.push_back(paths[i]);
+  files.sort();
+
+  /* Reuse the last pack if none of the images changed */
+  if(loadManifest() && isCurrent(files))
+    return true;
+  clear();
+  if(files.isEmpty() || !QDir().mkpath(dir))
+    return false;
+
+  /* Remove the pages of the last pack */
+  QDir page_dir(dir);
+  QStringList old_pages = page_dir.entryList(QStringList() << "page_*.png",
+                                             QDir::Files);
+  for(int i = 0; i < old_pages.size(); i++)
+    page_dir.remove(old_pages[i]);
+  page_dir.remove(kMANIFEST);
+
+  /* Render the pages on the thread pool, with progress shown after delay */
+  QVector<EditorAtlasPage> page_set = pack(files);
+  QProgressDialog dialog("Packing images...", "Cancel", 0, page_set.size(),
+                         parent);
+  dialog.setWindowModality(Qt::WindowModal);
+  dialog.setMinimumDuration(kPROGRESS_DELAY);
+  dialog.setValue(0);
+
+  QEventLoop loop;
+  QFutureWatcher<bool> watcher;
+  QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+  QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
+                   &dialog, SLOT(setValue(int)));
+  QObject::connect(&dialog, SIGNAL(canceled()), &watcher, SLOT(cancel()));
+  watcher.setFuture(QtConcurrent::mapped(page_set, &EditorAtlas::renderPage));
+  loop.exec();
+  watcher.waitForFinished();
+
+  bool success = !watcher.isCanceled();
+  for(int i = 0; success && i < page_set.size(); i++)
+    success = watcher.resultAt(i);
+  if(success)
+    success = saveManifest();
+  if(!success)
+    clear();
+
+  return success;
+}
+
+/*
+ * Description: Clears the pack. The files in the directory are left as is.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAtlas::clear()
+{
+  entries.clear();
+  pages.clear();
+}
+
+/*
+ * Description: Stops saving exported image paths into this atlas, if it is
+ *              the one being exported into.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorAtlas::endExport()
+{
+  if(exporting == this)
+    exporting = nullptr;
+}
+
+/*
+ * Description: Returns the number of images packed into the pages. Images
+ *              left off the pages are not counted.
+ *
+ * Inputs: none
+ * Output: int - the packed image count
+ */
+int EditorAtlas::getImageCount() const
+{
+  int count = 0;
+  for(auto it = entries.begin(); it != entries.end(); it++)
+    if(it.value().page >= 0)
+      count++;
+  return count;
+}
+
+/*
+ * Description: Returns the number of atlas pages.
+ *
+ * Inputs: none
+ * Output: int - the page count
+ */
+int EditorAtlas::getPageCount() const
+{
+  return pages.size();
+}
+
+/*
+ * Description: Returns the atlas region path of the image, trimmed to the
+ *              project directory. A region of a packed sheet is offset into
+ *              the sheet rect on the page.
+ *
+ * Inputs: QString path - the image path (full or trimmed, region or not)
+ * Output: QString - the atlas region path. Empty if the image is not packed
+ */
+QString EditorAtlas::getPath(QString path) const
+{
+  QRect region;
+  QString file = EditorHelpers::getProjectPath(
+                          EditorImageStore::splitRegionPath(path, &region));
+
+  auto it = entries.find(file);
+  if(it == entries.end() || it.value().page < 0)
+    return "";
+
+  QRect rect = it.value().rect;
+  if(region.isValid())
+    rect = region.translated(rect.topLeft()).intersected(rect);
+  if(rect.isEmpty())
+    return "";
+
+  return EditorImageStore::getRegionPath(
+                       EditorHelpers::trimPath(pages[it.value().page]), rect);
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the path to save for the image. While an export is
+ *              saving into an atlas, a packed image is saved as its atlas
+ *              region path. Otherwise the path is returned as is.
+ *
+ * Inputs: QString path - the image path
+ * Output: QString - the path to save
+ */
+QString EditorAtlas::getExportPath(QString path)
+{
+  if(exporting != nullptr && !path.isEmpty())
+  {
+    QString atlas_path = exporting->getPath(path);
+    if(!atlas_path.isEmpty())
+      return atlas_path;
+  }
+  return path;
+}
+
+/*
+ * Description: Returns if an export is saving image paths into an atlas.
+ *
+ * Inputs: none
+ * Output: bool - true if exporting into an atlas
+ */
+bool EditorAtlas::isExporting()
+{
+  return (exporting != nullptr);
+}
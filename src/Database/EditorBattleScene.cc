@@ -149,6 +149,31 @@ int EditorBattleScene::getID() const
   return scene.id;
 }
 
+/*
+ * Description: Returns the image files used by the background and the lay
+ *              overs (under, mid and over) of the scene, as full paths.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per use
+ */
+QStringList EditorBattleScene::getLayPaths() const
+{
+  QStringList paths;
+  const std::vector<LayOver>* lay_sets[] = {&scene.underlays, &scene.midlays,
+                                            &scene.overlays};
+
+  if(!scene.background.empty())
+    paths.push_back(EditorHelpers::getProjectPath(
+                                    QString::fromStdString(scene.background)));
+  for(const std::vector<LayOver>* lays : lay_sets)
+    for(uint32_t i = 0; i < lays->size(); i++)
+      if(!(*lays)[i].path.empty())
+        paths.push_back(EditorHelpers::getProjectPath(
+                                      QString::fromStdString((*lays)[i].path)));
+
+  return paths;
+}
+
 /*
  * Description: Returns the mid lay over at the index within the stack. If the
  *              index is out of range, it returns a blank struct.
@@ -347,11 +372,11 @@ bool EditorBattleScene::isChanged()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: bool - true if name was updated
  */
-bool EditorBattleScene::load(XmlData data, int index)
+bool EditorBattleScene::load(XmlData &data, int index)
 {
   bool name_updated = false;
 
@@ -369,6 +394,44 @@ bool EditorBattleScene::load(XmlData data, int index)
   return name_updated;
 }
 
+/*
+ * Description: Replaces the background and lay over image files of the scene
+ *              that are in the remap, keyed by full path.
+ *
+ * Inputs: const QHash<QString,QString> &remap - new paths, by old path
+ * Output: int - the number of images remapped
+ */
+int EditorBattleScene::remapLayPaths(const QHash<QString,QString> &remap)
+{
+  int count = 0;
+  std::vector<LayOver>* lay_sets[] = {&scene.underlays, &scene.midlays,
+                                      &scene.overlays};
+
+  QString background = QDir::fromNativeSeparators(EditorHelpers::getProjectPath(
+                                    QString::fromStdString(scene.background)));
+  if(remap.contains(background))
+  {
+    setBackground(EditorHelpers::trimPath(remap.value(background)));
+    count++;
+  }
+  for(std::vector<LayOver>* lays : lay_sets)
+  {
+    for(uint32_t i = 0; i < lays->size(); i++)
+    {
+      QString path = QDir::fromNativeSeparators(EditorHelpers::getProjectPath(
+                                     QString::fromStdString((*lays)[i].path)));
+      if(remap.contains(path))
+      {
+        (*lays)[i].path =
+                    EditorHelpers::trimPath(remap.value(path)).toStdString();
+        count++;
+      }
+    }
+  }
+
+  return count;
+}
+
 /*
  * Description: Saves the object data to the file handling pointer.
  *
@@ -33,9 +33,8 @@ EditorCategory::EditorCategory(QWidget *parent) : QWidget(parent)
   set_id = -1;
   set_id_base = -1;
 
-  /* Layouts and info loading */
-  createLayout();
-  loadWorkingInfo();
+  /* Layouts and info loading - created on the first show */
+  layout_created = false;
 }
 
 /*
@@ -334,6 +333,18 @@ void EditorCategory::createLayout()
  */
 void EditorCategory::loadWorkingInfo()
 {
+  /* Check the skill set is still available, with or without the widgets */
+  int set_index = -1;
+  for(int i = 0; i < set_total.size(); i++)
+    if(set_total[i]->getID() == set_id)
+      set_index = i + 1;
+  if(set_index < 0)
+    set_id = -1;
+
+  /* The rest is only the widgets */
+  if(!layout_created)
+    return;
+
   /* ID */
   edit_id->setText(QString::number(id));
 
@@ -354,17 +365,10 @@ void EditorCategory::loadWorkingInfo()
   combo_skill_set->blockSignals(true);
   combo_skill_set->clear();
   combo_skill_set->addItem("None");
-  int set_index = -1;
   for(int i = 0; i < set_total.size(); i++)
-  {
     combo_skill_set->addItem(set_total[i]->getNameList());
-    if(set_total[i]->getID() == set_id)
-      set_index = i + 1;
-  }
   if(set_index > 0)
     combo_skill_set->setCurrentIndex(set_index);
-  else
-    set_id = -1;
   combo_skill_set->blockSignals(false);
 
   /* Flags */
@@ -426,6 +430,24 @@ void EditorCategory::loadWorkingInfo()
 //  }
 }
 
+/*
+ * Description: Creates the widget layout the first time the category is
+ *              shown, so categories that are never opened hold no widgets.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorCategory::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
+}
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -676,11 +698,11 @@ QString EditorCategory::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorCategory::load(XmlData data, int index)
+void EditorCategory::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "skillset")
@@ -707,8 +729,11 @@ void EditorCategory::resetWorking()
   cat_curr = cat_base;
   set_id = set_id_base;
   setName(QString::fromStdString(cat_curr.getName()));
-  combo_stats_base->setCurrentIndex(kMAX_PRESETS);
-  combo_stats_max->setCurrentIndex(kMAX_PRESETS);
+  if(layout_created)
+  {
+    combo_stats_base->setCurrentIndex(kMAX_PRESETS);
+    combo_stats_max->setCurrentIndex(kMAX_PRESETS);
+  }
   loadWorkingInfo();
 }
 
@@ -856,6 +881,7 @@ void EditorCategory::saveWorking()
     emit nameChange(QString::fromStdString(cat_curr.getName()));
   cat_base = cat_curr;
   set_id_base = set_id;
+  emit dataSaved();
 }
 
 /*
@@ -867,7 +893,8 @@ void EditorCategory::saveWorking()
 void EditorCategory::setID(int id)
 {
   this->id = id;
-  edit_id->setText(QString::number(id));
+  if(layout_created)
+    edit_id->setText(QString::number(id));
 }
 
 /*
@@ -880,7 +907,7 @@ void EditorCategory::setID(int id)
 void EditorCategory::setName(QString name, bool update)
 {
   cat_curr.setName(name.toStdString());
-  if(update)
+  if(update && layout_created)
     edit_name->setText(QString::fromStdString(cat_curr.getName()));
   //emit nameChange(name);
 }
@@ -0,0 +1,255 @@
+/*******************************************************************************
+ * Class Name: EditorConvoPath
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: The path to a conversation entry, as the rows of the base index
+ *              (4.5.4). Odd steps are the place in a straight run and even
+ *              steps the option picked. Kept as integers so it can be compared
+ *              and hashed without parsing; the string form is only for display.
+ ******************************************************************************/
+#include "Database/EditorConvoPath.h"
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The path is empty.
+ *
+ * Inputs: none
+ */
+EditorConvoPath::EditorConvoPath()
+{
+}
+
+/*
+ * Description: Constructor function with the base index string. If any step
+ *              is not a number of 1 or more, the path is left empty.
+ *
+ * Inputs: QString base_index - the base index, in the form 4.5.4
+ */
+EditorConvoPath::EditorConvoPath(QString base_index) : EditorConvoPath()
+{
+  if(!base_index.isEmpty())
+  {
+    QStringList list = base_index.split('.');
+    for(int i = 0; i < list.size(); i++)
+    {
+      bool ok = false;
+      int step = list[i].toInt(&ok);
+      if(!ok || step < 1)
+      {
+        steps.clear();
+        return;
+      }
+      steps.append(step);
+    }
+  }
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorConvoPath::~EditorConvoPath()
+{
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Appends a step to the end of the path.
+ *
+ * Inputs: int step - the row of the next step, 1 or more
+ * Output: none
+ */
+void EditorConvoPath::append(int step)
+{
+  if(step >= 1)
+    steps.append(step);
+}
+
+/*
+ * Description: Returns the base index string of the path. Only used for
+ *              display and saving.
+ *
+ * Inputs: none
+ * Output: QString - the base index, in the form 4.5.4. Empty if empty
+ */
+QString EditorConvoPath::getBaseIndex() const
+{
+  QStringList list;
+  for(int i = 0; i < steps.size(); i++)
+    list.append(QString::number(steps[i]));
+  return list.join(".");
+}
+
+/*
+ * Description: Returns the game entry index of the path, built from the
+ *              expanded steps.
+ *
+ * Inputs: none
+ * Output: core::ConversationEntryIndex - the entry index
+ */
+core::ConversationEntryIndex EditorConvoPath::getEntryIndex() const
+{
+  QVector<int> expanded = getExpanded();
+  QStringList list;
+  for(int i = 0; i < expanded.size(); i++)
+    list.append(QString::number(expanded[i]));
+  return core::ConversationEntryIndex(list.join(".").toStdString());
+}
+
+/*
+ * Description: Returns the expanded steps. Every odd step (place in a run) is
+ *              expanded into that many 1s and every even step (option) is
+ *              kept, so 4.5.4 becomes 1.1.1.1.5.1.1.1.1.
+ *
+ * Inputs: none
+ * Output: QVector<int> - the expanded steps
+ */
+QVector<int> EditorConvoPath::getExpanded() const
+{
+  QVector<int> expanded;
+  for(int i = 0; i < steps.size(); i++)
+  {
+    if(i % 2 == 0)
+      expanded.insert(expanded.size(), steps[i], 1);
+    else
+      expanded.append(steps[i]);
+  }
+  return expanded;
+}
+
+/*
+ * Description: Returns the path of the entry after this one, in the same run
+ *              or option set.
+ *
+ * Inputs: none
+ * Output: EditorConvoPath - the next path. Empty if this is empty
+ */
+EditorConvoPath EditorConvoPath::getNext() const
+{
+  EditorConvoPath next = *this;
+  if(!next.steps.isEmpty())
+    next.steps.last()++;
+  return next;
+}
+
+/*
+ * Description: Returns the path of the entry before this one, in the same run
+ *              or option set. If this is the first, the parent is returned.
+ *
+ * Inputs: none
+ * Output: EditorConvoPath - the previous path. Empty if none
+ */
+EditorConvoPath EditorConvoPath::getPrevious() const
+{
+  EditorConvoPath previous = *this;
+  if(!previous.steps.isEmpty())
+  {
+    if(previous.steps.last() > 1)
+      previous.steps.last()--;
+    else
+      previous.steps.removeLast();
+  }
+  return previous;
+}
+
+/*
+ * Description: Returns the base index steps of the path.
+ *
+ * Inputs: none
+ * Output: QVector<int> - the steps
+ */
+QVector<int> EditorConvoPath::getSteps() const
+{
+  return steps;
+}
+
+/*
+ * Description: Returns if the path is empty.
+ *
+ * Inputs: none
+ * Output: bool - true if empty
+ */
+bool EditorConvoPath::isEmpty() const
+{
+  return steps.isEmpty();
+}
+
+/*
+ * Description: Returns if the path is to an option, which is any path that
+ *              ends on an even step.
+ *
+ * Inputs: none
+ * Output: bool - true if an option
+ */
+bool EditorConvoPath::isOption() const
+{
+  return (!steps.isEmpty() && steps.size() % 2 == 0);
+}
+
+/*
+ * Description: Returns if the path is to the first entry of the conversation.
+ *
+ * Inputs: none
+ * Output: bool - true if the start
+ */
+bool EditorConvoPath::isStart() const
+{
+  return (steps.size() == 1 && steps.front() == 1);
+}
+
+/*
+ * Description: Returns the last step of the path.
+ *
+ * Inputs: none
+ * Output: int - the last step. 0 if empty
+ */
+int EditorConvoPath::last() const
+{
+  if(steps.isEmpty())
+    return 0;
+  return steps.last();
+}
+
+/*============================================================================
+ * OPERATOR FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Equality operator. Paths are equal if the steps are.
+ *
+ * Inputs: const EditorConvoPath &other - the path to compare to
+ * Output: bool - true if equal
+ */
+bool EditorConvoPath::operator==(const EditorConvoPath &other) const
+{
+  return steps == other.steps;
+}
+
+/*
+ * Description: Inequality operator.
+ *
+ * Inputs: const EditorConvoPath &other - the path to compare to
+ * Output: bool - true if not equal
+ */
+bool EditorConvoPath::operator!=(const EditorConvoPath &other) const
+{
+  return steps != other.steps;
+}
+
+/*
+ * Description: Hash function for the path, over the steps.
+ *
+ * Inputs: const EditorConvoPath &path - the path to hash
+ *         uint seed - the hash seed
+ * Output: uint - the hash
+ */
+uint qHash(const EditorConvoPath &path, uint seed)
+{
+  QVector<int> steps = path.getSteps();
+  return qHashRange(steps.constBegin(), steps.constEnd(), seed);
+}
@@ -75,38 +75,6 @@ EditorEvent::~EditorEvent()
  * PRIVATE FUNCTIONS
  *===========================================================================*/
 
-/*
- * Description: Converts the compressed conversation index ("4.5.4")
- *              to the standard, expanded conversation index, as required by the
- *              {@link Conversation} class ("1.1.1.1.5.1.1.1.1")
- *
- * Inputs: QString index - the base simplified index
- * Output: ConversationEntryIndex - the entry index, used to access within the conversation tree
- */
-core::ConversationEntryIndex EditorEvent::convertConversationIndex(QString index)
-{
-  QStringList index_split = index.split('.');
-  QStringList expanded_index;
-
-  for(int i = 0; i < index_split.size(); i++)
-  {
-    // Every odd index should be expanded into '1's.
-    if(i % 2 == 0)
-    {
-      int one_count = index_split.at(i).toInt();
-      for(int one_index = 0; one_index < one_count; one_index++)
-        expanded_index.append("1");
-    }
-    // Every even index is an option and should be kept unchanged
-    else
-    {
-      expanded_index.append(index_split.at(i));
-    }
-  }
-
-  return core::ConversationEntryIndex(expanded_index.join(".").toStdString());
-}
-
 /*
  * Description: The copy function that is called by any copying methods in the
  *              class. Utilized by the copy constructor and the copy operator.
@@ -175,40 +143,50 @@ void EditorEvent::updateUnlockEvent(core::EventUnlock* event, bool view, bool vi
  *===========================================================================*/
 
 /*
- * Description: Deletes the conversation at the given reference index. All sub
- *              nodes under the parent node index are also deleted. Note this
+ * Description: Deletes the conversation at the given reference path. All sub
+ *              nodes under the parent node path are also deleted. Note this
  *              call will only execute if the current event is CONVO.
  *
- * Inputs: QString index - the index to the conversation node
+ * Inputs: const EditorConvoPath &path - the path to the conversation node
  * Output: none
  */
-void EditorEvent::deleteConversation(QString index)
+void EditorEvent::deleteConversation(const EditorConvoPath &path)
 {
-  if(getEventType() == core::EventType::CONVERSATION)
+  if(getEventType() == core::EventType::CONVERSATION && !path.isEmpty())
   {
     core::EventConversation* conversation_event = static_cast<core::EventConversation*>(event);
 
-    core::ConversationEntryIndex entry_index = convertConversationIndex(index);
-    conversation_event->getConversation().deleteEntry(entry_index);
+    convo_cache.clear();
+    conversation_event->getConversation().deleteEntry(path.getEntryIndex());
   }
 }
 
 /*
- * Description: Returns the conversation entry reference to the node of the index.
+ * Description: Returns the conversation entry reference to the node of the
+ *              path. Resolved entries are cached by path, so the expanded
+ *              entry index is only built on the first lookup after a change.
  *
- * Inputs: QString index - the node reference index
+ * Inputs: const EditorConvoPath &path - the node reference path
  * Output: ConversationEntry* - the returned conversation entry. NULL if not found or
  *                              not in conversation
  */
-core::ConversationEntry* EditorEvent::getConversation(QString index)
+core::ConversationEntry* EditorEvent::getConversation(const EditorConvoPath &path)
 {
-  if(getEventType() == core::EventType::CONVERSATION)
+  if(getEventType() == core::EventType::CONVERSATION && !path.isEmpty())
   {
-    core::EventConversation* conversation_event = static_cast<core::EventConversation*>(event);
-
-    core::ConversationEntryIndex entry_index = convertConversationIndex(index);
-    if(conversation_event->getConversation().hasEntry(entry_index))
-      return &conversation_event->getConversation().getEntry(entry_index);
+    core::ConversationEntry* entry = convo_cache.value(path, nullptr);
+    if(entry == nullptr)
+    {
+      core::EventConversation* conversation_event = static_cast<core::EventConversation*>(event);
+
+      core::ConversationEntryIndex entry_index = path.getEntryIndex();
+      if(conversation_event->getConversation().hasEntry(entry_index))
+      {
+        entry = &conversation_event->getConversation().getEntry(entry_index);
+        convo_cache.insert(path, entry);
+      }
+    }
+    return entry;
   }
   return nullptr;
 }
@@ -1038,18 +1016,19 @@ int EditorEvent::getUnlockViewTime()
  *              passed into the method. If there are tree gaps along the way, it creates
  *              blanks along the way.
  *
- * Inputs: QString index - the index reference node for where to insert
+ * Inputs: const EditorConvoPath &path - the reference path for where to insert
  *         ConversationEntry entry - the inserting conversation tree node
  * Output: bool - true if the conversation tree was modified and the entry was inserted
  */
-bool EditorEvent::insertConversation(QString index, core::ConversationEntry& entry)
+bool EditorEvent::insertConversation(const EditorConvoPath &path,
+                                     core::ConversationEntry& entry)
 {
-  if(getEventType() == core::EventType::CONVERSATION)
+  if(getEventType() == core::EventType::CONVERSATION && !path.isEmpty())
   {
     core::EventConversation* conversation_event = static_cast<core::EventConversation*>(event);
 
-    core::ConversationEntryIndex entry_index = convertConversationIndex(index);
-    conversation_event->getConversation().insertEntry(entry_index, entry);
+    convo_cache.clear();
+    conversation_event->getConversation().insertEntry(path.getEntryIndex(), entry);
     return true;
   }
   return false;
@@ -1072,12 +1051,13 @@ bool EditorEvent::isOneShot()
  * Description: Loads the event data from the XML struct and offset index. Uses
  *              existing functions in game EventHandler class.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorEvent::load(core::XmlData data, int index)
+void EditorEvent::load(core::XmlData &data, int index)
 {
+  convo_cache.clear();
   event = core::PersistEvent::load(event, data, index);
 }
 
@@ -1108,18 +1088,19 @@ void EditorEvent::save(core::XmlWriter* writer, QString wrapper, bool write_wrap
  *              all the data in that node only. If the index doesn't exist,
  *              it creates it plus all the nodes on the way there.
  *
- * Inputs: QString index - the reference conversation node to change info
- *         Conversation convo - new node information to place in index
+ * Inputs: const EditorConvoPath &path - the reference conversation node to change info
+ *         Conversation convo - new node information to place in path
  * Output: bool - true if the conversation tree was modified and the entry was set
  */
-bool EditorEvent::setConversation(QString index, core::ConversationEntry& entry)
+bool EditorEvent::setConversation(const EditorConvoPath &path,
+                                  core::ConversationEntry& entry)
 {
-  if(getEventType() == core::EventType::CONVERSATION)
+  if(getEventType() == core::EventType::CONVERSATION && !path.isEmpty())
   {
     core::EventConversation* conversation_event = static_cast<core::EventConversation*>(event);
 
-    core::ConversationEntryIndex entry_index = convertConversationIndex(index);
-    conversation_event->getConversation().setEntry(entry_index, entry);
+    convo_cache.clear();
+    conversation_event->getConversation().setEntry(path.getEntryIndex(), entry);
     return true;
   }
   return false;
@@ -1149,6 +1130,7 @@ void EditorEvent::setEvent(core::Event* event)
  */
 void EditorEvent::setEventBlank(bool delete_event)
 {
+  convo_cache.clear();
   if(delete_event)
     delete event;
   event = nullptr;
@@ -1843,26 +1825,16 @@ QString EditorEvent::classToText(core::EventType classification, QString prefix,
 }
 
 /*
- * Description: Checks if the passed in base index (4.5.4 format) and how many
- *              children the item has and returns if it could become an option.
+ * Description: Checks if the passed in path and how many children the item
+ *              has and returns if it could become an option.
  *
- * Inputs: QString base_index - the base index (non-simplified form)
+ * Inputs: const EditorConvoPath &path - the path to the conversation node
  *         int child_count - the number of children the index has
  * Output: bool - true if it could be an option
  */
-bool EditorEvent::couldBeOption(QString base_index, int child_count)
+bool EditorEvent::couldBeOption(const EditorConvoPath &path, int child_count)
 {
-  if(!base_index.isEmpty())
-  {
-    /* Only valid if not an option */
-    QStringList list = base_index.split('.');
-    if(list.size() % 2 == 1)
-    {
-      /* Only valid if not the first in the stack */
-      if(list.last() != "1" && child_count <= 1)
-        return true;
-    }
-  }
-
-  return false;
+  /* Only valid if not an option and not the first in the stack */
+  return (!path.isEmpty() && !path.isOption() && path.last() != 1 &&
+          child_count <= 1);
 }
@@ -249,46 +249,49 @@ bool EditorEventSet::isEmpty() const
  * Description: Loads the event set data from the XML struct and offset index.
  *              Uses existing functions in game EventSet class.
  *
- * Inputs: core::XmlData data - the XML data tree struct
+ * Inputs: core::XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorEventSet::load(core::XmlData data, int index)
+void EditorEventSet::load(core::XmlData &data, int index)
 {
-  QString element = QString::fromStdString(data.getElement(index));
-
   /* Parse elements */
-  if(element == kKEY_EVENT_LOCK)
-  {
-    event_locked.load(data, index + 1);
-  }
-  else if(element == kKEY_EVENT_UNLOCK)
+  switch(EditorHelpers::getXmlTag(data.getElement(index)))
   {
-    QString key = QString::fromStdString(data.getKey(index));
-    int unlock_index = std::stoi(data.getKeyValue(index));
-    if(key == kKEY_EVENT_UNLOCK_ID && unlock_index >= 0)
+    case EditorEnumDb::XML_LOCKEVENT:
+      event_locked.load(data, index + 1);
+      break;
+    case EditorEnumDb::XML_UNLOCKEVENT:
     {
-      while(unlock_index >= events_unlocked.size())
-        events_unlocked.append(new EditorEvent());
-      getEventUnlocked(index)->load(data, index + 1);
+      QString key = QString::fromStdString(data.getKey(index));
+      int unlock_index = std::stoi(data.getKeyValue(index));
+      if(key == kKEY_EVENT_UNLOCK_ID && unlock_index >= 0)
+      {
+        while(unlock_index >= events_unlocked.size())
+          events_unlocked.append(new EditorEvent());
+        getEventUnlocked(index)->load(data, index + 1);
+      }
+      break;
     }
-  }
-  else if(element == kKEY_EVENT_UNLOCK_ACCESS)
-  {
-    QString access_str = QString::fromStdString(data.getDataStringOrThrow());
-
-    if(access_str == kKEY_ACCESS_NONE)
-      unlocked_access = core::AccessOperation::NONE;
-    else if(access_str == kKEY_ACCESS_SEQUENTIAL)
-      unlocked_access = core::AccessOperation::SEQUENTIAL;
-    else if(access_str == kKEY_ACCESS_RANDOM)
-      unlocked_access = core::AccessOperation::RANDOM;
-    else
-      throw std::domain_error("Access operation mapping for load event set is not defined");
-  }
-  else if(element == kKEY_LOCK)
-  {
-    lock_data.load(data, index + 1);
+    case EditorEnumDb::XML_UNLOCKPARSE:
+    {
+      QString access_str = QString::fromStdString(data.getDataStringOrThrow());
+
+      if(access_str == kKEY_ACCESS_NONE)
+        unlocked_access = core::AccessOperation::NONE;
+      else if(access_str == kKEY_ACCESS_SEQUENTIAL)
+        unlocked_access = core::AccessOperation::SEQUENTIAL;
+      else if(access_str == kKEY_ACCESS_RANDOM)
+        unlocked_access = core::AccessOperation::RANDOM;
+      else
+        throw std::domain_error("Access operation mapping for load event set is not defined");
+      break;
+    }
+    case EditorEnumDb::XML_LOCK:
+      lock_data.load(data, index + 1);
+      break;
+    default:
+      break;
   }
 }
 
@@ -0,0 +1,187 @@
+/*******************************************************************************
+ * Class Name: EditorImageScan
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Finds image files with identical pixels, so the references to
+ *              them can be remapped to one canonical file. The images are
+ *              decoded and hashed on the thread pool, apart from the image
+ *              store, so a scan of the whole sprite tree does not fill it.
+ ******************************************************************************/
+#include "Database/EditorImageScan.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorImageScan::kPROGRESS_DELAY = 500;
+
+/*============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the hash of the decoded pixels of the image file. The
+ *              pixels are hashed in one format with the size, so files that
+ *              are encoded differently but show the same image match. Safe to
+ *              call from the decode threads.
+ *
+ * Inputs: const QString &path - the image file path
+ * Output: QByteArray - the pixel hash. Empty if it fails to decode
+ */
+QByteArray EditorImageScan::hashImage(const QString &path)
+{
+  QImage image(path);
+  if(image.isNull())
+    return QByteArray();
+  if(image.format() != QImage::Format_ARGB32)
+    image = image.convertToFormat(QImage::Format_ARGB32);
+
+  QCryptographicHash hash(QCryptographicHash::Sha1);
+  qint32 size[2] = {image.width(), image.height()};
+  hash.addData(reinterpret_cast<const char*>(size), sizeof(size));
+  for(int y = 0; y < image.height(); y++)
+    hash.addData(reinterpret_cast<const char*>(image.constScanLine(y)),
+                 image.width() * 4);
+
+  return hash.result();
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the groups of image files with identical pixels. The
+ *              files are hashed concurrently on the global thread pool, with
+ *              a cancellable progress dialog shown if it runs longer than
+ *              kPROGRESS_DELAY. The first file of each group is the canonical
+ *              one: the most referenced, then the shortest path.
+ *
+ * Inputs: QStringList paths - the image files to scan. Missing files skipped
+ *         QStringList referenced - the file of each reference in the project
+ *         QWidget* parent - the parent of the progress dialog
+ *         bool* cancelled - set true if the scan was cancelled
+ * Output: QList<QStringList> - the duplicate groups, canonical file first
+ */
+QList<QStringList> EditorImageScan::findDuplicates(QStringList paths,
+                                                   QStringList referenced,
+                                                   QWidget* parent,
+                                                   bool* cancelled)
+{
+  QList<QStringList> groups;
+  if(cancelled != nullptr)
+    *cancelled = false;
+
+  /* Only scan each existing file once */
+  QStringList files;
+  for(int i = 0; i < paths.size(); i++)
+    paths[i] = QDir::toNativeSeparators(
+                                 EditorImageStore::splitRegionPath(paths[i]));
+  paths.removeDuplicates();
+  for(int i = 0; i < paths.size(); i++)
+    if(QFileInfo(paths[i]).isFile())
+      files.push_back(paths[i]);
+  if(files.size() < 2)
+    return groups;
+
+  /* Hash on the thread pool, with progress shown after the delay */
+  QProgressDialog dialog("Scanning images...", "Cancel", 0, files.size(),
+                         parent);
+  dialog.setWindowModality(Qt::WindowModal);
+  dialog.setMinimumDuration(kPROGRESS_DELAY);
+  dialog.setValue(0);
+
+  QEventLoop loop;
+  QFutureWatcher<QByteArray> watcher;
+  QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+  QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
+                   &dialog, SLOT(setValue(int)));
+  QObject::connect(&dialog, SIGNAL(canceled()), &watcher, SLOT(cancel()));
+  watcher.setFuture(QtConcurrent::mapped(files, &EditorImageScan::hashImage));
+  loop.exec();
+  watcher.waitForFinished();
+  if(watcher.isCanceled())
+  {
+    if(cancelled != nullptr)
+      *cancelled = true;
+    return groups;
+  }
+
+  /* Group the files by hash */
+  QHash<QByteArray, QStringList> hashes;
+  for(int i = 0; i < files.size(); i++)
+  {
+    QByteArray hash = watcher.resultAt(i);
+    if(!hash.isEmpty())
+      hashes[hash].push_back(files[i]);
+  }
+
+  /* Count the references to each file */
+  QHash<QString, int> uses;
+  for(int i = 0; i < referenced.size(); i++)
+    uses[QDir::toNativeSeparators(
+                   EditorImageStore::splitRegionPath(referenced[i]))]++;
+
+  /* Order each group with the canonical file first */
+  for(auto it = hashes.begin(); it != hashes.end(); it++)
+  {
+    if(it.value().size() > 1)
+    {
+      QStringList group = it.value();
+      std::sort(group.begin(), group.end(),
+                [&uses](const QString &a, const QString &b)
+      {
+        if(uses.value(a) != uses.value(b))
+          return uses.value(a) > uses.value(b);
+        if(a.size() != b.size())
+          return a.size() < b.size();
+        return a < b;
+      });
+      groups.push_back(group);
+    }
+  }
+  std::sort(groups.begin(), groups.end(),
+            [](const QStringList &a, const QStringList &b)
+  {
+    return a.first() < b.first();
+  });
+
+  return groups;
+}
+
+/*
+ * Description: Returns all the image (png) files under the directory and its
+ *              sub-directories, with native separators.
+ *
+ * Inputs: QString dir - the directory to search
+ * Output: QStringList - the image file paths
+ */
+QStringList EditorImageScan::getImageFiles(QString dir)
+{
+  QStringList files;
+
+  QDirIterator it(dir, QStringList() << "*.png", QDir::Files,
+                  QDirIterator::Subdirectories);
+  while(it.hasNext())
+    files.push_back(QDir::toNativeSeparators(it.next()));
+
+  return files;
+}
+
+/*
+ * Description: Returns the remap of the duplicate groups: every file that is
+ *              not canonical (first in its group) to the canonical file. Both
+ *              are stored with '/' separators, so look ups must convert the
+ *              path with QDir::fromNativeSeparators() first.
+ *
+ * Inputs: QList<QStringList> groups - the duplicate groups, canonical first
+ * Output: QHash<QString,QString> - the canonical file, by duplicate file
+ */
+QHash<QString,QString> EditorImageScan::getRemap(QList<QStringList> groups)
+{
+  QHash<QString,QString> remap;
+
+  for(int i = 0; i < groups.size(); i++)
+    for(int j = 1; j < groups[i].size(); j++)
+      remap.insert(QDir::fromNativeSeparators(groups[i][j]),
+                   QDir::fromNativeSeparators(groups[i].first()));
+
+  return remap;
+}
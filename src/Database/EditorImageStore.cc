@@ -0,0 +1,585 @@
+/*******************************************************************************
+ * Class Name: EditorImageStore
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Shared store of the decoded sprite frame images, by file path.
+ *              Sprites that use the same file share the one image, and sets of
+ *              files (such as a matrix import or a project load) can be
+ *              decoded up front on the thread pool, so the sprites are only
+ *              attached on the GUI thread. Region paths ("file#x,y,w,h")
+ *              reference a cell of a sprite sheet, sharing the sheet pixels.
+ *              Region paths are editor only: game exports write each region
+ *              out as its own image file and save that path (see
+ *              saveRegion()). Editor saves keep the region paths.
+ ******************************************************************************/
+#include "Database/EditorImageStore.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorImageStore::kCACHE_KB = 256 * 1024;
+const int EditorImageStore::kPROGRESS_DELAY = 500;
+const QChar EditorImageStore::kREGION_SEPARATOR = '#';
+
+/* Static Implementation */
+EditorImageStore* EditorImageStore::shared_store = nullptr;
+
+/*============================================================================
+ * INPUT BLOCK
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. Blocks user input to the application,
+ *              except to the allowed widget, until destroyed.
+ *
+ * Inputs: QWidget* allowed - the widget still given input. Null for none
+ */
+EditorInputBlock::EditorInputBlock(QWidget* allowed)
+{
+  this->allowed = allowed;
+  QCoreApplication::instance()->installEventFilter(this);
+}
+
+/*
+ * Description: Destructor function. Input is no longer blocked.
+ */
+EditorInputBlock::~EditorInputBlock()
+{
+  QCoreApplication::instance()->removeEventFilter(this);
+}
+
+/*
+ * Description: Filters the user input events sent to any widget other than
+ *              the allowed one and its children.
+ *
+ * Inputs: QObject* watched - the receiver of the event
+ *         QEvent* event - the event
+ * Output: bool - true if the event is blocked
+ */
+bool EditorInputBlock::eventFilter(QObject* watched, QEvent* event)
+{
+  switch(event->type())
+  {
+    case QEvent::ContextMenu:
+    case QEvent::Drop:
+    case QEvent::KeyPress:
+    case QEvent::KeyRelease:
+    case QEvent::MouseButtonDblClick:
+    case QEvent::MouseButtonPress:
+    case QEvent::MouseButtonRelease:
+    case QEvent::Shortcut:
+    case QEvent::ShortcutOverride:
+    case QEvent::Wheel:
+    {
+      QWidget* widget = qobject_cast<QWidget*>(watched);
+      if(allowed != nullptr && widget != nullptr &&
+         (widget == allowed || allowed->isAncestorOf(widget)))
+        return false;
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The store is empty.
+ *
+ * Inputs: none
+ */
+EditorImageStore::EditorImageStore()
+{
+  deferring = false;
+  images.setMaxCost(kCACHE_KB);
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorImageStore::~EditorImageStore()
+{
+  clear();
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Decodes the paths concurrently on the global thread pool, so
+ *              it scales with the core count. The calling thread waits in a
+ *              local event loop, updating the dialog, so the interface stays
+ *              responsive. User input, except to the dialog, is blocked from
+ *              the start, since the dialog only shows (and turns modal) after
+ *              kPROGRESS_DELAY and the input could re-enter the caller.
+ *
+ * Inputs: QStringList paths - the image file paths, all to be decoded
+ *         QProgressDialog* dialog - the progress dialog, set to the path count
+ *         bool pin - true to pin the images, so the cache cannot evict them
+ * Output: bool - true if all were decoded. false if cancelled
+ */
+bool EditorImageStore::decodeAll(QStringList paths, QProgressDialog* dialog,
+                                 bool pin)
+{
+  QEventLoop loop;
+  QFutureWatcher<void> watcher;
+  QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+  if(dialog != nullptr)
+  {
+    QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
+                     dialog, SLOT(setValue(int)));
+    QObject::connect(dialog, SIGNAL(canceled()), &watcher, SLOT(cancel()));
+  }
+  watcher.setFuture(QtConcurrent::map(paths, [this, pin](const QString &path)
+  {
+    loadImage(path, pin);
+  }));
+
+  {
+    EditorInputBlock block(dialog);
+    loop.exec();
+  }
+  watcher.waitForFinished();
+  if(dialog != nullptr)
+    QObject::disconnect(dialog, nullptr, &watcher, nullptr);
+  return !watcher.isCanceled();
+}
+
+/*
+ * Description: Returns the stored image of the path, if it was decoded from
+ *              the file as it is on disk now. Pinned images are checked first.
+ *
+ * Inputs: const QString &path - the image file path
+ *         const QDateTime &modified - the modified time of the file now
+ * Output: QImage - the stored image. Null if missing or stale
+ */
+QImage EditorImageStore::findImage(const QString &path,
+                                   const QDateTime &modified) const
+{
+  QMutexLocker locker(&images_lock);
+  auto it = pinned.constFind(path);
+  if(it != pinned.constEnd() && it.value().modified == modified)
+    return it.value().image;
+  EditorImageEntry* entry = images.object(path);
+  if(entry != nullptr && entry->modified == modified)
+    return entry->image;
+  return QImage();
+}
+
+/*
+ * Description: Returns a view of the region of the sheet. The view references
+ *              the sheet pixels in place (no copy) and holds a reference to the
+ *              sheet until it is released, so all the cells of a sheet share
+ *              the one decoded image. Writing to the view detaches it.
+ *
+ * Inputs: const QImage &sheet - the decoded sheet
+ *         QRect rect - the region in the sheet. Clipped to the sheet
+ * Output: QImage - the region view. Null if the region is outside the sheet
+ */
+QImage EditorImageStore::getRegion(const QImage &sheet, QRect rect)
+{
+  rect = rect.intersected(sheet.rect());
+  if(sheet.isNull() || rect.isEmpty())
+    return QImage();
+
+  /* Pixel offsets only stay aligned for 32 bit images, which all loads are */
+  if(sheet.depth() != 32)
+    return sheet.copy(rect);
+
+  const uchar* data = sheet.constBits() + rect.y() * sheet.bytesPerLine() +
+                      rect.x() * 4;
+  return QImage(data, rect.width(), rect.height(), sheet.bytesPerLine(),
+                sheet.format(), releaseRegion, new QImage(sheet));
+}
+
+/*
+ * Description: Decodes the image of the path and stores it. Safe to call from
+ *              the decode threads; only the store is locked, not the decode.
+ *              Images are stored in 32 bit, so sheet regions can reference
+ *              the pixels in place. A pinned image is also held outside the
+ *              cache, so a large set cannot evict itself before it is used.
+ *
+ * Inputs: const QString &path - the image file path
+ *         bool pin - true to pin the image until releasePinned()
+ * Output: QImage - the decoded image. Null if it failed
+ */
+QImage EditorImageStore::loadImage(const QString &path, bool pin)
+{
+  QFileInfo file_info(path);
+  QImage image(path);
+
+  if(!image.isNull())
+  {
+    if(image.depth() != 32)
+      image = image.convertToFormat(image.hasAlphaChannel() ?
+                                    QImage::Format_ARGB32 :
+                                    QImage::Format_RGB32);
+
+    EditorImageEntry* entry = new EditorImageEntry;
+    entry->image = image;
+    entry->modified = file_info.lastModified();
+
+    QMutexLocker locker(&images_lock);
+    if(pin)
+      pinned.insert(path, *entry);
+    images.insert(path, entry, qMax(1, (int)(image.sizeInBytes() / 1024)));
+  }
+
+  return image;
+}
+
+/*
+ * Description: Releases the copy of the sheet held by a region view. Called
+ *              by QImage when the last reference to the view is dropped.
+ *
+ * Inputs: void* sheet - the held sheet image
+ * Output: none
+ */
+void EditorImageStore::releaseRegion(void* sheet)
+{
+  delete static_cast<QImage*>(sheet);
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Starts deferring images. Until endDeferred(), getImage() calls
+ *              that accept a pending result only record the paths not stored,
+ *              instead of decoding them one at a time.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorImageStore::beginDeferred()
+{
+  deferring = true;
+}
+
+/*
+ * Description: Clears all stored images. Sprites keep their own copies.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorImageStore::clear()
+{
+  QMutexLocker locker(&images_lock);
+  images.clear();
+  pinned.clear();
+}
+
+/*
+ * Description: Stops deferring and decodes all the deferred paths not stored,
+ *              concurrently. The decoded images are pinned outside the cache,
+ *              so none are evicted before the sprites that deferred them are
+ *              attached; call releasePinned() after. The dialog, if set, is
+ *              borrowed to show the decode progress and then restored to its
+ *              prior label, range and value.
+ *
+ * Inputs: QProgressDialog* dialog - the existing progress dialog
+ * Output: bool - true if all were decoded. false if cancelled
+ */
+bool EditorImageStore::endDeferred(QProgressDialog* dialog)
+{
+  QStringList paths;
+  for(auto it = deferred.constBegin(); it != deferred.constEnd(); it++)
+  {
+    QFileInfo file_info(*it);
+    if(file_info.exists() &&
+       findImage(*it, file_info.lastModified()).isNull())
+      paths.push_back(*it);
+  }
+  deferred.clear();
+  deferring = false;
+
+  if(paths.isEmpty())
+    return true;
+
+  /* Borrow the dialog for the decode */
+  bool auto_reset = true;
+  QString label;
+  int maximum = 0;
+  int minimum = 0;
+  int value = 0;
+  if(dialog != nullptr)
+  {
+    label = dialog->labelText();
+    maximum = dialog->maximum();
+    minimum = dialog->minimum();
+    value = dialog->value();
+    auto_reset = dialog->autoReset();
+
+    dialog->setAutoReset(false);
+    dialog->setLabelText("Decoding Images...");
+    dialog->setRange(0, paths.size());
+    dialog->setValue(0);
+  }
+
+  bool success = decodeAll(paths, dialog, true);
+
+  /* Restore the dialog */
+  if(dialog != nullptr)
+  {
+    dialog->setLabelText(label);
+    dialog->setRange(minimum, maximum);
+    dialog->setValue(value);
+    dialog->setAutoReset(auto_reset);
+  }
+
+  return success;
+}
+
+/*
+ * Description: Returns the image of the path (stored by native separators).
+ *              If not stored, or the file has changed since, it is decoded now
+ *              and stored. While deferred, callers that pass pending only get
+ *              the path recorded and are expected to call again after
+ *              endDeferred(). Region paths store and defer the sheet file, and
+ *              return a view of the region in it.
+ *
+ * Inputs: QString path - the image file path
+ *         bool* pending - set true if deferred. Null to never defer
+ * Output: QImage - the image. Null if the path is empty, fails to decode or
+ *                  is pending
+ */
+QImage EditorImageStore::getImage(QString path, bool* pending)
+{
+  if(pending != nullptr)
+    *pending = false;
+  if(path.isEmpty())
+    return QImage();
+  QRect rect;
+  bool region = isRegionPath(path);
+  path = QDir::toNativeSeparators(splitRegionPath(path, &rect));
+
+  QImage image = findImage(path, QFileInfo(path).lastModified());
+  if(image.isNull())
+  {
+    if(deferring && pending != nullptr)
+    {
+      deferred.insert(path);
+      *pending = true;
+    }
+    else
+    {
+      image = loadImage(path);
+    }
+  }
+
+  if(region)
+    return getRegion(image, rect);
+  return image;
+}
+
+/*
+ * Description: Decodes all the paths not already stored, concurrently on the
+ *              global thread pool. A progress dialog with cancel is shown if
+ *              the decode runs longer than kPROGRESS_DELAY. While deferred, the
+ *              paths are only recorded for endDeferred(). Region paths decode
+ *              their sheet file, once for all the regions in it.
+ *
+ * Inputs: QStringList paths - the image file paths
+ *         QWidget* parent - the parent of the progress dialog
+ *         QString label - the progress dialog label
+ * Output: bool - true if all were decoded. false if cancelled
+ */
+bool EditorImageStore::loadImages(QStringList paths, QWidget* parent,
+                                  QString label)
+{
+  /* Only decode the paths not stored */
+  for(int i = 0; i < paths.size(); i++)
+    paths[i] = QDir::toNativeSeparators(splitRegionPath(paths[i]));
+  paths.removeDuplicates();
+  QStringList missing;
+  for(int i = 0; i < paths.size(); i++)
+  {
+    QFileInfo file_info(paths[i]);
+    if(file_info.exists() &&
+       findImage(paths[i], file_info.lastModified()).isNull())
+      missing.push_back(paths[i]);
+  }
+
+  if(missing.isEmpty())
+    return true;
+
+  /* While deferred, the paths join the one decode at the end */
+  if(deferring)
+  {
+    for(int i = 0; i < missing.size(); i++)
+      deferred.insert(missing[i]);
+    return true;
+  }
+
+  if(missing.size() == 1)
+  {
+    loadImage(missing.first());
+    return true;
+  }
+
+  /* Progress, shown after the delay */
+  QProgressDialog dialog(label, "Cancel", 0, missing.size(), parent);
+  dialog.setWindowModality(Qt::WindowModal);
+  dialog.setMinimumDuration(kPROGRESS_DELAY);
+  dialog.setValue(0);
+
+  return decodeAll(missing, &dialog);
+}
+
+/*
+ * Description: Releases the images pinned by endDeferred(). They stay in the
+ *              cache, which can evict them from then on.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorImageStore::releasePinned()
+{
+  QMutexLocker locker(&images_lock);
+  pinned.clear();
+}
+
+/*
+ * Description: Writes the region of a sheet out as its own image file, next
+ *              to the sheet, so game exports only reference files the game
+ *              can open. The file is only rewritten if the sheet changed
+ *              since. Paths that are not regions are returned as is. Regions
+ *              that cannot be written are kept for takeFailedRegions().
+ *
+ * Inputs: QString path - the image path
+ *         QString* file - set to the path of the region file. Set to the
+ *                         unchanged path if it could not be written
+ * Output: bool - true if the path is not a region or the region was written
+ */
+bool EditorImageStore::saveRegion(QString path, QString* file)
+{
+  QRect rect;
+  QString sheet = QDir::toNativeSeparators(splitRegionPath(path, &rect));
+  if(file != nullptr)
+    *file = path;
+  if(rect.isNull())
+    return true;
+
+  QFileInfo sheet_info(sheet);
+  QString cell = sheet_info.path() + QDir::separator() +
+                 sheet_info.completeBaseName() + "-cell-" +
+                 QString::number(rect.x()) + "-" + QString::number(rect.y()) +
+                 "-" + QString::number(rect.width()) + "-" +
+                 QString::number(rect.height()) + ".png";
+
+  QFileInfo cell_info(cell);
+  if(!cell_info.exists() ||
+     cell_info.lastModified() < sheet_info.lastModified())
+  {
+    QImage image = getImage(path);
+    if(image.isNull() || !image.save(cell, "PNG"))
+    {
+      if(!failed_regions.contains(path))
+        failed_regions.push_back(path);
+      return false;
+    }
+  }
+
+  if(file != nullptr)
+    *file = cell;
+  return true;
+}
+
+/*
+ * Description: Returns the regions that saveRegion() could not write out since
+ *              the last call, and clears them. Used to report them after an
+ *              export.
+ *
+ * Inputs: none
+ * Output: QStringList - the region paths that failed
+ */
+QStringList EditorImageStore::takeFailedRegions()
+{
+  QStringList failed = failed_regions;
+  failed_regions.clear();
+  return failed;
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the region path of the rect in the sheet file, in the
+ *              form "file#x,y,w,h". Sprites store it as their frame path.
+ *
+ * Inputs: QString path - the sheet file path
+ *         QRect rect - the region in the sheet
+ * Output: QString - the region path
+ */
+QString EditorImageStore::getRegionPath(QString path, QRect rect)
+{
+  return splitRegionPath(path) + kREGION_SEPARATOR +
+         QString::number(rect.x()) + "," + QString::number(rect.y()) + "," +
+         QString::number(rect.width()) + "," + QString::number(rect.height());
+}
+
+/*
+ * Description: Returns the shared store. Created on the first call and kept
+ *              for the life of the application.
+ *
+ * Inputs: none
+ * Output: EditorImageStore* - the shared store
+ */
+EditorImageStore* EditorImageStore::getShared()
+{
+  if(shared_store == nullptr)
+    shared_store = new EditorImageStore();
+  return shared_store;
+}
+
+/*
+ * Description: Returns if the path references a region of a sheet file.
+ *
+ * Inputs: QString path - the image path
+ * Output: bool - true if a region path
+ */
+bool EditorImageStore::isRegionPath(QString path)
+{
+  QRect rect;
+  splitRegionPath(path, &rect);
+  return !rect.isNull();
+}
+
+/*
+ * Description: Splits a region path into the sheet file and the region. Paths
+ *              without a valid region suffix are returned as is.
+ *
+ * Inputs: QString path - the image path
+ *         QRect* rect - set to the region. Null rect if not a region path
+ * Output: QString - the sheet file path
+ */
+QString EditorImageStore::splitRegionPath(QString path, QRect* rect)
+{
+  if(rect != nullptr)
+    *rect = QRect();
+
+  int index = path.lastIndexOf(kREGION_SEPARATOR);
+  if(index >= 0)
+  {
+    QStringList values = path.mid(index + 1).split(",");
+    if(values.size() == 4)
+    {
+      bool ok[4];
+      QRect region(values[0].toInt(&ok[0]), values[1].toInt(&ok[1]),
+                   values[2].toInt(&ok[2]), values[3].toInt(&ok[3]));
+      if(ok[0] && ok[1] && ok[2] && ok[3] && !region.isEmpty())
+      {
+        if(rect != nullptr)
+          *rect = region;
+        return path.left(index);
+      }
+    }
+  }
+  return path;
+}
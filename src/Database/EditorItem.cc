@@ -33,9 +33,8 @@ EditorItem::EditorItem(QWidget *parent) : QWidget(parent)
   if(sprite_thumb_base.frameCount() == 0)
     sprite_thumb_base.setPath(0, "");
 
-  /* Layout */
-  createLayout();
-  loadWorkingInfo();
+  /* Layout - created on the first show */
+  layout_created = false;
 }
 
 /*
@@ -375,6 +374,18 @@ void EditorItem::createLayout()
  */
 void EditorItem::loadWorkingInfo()
 {
+  /* Check the skill is still available, with or without the widgets */
+  int skill_index = -1;
+  for(int i = 0; i < skill_total.size(); i++)
+    if(skill_total[i]->getID() == skill_id)
+      skill_index = i + 1;
+  if(skill_index < 0)
+    skill_id = -1;
+
+  /* The rest is only the widgets */
+  if(!layout_created)
+    return;
+
   /* ID */
   edit_id->setText(QString::number(id));
 
@@ -410,17 +421,10 @@ void EditorItem::loadWorkingInfo()
   combo_skill->blockSignals(true);
   combo_skill->clear();
   combo_skill->addItem("None");
-  int skill_index = -1;
   for(int i = 0; i < skill_total.size(); i++)
-  {
     combo_skill->addItem(skill_total[i]->getNameList());
-    if(skill_total[i]->getID() == skill_id)
-      skill_index = i + 1;
-  }
   if(skill_index > 0)
     combo_skill->setCurrentIndex(skill_index);
-  else
-    skill_id = -1;
   combo_skill->blockSignals(false);
 
   /* Animation and Thumbnail */
@@ -489,6 +493,26 @@ void EditorItem::loadWorkingInfo()
   updateConnected();
 }
 
+/*
+ * Description: Creates the widget layout the first time the item is shown, so
+ *              items that are never opened hold no widgets. The ID is re-set
+ *              first so the protected widgets are locked before loading.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorItem::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    setID(id);
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
+}
+
 /*
  * Description: Updates the interconnected widget enable and disable status to
  *              indicate what data can be edited by the UI interacting user.
@@ -1063,6 +1087,19 @@ int EditorItem::getID() const
   return id;
 }
 
+/*
+ * Description: Returns the image files of the saved sprites of the item, the
+ *              ones a game export writes. The working sprites of the open
+ *              editor are not included.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorItem::getImagePaths()
+{
+  return sprite_thumb_base.getPaths() + sprite_anim_base.getPaths();
+}
+
 /*
  * Description: Returns the mass of the item
  *
@@ -1099,11 +1136,11 @@ QString EditorItem::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorItem::load(XmlData data, int index)
+void EditorItem::load(XmlData &data, int index)
 {
   //bool data_change = false;
 
@@ -1159,7 +1196,8 @@ void EditorItem::resetWorking()
 
   /* Properly load the information */
   setName(QString::fromStdString(item_curr.getName()));
-  combo_buff_preset->setCurrentIndex(kMAX_PRESETS);
+  if(layout_created)
+    combo_buff_preset->setCurrentIndex(kMAX_PRESETS);
   loadWorkingInfo();
 }
 
@@ -1177,6 +1215,21 @@ void EditorItem::save(FileHandler* fh, bool game_only)
     /* Processing */
     Item blank;
 
+    /* Data in use by the category, matching the connected widgets. Those
+     * are enabled from the working item, as in updateConnected() */
+    bool consumed = item_curr.getFlag(ItemFlags::CONSUMED);
+    bool usable = !is_protected &&
+                  (consumed || (!item_curr.getFlag(ItemFlags::MATERIAL) &&
+                                !item_curr.getFlag(ItemFlags::KEY_ITEM)));
+    bool use_action = usable &&
+                      (item_curr.getOccasion() == ActionOccasion::ALWAYS ||
+                       item_curr.getOccasion() == ActionOccasion::BATTLE ||
+                       item_curr.getOccasion() == ActionOccasion::MENU);
+    bool stat_altering = !is_protected && consumed &&
+                         item_base.getFlag(ItemFlags::STAT_ALTERING);
+    bool skill_learning = usable &&
+                          item_base.getFlag(ItemFlags::SKILL_LEARNING);
+
     /* Wrapper */
     fh->writeXmlElement("item", "id", getID());
 
@@ -1209,8 +1262,10 @@ void EditorItem::save(FileHandler* fh, bool game_only)
 
     /* Thumbnail */
     if(!sprite_thumb_base.isAllNull() && sprite_thumb_base.frameCount() == 1)
-      fh->writeXmlData("thumb",
-           EditorHelpers::trimPath(sprite_thumb_base.getPath(0)).toStdString());
+    {
+      QString path = EditorAtlas::getExportPath(sprite_thumb_base.getPath(0));
+      fh->writeXmlData("thumb", EditorHelpers::trimPath(path).toStdString());
+    }
 
     /* Category */
     fh->writeXmlElement("flags");
@@ -1224,22 +1279,15 @@ void EditorItem::save(FileHandler* fh, bool game_only)
       fh->writeXmlData("no_category", true);
 
     /* Consumed and no category flags */
-    if(chk_f_statalter->isEnabled() &&
-       item_base.getFlag(ItemFlags::STAT_ALTERING) !=
-       blank.getFlag(ItemFlags::STAT_ALTERING))
-    {
+    if(stat_altering != blank.getFlag(ItemFlags::STAT_ALTERING))
       fh->writeXmlData("stat_altering", true);
-    }
-    if(chk_f_skilllearn->isEnabled() &&
-       item_base.getFlag(ItemFlags::SKILL_LEARNING) !=
-       blank.getFlag(ItemFlags::SKILL_LEARNING))
-    {
+    if(skill_learning != blank.getFlag(ItemFlags::SKILL_LEARNING))
       fh->writeXmlData("skill_learning", true);
-    }
     fh->writeXmlElementEnd();
 
     /* Use */
-    if(combo_use->isEnabled() && item_base.getOccasion() != blank.getOccasion())
+    if(usable && !item_curr.getFlag(ItemFlags::SKILL_LEARNING) &&
+       item_base.getOccasion() != blank.getOccasion())
     {
       QString state = "";
 
@@ -1256,47 +1304,46 @@ void EditorItem::save(FileHandler* fh, bool game_only)
     }
 
     /* Use Message */
-    if(edit_msg->isEnabled() &&
-       item_base.getUseMessage() != blank.getUseMessage())
+    if(use_action && item_base.getUseMessage() != blank.getUseMessage())
     {
       fh->writeXmlData("message", item_base.getUseMessage());
     }
 
     /* Skill */
-    if(combo_skill->isEnabled() && skill_id_base >= 0)
+    if(use_action && skill_id_base >= 0)
       fh->writeXmlData("skill", skill_id_base);
 
     /* Material */
-    if(box_material->isEnabled())
+    if(!is_protected && item_curr.getFlag(ItemFlags::MATERIAL))
     {
       /* Base material */
       QString mat_base = "";
-      if(radio_m_fire->isChecked())
+      if(item_base.getMaterial(Material::FIRE))
         mat_base = "fire";
-      else if(radio_m_forest->isChecked())
+      else if(item_base.getMaterial(Material::FOREST))
         mat_base = "forest";
-      else if(radio_m_ice->isChecked())
+      else if(item_base.getMaterial(Material::ICE))
         mat_base = "ice";
-      else if(radio_m_electric->isChecked())
+      else if(item_base.getMaterial(Material::ELECTRIC))
         mat_base = "electric";
-      else if(radio_m_digital->isChecked())
+      else if(item_base.getMaterial(Material::DIGITAL))
         mat_base = "digital";
-      else if(radio_m_nihil->isChecked())
+      else if(item_base.getMaterial(Material::NIHIL))
         mat_base = "void";
       else
         mat_base = "physical";
 
       /* Secondary material */
       QString mat_sec = "";
-      if(radio_m_wood->isChecked())
+      if(item_base.getMaterial(Material::WOODEN))
         mat_sec = "wooden";
-      else if(radio_m_steel->isChecked())
+      else if(item_base.getMaterial(Material::STEEL))
         mat_sec = "steel";
-      else if(radio_m_brass->isChecked())
+      else if(item_base.getMaterial(Material::BRASS))
         mat_sec = "brass";
-      else if(radio_m_titanium->isChecked())
+      else if(item_base.getMaterial(Material::TITANIUM))
         mat_sec = "titanium";
-      else if(radio_m_graphene->isChecked())
+      else if(item_base.getMaterial(Material::GRAPHENE))
         mat_sec = "graphene";
 
       /* Write to file */
@@ -1312,7 +1359,7 @@ void EditorItem::save(FileHandler* fh, bool game_only)
       sprite_anim_base.save(fh, game_only, false, "animation");
 
     /* Buff Set */
-    if(box_buff->isEnabled())
+    if(stat_altering)
       fh->writeXmlData("buff_set",
                        AttributeSet::setToStr(item_base.getStats()));
 
@@ -1352,6 +1399,7 @@ void EditorItem::saveWorking()
   /* Update the map connected data */
   if(descrip_diff || name_diff || path_diff)
     emit dataChange(getData());
+  emit dataSaved();
 }
 
 /*
@@ -1363,13 +1411,14 @@ void EditorItem::saveWorking()
 void EditorItem::setID(int id)
 {
   this->id = id;
+  is_protected = (id == (int)Item::kID_MONEY);
+  if(!layout_created)
+    return;
   edit_id->setText(QString::number(id));
 
   /* ID checks for data not allowed to be changed */
-  if(id == (int)Item::kID_MONEY)
+  if(is_protected)
   {
-    is_protected = true;
-
     box_flags->setDisabled(true);
 
     combo_tier->setDisabled(true);
@@ -1387,8 +1436,6 @@ void EditorItem::setID(int id)
   }
   else
   {
-    is_protected = false;
-
     box_flags->setEnabled(true);
 
     combo_tier->setEnabled(true);
@@ -1411,7 +1458,7 @@ void EditorItem::setID(int id)
 void EditorItem::setName(QString name, bool update)
 {
   item_curr.setName(name.toStdString());
-  if(update)
+  if(update && layout_created)
     edit_name->setText(name);
   //emit nameChange(name);
 }
@@ -0,0 +1,637 @@
+/*******************************************************************************
+ * Class Name: EditorJournal
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: Append-only binary journal of the edits made since the project
+ *              was last saved (or started). Each edit is appended as it is
+ *              made, so the work since the last save can be recovered after a
+ *              crash by loading the save and replaying the journal. Appends
+ *              are synced to disk together, shortly after a burst of edits,
+ *              so painting does not wait on the disk for each tile. Records
+ *              that are replaced by later ones are folded out when the journal
+ *              grows, so it stays near the size of the changes, not the edits.
+ *              Each saved project has its own journal, so editors open on
+ *              different projects do not share one.
+ ******************************************************************************/
+#include "Database/EditorJournal.h"
+
+/* Constant Implementation - see header file for descriptions */
+const qint64 EditorJournal::kCOMPACT_SIZE = 1048576;
+const quint32 EditorJournal::kMAGIC = 0x46495341;
+const int EditorJournal::kSYNC_DELAY = 250;
+const quint16 EditorJournal::kVERSION = 1;
+
+/* Static Implementation */
+EditorJournal* EditorJournal::shared_journal = nullptr;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. Not recording until opened.
+ *
+ * Inputs: QObject* parent - the parent object
+ */
+EditorJournal::EditorJournal(QObject* parent) : QObject(parent)
+{
+  base_modified = 0;
+  compact_size = 0;
+
+  sync_timer.setInterval(kSYNC_DELAY);
+  sync_timer.setSingleShot(true);
+  connect(&sync_timer, SIGNAL(timeout()), this, SLOT(sync()));
+}
+
+/*
+ * Description: Destructor function. The journal is left on disk, since only
+ *              a clean close (see close()) removes it.
+ */
+EditorJournal::~EditorJournal()
+{
+  sync_timer.stop();
+  if(file.isOpen())
+  {
+    syncFile(&file);
+    file.close();
+  }
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Appends the record to the end of the journal and flushes it to
+ *              the system, so it survives a crash of the editor. It is synced
+ *              to disk, to survive a crash of the system, by sync() once the
+ *              appends pause for kSYNC_DELAY, so a burst of appends (such as
+ *              painting tiles) shares one sync.
+ *              Once the journal is past kCOMPACT_SIZE and has
+ *              doubled since the last compaction, it is compacted, so the cost
+ *              of compacting stays in proportion to the edits.
+ *
+ * Inputs: const EditorJournalRecord &record - the record to append
+ * Output: none
+ */
+void EditorJournal::append(const EditorJournalRecord &record)
+{
+  if(file.isOpen() && writeRecord(&file, record) && file.flush())
+  {
+    if(file.size() > kCOMPACT_SIZE && file.size() > 2 * compact_size)
+      compact();
+    else
+      sync_timer.start();
+  }
+}
+
+/*
+ * Description: Folds the records that are replaced by later records out of
+ *              the set, keeping the order of the rest:
+ *              - Only the last core record is kept.
+ *              - A thing move folds into the add or move of the same instance
+ *                before it, and a remove drops both.
+ *              - A tile record inside the range of a later tile record of the
+ *                same sub-map is dropped, since tile records hold the full
+ *                tile state.
+ *
+ * Inputs: QList<EditorJournalRecord> records - the records, oldest first
+ * Output: QList<EditorJournalRecord> - the compacted records
+ */
+QList<EditorJournalRecord> EditorJournal::compactRecords(
+                                          QList<EditorJournalRecord> records)
+{
+  QVector<bool> keep(records.size(), true);
+
+  /* Core and thing records, oldest to newest */
+  QHash<QString, int> last_add;
+  QHash<QString, int> last_move;
+  int last_core = -1;
+  for(int i = 0; i < records.size(); i++)
+  {
+    const EditorJournalRecord &record = records[i];
+    QString key = QString::number(record.map_id) + ":" +
+                  QString::number(record.kind) + ":" +
+                  QString::number(record.id);
+
+    if(record.type == EditorEnumDb::JOURNAL_CORE)
+    {
+      if(last_core >= 0)
+        keep[last_core] = false;
+      last_core = i;
+    }
+    else if(record.type == EditorEnumDb::JOURNAL_THING_ADD)
+    {
+      last_add.insert(key, i);
+      last_move.remove(key);
+    }
+    else if(record.type == EditorEnumDb::JOURNAL_THING_MOVE)
+    {
+      /* Add at the moved location, in the place of the move */
+      if(last_add.contains(key))
+      {
+        int add = last_add.value(key);
+        QPoint pos = records[i].pos;
+        records[i] = records[add];
+        records[i].pos = pos;
+        keep[add] = false;
+        last_add.insert(key, i);
+      }
+      else
+      {
+        if(last_move.contains(key))
+          keep[last_move.value(key)] = false;
+        last_move.insert(key, i);
+      }
+    }
+    else if(record.type == EditorEnumDb::JOURNAL_THING_REMOVE)
+    {
+      if(last_add.contains(key))
+        keep[last_add.take(key)] = false;
+      if(last_move.contains(key))
+        keep[last_move.take(key)] = false;
+    }
+  }
+
+  /* Tile records, newest to oldest */
+  QHash<QString, QVector<QRect>> later;
+  for(int i = records.size() - 1; i >= 0; i--)
+  {
+    if(keep[i] && records[i].type == EditorEnumDb::JOURNAL_TILES)
+    {
+      QString key = QString::number(records[i].map_id) + ":" +
+                    QString::number(records[i].sub_id);
+      QVector<QRect> &rects = later[key];
+
+      bool covered = false;
+      for(int j = 0; !covered && j < rects.size(); j++)
+        covered = rects[j].contains(records[i].rect);
+
+      if(covered)
+        keep[i] = false;
+      else
+        rects.push_back(records[i].rect);
+    }
+  }
+
+  QList<EditorJournalRecord> compacted;
+  for(int i = 0; i < records.size(); i++)
+    if(keep[i])
+      compacted.push_back(records[i]);
+  return compacted;
+}
+
+/*
+ * Description: Encodes the record into bytes, for one frame of the journal.
+ *
+ * Inputs: const EditorJournalRecord &record - the record to encode
+ * Output: QByteArray - the encoded record
+ */
+QByteArray EditorJournal::packRecord(const EditorJournalRecord &record)
+{
+  QByteArray bytes;
+  QDataStream out(&bytes, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_5_0);
+
+  out << static_cast<qint32>(record.type) << static_cast<qint32>(record.map_id)
+      << static_cast<qint32>(record.sub_id) << static_cast<qint32>(record.kind)
+      << static_cast<qint32>(record.id) << static_cast<qint32>(record.base_id)
+      << record.pos << record.rect << record.data;
+
+  return bytes;
+}
+
+/*
+ * Description: Decodes the record from the bytes of one frame of the journal.
+ *
+ * Inputs: const QByteArray &bytes - the encoded record
+ *         EditorJournalRecord* record - the decoded record
+ * Output: bool - true if decoded
+ */
+bool EditorJournal::unpackRecord(const QByteArray &bytes,
+                                 EditorJournalRecord* record)
+{
+  QDataStream in(bytes);
+  in.setVersion(QDataStream::Qt_5_0);
+
+  qint32 type, map_id, sub_id, kind, id, base_id;
+  in >> type >> map_id >> sub_id >> kind >> id >> base_id
+     >> record->pos >> record->rect >> record->data;
+  if(in.status() != QDataStream::Ok || type < EditorEnumDb::JOURNAL_CORE ||
+     type > EditorEnumDb::JOURNAL_TILES)
+    return false;
+
+  record->type = static_cast<EditorEnumDb::JournalRecord>(type);
+  record->map_id = map_id;
+  record->sub_id = sub_id;
+  record->kind = kind;
+  record->id = id;
+  record->base_id = base_id;
+  return true;
+}
+
+/*
+ * Description: Flushes the buffered writes of the file to the system and
+ *              syncs the file to disk.
+ *
+ * Inputs: QFile* file - the open file
+ * Output: bool - true if synced
+ */
+bool EditorJournal::syncFile(QFile* file)
+{
+  if(!file->flush())
+    return false;
+#ifdef _WIN32
+  return (_commit(file->handle()) == 0);
+#else
+  return (fsync(file->handle()) == 0);
+#endif
+}
+
+/*
+ * Description: Writes the journal header (format, and the saved project with
+ *              its modified time) and the records to the device.
+ *
+ * Inputs: QIODevice* device - the open device to write to
+ *         const QList<EditorJournalRecord> &records - the records to write
+ * Output: bool - true if all written
+ */
+bool EditorJournal::writeJournal(QIODevice* device,
+                                 const QList<EditorJournalRecord> &records)
+                                 const
+{
+  QDataStream out(device);
+  out.setVersion(QDataStream::Qt_5_0);
+  out << kMAGIC << kVERSION << base_path << base_modified;
+
+  bool success = (out.status() == QDataStream::Ok);
+  for(int i = 0; success && i < records.size(); i++)
+    success = writeRecord(device, records[i]);
+  return success;
+}
+
+/*
+ * Description: Writes a single record frame to the device: the size, the
+ *              encoded record and its checksum. A frame cut short by a crash
+ *              fails the checksum, so it and anything after it is ignored on
+ *              read.
+ *
+ * Inputs: QIODevice* device - the open device to write to
+ *         const EditorJournalRecord &record - the record to write
+ * Output: bool - true if written
+ */
+bool EditorJournal::writeRecord(QIODevice* device,
+                                const EditorJournalRecord &record)
+{
+  QByteArray bytes = packRecord(record);
+
+  QByteArray frame;
+  QDataStream out(&frame, QIODevice::WriteOnly);
+  out.setVersion(QDataStream::Qt_5_0);
+  out << static_cast<quint32>(bytes.size());
+  out.writeRawData(bytes.constData(), bytes.size());
+  out << static_cast<quint16>(qChecksum(bytes.constData(), bytes.size()));
+
+  return (device->write(frame) == frame.size());
+}
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+
+/*
+ * Description: Syncs the records appended since the last sync to disk.
+ *              Connected to the sync timer, started by each append.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorJournal::sync()
+{
+  if(file.isOpen())
+    syncFile(&file);
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Appends a checkpoint of the core objects, as staged by the
+ *              game database. Replaces any earlier checkpoint on compaction.
+ *
+ * Inputs: const QByteArray &data - the core object data
+ * Output: none
+ */
+void EditorJournal::appendCore(const QByteArray &data)
+{
+  EditorJournalRecord record;
+  record.type = EditorEnumDb::JOURNAL_CORE;
+  record.map_id = -1;
+  record.sub_id = -1;
+  record.kind = -1;
+  record.id = -1;
+  record.base_id = -1;
+  record.data = data;
+  append(record);
+}
+
+/*
+ * Description: Appends an add, move or remove of a map thing instance.
+ *
+ * Inputs: EditorEnumDb::JournalRecord type - the thing record type
+ *         int map_id - the map of the thing
+ *         int sub_id - the sub-map of the thing. Not used for removes
+ *         int kind - the thing class (ThingBase)
+ *         int id - the thing instance ID
+ *         int base_id - the base thing ID. Only used for adds
+ *         QPoint pos - the tile location of the thing. Not used for removes
+ * Output: none
+ */
+void EditorJournal::appendThing(EditorEnumDb::JournalRecord type, int map_id,
+                                int sub_id, int kind, int id, int base_id,
+                                QPoint pos)
+{
+  EditorJournalRecord record;
+  record.type = type;
+  record.map_id = map_id;
+  record.sub_id = sub_id;
+  record.kind = kind;
+  record.id = id;
+  record.base_id = base_id;
+  record.pos = pos;
+  append(record);
+}
+
+/*
+ * Description: Appends the full state of a range of tiles in a sub-map, as
+ *              encoded by the map.
+ *
+ * Inputs: int map_id - the map of the tiles
+ *         int sub_id - the sub-map of the tiles
+ *         QRect rect - the tile range
+ *         const QByteArray &states - the encoded tile states
+ * Output: none
+ */
+void EditorJournal::appendTiles(int map_id, int sub_id, QRect rect,
+                                const QByteArray &states)
+{
+  EditorJournalRecord record;
+  record.type = EditorEnumDb::JOURNAL_TILES;
+  record.map_id = map_id;
+  record.sub_id = sub_id;
+  record.kind = -1;
+  record.id = -1;
+  record.base_id = -1;
+  record.rect = rect;
+  record.data = states;
+  append(record);
+}
+
+/*
+ * Description: Stops recording and removes the journal. Called when the edits
+ *              no longer need recovery (on a clean close, or before the
+ *              project is replaced).
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorJournal::close()
+{
+  sync_timer.stop();
+  if(file.isOpen())
+    file.close();
+  QFile::remove(getJournalPath(base_path));
+
+  base_path = "";
+  base_modified = 0;
+  compact_size = 0;
+}
+
+/*
+ * Description: Folds the records replaced by later records out of the
+ *              journal (see compactRecords()). The compacted journal is
+ *              written beside it and swapped in, so a crash part way leaves
+ *              the full journal.
+ *
+ * Inputs: none
+ * Output: bool - true if compacted
+ */
+bool EditorJournal::compact()
+{
+  sync_timer.stop();
+  if(!file.isOpen() || !syncFile(&file))
+    return false;
+
+  QString path;
+  QList<EditorJournalRecord> records;
+  if(!read(file.fileName(), &path, &records))
+    return false;
+
+  QSaveFile save_file(file.fileName());
+  if(!save_file.open(QIODevice::WriteOnly) ||
+     !writeJournal(&save_file, compactRecords(records)) || !save_file.commit())
+    return false;
+
+  /* Continue appending to the compacted journal */
+  file.close();
+  bool success = file.open(QIODevice::WriteOnly | QIODevice::Append);
+  compact_size = file.size();
+  return success;
+}
+
+/*
+ * Description: Returns the saved project the journal applies to.
+ *
+ * Inputs: none
+ * Output: QString - the project file. Empty if never saved
+ */
+QString EditorJournal::getBasePath() const
+{
+  return base_path;
+}
+
+/*
+ * Description: Returns if edits are being recorded (the journal is open).
+ *
+ * Inputs: none
+ * Output: bool - true if recording
+ */
+bool EditorJournal::isRecording() const
+{
+  return file.isOpen();
+}
+
+/*
+ * Description: Starts a new journal for the saved project, replacing any
+ *              journal on disk, and records edits until closed. The starting
+ *              records (such as those recovered from the last journal) are
+ *              compacted into it. The journal of the last project recorded,
+ *              if another, is removed since its edits are saved or dropped.
+ *
+ * Inputs: QString base_path - the saved project. Empty if never saved
+ *         QList<EditorJournalRecord> records - the starting records
+ * Output: bool - true if the journal is recording
+ */
+bool EditorJournal::open(QString base_path, QList<EditorJournalRecord> records)
+{
+  QString path = getJournalPath(base_path);
+  sync_timer.stop();
+  if(file.isOpen())
+  {
+    file.close();
+    if(file.fileName() != path)
+      QFile::remove(file.fileName());
+  }
+
+  this->base_path = base_path;
+  base_modified = 0;
+  if(!base_path.isEmpty())
+    base_modified = QFileInfo(base_path).lastModified().toMSecsSinceEpoch();
+
+  QDir().mkpath(QFileInfo(path).absolutePath());
+  QSaveFile save_file(path);
+  if(!save_file.open(QIODevice::WriteOnly) ||
+     !writeJournal(&save_file, compactRecords(records)) || !save_file.commit())
+    return false;
+
+  file.setFileName(path);
+  bool success = file.open(QIODevice::WriteOnly | QIODevice::Append);
+  compact_size = file.size();
+  return success;
+}
+
+/*
+ * Description: Reads a journal on disk: the saved project it applies to
+ *              and its records. Reading stops at the first record that is
+ *              cut short or fails its checksum. A journal whose project was
+ *              changed or removed since the journal started is not read,
+ *              since its edits no longer apply.
+ *
+ * Inputs: QString path - the journal file
+ *         QString* base_path - the saved project. Empty if never saved
+ *         QList<EditorJournalRecord>* records - the records, oldest first
+ * Output: bool - true if a journal was read
+ */
+bool EditorJournal::read(QString path, QString* base_path,
+                         QList<EditorJournalRecord>* records) const
+{
+  QFile journal_file(path);
+  if(base_path == nullptr || records == nullptr ||
+     !journal_file.open(QIODevice::ReadOnly))
+    return false;
+
+  /* Header */
+  QDataStream in(&journal_file);
+  in.setVersion(QDataStream::Qt_5_0);
+  quint32 magic;
+  quint16 version;
+  qint64 modified;
+  in >> magic >> version >> *base_path >> modified;
+  if(in.status() != QDataStream::Ok || magic != kMAGIC || version != kVERSION)
+    return false;
+  if(!base_path->isEmpty())
+  {
+    QFileInfo info(*base_path);
+    if(!info.isFile() || info.lastModified().toMSecsSinceEpoch() != modified)
+      return false;
+  }
+
+  /* Records, up to the first one cut short */
+  records->clear();
+  while(!in.atEnd())
+  {
+    quint32 size;
+    in >> size;
+    if(in.status() != QDataStream::Ok ||
+       static_cast<qint64>(size) > journal_file.bytesAvailable())
+      break;
+
+    QByteArray bytes(static_cast<int>(size), 0);
+    quint16 checksum;
+    if(in.readRawData(bytes.data(), bytes.size()) != bytes.size())
+      break;
+    in >> checksum;
+    if(in.status() != QDataStream::Ok ||
+       checksum != qChecksum(bytes.constData(), bytes.size()))
+      break;
+
+    EditorJournalRecord record;
+    if(!unpackRecord(bytes, &record))
+      break;
+    records->push_back(record);
+  }
+
+  return true;
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the journal files left on disk, beside the editor
+ *              saves, newest first.
+ *
+ * Inputs: none
+ * Output: QStringList - the journal file paths
+ */
+QStringList EditorJournal::getJournalFiles()
+{
+  QDir dir(QFileInfo(getJournalPath("")).absolutePath());
+  QStringList files = dir.entryList(QStringList() << "recovery-*.journal",
+                                    QDir::Files, QDir::Time);
+  for(int i = 0; i < files.size(); i++)
+    files[i] = dir.absoluteFilePath(files[i]);
+  return files;
+}
+
+/*
+ * Description: Returns the journal file path of the saved project, beside the
+ *              editor saves. The name is the project file name and a hash of
+ *              its full path, so each saved project has its own journal.
+ *
+ * Inputs: QString base_path - the saved project. Empty if never saved
+ * Output: QString - the journal file path
+ */
+QString EditorJournal::getJournalPath(QString base_path)
+{
+  QString name = "untitled";
+  if(!base_path.isEmpty())
+  {
+    QFileInfo info(base_path);
+    name = info.completeBaseName() + "-" +
+           QCryptographicHash::hash(info.absoluteFilePath().toUtf8(),
+                                    QCryptographicHash::Sha1).toHex().left(8);
+  }
+  return EditorHelpers::getProjectDir() + "/../Editor/saves/recovery-" +
+         name + ".journal";
+}
+
+/*
+ * Description: Returns the scratch file path of the saved project, where
+ *              object data is staged through the file handler on its way in
+ *              or out of its journal.
+ *
+ * Inputs: QString base_path - the saved project. Empty if never saved
+ * Output: QString - the scratch file path
+ */
+QString EditorJournal::getScratchPath(QString base_path)
+{
+  QString path = getJournalPath(base_path);
+  return path.left(path.lastIndexOf('.')) + ".tmp";
+}
+
+/*
+ * Description: Returns the shared journal. Created on the first call and kept
+ *              for the life of the application.
+ *
+ * Inputs: none
+ * Output: EditorJournal* - the shared journal
+ */
+EditorJournal* EditorJournal::getShared()
+{
+  if(shared_journal == nullptr)
+    shared_journal = new EditorJournal();
+  return shared_journal;
+}
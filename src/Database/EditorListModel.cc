@@ -0,0 +1,303 @@
+/*******************************************************************************
+ * Class Name: EditorListModel
+ * Date Created: October 19, 2026
+ * Inheritance: QAbstractListModel
+ * Description: A list of game objects keyed by ID, shown as "ID: name". One
+ *              shared model exists per object category, filled by the game
+ *              database, so every combo box binds to the same rows. New lists
+ *              are merged in by ID, so only changed rows are signalled.
+ ******************************************************************************/
+#include "Database/EditorListModel.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorListModel::kID_ROLE = Qt::UserRole;
+const int EditorListModel::kNAME_ROLE = Qt::UserRole + 1;
+const int EditorListModel::kNO_ID = -1;
+
+/* Static Implementation */
+QMap<EditorEnumDb::ListType, EditorListModel*> EditorListModel::shared_models;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The list is empty.
+ *
+ * Inputs: QObject* parent - the parent object
+ */
+EditorListModel::EditorListModel(QObject* parent)
+               : QAbstractListModel(parent)
+{
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorListModel::~EditorListModel()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Updates the row lookup of each ID in the range of rows.
+ *
+ * Inputs: int first - the first row
+ *         int last - the last row
+ * Output: none
+ */
+void EditorListModel::updateRows(int first, int last)
+{
+  for(int i = first; i <= last && i < entries.size(); i++)
+    rows.insert(entries[i].id, i);
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the data of the index. The display role is the "ID:
+ *              name" string and the ID and name roles are the split parts.
+ *
+ * Inputs: const QModelIndex &index - the row index
+ *         int role - the data role
+ * Output: QVariant - the data. Invalid if not handled
+ */
+QVariant EditorListModel::data(const QModelIndex &index, int role) const
+{
+  if(index.isValid() && index.row() < entries.size())
+  {
+    const EditorListEntry &entry = entries[index.row()];
+    if(role == Qt::DisplayRole)
+      return entry.text;
+    else if(role == kID_ROLE)
+      return entry.id;
+    else if(role == kNAME_ROLE)
+      return entry.name;
+  }
+  return QVariant();
+}
+
+/*
+ * Description: Returns the ID of the row.
+ *
+ * Inputs: int row - the row
+ * Output: int - the ID. kNO_ID if out of range or the row has none
+ */
+int EditorListModel::getID(int row) const
+{
+  if(row >= 0 && row < entries.size())
+    return entries[row].id;
+  return kNO_ID;
+}
+
+/*
+ * Description: Returns the display strings of all rows, for the few places
+ *              that still take a plain list (input dialogs, xml preview).
+ *
+ * Inputs: none
+ * Output: QList<QString> - the "ID: name" strings
+ */
+QList<QString> EditorListModel::getList() const
+{
+  QList<QString> list;
+  for(int i = 0; i < entries.size(); i++)
+    list.push_back(entries[i].text);
+  return list;
+}
+
+/*
+ * Description: Returns the name of the ID.
+ *
+ * Inputs: int id - the object ID
+ * Output: QString - the name. Empty if not found
+ */
+QString EditorListModel::getName(int id) const
+{
+  int row = getRow(id);
+  if(row >= 0)
+    return entries[row].name;
+  return "";
+}
+
+/*
+ * Description: Returns the row of the ID.
+ *
+ * Inputs: int id - the object ID
+ * Output: int - the row. -1 if not found
+ */
+int EditorListModel::getRow(int id) const
+{
+  return rows.value(id, -1);
+}
+
+/*
+ * Description: Returns the number of rows.
+ *
+ * Inputs: const QModelIndex &parent - the parent. Only the root has rows
+ * Output: int - the row count
+ */
+int EditorListModel::rowCount(const QModelIndex &parent) const
+{
+  if(parent.isValid())
+    return 0;
+  return entries.size();
+}
+
+/*
+ * Description: Merges the new entries into the list by ID. Rows no longer in
+ *              the list are removed, then each new entry is updated in place,
+ *              moved up or inserted at its row. Views only see the rows that
+ *              actually changed, so selections on the other rows are kept.
+ *
+ * Inputs: QList<EditorListEntry> new_entries - the new list, in order
+ * Output: none
+ */
+void EditorListModel::setEntries(QList<EditorListEntry> new_entries)
+{
+  /* Drop repeated IDs, the first is kept */
+  QSet<int> new_ids;
+  for(int i = 0; i < new_entries.size(); i++)
+  {
+    if(new_ids.contains(new_entries[i].id))
+      new_entries.removeAt(i--);
+    else
+      new_ids.insert(new_entries[i].id);
+  }
+
+  /* The first fill is a single reset */
+  if(entries.isEmpty())
+  {
+    if(!new_entries.isEmpty())
+    {
+      beginResetModel();
+      entries = new_entries;
+      rows.clear();
+      updateRows(0, entries.size() - 1);
+      endResetModel();
+    }
+    return;
+  }
+
+  /* Remove the rows no longer in the list, as contiguous runs */
+  for(int i = entries.size() - 1; i >= 0; i--)
+  {
+    if(!new_ids.contains(entries[i].id))
+    {
+      int first = i;
+      while(first > 0 && !new_ids.contains(entries[first - 1].id))
+        first--;
+
+      beginRemoveRows(QModelIndex(), first, i);
+      for(int j = i; j >= first; j--)
+      {
+        rows.remove(entries[j].id);
+        entries.removeAt(j);
+      }
+      endRemoveRows();
+      i = first;
+    }
+  }
+  updateRows(0, entries.size() - 1);
+
+  /* Walk the new order. Rows above i already match */
+  for(int i = 0; i < new_entries.size(); i++)
+  {
+    const EditorListEntry &entry = new_entries[i];
+    int row = getRow(entry.id);
+    if(row < 0)
+    {
+      beginInsertRows(QModelIndex(), i, i);
+      entries.insert(i, entry);
+      endInsertRows();
+      updateRows(i, entries.size() - 1);
+    }
+    else
+    {
+      if(row != i)
+      {
+        beginMoveRows(QModelIndex(), row, row, QModelIndex(), i);
+        entries.move(row, i);
+        endMoveRows();
+        updateRows(i, row);
+      }
+
+      if(entries[i].name != entry.name || entries[i].text != entry.text)
+      {
+        entries[i] = entry;
+        QModelIndex changed = index(i);
+        emit dataChanged(changed, changed);
+      }
+    }
+  }
+}
+
+/*
+ * Description: Merges in a list of "ID: name" strings. Strings without an ID
+ *              (such as "None") are kept with kNO_ID.
+ *
+ * Inputs: QList<QString> list - the new list, in order
+ * Output: none
+ */
+void EditorListModel::setList(QList<QString> list)
+{
+  QList<EditorListEntry> new_entries;
+  for(int i = 0; i < list.size(); i++)
+    new_entries.push_back(parseEntry(list[i]));
+  setEntries(new_entries);
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the shared model of the category. Created empty on the
+ *              first call and kept for the life of the application.
+ *
+ * Inputs: EditorEnumDb::ListType type - the object category
+ * Output: EditorListModel* - the shared model
+ */
+EditorListModel* EditorListModel::getShared(EditorEnumDb::ListType type)
+{
+  EditorListModel* model = shared_models.value(type, nullptr);
+  if(model == nullptr)
+  {
+    model = new EditorListModel();
+    shared_models.insert(type, model);
+  }
+  return model;
+}
+
+/*
+ * Description: Parses an "ID: name" string into an entry. If there is no
+ *              valid ID in front, the whole string is the name.
+ *
+ * Inputs: QString text - the list string
+ * Output: EditorListEntry - the parsed entry
+ */
+EditorListEntry EditorListModel::parseEntry(QString text)
+{
+  EditorListEntry entry;
+  entry.id = kNO_ID;
+  entry.name = text;
+  entry.text = text;
+
+  int split = text.indexOf(':');
+  if(split > 0)
+  {
+    bool ok = false;
+    int id = text.left(split).toInt(&ok);
+    if(ok && id >= 0)
+    {
+      entry.id = id;
+      entry.name = text.mid(split + 1).trimmed();
+    }
+  }
+
+  return entry;
+}
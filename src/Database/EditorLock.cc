@@ -173,11 +173,11 @@ bool EditorLock::isPermanent()
  * Description: Loads the lock data from the XML struct and offset index. Uses
  *              existing functions in game EventSet class.
  *
- * Inputs: core::XmlData data - the XML data tree struct
+ * Inputs: core::XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorLock::load(core::XmlData data, int index)
+void EditorLock::load(core::XmlData &data, int index)
 {
   lock = core::PersistLock::load(lock, data, index);
 }
@@ -8,6 +8,7 @@
 #include <QDebug>
 
 /* Constant Implementation - see header file for descriptions */
+const int EditorMap::kCHUNK_SIZE = 16;
 const int EditorMap::kUNSET_ID = -1;
 
 /*============================================================================
@@ -24,10 +25,27 @@ EditorMap::EditorMap() : QObject()
   active_submap = nullptr;
   id = kUNSET_ID;
   name = "";
+  path_notify = false;
   tile_icons = nullptr;
   visible_path = true;
 
+  /* Visibility control - all layers and the grid shown by default */
+  for(int i = 0; i < EditorEnumDb::NO_LAYER; i++)
+    visible_info.layers[i] = true;
+  visible_info.events = false;
+  visible_info.grid = true;
+  visible_info.passability = false;
+  visible_info.reachability = false;
+  visible_info.animate = false;
+  visible_info.animate_time = 0;
+
+  hover_item = new EditorMapHover(&active_info, &visible_info);
   clearHoverInfo();
+
+  /* Reachability overlay - flooded again once the passability settles */
+  reach_item = new EditorMapReach(&reach, &visible_info);
+  reach_start = QPoint(-1, -1);
+  connect(this, SIGNAL(passabilityChanged()), this, SLOT(updateReach()));
 }
 
 /*
@@ -69,6 +87,8 @@ EditorMap::EditorMap(const EditorMap &source) : EditorMap()
 EditorMap::~EditorMap()
 {
   clearAll();
+  delete hover_item;
+  delete reach_item;
 }
 
 /*============================================================================
@@ -116,6 +136,7 @@ bool EditorMap::addIO(EditorMapIO* io, SubMapInfo* map, bool existing)
   if(valid)
   {
     /* Add the IO to tiles */
+    detachTiles(map, x, y, w, h);
     for(int i = x; i < (w+x); i++)
       for(int j = y; j < (h+y); j++)
         map->tiles[i][j]->setIO(io);
@@ -170,6 +191,7 @@ bool EditorMap::addItem(EditorMapItem* item, SubMapInfo* map, bool existing)
   if(valid)
   {
     /* Add the item to the tile */
+    detachTiles(map, x, y);
     map->tiles[x][y]->addItem(item);
 
     /* Add to stack and emit new signals */
@@ -233,6 +255,7 @@ bool EditorMap::addNPC(EditorMapNPC* npc, SubMapInfo* map, bool existing)
   if(valid)
   {
     /* Tile placement */
+    detachTiles(map, x, y, w, h);
     for(int i = x; i < (w+x); i++)
       for(int j = y; j < (h+y); j++)
         map->tiles[i][j]->setNPC(npc);
@@ -306,6 +329,7 @@ bool EditorMap::addPerson(EditorMapPerson* person, SubMapInfo* map,
   if(valid)
   {
     /* Add the person to tiles */
+    detachTiles(map, x, y, w, h);
     for(int i = x; i < (w+x); i++)
       for(int j = y; j < (h+y); j++)
         map->tiles[i][j]->setPerson(person);
@@ -322,6 +346,72 @@ bool EditorMap::addPerson(EditorMapPerson* person, SubMapInfo* map,
   return valid;
 }
 
+/*
+ * Description: Adds the teleport target and the exit of the event, for the
+ *              reachability of the active sub-map. Teleports into the active
+ *              sub-map add their target tile. Teleports and map switches set
+ *              on a tile of the active sub-map add that tile as an exit.
+ *              Multiple events are walked through.
+ *
+ * Inputs: core::Event* event - the event to check
+ *         QPoint source - the active sub-map tile of the event. -1 if none
+ *         QList<QPoint>* targets - the teleport targets to add to
+ *         QList<QPoint>* exits - the event exits to add to
+ * Output: none
+ */
+void EditorMap::addReachEvent(core::Event* event, QPoint source,
+                              QList<QPoint>* targets, QList<QPoint>* exits)
+{
+  if(event == nullptr || active_submap == nullptr)
+    return;
+
+  if(event->getType() == core::EventType::MULTIPLE)
+  {
+    core::EventMultiple* multiple = static_cast<core::EventMultiple*>(event);
+    for(int i = 0; i < multiple->getEventCount(); i++)
+      addReachEvent(&multiple->getEvent(i), source, targets, exits);
+  }
+  else if(event->getType() == core::EventType::TELEPORT)
+  {
+    core::EventTeleport* teleport = static_cast<core::EventTeleport*>(event);
+    if(teleport->getSectionId() == active_submap->id)
+      targets->append(QPoint(teleport->getTileHorizontal(),
+                             teleport->getTileVertical()));
+    if(source.x() >= 0)
+      exits->append(source);
+  }
+  else if(event->getType() == core::EventType::MAPSWITCH)
+  {
+    if(source.x() >= 0)
+      exits->append(source);
+  }
+}
+
+/*
+ * Description: Adds the teleport targets and the exits of the locked and all
+ *              unlocked events in the set. See addReachEvent().
+ *
+ * Inputs: EditorEventSet* set - the event set to check
+ *         QPoint source - the active sub-map tile of the set. -1 if none
+ *         QList<QPoint>* targets - the teleport targets to add to
+ *         QList<QPoint>* exits - the event exits to add to
+ * Output: none
+ */
+void EditorMap::addReachEvents(EditorEventSet* set, QPoint source,
+                               QList<QPoint>* targets, QList<QPoint>* exits)
+{
+  if(set == nullptr || set->isEmpty())
+    return;
+
+  if(set->getEventLocked() != nullptr)
+    addReachEvent(set->getEventLocked()->getEvent(), source, targets, exits);
+
+  QVector<EditorEvent*> unlocked = set->getEventUnlocked();
+  for(int i = 0; i < unlocked.size(); i++)
+    if(unlocked[i] != nullptr)
+      addReachEvent(unlocked[i]->getEvent(), source, targets, exits);
+}
+
 /*
  * Description: Attempts to add the thing to the current sub-map. Thing needs
  *              to be given an x and y start location prior to calling this
@@ -363,6 +453,7 @@ bool EditorMap::addThing(EditorMapThing* thing, SubMapInfo* map, bool existing)
   if(valid)
   {
     /* Add the thing to tiles */
+    detachTiles(map, x, y, w, h);
     for(int i = x; i < (w+x); i++)
       for(int j = y; j < (h+y); j++)
         map->tiles[i][j]->setThing(thing);
@@ -480,6 +571,164 @@ void EditorMap::addTileSpriteData(FileHandler* fh, QProgressDialog* save_dialog,
   save_dialog->setValue(save_dialog->value() + 1);
 }
 
+/*
+ * Description: Adds the game object references of the event: the sound, the
+ *              item given or taken, the map switched to and the thing unlocked,
+ *              teleported or modified. Multiple and battle events are checked
+ *              through to their child events.
+ *
+ * Inputs: core::Event* event - the event to check
+ *         QString where - the place of the event, for display
+ *         QList<EditorUsage>* usages - the references to add to
+ * Output: none
+ */
+void EditorMap::addUsageEvent(core::Event* event, QString where,
+                              QList<EditorUsage>* usages)
+{
+  if(event == nullptr || event->getType() == core::EventType::NONE)
+    return;
+
+  usages->push_back({EditorEnumDb::USE_SOUND,
+                     static_cast<core::ExecutableEvent*>(event)->getSoundId(),
+                     where});
+
+  /* The object used by the event type, if any */
+  EditorEnumDb::UsageType type = EditorEnumDb::USE_THING;
+  int id = -1;
+  switch(event->getType())
+  {
+    case core::EventType::BATTLESTART:
+    {
+      core::EventBattleStart* battle =
+                                 static_cast<core::EventBattleStart*>(event);
+      addUsageEvent(&battle->getWinEvent(), where + " (Win)", usages);
+      addUsageEvent(&battle->getLoseEvent(), where + " (Lose)", usages);
+      break;
+    }
+    case core::EventType::ITEMGIVE:
+      type = EditorEnumDb::USE_ITEM;
+      id = static_cast<core::EventItemGive*>(event)->getItemId();
+      break;
+    case core::EventType::ITEMTAKE:
+      type = EditorEnumDb::USE_ITEM;
+      id = static_cast<core::EventItemTake*>(event)->getItemId();
+      break;
+    case core::EventType::MAPSWITCH:
+      type = EditorEnumDb::USE_MAP;
+      id = static_cast<core::EventMapSwitch*>(event)->getMapId();
+      break;
+    case core::EventType::MULTIPLE:
+    {
+      core::EventMultiple* multiple = static_cast<core::EventMultiple*>(event);
+      for(int i = 0; i < multiple->getEventCount(); i++)
+        addUsageEvent(&multiple->getEvent(i), where, usages);
+      break;
+    }
+    case core::EventType::PROPERTY:
+      id = static_cast<core::EventProperty*>(event)->getThingId();
+      break;
+    case core::EventType::TELEPORT:
+      id = static_cast<core::EventTeleport*>(event)->getThingId();
+      break;
+    case core::EventType::UNLOCKIO:
+      id = static_cast<core::EventUnlockIO*>(event)->getInteractiveObjectId();
+      break;
+    case core::EventType::UNLOCKTHING:
+      id = static_cast<core::EventUnlockThing*>(event)->getThingId();
+      break;
+    default:
+      break;
+  }
+
+  if(id >= 0)
+    usages->push_back({type, id, where});
+}
+
+/*
+ * Description: Adds the game object references of the lock, the locked event
+ *              and all unlocked events in the set. If the set is the one of the
+ *              base, it is skipped since the base adds it.
+ *
+ * Inputs: EditorEventSet* set - the event set to check
+ *         QString where - the place of the set, for display
+ *         QList<EditorUsage>* usages - the references to add to
+ *         EditorEventSet* base_set - the set of the base. Default none
+ * Output: none
+ */
+void EditorMap::addUsageEvents(EditorEventSet* set, QString where,
+                               QList<EditorUsage>* usages,
+                               EditorEventSet* base_set)
+{
+  if(set == nullptr || set == base_set || set->isEmpty())
+    return;
+
+  usages->push_back({EditorEnumDb::USE_ITEM,
+                     set->getLockedState()->getHaveItemID(), where + " Lock"});
+  addUsageEvent(set->getEventLocked()->getEvent(), where, usages);
+
+  QVector<EditorEvent*> unlocked = set->getEventUnlocked();
+  for(int i = 0; i < unlocked.size(); i++)
+    if(unlocked[i] != nullptr)
+      addUsageEvent(unlocked[i]->getEvent(), where + " (Unlocked)", usages);
+}
+
+/*
+ * Description: Adds the game object references of the IO: the thing
+ *              references, the lock and the events of every state. Anything
+ *              used from the base is skipped.
+ *
+ * Inputs: EditorMapIO* io - the IO to check
+ *         QString where - the place of the IO, for display
+ *         QList<EditorUsage>* usages - the references to add to
+ * Output: none
+ */
+void EditorMap::addUsageIO(EditorMapIO* io, QString where,
+                           QList<EditorUsage>* usages)
+{
+  EditorMapIO* base_io = io->getBaseIO();
+  addUsageThing(io, where, usages);
+
+  if(base_io == nullptr || !io->isBaseLock())
+    usages->push_back({EditorEnumDb::USE_ITEM, io->getLock()->getHaveItemID(),
+                       where + " Lock"});
+
+  for(int i = 0; i < io->getStates().size(); i++)
+  {
+    QString state = where + " State " + QString::number(i);
+    bool base = (base_io != nullptr);
+    addUsageEvents(io->getEventEnter(i), state + " Enter", usages,
+                   base ? base_io->getEventEnter(i) : nullptr);
+    addUsageEvents(io->getEventExit(i), state + " Exit", usages,
+                   base ? base_io->getEventExit(i) : nullptr);
+    addUsageEvents(io->getEventUse(i), state + " Use", usages,
+                   base ? base_io->getEventUse(i) : nullptr);
+    addUsageEvents(io->getEventWalkover(i), state + " Walkover", usages,
+                   base ? base_io->getEventWalkover(i) : nullptr);
+  }
+}
+
+/*
+ * Description: Adds the game object references of the thing: the sound and
+ *              the interact event set. If both are used from the base, the
+ *              base adds them instead.
+ *
+ * Inputs: EditorMapThing* thing - the thing to check
+ *         QString where - the place of the thing, for display
+ *         QList<EditorUsage>* usages - the references to add to
+ * Output: none
+ */
+void EditorMap::addUsageThing(EditorMapThing* thing, QString where,
+                              QList<EditorUsage>* usages)
+{
+  EditorMapThing* base = thing->getBaseThing();
+  if(base == nullptr)
+    usages->push_back({EditorEnumDb::USE_SOUND, thing->getSoundID(),
+                       where + " Sound"});
+
+  addUsageEvents(thing->getEventSet(), where, usages,
+                 base != nullptr ? base->getEventSet() : nullptr);
+}
+
 /*
  * Description: Clears all set map data and leaves just a clean construct.
  *
@@ -520,6 +769,7 @@ void EditorMap::copySelf(const EditorMap &source)
   /* Add const values */
   name = source.name;
   battle_scenes = source.battle_scenes;
+  visible_info = source.visible_info;
 
   /* Add sprites */
   for(int i = 0; i < source.sprites.size(); i++)
@@ -559,13 +809,15 @@ void EditorMap::copySelf(const EditorMap &source)
     sub_maps.last()->music = source.sub_maps[i]->music;
     sub_maps.last()->weather = source.sub_maps[i]->weather;
     sub_maps.last()->center_point = QPoint(0, 0);
+    sub_maps.last()->animated_valid = false;
+    sub_maps.last()->event_valid = false;
     for(int j = 0; j < source.sub_maps[i]->tiles.size(); j++)
     {
       QVector<EditorTile*> row;
       for(int k = 0; k < source.sub_maps[i]->tiles[j].size(); k++)
       {
         row.push_back(new EditorTile(*source.sub_maps[i]->tiles[j][k]));
-        row.last()->setHoverInfo(&active_info);
+        row.last()->setVisibilityInfo(&visible_info);
       }
       sub_maps.last()->tiles.push_back(row);
     }
@@ -663,486 +915,826 @@ void EditorMap::copySelf(const EditorMap &source)
 }
 
 /*
- * Description: Loads the sub-map info from the xml data and index of the data
- *              stack.
+ * Description: Creates a new tile at the x, y location which is a copy of the
+ *              source tile. Things are not copied (handled by the map).
  *
- * Inputs: SubMapInfo* map - the sub-map info to load data into
- *         XmlData data - the current xml data to load in
- *         int index - the offset index into the data stack
+ * Inputs: EditorTile* source - the tile to copy
+ *         int x - the x tile location
+ *         int y - the y tile location
+ * Output: EditorTile* - the new tile. Ownership passed to caller
+ */
+EditorTile* EditorMap::copyTile(EditorTile* source, int x, int y)
+{
+  EditorTile* tile = new EditorTile(x, y, tile_icons);
+  *tile = *source;
+  tile->setVisibilityInfo(source->getVisibilityInfo());
+  return tile;
+}
+
+/*
+ * Description: Detaches the chunk from all other sub-maps that share it, prior
+ *              to it being modified. The active sub-map is the one in the
+ *              scene, so it always keeps the original tiles: if it is the one
+ *              written, the other sharers move together onto one new copy.
+ *              Otherwise, the written sub-map takes a private copy.
+ *
+ * Inputs: SubMapInfo* map - the sub-map that is about to be modified
+ *         int index - the chunk index
  * Output: none
  */
-void EditorMap::loadSubMap(SubMapInfo* map, XmlData data, int index)
+void EditorMap::detachChunk(SubMapInfo* map, int index)
 {
-  QString element = QString::fromStdString(data.getElement(index));
-  /* -------------- NAME -------------- */
-  if(element == "name")
-  {
-    map->name = QString::fromStdString(data.getDataString());
-  }
-  /* -------------- WIDTH -------------- */
-  else if(element == "width")
-  {
-    setMap(map->id, map->name, data.getDataInteger(),map->tiles.front().size(),
-           false);
-  }
-  /* -------------- HEIGHT -------------- */
-  else if(element == "height")
+  if(map != nullptr && index >= 0 && index < map->chunks.size() &&
+     map->chunks[index] != nullptr)
   {
-    setMap(map->id, map->name, map->tiles.size(), data.getDataInteger(),
-           false);
-  }
-  /* ----------- BATTLE SCENES --------------*/
-  else if(element == "battlescene")
-  {
-    int scene_id = data.getDataInteger();
-    if(scene_id >= 0)
-      map->battle_scenes.push_back(scene_id);
-  }
-  /* --------- UNDERLAYS / OVERLAYS -----------*/
-  else if(element == "overlay" || element == "underlay")
-  {
-    /* Get index */
-    int index_ref = -1;
-    std::string index_str = data.getKeyValue(index);
-    if(!index_str.empty())
-      index_ref = std::stoi(index_str);
+    TileChunkShare* share = map->chunks[index];
+    QRect rect = getChunkRect(map, index);
+    share->maps.removeAll(map);
 
-    /* Proceed if index is valid */
-    if(index_ref >= 0)
+    /* Active: keep the originals, move all other sharers to one copy */
+    if(map == active_submap)
     {
-      /* Get referenced layer */
-      LayOver* lay_ref = nullptr;
-      if(element == "overlay")
+      for(int i = rect.left(); i <= rect.right(); i++)
       {
-        while(static_cast<int>(map->lays_over.size()) <= index_ref)
-          map->lays_over.push_back(Helpers::createBlankLayOver());
-        lay_ref = &map->lays_over[index_ref];
-      }
-      else /* underlay */
-      {
-        while(static_cast<int>(map->lays_under.size()) <= index_ref)
-          map->lays_under.push_back(Helpers::createBlankLayOver());
-        lay_ref = &map->lays_under[index_ref];
+        for(int j = rect.top(); j <= rect.bottom(); j++)
+        {
+          EditorTile* tile = copyTile(map->tiles[i][j], i, j);
+          for(int k = 0; k < share->maps.size(); k++)
+            share->maps[k]->tiles[i][j] = tile;
+        }
       }
+    }
+    /* Otherwise: take a private copy */
+    else
+    {
+      for(int i = rect.left(); i <= rect.right(); i++)
+        for(int j = rect.top(); j <= rect.bottom(); j++)
+          map->tiles[i][j] = copyTile(map->tiles[i][j], i, j);
+    }
 
-      /* Modify referenced lay */
-      *lay_ref = Helpers::updateLayOver(*lay_ref, data, index + 1);
+    /* Clean up the share, if only one sub-map is left in it */
+    if(share->maps.size() <= 1)
+    {
+      for(int k = 0; k < share->maps.size(); k++)
+        share->maps[k]->chunks[index] = nullptr;
+      delete share;
     }
+    map->chunks[index] = nullptr;
   }
-  /* -------------- MUSIC ----------------*/
-  else if(element == "music")
+}
+
+/*
+ * Description: Returns the tile rect covered by the chunk index in the
+ *              sub-map. Chunks are kCHUNK_SIZE square, stored column major.
+ *
+ * Inputs: SubMapInfo* map - the sub-map reference
+ *         int index - the chunk index
+ * Output: QRect - the tile rect of the chunk. Clipped to the sub-map
+ */
+QRect EditorMap::getChunkRect(SubMapInfo* map, int index)
+{
+  if(map != nullptr && map->tiles.size() > 0 && index >= 0)
+  {
+    int width = map->tiles.size();
+    int height = map->tiles.front().size();
+    int rows = (height + kCHUNK_SIZE - 1) / kCHUNK_SIZE;
+    int x = (index / rows) * kCHUNK_SIZE;
+    int y = (index % rows) * kCHUNK_SIZE;
+
+    return QRect(x, y, qMin(kCHUNK_SIZE, width - x),
+                 qMin(kCHUNK_SIZE, height - y));
+  }
+  return QRect();
+}
+
+/*
+ * Description: Returns the tile layers recorded in the edit journal: the
+ *              sprite layers, or the layers that hold passability.
+ *
+ * Inputs: bool passability - true for the passability layers
+ * Output: QVector<EditorEnumDb::Layer> - the layers, in record order
+ */
+QVector<EditorEnumDb::Layer> EditorMap::getJournalLayers(bool passability)
+{
+  QVector<EditorEnumDb::Layer> layers;
+
+  layers.push_back(EditorEnumDb::BASE);
+  if(!passability)
+    layers.push_back(EditorEnumDb::ENHANCER);
+  layers.push_back(EditorEnumDb::LOWER1);
+  layers.push_back(EditorEnumDb::LOWER2);
+  layers.push_back(EditorEnumDb::LOWER3);
+  layers.push_back(EditorEnumDb::LOWER4);
+  layers.push_back(EditorEnumDb::LOWER5);
+  if(!passability)
   {
-    int music_id = data.getDataInteger();
-    if(music_id >= 0)
-      map->music.push_back(music_id);
+    layers.push_back(EditorEnumDb::UPPER1);
+    layers.push_back(EditorEnumDb::UPPER2);
+    layers.push_back(EditorEnumDb::UPPER3);
+    layers.push_back(EditorEnumDb::UPPER4);
+    layers.push_back(EditorEnumDb::UPPER5);
   }
-  /* -------------- WEATHER ----------------*/
-  else if(element == "weather")
+
+  return layers;
+}
+
+/*
+ * Description: Returns the thing of the internal type with the ID.
+ *
+ * Inputs: ThingBase type - the thing class
+ *         int id - the thing ID
+ *         int sub_map - the sub-map to get the thing from (<0 is base)
+ * Output: EditorMapThing* - the thing. NULL if not found
+ */
+EditorMapThing* EditorMap::getThingGeneric(ThingBase type, int id,
+                                           int sub_map)
+{
+  if(type == ThingBase::THING)
+    return getThing(id, sub_map);
+  else if(type == ThingBase::ITEM)
+    return getItem(id, sub_map);
+  else if(type == ThingBase::INTERACTIVE)
+    return getIO(id, sub_map);
+  else if(type == ThingBase::PERSON)
+    return getPerson(id, sub_map);
+  else if(type == ThingBase::NPC)
+    return getNPC(id, sub_map);
+  return nullptr;
+}
+
+/*
+ * Description: Records the removal of a thing instance from the sub-maps in
+ *              the edit journal.
+ *
+ * Inputs: ThingBase type - the thing class
+ *         int id - the thing instance ID
+ * Output: none
+ */
+void EditorMap::journalRemove(ThingBase type, int id)
+{
+  EditorJournal::getShared()->appendThing(
+                  EditorEnumDb::JOURNAL_THING_REMOVE, getID(), -1,
+                  static_cast<int>(type), id);
+}
+
+/*
+ * Description: Records the add or move of a thing instance in the active
+ *              sub-map in the edit journal, at its current location.
+ *
+ * Inputs: EditorEnumDb::JournalRecord type - the add or move record type
+ *         EditorMapThing* thing - the thing instance
+ * Output: none
+ */
+void EditorMap::journalThing(EditorEnumDb::JournalRecord type,
+                             EditorMapThing* thing)
+{
+  if(thing != nullptr && active_submap != nullptr)
   {
-    int music_id = data.getDataInteger();
-    if(music_id >= 0)
-      map->weather = music_id;
+    int base_id = -1;
+    if(thing->getBaseThing() != nullptr)
+      base_id = thing->getBaseThing()->getID();
+
+    EditorJournal::getShared()->appendThing(
+                  type, getID(), active_submap->id,
+                  static_cast<int>(thing->getClass()), thing->getID(), base_id,
+                  QPoint(thing->getX(), thing->getY()));
   }
-  /* -------------- TILES -------------- */
-  else if((element == "base" || element == "enhancer" ||
-           element == "lower" || element == "upper") &&
-          data.getElement(index + 1) == "x" &&
-          data.getElement(index + 2) == "y")
+}
+
+/*
+ * Description: Loads the sub-map info from the xml data and index of the data
+ *              stack.
+ *
+ * Inputs: SubMapInfo* map - the sub-map info to load data into
+ *         XmlData &data - the current xml data to load in
+ *         int index - the offset index into the data stack
+ * Output: none
+ */
+void EditorMap::loadSubMap(SubMapInfo* map, XmlData &data, int index)
+{
+  EditorEnumDb::XmlTag tag = EditorHelpers::getXmlTag(data.getElement(index));
+  switch(tag)
   {
-    /* Determine the layer */
-    EditorEnumDb::Layer layer = EditorEnumDb::NO_LAYER;
-    if(element == "base")
-      layer = EditorEnumDb::BASE;
-    else if(element == "enhancer")
-      layer = EditorEnumDb::ENHANCER;
-    else if(element == "lower")
-      layer = (EditorEnumDb::Layer)(static_cast<int>(EditorEnumDb::LOWER1) +
+    /* -------------- NAME -------------- */
+    case EditorEnumDb::XML_NAME:
+    {
+      map->name = QString::fromStdString(data.getDataString());
+      break;
+    }
+    /* -------------- WIDTH -------------- */
+    case EditorEnumDb::XML_WIDTH:
+    {
+      setMap(map->id, map->name, data.getDataInteger(),
+             map->tiles.front().size(), false);
+      break;
+    }
+    /* -------------- HEIGHT -------------- */
+    case EditorEnumDb::XML_HEIGHT:
+    {
+      setMap(map->id, map->name, map->tiles.size(), data.getDataInteger(),
+             false);
+      break;
+    }
+    /* ----------- BATTLE SCENES --------------*/
+    case EditorEnumDb::XML_BATTLESCENE:
+    {
+      int scene_id = data.getDataInteger();
+      if(scene_id >= 0)
+        map->battle_scenes.push_back(scene_id);
+      break;
+    }
+    /* --------- UNDERLAYS / OVERLAYS -----------*/
+    case EditorEnumDb::XML_OVERLAY:
+    case EditorEnumDb::XML_UNDERLAY:
+    {
+      /* Get index */
+      int index_ref = -1;
+      std::string index_str = data.getKeyValue(index);
+      if(!index_str.empty())
+        index_ref = std::stoi(index_str);
+
+      /* Proceed if index is valid */
+      if(index_ref >= 0)
+      {
+        /* Get referenced layer */
+        LayOver* lay_ref = nullptr;
+        if(tag == EditorEnumDb::XML_OVERLAY)
+        {
+          while(static_cast<int>(map->lays_over.size()) <= index_ref)
+            map->lays_over.push_back(Helpers::createBlankLayOver());
+          lay_ref = &map->lays_over[index_ref];
+        }
+        else /* underlay */
+        {
+          while(static_cast<int>(map->lays_under.size()) <= index_ref)
+            map->lays_under.push_back(Helpers::createBlankLayOver());
+          lay_ref = &map->lays_under[index_ref];
+        }
+
+        /* Modify referenced lay */
+        *lay_ref = Helpers::updateLayOver(*lay_ref, data, index + 1);
+      }
+      break;
+    }
+    /* -------------- MUSIC ----------------*/
+    case EditorEnumDb::XML_MUSIC:
+    {
+      int music_id = data.getDataInteger();
+      if(music_id >= 0)
+        map->music.push_back(music_id);
+      break;
+    }
+    /* -------------- WEATHER ----------------*/
+    case EditorEnumDb::XML_WEATHER:
+    {
+      int music_id = data.getDataInteger();
+      if(music_id >= 0)
+        map->weather = music_id;
+      break;
+    }
+    /* -------------- TILES -------------- */
+    case EditorEnumDb::XML_BASE:
+    case EditorEnumDb::XML_ENHANCER:
+    case EditorEnumDb::XML_LOWER:
+    case EditorEnumDb::XML_UPPER:
+    {
+      if(data.getElement(index + 1) != "x" ||
+         data.getElement(index + 2) != "y")
+        break;
+
+      /* Determine the layer */
+      EditorEnumDb::Layer layer = EditorEnumDb::NO_LAYER;
+      if(tag == EditorEnumDb::XML_BASE)
+        layer = EditorEnumDb::BASE;
+      else if(tag == EditorEnumDb::XML_ENHANCER)
+        layer = EditorEnumDb::ENHANCER;
+      else if(tag == EditorEnumDb::XML_LOWER)
+        layer = (EditorEnumDb::Layer)(static_cast<int>(EditorEnumDb::LOWER1) +
                        QString::fromStdString(data.getKeyValue(index)).toInt());
-    else if(element == "upper")
-      layer = (EditorEnumDb::Layer)(static_cast<int>(EditorEnumDb::UPPER1) +
+      else if(tag == EditorEnumDb::XML_UPPER)
+        layer = (EditorEnumDb::Layer)(static_cast<int>(EditorEnumDb::UPPER1) +
                        QString::fromStdString(data.getKeyValue(index)).toInt());
 
-    /* Determine the sprite, if applicable. or passability, if applicable */
-    int last = data.getNumElements() - 1;
-    bool pass_north, pass_east, pass_south, pass_west;
-    EditorSprite* sprite = nullptr;
-    if(data.getElement(last) == "sprite_id")
-      sprite = getSprite(QString::fromStdString(data.getDataString()).toInt());
-    else if(data.getElement(last) == "passability")
-      EditorHelpers::getPassability(
+      /* Determine the sprite, if applicable. or passability, if applicable */
+      int last = data.getNumElements() - 1;
+      EditorEnumDb::XmlTag last_tag =
+                           EditorHelpers::getXmlTag(data.getElement(last));
+      bool pass_north, pass_east, pass_south, pass_west;
+      EditorSprite* sprite = nullptr;
+      if(last_tag == EditorEnumDb::XML_SPRITE_ID)
+        sprite = getSprite(
+                      QString::fromStdString(data.getDataString()).toInt());
+      else if(last_tag == EditorEnumDb::XML_PASSABILITY)
+        EditorHelpers::getPassability(
                        QString::fromStdString(data.getDataString()), pass_north,
                        pass_east, pass_south, pass_west);
 
-    /* Parse through x and y index */
-    int parse = 0;
-    QStringList x_list = QString::fromStdString(data.getKeyValue(index + 1))
-                          .split(",");
-    QStringList y_list = QString::fromStdString(data.getKeyValue(index + 2))
-                          .split(",");
-    while(parse < x_list.size() && parse < y_list.size())
-    {
-      QStringList x_pair = x_list[parse].split("-");
-      QStringList y_pair = y_list[parse].split("-");
-
-      /* Loop through all tiles */
-      for(int i = x_pair.front().toInt(); i <= x_pair.back().toInt(); i++)
+      /* Parse through x and y index */
+      int parse = 0;
+      QStringList x_list = QString::fromStdString(data.getKeyValue(index + 1))
+                            .split(",");
+      QStringList y_list = QString::fromStdString(data.getKeyValue(index + 2))
+                            .split(",");
+      while(parse < x_list.size() && parse < y_list.size())
       {
-        for(int j = y_pair.front().toInt(); j <= y_pair.back().toInt(); j++)
+        QStringList x_pair = x_list[parse].split("-");
+        QStringList y_pair = y_list[parse].split("-");
+
+        /* Loop through all tiles */
+        for(int i = x_pair.front().toInt(); i <= x_pair.back().toInt(); i++)
         {
-          if(map->tiles.size() > i && map->tiles[i].size() > j)
+          for(int j = y_pair.front().toInt(); j <= y_pair.back().toInt(); j++)
           {
-            EditorTile* tile = map->tiles[i][j];
-            if(data.getElement(last) == "sprite_id")
-              tile->place(layer, sprite, true);
-            else if(data.getElement(last) == "passability")
+            if(map->tiles.size() > i && map->tiles[i].size() > j)
             {
-              tile->setPassability(layer, Direction::NORTH, pass_north);
-              tile->setPassability(layer, Direction::EAST, pass_east);
-              tile->setPassability(layer, Direction::SOUTH, pass_south);
-              tile->setPassability(layer, Direction::WEST, pass_west);
+              EditorTile* tile = map->tiles[i][j];
+              if(last_tag == EditorEnumDb::XML_SPRITE_ID)
+                tile->place(layer, sprite, true);
+              else if(last_tag == EditorEnumDb::XML_PASSABILITY)
+              {
+                tile->setPassability(layer, Direction::NORTH, pass_north);
+                tile->setPassability(layer, Direction::EAST, pass_east);
+                tile->setPassability(layer, Direction::SOUTH, pass_south);
+                tile->setPassability(layer, Direction::WEST, pass_west);
+              }
             }
           }
         }
-      }
 
-      /* Increment */
-      parse++;
+        /* Increment */
+        parse++;
+      }
+      break;
     }
-  }
-  /* -------------- TILE EVENTS -------------*/
-  else if(element == "tileevent" && data.getElement(index + 1) == "x" &&
-          data.getElement(index + 2) == "y")
-  {
-    /* Get the category */
-    QString category = QString::fromStdString(data.getKeyValue(index));
-    int x = QString::fromStdString(data.getKeyValue(index + 1)).toInt();
-    int y = QString::fromStdString(data.getKeyValue(index + 2)).toInt();
-
-    /* Ensure x/y is in range */
-    if(x >= 0 && x < map->tiles.size() && y >= 0 && y < map->tiles[x].size())
+    /* -------------- TILE EVENTS -------------*/
+    case EditorEnumDb::XML_TILEEVENT:
     {
-      if(category == "enter")
+      if(data.getElement(index + 1) != "x" ||
+         data.getElement(index + 2) != "y")
+        break;
+
+      /* Get the category */
+      EditorEnumDb::XmlTag category =
+                              EditorHelpers::getXmlTag(data.getKeyValue(index));
+      int x = QString::fromStdString(data.getKeyValue(index + 1)).toInt();
+      int y = QString::fromStdString(data.getKeyValue(index + 2)).toInt();
+
+      /* Ensure x/y is in range */
+      if(x >= 0 && x < map->tiles.size() && y >= 0 && y < map->tiles[x].size())
       {
-        EditorEventSet* set = map->tiles[x][y]->getEventEnter();
-        set->load(data, index + 2);
+        resetEventTiles(map);
+        if(category == EditorEnumDb::XML_ENTER)
+        {
+          EditorEventSet* set = map->tiles[x][y]->getEventEnter();
+          set->load(data, index + 2);
+        }
+        else if(category == EditorEnumDb::XML_ENTERSET)
+        {
+          EditorEventSet* set = map->tiles[x][y]->getEventEnter();
+          set->load(data, index + 3);
+        }
+        else if(category == EditorEnumDb::XML_EXIT)
+        {
+          EditorEventSet* set = map->tiles[x][y]->getEventExit();
+          set->load(data, index + 2);
+        }
+        else if(category == EditorEnumDb::XML_EXITSET)
+        {
+          EditorEventSet* set = map->tiles[x][y]->getEventExit();
+          set->load(data, index + 3);
+        }
       }
-      else if(category == "enterset")
+      break;
+    }
+    /* -------------- MAP THING -------------- */
+    case EditorEnumDb::XML_MAPTHING:
+    {
+      int thing_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapThing* thing = getThing(thing_id, map->id);
+
+      /* Create new thing if it doesn't exist */
+      if(thing == NULL)
       {
-        EditorEventSet* set = map->tiles[x][y]->getEventEnter();
-        set->load(data, index + 3);
+        thing = new EditorMapThing(thing_id);
+        thing->setTileIcons(getTileIcons());
+
+        /* Find insertion location */
+        int index = -1;
+        bool near = false;
+        for(int i = 0; !near && (i < map->things.size()); i++)
+        {
+          if(map->things[i]->getID() > thing->getID())
+          {
+            index = i;
+            near = true;
+          }
+        }
+
+        /* If near, insert at index. Otherwise, append */
+        if(near)
+          map->things.insert(index, thing);
+        else
+          map->things.append(thing);
       }
-      else if(category == "exit")
+
+      /* Continue to parse the data in the thing */
+      if(EditorHelpers::getXmlTag(data.getElement(index + 1)) ==
+         EditorEnumDb::XML_BASE)
       {
-        EditorEventSet* set = map->tiles[x][y]->getEventExit();
-        set->load(data, index + 2);
+        /* Get name and desc. if it has been changed */
+        EditorMapThing default_thing;
+        QString default_name = "";
+        QString default_desc = "";
+        if(default_thing.getName() != thing->getName())
+          default_name = thing->getName();
+        if(default_thing.getDescription() != thing->getDescription())
+          default_desc = thing->getDescription();
+
+        /* Set the base */
+        EditorMapThing* base_thing = getThing(data.getDataInteger());
+        if(base_thing != nullptr)
+        {
+          thing->setBase(base_thing);
+          if(default_name != "")
+            thing->setName(default_name);
+          if(default_desc != "")
+            thing->setDescription(default_desc);
+        }
       }
-      else if(category == "exitset")
+      else
       {
-        EditorEventSet* set = map->tiles[x][y]->getEventExit();
-        set->load(data, index + 3);
+        thing->load(data, index + 1);
       }
+      break;
     }
-  }
-  /* -------------- MAP THING -------------- */
-  else if(element == "mapthing")
-  {
-    int thing_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapThing* thing = getThing(thing_id, map->id);
-
-    /* Create new thing if it doesn't exist */
-    if(thing == NULL)
+    /* -------------- MAP IO -------------- */
+    case EditorEnumDb::XML_MAPIO:
     {
-      thing = new EditorMapThing(thing_id);
-      thing->setTileIcons(getTileIcons());
+      int io_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapIO* io = getIO(io_id, map->id);
 
-      /* Find insertion location */
-      int index = -1;
-      bool near = false;
-      for(int i = 0; !near && (i < map->things.size()); i++)
+      /* Create new IO if it doesn't exist */
+      if(io == NULL)
       {
-        if(map->things[i]->getID() > thing->getID())
+        io = new EditorMapIO(io_id);
+        io->setTileIcons(getTileIcons());
+
+        /* Find insertion location */
+        int index = -1;
+        bool near = false;
+        for(int i = 0; !near && (i < map->ios.size()); i++)
         {
-          index = i;
-          near = true;
+          if(map->ios[i]->getID() > io->getID())
+          {
+            index = i;
+            near = true;
+          }
         }
-      }
 
-      /* If near, insert at index. Otherwise, append */
-      if(near)
-        map->things.insert(index, thing);
-      else
-        map->things.append(thing);
-    }
+        /* If near, insert at index. Otherwise, append */
+        if(near)
+          map->ios.insert(index, io);
+        else
+          map->ios.append(io);
+      }
 
-    /* Continue to parse the data in the thing */
-    QString element = QString::fromStdString(data.getElement(index + 1));
-    if(element == "base")
-    {
-      /* Get name and desc. if it has been changed */
-      EditorMapThing default_thing;
-      QString default_name = "";
-      QString default_desc = "";
-      if(default_thing.getName() != thing->getName())
-        default_name = thing->getName();
-      if(default_thing.getDescription() != thing->getDescription())
-        default_desc = thing->getDescription();
+      /* Continue to parse the data in the thing */
+      if(EditorHelpers::getXmlTag(data.getElement(index + 1)) ==
+         EditorEnumDb::XML_BASE)
+      {
+        /* Get name and desc. if it has been changed */
+        EditorMapIO default_io;
+        QString default_name = "";
+        QString default_desc = "";
+        if(default_io.getName() != io->getName())
+          default_name = io->getName();
+        if(default_io.getDescription() != io->getDescription())
+          default_desc = io->getDescription();
 
-      /* Set the base */
-      EditorMapThing* base_thing = getThing(data.getDataInteger());
-      if(base_thing != nullptr)
+        /* Set the base */
+        EditorMapIO* base_io = getIO(data.getDataInteger());
+        if(base_io != nullptr)
+        {
+          io->setBase(base_io);
+          if(default_name != "")
+            io->setName(default_name);
+          if(default_desc != "")
+            io->setDescription(default_desc);
+        }
+      }
+      else
       {
-        thing->setBase(base_thing);
-        if(default_name != "")
-          thing->setName(default_name);
-        if(default_desc != "")
-          thing->setDescription(default_desc);
+        io->load(data, index + 1);
       }
+      break;
     }
-    else
+    /* -------------- MAP Item -------------- */
+    case EditorEnumDb::XML_MAPITEM:
     {
-      thing->load(data, index + 1);
-    }
-  }
-  /* -------------- MAP IO -------------- */
-  else if(element == "mapio")
-  {
-    int io_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapIO* io = getIO(io_id, map->id);
+      int item_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapItem* item = getItem(item_id, map->id);
 
-    /* Create new IO if it doesn't exist */
-    if(io == NULL)
-    {
-      io = new EditorMapIO(io_id);
-      io->setTileIcons(getTileIcons());
-
-      /* Find insertion location */
-      int index = -1;
-      bool near = false;
-      for(int i = 0; !near && (i < map->ios.size()); i++)
+      /* Create new item if it doesn't exist */
+      if(item == nullptr)
       {
-        if(map->ios[i]->getID() > io->getID())
+        item = new EditorMapItem(item_id);
+        item->setTileIcons(getTileIcons());
+
+        /* Find insertion location */
+        int index = -1;
+        bool near = false;
+        for(int i = 0; !near && (i < map->items.size()); i++)
         {
-          index = i;
-          near = true;
+          if(map->items[i]->getID() > item->getID())
+          {
+            index = i;
+            near = true;
+          }
         }
-      }
 
-      /* If near, insert at index. Otherwise, append */
-      if(near)
-        map->ios.insert(index, io);
-      else
-        map->ios.append(io);
-    }
+        /* If near, insert at index. Otherwise, append */
+        if(near)
+          map->items.insert(index, item);
+        else
+          map->items.append(item);
+      }
 
-    /* Continue to parse the data in the thing */
-    QString element = QString::fromStdString(data.getElement(index + 1));
-    if(element == "base")
-    {
-      /* Get name and desc. if it has been changed */
-      EditorMapIO default_io;
-      QString default_name = "";
-      QString default_desc = "";
-      if(default_io.getName() != io->getName())
-        default_name = io->getName();
-      if(default_io.getDescription() != io->getDescription())
-        default_desc = io->getDescription();
+      /* Continue to parse the data in the thing */
+      if(EditorHelpers::getXmlTag(data.getElement(index + 1)) ==
+         EditorEnumDb::XML_BASE)
+      {
+        /* Get name and desc. if it has been changed */
+        EditorMapItem default_item;
+        QString default_name = "";
+        QString default_desc = "";
+        if(default_item.getName() != item->getName())
+          default_name = item->getName();
+        if(default_item.getDescription() != item->getDescription())
+          default_desc = item->getDescription();
 
-      /* Set the base */
-      EditorMapIO* base_io = getIO(data.getDataInteger());
-      if(base_io != nullptr)
+        /* Set the base */
+        EditorMapItem* base_item = getItem(data.getDataInteger());
+        if(base_item != nullptr)
+        {
+          item->setBase(base_item);
+          if(default_name != "")
+            item->setName(default_name);
+          if(default_desc != "")
+            item->setDescription(default_desc);
+        }
+      }
+      else
       {
-        io->setBase(base_io);
-        if(default_name != "")
-          io->setName(default_name);
-        if(default_desc != "")
-          io->setDescription(default_desc);
+        item->load(data, index + 1);
       }
+      break;
     }
-    else
-    {
-      io->load(data, index + 1);
-    }
-  }
-  /* -------------- MAP Item -------------- */
-  else if(element == "mapitem")
-  {
-    int item_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapItem* item = getItem(item_id, map->id);
-
-    /* Create new item if it doesn't exist */
-    if(item == nullptr)
+    /* -------------- MAP PERSON -------------- */
+    case EditorEnumDb::XML_MAPPERSON:
     {
-      item = new EditorMapItem(item_id);
-      item->setTileIcons(getTileIcons());
+      int person_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapPerson* person = getPerson(person_id, map->id);
 
-      /* Find insertion location */
-      int index = -1;
-      bool near = false;
-      for(int i = 0; !near && (i < map->items.size()); i++)
+      /* Create new person if it doesn't exist */
+      if(person == nullptr)
       {
-        if(map->items[i]->getID() > item->getID())
+        person = new EditorMapPerson(person_id);
+        person->setTileIcons(getTileIcons());
+
+        /* Find insertion location */
+        int index = -1;
+        bool near = false;
+        for(int i = 0; !near && (i < map->persons.size()); i++)
         {
-          index = i;
-          near = true;
+          if(map->persons[i]->getID() > person->getID())
+          {
+            index = i;
+            near = true;
+          }
         }
-      }
 
-      /* If near, insert at index. Otherwise, append */
-      if(near)
-        map->items.insert(index, item);
-      else
-        map->items.append(item);
-    }
+        /* If near, insert at index. Otherwise, append */
+        if(near)
+          map->persons.insert(index, person);
+        else
+          map->persons.append(person);
+      }
 
-    /* Continue to parse the data in the thing */
-    QString element = QString::fromStdString(data.getElement(index + 1));
-    if(element == "base")
-    {
-      /* Get name and desc. if it has been changed */
-      EditorMapItem default_item;
-      QString default_name = "";
-      QString default_desc = "";
-      if(default_item.getName() != item->getName())
-        default_name = item->getName();
-      if(default_item.getDescription() != item->getDescription())
-        default_desc = item->getDescription();
+      /* Continue to parse the data in the person */
+      if(EditorHelpers::getXmlTag(data.getElement(index + 1)) ==
+         EditorEnumDb::XML_BASE)
+      {
+        /* Get name and desc. if it has been changed */
+        EditorMapPerson default_person;
+        QString default_name = "";
+        QString default_desc = "";
+        if(default_person.getName() != person->getName())
+          default_name = person->getName();
+        if(default_person.getDescription() != person->getDescription())
+          default_desc = person->getDescription();
 
-      /* Set the base */
-      EditorMapItem* base_item = getItem(data.getDataInteger());
-      if(base_item != nullptr)
+        /* Set the base */
+        EditorMapPerson* base_person = getPerson(data.getDataInteger());
+        if(base_person != nullptr)
+        {
+          person->setBase(base_person);
+          if(default_name != "")
+            person->setName(default_name);
+          if(default_desc != "")
+            person->setDescription(default_desc);
+        }
+      }
+      else
       {
-        item->setBase(base_item);
-        if(default_name != "")
-          item->setName(default_name);
-        if(default_desc != "")
-          item->setDescription(default_desc);
+        person->load(data, index + 1);
       }
+      break;
     }
-    else
-    {
-      item->load(data, index + 1);
-    }
-  }
-  /* -------------- MAP PERSON -------------- */
-  else if(element == "mapperson")
-  {
-    int person_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapPerson* person = getPerson(person_id, map->id);
-
-    /* Create new person if it doesn't exist */
-    if(person == nullptr)
+    /* -------------- MAP NPC -------------- */
+    case EditorEnumDb::XML_MAPNPC:
     {
-      person = new EditorMapPerson(person_id);
-      person->setTileIcons(getTileIcons());
+      int npc_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapNPC* npc = getNPC(npc_id, map->id);
 
-      /* Find insertion location */
-      int index = -1;
-      bool near = false;
-      for(int i = 0; !near && (i < map->persons.size()); i++)
+      /* Create new npc if it doesn't exist */
+      if(npc == nullptr)
       {
-        if(map->persons[i]->getID() > person->getID())
+        npc = new EditorMapNPC(npc_id);
+        npc->setTileIcons(getTileIcons());
+
+        /* Find insertion location */
+        int index = -1;
+        bool near = false;
+        for(int i = 0; !near && (i < map->npcs.size()); i++)
         {
-          index = i;
-          near = true;
+          if(map->npcs[i]->getID() > npc->getID())
+          {
+            index = i;
+            near = true;
+          }
         }
-      }
 
-      /* If near, insert at index. Otherwise, append */
-      if(near)
-        map->persons.insert(index, person);
-      else
-        map->persons.append(person);
-    }
+        /* If near, insert at index. Otherwise, append */
+        if(near)
+          map->npcs.insert(index, npc);
+        else
+          map->npcs.append(npc);
+      }
 
-    /* Continue to parse the data in the person */
-    QString element = QString::fromStdString(data.getElement(index + 1));
-    if(element == "base")
-    {
-      /* Get name and desc. if it has been changed */
-      EditorMapPerson default_person;
-      QString default_name = "";
-      QString default_desc = "";
-      if(default_person.getName() != person->getName())
-        default_name = person->getName();
-      if(default_person.getDescription() != person->getDescription())
-        default_desc = person->getDescription();
+      /* Continue to parse the data in the npc */
+      if(EditorHelpers::getXmlTag(data.getElement(index + 1)) ==
+         EditorEnumDb::XML_BASE)
+      {
+        /* Get name and desc. if it has been changed */
+        EditorMapNPC default_npc;
+        QString default_name = "";
+        QString default_desc = "";
+        if(default_npc.getName() != npc->getName())
+          default_name = npc->getName();
+        if(default_npc.getDescription() != npc->getDescription())
+          default_desc = npc->getDescription();
 
-      /* Set the base */
-      EditorMapPerson* base_person = getPerson(data.getDataInteger());
-      if(base_person != nullptr)
+        /* Set the base */
+        EditorMapNPC* base_npc = getNPC(data.getDataInteger());
+        if(base_npc != nullptr)
+        {
+          npc->setBase(base_npc);
+          if(default_name != "")
+            npc->setName(default_name);
+          if(default_desc != "")
+            npc->setDescription(default_desc);
+        }
+      }
+      else
       {
-        person->setBase(base_person);
-        if(default_name != "")
-          person->setName(default_name);
-        if(default_desc != "")
-          person->setDescription(default_desc);
+        npc->load(data, index + 1);
       }
+      break;
     }
-    else
+    default:
+      break;
+  }
+}
+
+/*
+ * Description: Marks the passability of all tiles in the sub-map as changed.
+ *              Only relevant if the sub-map is the one read for npc path
+ *              checks. Notifies once the edit returns to the event loop, so
+ *              a burst of changes signals once (see passabilityNotify()).
+ *
+ * Inputs: SubMapInfo* map - the sub-map being modified
+ * Output: none
+ */
+void EditorMap::markPassChanged(SubMapInfo* map)
+{
+  if(map != nullptr && map == path_grid.getSubMap())
+  {
+    path_grid.markDirty();
+    if(!path_notify)
     {
-      person->load(data, index + 1);
+      path_notify = true;
+      QTimer::singleShot(0, this, SLOT(passabilityNotify()));
     }
   }
-  /* -------------- MAP NPC -------------- */
-  else if(element == "mapnpc")
-  {
-    int npc_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapNPC* npc = getNPC(npc_id, map->id);
+}
 
-    /* Create new npc if it doesn't exist */
-    if(npc == nullptr)
+/*
+ * Description: Marks the passability of the tile range in the sub-map as
+ *              changed. Can be called before the tiles are modified, since
+ *              the tiles are only re-read on the next npc path check.
+ *              Notifies as the full sub-map mark does.
+ *
+ * Inputs: SubMapInfo* map - the sub-map being modified
+ *         int x - the x tile location of the range
+ *         int y - the y tile location of the range
+ *         int w - the width of the range, in tiles
+ *         int h - the height of the range, in tiles
+ * Output: none
+ */
+void EditorMap::markPassChanged(SubMapInfo* map, int x, int y, int w, int h)
+{
+  if(map != nullptr && map == path_grid.getSubMap())
+  {
+    path_grid.markDirty(x, y, w, h);
+    if(!path_notify)
     {
-      npc = new EditorMapNPC(npc_id);
-      npc->setTileIcons(getTileIcons());
+      path_notify = true;
+      QTimer::singleShot(0, this, SLOT(passabilityNotify()));
+    }
+  }
+}
 
-      /* Find insertion location */
-      int index = -1;
-      bool near = false;
-      for(int i = 0; !near && (i < map->npcs.size()); i++)
-      {
-        if(map->npcs[i]->getID() > npc->getID())
-        {
-          index = i;
-          near = true;
-        }
-      }
+/*
+ * Description: Moves the thing in the sub-map to a new tile location. If the
+ *              thing does not fit at the new location, it is put back where it
+ *              was.
+ *
+ * Inputs: EditorMapThing* thing - the thing to move
+ *         int x - the new x tile location
+ *         int y - the new y tile location
+ *         SubMapInfo* map - the sub-map of the thing
+ * Output: bool - true if the thing was moved
+ */
+bool EditorMap::moveThing(EditorMapThing* thing, int x, int y, SubMapInfo* map)
+{
+  if(thing == nullptr || map == nullptr)
+    return false;
 
-      /* If near, insert at index. Otherwise, append */
-      if(near)
-        map->npcs.insert(index, npc);
-      else
-        map->npcs.append(npc);
-    }
+  /* Data */
+  int old_x = thing->getX();
+  int old_y = thing->getY();
+  ThingBase type = thing->getClass();
+  int w = thing->getMatrix()->getWidth();
+  int h = thing->getMatrix()->getHeight();
 
-    /* Continue to parse the data in the npc */
-    QString element = QString::fromStdString(data.getElement(index + 1));
-    if(element == "base")
-    {
-      /* Get name and desc. if it has been changed */
-      EditorMapNPC default_npc;
-      QString default_name = "";
-      QString default_desc = "";
-      if(default_npc.getName() != npc->getName())
-        default_name = npc->getName();
-      if(default_npc.getDescription() != npc->getDescription())
-        default_desc = npc->getDescription();
+  /* Remove */
+  markPassChanged(map, old_x, old_y, w, h);
+  if(type == ThingBase::THING)
+  {
+    for(int i = 0; i < w; i++)
+      for(int j = 0; j < h; j++)
+        map->tiles[old_x + i][old_y + j]->unsetThing(
+                                    thing->getMatrix()->getRenderDepth(i, j));
+  }
+  else if(type == ThingBase::ITEM)
+  {
+    map->tiles[old_x][old_y]->unsetItem(static_cast<EditorMapItem*>(thing));
+  }
+  else if(type == ThingBase::INTERACTIVE)
+  {
+    for(int i = 0; i < w; i++)
+      for(int j = 0; j < h; j++)
+        map->tiles[old_x + i][old_y + j]->unsetIO(
+                                    thing->getMatrix()->getRenderDepth(i, j));
+  }
+  else if(type == ThingBase::PERSON)
+  {
+    for(int i = 0; i < w; i++)
+      for(int j = 0; j < h; j++)
+        map->tiles[old_x + i][old_y + j]->unsetPerson(
+                                    thing->getMatrix()->getRenderDepth(i, j));
+  }
+  else if(type == ThingBase::NPC)
+  {
+    for(int i = 0; i < w; i++)
+      for(int j = 0; j < h; j++)
+        map->tiles[old_x + i][old_y + j]->unsetNPC(
+                                    thing->getMatrix()->getRenderDepth(i, j));
+  }
 
-      /* Set the base */
-      EditorMapNPC* base_npc = getNPC(data.getDataInteger());
-      if(base_npc != nullptr)
-      {
-        npc->setBase(base_npc);
-        if(default_name != "")
-          npc->setName(default_name);
-        if(default_desc != "")
-          npc->setDescription(default_desc);
-      }
-    }
-    else
-    {
-      npc->load(data, index + 1);
-    }
+  /* Set the new X/Y */
+  thing->setX(x);
+  thing->setY(y);
+
+  /* Try and add - if not, put back */
+  if(!addThingGeneric(thing, map))
+  {
+    thing->setX(old_x);
+    thing->setY(old_y);
+    addThingGeneric(thing, map);
+    return false;
   }
+  return true;
 }
 
 /*
@@ -1196,6 +1788,7 @@ void EditorMap::recursiveErase(int x, int y, EditorEnumDb::Layer layer,
      map->tiles[x][y]->getSprite(layer) == target && target != NULL)
   {
     /* Un-place sprite */
+    detachTiles(map, x, y);
     map->tiles[x][y]->unplace(layer);
 
     /* Recursively proceed */
@@ -1207,26 +1800,109 @@ void EditorMap::recursiveErase(int x, int y, EditorEnumDb::Layer layer,
 }
 
 /*
- * Description: Recursively fills all of the similar adjoining tiles with the
- *              selected sprite
+ * Description: Recursively fills all of the similar adjoining tiles with the
+ *              selected sprite
+ *
+ * Inputs: x and y positions for the tile, and target(the tile's ID)
+ *         and replacement (New sprite) id numbers
+ */
+void EditorMap::recursiveFill(int x, int y, EditorEnumDb::Layer layer,
+                            EditorSprite* target, SubMapInfo* map)
+{
+  if(x >= 0 && y >= 0 && x < map->tiles.size() && y < map->tiles[x].size() &&
+     map->tiles[x][y]->getSprite(layer) == target)
+  {
+    /* Place sprite */
+    detachTiles(map, x, y);
+    map->tiles[x][y]->place(layer, active_info.active_sprite);
+
+    /* Recursively proceed */
+    recursiveFill(x + 1, y, layer, target, map);
+    recursiveFill(x - 1, y, layer, target, map);
+    recursiveFill(x, y + 1, layer, target, map);
+    recursiveFill(x, y - 1, layer, target, map);
+  }
+}
+
+/*
+ * Description: Points the passability grid at the active sub-map and re-reads
+ *              the tiles changed since the last refresh. Npc path checks that
+ *              read those tiles are dropped.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMap::refreshPathGrid()
+{
+  /* Follow the active sub-map */
+  if(path_grid.getSubMap() != active_submap)
+  {
+    path_grid.setSubMap(active_submap);
+    path_checks.clear();
+  }
+
+  /* Re-read the changed tiles and drop the checks that read them */
+  QRect changed = path_grid.refresh();
+  if(!changed.isEmpty())
+  {
+    QMutableHashIterator<EditorNPCPath*, PathCheck> it(path_checks);
+    while(it.hasNext())
+    {
+      it.next();
+      if(it.value().bound.intersects(changed))
+        it.remove();
+    }
+  }
+}
+
+/*
+ * Description: Releases the tiles of the sub-map. Tiles in chunks still shared
+ *              with another sub-map stay with it. All others are deleted, if
+ *              requested.
  *
- * Inputs: x and y positions for the tile, and target(the tile's ID)
- *         and replacement (New sprite) id numbers
+ * Inputs: SubMapInfo* map - the sub-map to release the tiles from
+ *         bool delete_tiles - true to delete the tiles it solely owns
+ * Output: none
  */
-void EditorMap::recursiveFill(int x, int y, EditorEnumDb::Layer layer,
-                            EditorSprite* target, SubMapInfo* map)
+void EditorMap::releaseTiles(SubMapInfo* map, bool delete_tiles)
 {
-  if(x >= 0 && y >= 0 && x < map->tiles.size() && y < map->tiles[x].size() &&
-     map->tiles[x][y]->getSprite(layer) == target)
+  if(map != nullptr)
   {
-    /* Place sprite */
-    map->tiles[x][y]->place(layer, active_info.active_sprite);
+    /* Flag the shared tiles */
+    QVector<QVector<bool>> shared;
+    for(int i = 0; i < map->tiles.size(); i++)
+      shared.push_back(QVector<bool>(map->tiles[i].size(), false));
+    for(int c = 0; c < map->chunks.size(); c++)
+    {
+      TileChunkShare* share = map->chunks[c];
+      if(share != nullptr)
+      {
+        QRect rect = getChunkRect(map, c);
+        for(int i = rect.left(); i <= rect.right(); i++)
+          for(int j = rect.top(); j <= rect.bottom(); j++)
+            shared[i][j] = true;
 
-    /* Recursively proceed */
-    recursiveFill(x + 1, y, layer, target, map);
-    recursiveFill(x - 1, y, layer, target, map);
-    recursiveFill(x, y + 1, layer, target, map);
-    recursiveFill(x, y - 1, layer, target, map);
+        /* Leave the share */
+        share->maps.removeAll(map);
+        if(share->maps.size() <= 1)
+        {
+          for(int k = 0; k < share->maps.size(); k++)
+            share->maps[k]->chunks[c] = nullptr;
+          delete share;
+        }
+      }
+    }
+    map->chunks.clear();
+
+    /* Delete the solely owned tiles */
+    if(delete_tiles)
+    {
+      for(int i = 0; i < map->tiles.size(); i++)
+        for(int j = 0; j < map->tiles[i].size(); j++)
+          if(!shared[i][j])
+            delete map->tiles[i][j];
+      map->tiles.clear();
+    }
   }
 }
 
@@ -1251,8 +1927,12 @@ bool EditorMap::resizeMap(SubMapInfo* map, int width, int height)
   tilesPersonRemove(true);
   tilesNPCRemove(true);
 
-  /* Reference tile */
-  EditorTile* ref_tile = map->tiles.front().front();
+  /* Materialize all shared tiles, since the chunk grid changes */
+  for(int i = 0; i < map->chunks.size(); i++)
+    detachChunk(map, i);
+  resetAnimatedTiles(map);
+  resetEventTiles(map);
+  map->chunks.clear();
 
   /* If smaller, delete tiles on width */
   if(map->tiles.size() > width)
@@ -1274,10 +1954,7 @@ bool EditorMap::resizeMap(SubMapInfo* map, int width, int height)
       for(int j = 0; j < map->tiles.front().size(); j++)
       {
         row.push_back(new EditorTile(i, j, getTileIcons()));
-        row.last()->setHoverInfo(getHoverInfo());
-        row.last()->setVisibilityEvents(ref_tile->getVisibilityEvents());
-        row.last()->setVisibilityGrid(ref_tile->getVisibilityGrid());
-        row.last()->setVisibilityPass(ref_tile->getVisibilityPass());
+        row.last()->setVisibilityInfo(getVisibilityInfo());
       }
 
       map->tiles.push_back(row);
@@ -1304,11 +1981,7 @@ bool EditorMap::resizeMap(SubMapInfo* map, int width, int height)
       for(int j = map->tiles[i].size(); j < height; j++)
       {
         map->tiles[i].push_back(new EditorTile(i, j, getTileIcons()));
-        map->tiles[i].last()->setHoverInfo(getHoverInfo());
-        map->tiles[i].last()->setVisibilityEvents(
-                                              ref_tile->getVisibilityEvents());
-        map->tiles[i].last()->setVisibilityGrid(ref_tile->getVisibilityGrid());
-        map->tiles[i].last()->setVisibilityPass(ref_tile->getVisibilityPass());
+        map->tiles[i].last()->setVisibilityInfo(getVisibilityInfo());
       }
     }
   }
@@ -1618,6 +2291,80 @@ void EditorMap::saveSubMap(FileHandler* fh, QProgressDialog* save_dialog,
   fh->writeXmlElementEnd();
 }
 
+/*
+ * Description: Shares the tiles of the source sub-map with the destination
+ *              sub-map, copy-on-write per chunk. Existing destination tiles are
+ *              released. Chunks that hold any thing, IO, item, person or npc
+ *              are copied immediately instead, so a shared chunk never
+ *              carries instance pointers.
+ *
+ * Inputs: SubMapInfo* source - the sub-map to share from
+ *         SubMapInfo* dest - the sub-map to share to
+ * Output: none
+ */
+void EditorMap::shareTiles(SubMapInfo* source, SubMapInfo* dest)
+{
+  if(source != nullptr && dest != nullptr && source != dest)
+  {
+    releaseTiles(dest);
+    dest->tiles = source->tiles;
+    resetAnimatedTiles(dest);
+    resetEventTiles(dest);
+    if(source->tiles.size() == 0)
+      return;
+
+    /* Chunk table sizing */
+    int width = source->tiles.size();
+    int height = source->tiles.front().size();
+    int count = ((width + kCHUNK_SIZE - 1) / kCHUNK_SIZE) *
+                ((height + kCHUNK_SIZE - 1) / kCHUNK_SIZE);
+    if(source->chunks.size() != count)
+      source->chunks.fill(nullptr, count);
+    dest->chunks.fill(nullptr, count);
+
+    /* Share or copy each chunk */
+    for(int c = 0; c < count; c++)
+    {
+      QRect rect = getChunkRect(source, c);
+      bool has_things = false;
+      for(int i = rect.left(); !has_things && i <= rect.right(); i++)
+      {
+        for(int j = rect.top(); !has_things && j <= rect.bottom(); j++)
+        {
+          EditorTile* tile = source->tiles[i][j];
+          has_things = (tile->getItems().size() > 0 ||
+                        tile->getIOs().count(nullptr) != tile->getIOs().size() ||
+                        tile->getNPCs().count(nullptr) !=
+                                                     tile->getNPCs().size() ||
+                        tile->getPersons().count(nullptr) !=
+                                                  tile->getPersons().size() ||
+                        tile->getThings().count(nullptr) !=
+                                                   tile->getThings().size());
+        }
+      }
+
+      /* Instance carrying chunk: copy now */
+      if(has_things)
+      {
+        for(int i = rect.left(); i <= rect.right(); i++)
+          for(int j = rect.top(); j <= rect.bottom(); j++)
+            dest->tiles[i][j] = copyTile(source->tiles[i][j], i, j);
+      }
+      /* Otherwise: share */
+      else
+      {
+        if(source->chunks[c] == nullptr)
+        {
+          source->chunks[c] = new TileChunkShare;
+          source->chunks[c]->maps.push_back(source);
+        }
+        source->chunks[c]->maps.push_back(dest);
+        dest->chunks[c] = source->chunks[c];
+      }
+    }
+  }
+}
+
 /*
  * Description: Sets the hover thing, being flagged when selecting an instance
  *              in the list in View.
@@ -1627,110 +2374,36 @@ void EditorMap::saveSubMap(FileHandler* fh, QProgressDialog* save_dialog,
  */
 bool EditorMap::setHoverThing(EditorMapThing* thing)
 {
+  bool success = false;
+
   /* First clear the existing one */
-  QRect existing = active_info.selected_thing;
   active_info.selected_thing = QRect();
 
   /* Then, set the new one */
-  if(active_submap != NULL)
+  if(active_submap != NULL && thing != NULL)
   {
-    /* First, update the old tiles to remove line */
-    for(int i = 0; i < existing.width(); i++)
-      for(int j = 0; j < existing.height(); j++)
-        active_submap->tiles[existing.x() + i][existing.y() + j]->update();
-
-    /* Next, try and get the new thing */
-    if(thing != NULL)
-    {
-      active_info.selected_thing = QRect(thing->getX(), thing->getY(),
-                                         thing->getMatrix()->getWidth(),
-                                         thing->getMatrix()->getHeight());
-      for(int i = 0; i < active_info.selected_thing.width(); i++)
-        for(int j = 0; j < active_info.selected_thing.height(); j++)
-          active_submap->tiles[thing->getX() + i][thing->getY() + j]->update();
-
-      return true;
-    }
+    active_info.selected_thing = QRect(thing->getX(), thing->getY(),
+                                       thing->getMatrix()->getWidth(),
+                                       thing->getMatrix()->getHeight());
+    success = true;
   }
 
-  return false;
+  /* Repaint the selected border */
+  updateHover();
+  return success;
 }
 
 /*
- * Description: Updates the tiles that contain the hover information with the
- *              relevant thing. If unset is false, it sets it to display.
- *              Otherwise, it unsets it and stops it from displaying. This works
- *              for things and all children (person, etc)
+ * Description: Updates the hover preview overlay after any change to the
+ *              hover information. Only the overlay bound is repainted; the
+ *              tiles themselves are untouched.
  *
- * Inputs: bool unset - unset the hover thing?
- * Output: bool - true if the hover thing was updated
+ * Inputs: none
+ * Output: none
  */
-bool EditorMap::updateHoverThing(bool unset)
+void EditorMap::updateHover()
 {
-  /* Determine the thing to work with */
-  EditorMapThing* thing = NULL;
-  if(active_submap != NULL && active_info.hover_tile != NULL)
-  {
-    if(active_info.active_cursor == EditorEnumDb::BASIC)
-    {
-      if(active_info.active_layer == EditorEnumDb::THING)
-        thing = active_info.active_thing;
-      else if(active_info.active_layer == EditorEnumDb::IO)
-        thing = active_info.active_io;
-      else if(active_info.active_layer == EditorEnumDb::ITEM)
-        thing = active_info.active_item;
-      else if(active_info.active_layer == EditorEnumDb::PERSON)
-        thing = active_info.active_person;
-      else if(active_info.active_layer == EditorEnumDb::NPC)
-        thing = active_info.active_npc;
-    }
-    else if(active_info.active_cursor == EditorEnumDb::MOVE)
-    {
-      thing = active_info.move_thing;
-    }
-  }
-
-  /* Pre-checks to determine if this is valid to execute */
-  if(thing != NULL)
-  {
-    SubMapInfo* map = active_submap;
-    EditorMatrix* ref = thing->getMatrix();
-    int hover_x = active_info.hover_tile->getX();
-    int hover_y = active_info.hover_tile->getY();
-    int hover_w = hover_x + ref->getWidth();
-    int hover_h = hover_y + ref->getHeight();
-
-    /* If unset, the hover is being removed from the tiles */
-    if(unset)
-    {
-      /* Go through and unset hover on all */
-      for(int i = hover_x; (i < hover_w && i < map->tiles.size()); i++)
-        for(int j = hover_y; (j < hover_h && j < map->tiles[i].size()); j++)
-          map->tiles[i][j]->setHover(false);
-
-      /* Re-set on base hover tile */
-      active_info.hover_tile->setHover(true);
-    }
-    /* Otherwise, it is being added */
-    else if(!active_info.path_edit_mode)
-    {
-      /* Check if it would be valid */
-      bool invalid = false;
-      if((hover_w > map->tiles.size()) ||
-         (hover_h > map->tiles[hover_x].size()))
-      {
-        invalid = true;
-      }
-
-      /* Go through and set hover on all */
-      for(int i = hover_x; (i < hover_w && i < map->tiles.size()); i++)
-        for(int j = hover_y; (j < hover_h && j < map->tiles[i].size()); j++)
-          map->tiles[i][j]->setHover(true, invalid);
-    }
-
-    return true;
-  }
-  return false;
+  hover_item->updateHover();
 }
 
 /*
@@ -1756,6 +2429,63 @@ void EditorMap::updateTiles(SubMapInfo* map, int x, int y, int w, int h)
  * PUBLIC SLOTS
  *===========================================================================*/
 
+/*
+ * Description: Records the full state of the tiles changed since the last
+ *              call in the edit journal, one range per rect of the changed
+ *              region of each sub-map, so separate edits are not recorded as
+ *              one range around all of them. Changes are
+ *              gathered by detachTiles() and recorded once the edit returns to
+ *              the event loop, so the states are those after the edit. The
+ *              sprite IDs of each layer and the passability are recorded.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMap::journalTiles()
+{
+  EditorJournal* journal = EditorJournal::getShared();
+  QVector<EditorEnumDb::Layer> layers = getJournalLayers(false);
+  QVector<EditorEnumDb::Layer> pass_layers = getJournalLayers(true);
+
+  QHash<int,QRegion>::const_iterator it;
+  for(it = journal_tiles.constBegin(); it != journal_tiles.constEnd(); it++)
+  {
+    SubMapInfo* map = getMap(it.key());
+    if(!journal->isRecording() || map == nullptr || map->tiles.size() == 0)
+      continue;
+
+    QRegion region = it.value() & QRect(0, 0, map->tiles.size(),
+                                        map->tiles.front().size());
+    for(const QRect &rect : region)
+    {
+      QByteArray states;
+      QDataStream out(&states, QIODevice::WriteOnly);
+      out.setVersion(QDataStream::Qt_5_0);
+
+      for(int i = rect.left(); i <= rect.right(); i++)
+      {
+        for(int j = rect.top(); j <= rect.bottom(); j++)
+        {
+          EditorTile* tile = map->tiles[i][j];
+          for(int k = 0; k < layers.size(); k++)
+          {
+            EditorSprite* sprite = tile->getSprite(layers[k]);
+            out << static_cast<qint32>(sprite != nullptr ? sprite->getID()
+                                                         : -1);
+          }
+          for(int k = 0; k < pass_layers.size(); k++)
+            out << static_cast<quint8>(
+                                  tile->getPassabilityNum(pass_layers[k]));
+        }
+      }
+
+      journal->appendTiles(getID(), map->id, rect, qCompress(states));
+    }
+  }
+
+  journal_tiles.clear();
+}
+
 /*
  * Description: Slot which fires each time the hover npc on the active sub-map
  *              changes. This is used to change the rendering depth to push all
@@ -1779,6 +2509,114 @@ void EditorMap::npcHoverPathChanged(EditorNPCPath* path)
   }
 }
 
+/*
+ * Description: Re-arms the passability notify and signals that the
+ *              passability changed. Queued by markPassChanged() on the first
+ *              change after the last notify, so it is re-armed here whether
+ *              or not any view re-checks the paths.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMap::passabilityNotify()
+{
+  path_notify = false;
+  emit passabilityChanged();
+}
+
+/*
+ * Description: Floods the active sub-map from the reach start tile and every
+ *              teleport target into it, then marks the teleports that land on
+ *              a tile that can not be left and the teleport or map switch
+ *              tiles that can not be walked to. Only runs while the overlay
+ *              is visible. Connected to the passability changed signal.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMap::updateReach()
+{
+  if(!visible_info.reachability || active_submap == nullptr)
+  {
+    reach.clear();
+    reach_item->updateReach();
+    return;
+  }
+
+  /* Pack the passability */
+  refreshPathGrid();
+  reach.build(&path_grid);
+
+  /* Teleport targets from every sub-map and the exits of the active one.
+   * Only the indexed event tiles are checked, not every tile */
+  QList<QPoint> exits;
+  QList<QPoint> targets;
+  for(int i = 0; i < sub_maps.size(); i++)
+  {
+    SubMapInfo* map = sub_maps[i];
+    QVector<QPoint> event_tiles = getEventTiles(map);
+    for(int j = 0; j < event_tiles.size(); j++)
+    {
+      int x = event_tiles[j].x();
+      int y = event_tiles[j].y();
+      QPoint source(-1, -1);
+      if(map == active_submap)
+        source = QPoint(x, y);
+      addReachEvents(map->tiles[x][y]->getEventEnter(), source,
+                     &targets, &exits);
+      addReachEvents(map->tiles[x][y]->getEventExit(), source,
+                     &targets, &exits);
+    }
+
+    for(int j = 0; j < map->ios.size(); j++)
+    {
+      EditorMapIO* io = map->ios[j];
+      addReachEvents(io->getEventSet(), QPoint(-1, -1), &targets, &exits);
+      for(int k = 0; k < io->getStates().size(); k++)
+      {
+        addReachEvents(io->getEventEnter(k), QPoint(-1, -1), &targets, &exits);
+        addReachEvents(io->getEventExit(k), QPoint(-1, -1), &targets, &exits);
+        addReachEvents(io->getEventUse(k), QPoint(-1, -1), &targets, &exits);
+        addReachEvents(io->getEventWalkover(k), QPoint(-1, -1),
+                       &targets, &exits);
+      }
+    }
+    for(int j = 0; j < map->npcs.size(); j++)
+      addReachEvents(map->npcs[j]->getEventSet(), QPoint(-1, -1),
+                     &targets, &exits);
+    for(int j = 0; j < map->persons.size(); j++)
+      addReachEvents(map->persons[j]->getEventSet(), QPoint(-1, -1),
+                     &targets, &exits);
+    for(int j = 0; j < map->things.size(); j++)
+      addReachEvents(map->things[j]->getEventSet(), QPoint(-1, -1),
+                     &targets, &exits);
+  }
+
+  /* Flood */
+  QList<QPoint> starts = targets;
+  if(reach_start.x() >= 0)
+    starts.append(reach_start);
+  reach.flood(starts);
+
+  /* Dead ends */
+  QList<QPoint> dead_ends;
+  for(int i = 0; i < targets.size(); i++)
+  {
+    QPoint target = targets[i];
+    if(target.x() >= 0 && target.y() >= 0 &&
+       target.x() < reach.getWidth() && target.y() < reach.getHeight() &&
+       !reach.canLeave(target.x(), target.y()) && !dead_ends.contains(target))
+      dead_ends.append(target);
+  }
+  for(int i = 0; i < exits.size(); i++)
+    if(!reach.isReached(exits[i].x(), exits[i].y()) &&
+       !dead_ends.contains(exits[i]))
+      dead_ends.append(exits[i]);
+  reach.setDeadEnds(dead_ends);
+
+  reach_item->updateReach();
+}
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -1811,6 +2649,7 @@ void EditorMap::clearHoverInfo()
 
   /* Clean the active submap */
   active_submap = nullptr;
+  hover_item->setSubMap(nullptr);
 }
 
 /*
@@ -1841,6 +2680,10 @@ void EditorMap::clickTrigger(bool single, bool right_click)
     {
       EditorSprite* sprite = active_info.active_sprite;
 
+      /* Own the tile before modifying it (the active sub-map keeps the ptr) */
+      detachTiles(active_submap, active_info.hover_tile->getX(),
+                  active_info.hover_tile->getY());
+
       /* ---- BASIC PLACE CURSOR ---- */
       if(cursor == EditorEnumDb::BASIC && sprite != nullptr)
       {
@@ -1906,81 +2749,23 @@ void EditorMap::clickTrigger(bool single, bool right_click)
         if(active_info.move_thing == nullptr)
         {
           active_info.move_thing = active_info.hover_tile->getThingTop(layer);
-          if(active_info.move_thing != nullptr)
-            updateHoverThing();
         }
         /* Attempt to move */
         else
         {
-          updateHoverThing(true);
           EditorMapThing* ref_thing = active_info.move_thing;
           active_info.move_thing = nullptr;
 
           /* If reference thing is valid, attempt move */
-          if(ref_thing != nullptr)
-          {
-            /* Data */
-            int old_x = ref_thing->getX();
-            int old_y = ref_thing->getY();
-            int new_x = active_info.hover_tile->getX();
-            int new_y = active_info.hover_tile->getY();
-            ThingBase type = ref_thing->getClass();
-            int w = ref_thing->getMatrix()->getWidth();
-            int h = ref_thing->getMatrix()->getHeight();
-
-            /* Remove */
-            if(type == ThingBase::THING)
-            {
-              for(int i = 0; i < w; i++)
-                for(int j = 0; j < h; j++)
-                  active_submap->tiles[old_x + i][old_y + j]->unsetThing(
-                                ref_thing->getMatrix()->getRenderDepth(i, j));
-            }
-            else if(type == ThingBase::ITEM)
-            {
-              active_submap->tiles[old_x][old_y]->unsetItem(
-                                       static_cast<EditorMapItem*>(ref_thing));
-            }
-            else if(type == ThingBase::INTERACTIVE)
-            {
-              for(int i = 0; i < w; i++)
-                for(int j = 0; j < h; j++)
-                  active_submap->tiles[old_x + i][old_y + j]->unsetIO(
-                                ref_thing->getMatrix()->getRenderDepth(i, j));
-            }
-            else if(type == ThingBase::PERSON)
-            {
-              for(int i = 0; i < w; i++)
-                for(int j = 0; j < h; j++)
-                  active_submap->tiles[old_x + i][old_y + j]->unsetPerson(
-                                ref_thing->getMatrix()->getRenderDepth(i, j));
-            }
-            else if(type == ThingBase::NPC)
-            {
-              for(int i = 0; i < w; i++)
-                for(int j = 0; j < h; j++)
-                  active_submap->tiles[old_x + i][old_y + j]->unsetNPC(
-                                ref_thing->getMatrix()->getRenderDepth(i, j));
-            }
-
-            /* Set the new X/Y */
-            ref_thing->setX(new_x);
-            ref_thing->setY(new_y);
-
-            /* Try and add - if not, put back */
-            if(!addThingGeneric(ref_thing))
-            {
-              ref_thing->setX(old_x);
-              ref_thing->setY(old_y);
-              addThingGeneric(ref_thing);
-            }
-          }
+          if(ref_thing != nullptr &&
+             moveThing(ref_thing, active_info.hover_tile->getX(),
+                       active_info.hover_tile->getY(), active_submap))
+            journalThing(EditorEnumDb::JOURNAL_THING_MOVE, ref_thing);
         }
       }
       /* Otherwise it is right click: deactivate */
       else
       {
-        updateHoverThing(true);
         active_info.move_thing = nullptr;
       }
     }
@@ -2002,6 +2787,8 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           /* Attempt to place - if failed, delete */
           if(!addThing(new_thing, nullptr, false))
             delete new_thing;
+          else
+            journalThing(EditorEnumDb::JOURNAL_THING_ADD, new_thing);
         }
         else
         {
@@ -2041,6 +2828,8 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           /* Attempt to place - if failed, delete */
           if(!addIO(new_io, nullptr, false))
             delete new_io;
+          else
+            journalThing(EditorEnumDb::JOURNAL_THING_ADD, new_io);
         }
         else
         {
@@ -2080,6 +2869,8 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           /* Attempt to place - if failed, delete */
           if(!addItem(new_item, nullptr, false))
             delete new_item;
+          else
+            journalThing(EditorEnumDb::JOURNAL_THING_ADD, new_item);
         }
         else
         {
@@ -2117,6 +2908,8 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           /* Attempt to place - if failed, delete */
           if(!addPerson(new_person, nullptr, false))
             delete new_person;
+          else
+            journalThing(EditorEnumDb::JOURNAL_THING_ADD, new_person);
         }
         else
         {
@@ -2156,6 +2949,8 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           /* Attempt to place - if failed, delete */
           if(!addNPC(new_npc, nullptr, false))
             delete new_npc;
+          else
+            journalThing(EditorEnumDb::JOURNAL_THING_ADD, new_npc);
         }
         else
         {
@@ -2177,6 +2972,9 @@ void EditorMap::clickTrigger(bool single, bool right_click)
           unsetNPC(found->getID(), true);
       }
     }
+
+    /* The hover tile contents may have changed */
+    updateHover();
   }
 }
 
@@ -2212,6 +3010,7 @@ void EditorMap::clickTrigger(QList<EditorTile*> tiles, bool erase)
         {
           if(tiles[i] != NULL)
           {
+            detachTiles(active_submap, tiles[i]->getX(), tiles[i]->getY());
             if(erase)
               tiles[i]->unplace(layer);
             else
@@ -2225,8 +3024,9 @@ void EditorMap::clickTrigger(QList<EditorTile*> tiles, bool erase)
 
 /*
  * Description: Copies the sub-map information from a base map to a new map.
- *              It does not copy the ID. It does not take ownership of newly
- *              created tiles.
+ *              It does not copy the ID. Tiles are shared copy-on-write per
+ *              chunk and only materialized when first modified. Instances
+ *              get new IDs, so they are always copied.
  *
  * Inputs: SubMapInfo* copy_map - the map to copy information from
  *         SubMapInfo* new_map - the map to copy information to
@@ -2244,26 +3044,8 @@ bool EditorMap::copySubMap(SubMapInfo* copy_map, SubMapInfo* new_map)
     new_map->music = copy_map->music;
     new_map->weather = copy_map->weather;
 
-    /* Delete all tiles in the new map -> not relevant */
-    for(int i = 0; i < new_map->tiles.size(); i++)
-      for(int j = 0; j < new_map->tiles[i].size(); j++)
-        delete new_map->tiles[i][j];
-    new_map->tiles.clear();
-
-    /* Add a copy of all tiles in copy to new */
-    for(int i = 0; i < copy_map->tiles.size(); i++)
-    {
-      QVector<EditorTile*> row;
-
-      for(int j = 0; j < copy_map->tiles[i].size(); j++)
-      {
-        row.push_back(new EditorTile(i, j, tile_icons));
-        *row.last() = *copy_map->tiles[i][j];
-        row.last()->setHoverInfo(copy_map->tiles[i][j]->getHoverInfo());
-      }
-
-      new_map->tiles.push_back(row);
-    }
+    /* Share the tiles, copy-on-write. Replaces the tiles in the new map */
+    shareTiles(copy_map, new_map);
 
     /* Add thing instances */
     while(new_map->things.size() > 0)
@@ -2440,6 +3222,75 @@ void EditorMap::ctrlClickTrigger()
   }
 }
 
+/*
+ * Description: Detaches any tiles in the range that are shared copy-on-write
+ *              with another sub-map. Must be called before modifying tiles.
+ *              Tile pointers of the active sub-map stay valid. For any other
+ *              sub-map, re-read the tile pointers after the call. The range
+ *              is also marked for the next npc path check and for the edit
+ *              journal.
+ *
+ * Inputs: SubMapInfo* map - the sub-map that is about to be modified
+ *         int x - the x tile location of the range
+ *         int y - the y tile location of the range
+ *         int w - the width of the range, in tiles
+ *         int h - the height of the range, in tiles
+ * Output: none
+ */
+void EditorMap::detachTiles(SubMapInfo* map, int x, int y, int w, int h)
+{
+  markPassChanged(map, x, y, w, h);
+
+  /* Record the range in the edit journal, once the edit is done */
+  if(map != nullptr && w > 0 && h > 0 &&
+     EditorJournal::getShared()->isRecording())
+  {
+    if(journal_tiles.isEmpty())
+      QTimer::singleShot(0, this, SLOT(journalTiles()));
+    journal_tiles[map->id] += QRect(x, y, w, h);
+  }
+
+  if(map != nullptr && map->chunks.size() > 0 && w > 0 && h > 0 &&
+     map->tiles.size() > 0)
+  {
+    int rows = (map->tiles.front().size() + kCHUNK_SIZE - 1) / kCHUNK_SIZE;
+    int x_end = qMin(x + w, map->tiles.size()) - 1;
+    int y_end = qMin(y + h, map->tiles.front().size()) - 1;
+
+    if(x_end >= 0 && y_end >= 0)
+      for(int i = qMax(x, 0) / kCHUNK_SIZE; i <= x_end / kCHUNK_SIZE; i++)
+        for(int j = qMax(y, 0) / kCHUNK_SIZE; j <= y_end / kCHUNK_SIZE; j++)
+          detachChunk(map, i * rows + j);
+  }
+}
+
+/*
+ * Description: Returns the index of the tiles in the sub-map that paint an
+ *              animated sprite, in a layer or from a thing. The index is built
+ *              on first use after a reset, so the animated preview only walks
+ *              these tiles on each clock tick.
+ *
+ * Inputs: SubMapInfo* map - the sub-map
+ * Output: QVector<QPoint> - the tile positions. Empty if none
+ */
+QVector<QPoint> EditorMap::getAnimatedTiles(SubMapInfo* map)
+{
+  if(map == nullptr)
+    return QVector<QPoint>();
+
+  if(!map->animated_valid)
+  {
+    map->animated_tiles.clear();
+    for(int i = 0; i < map->tiles.size(); i++)
+      for(int j = 0; j < map->tiles[i].size(); j++)
+        if(map->tiles[i][j]->isAnimated())
+          map->animated_tiles.push_back(QPoint(i, j));
+    map->animated_valid = true;
+  }
+
+  return map->animated_tiles;
+}
+
 /*
  * Description: Accesses and returns the ID at the given index for the battle
  *              scene. If out of range, returns invalid (-1).
@@ -2476,6 +3327,34 @@ QVector<int> EditorMap::getBattleScenes()
   return battle_scenes;
 }
 
+/*
+ * Description: Returns the index of the tiles in the sub-map with an enter or
+ *              exit event. The index is built on first use after a reset and
+ *              kept up to date by updateEventTile(), so the reachability only
+ *              checks these tiles for teleports and map switches.
+ *
+ * Inputs: SubMapInfo* map - the sub-map
+ * Output: QVector<QPoint> - the tile positions. Empty if none
+ */
+QVector<QPoint> EditorMap::getEventTiles(SubMapInfo* map)
+{
+  if(map == nullptr)
+    return QVector<QPoint>();
+
+  if(!map->event_valid)
+  {
+    map->event_tiles.clear();
+    for(int i = 0; i < map->tiles.size(); i++)
+      for(int j = 0; j < map->tiles[i].size(); j++)
+        if(!map->tiles[i][j]->getEventEnter()->isEmpty() ||
+           !map->tiles[i][j]->getEventExit()->isEmpty())
+          map->event_tiles.push_back(QPoint(i, j));
+    map->event_valid = true;
+  }
+
+  return map->event_tiles;
+}
+
 /*
  * Description: Returns the current selected base IO in the list of IOs.
  *              On click, if the layer and pen is correct, this is the IO
@@ -2666,6 +3545,18 @@ HoverInfo* EditorMap::getHoverInfo()
   return &active_info;
 }
 
+/*
+ * Description: Returns the hover preview overlay of the map. It is added to
+ *              the rendering scene above the tiles of the active sub-map.
+ *
+ * Inputs: none
+ * Output: EditorMapHover* - the overlay item. Do not delete
+ */
+EditorMapHover* EditorMap::getHoverItem()
+{
+  return hover_item;
+}
+
 /*
  * Description: Returns the ID of the editor map.
  *
@@ -3066,6 +3957,89 @@ QVector<EditorMapItem*> EditorMap::getItems(int sub_map)
   return blank_list;
 }
 
+/*
+ * Description: Returns the image files that a game export of the map writes:
+ *              the tile sprites, and the matrices and dialog images of the
+ *              base things, IOs, items, persons and npcs. Instances save only
+ *              their base reference, so they add none. Lay overs are not
+ *              included (see getLayPaths()).
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorMap::getImagePaths()
+{
+  QStringList paths;
+
+  for(int i = 0; i < sprites.size(); i++)
+    paths += sprites[i]->getPaths();
+
+  QVector<EditorMapThing*> things;
+  for(int i = 0; i < base_things.size(); i++)
+    things.push_back(base_things[i]);
+  for(int i = 0; i < base_items.size(); i++)
+    things.push_back(base_items[i]);
+  for(int i = 0; i < base_ios.size(); i++)
+  {
+    things.push_back(base_ios[i]);
+    QVector<EditorState*> states = base_ios[i]->getStates();
+    for(int j = 0; j < states.size(); j++)
+      if(states[j]->matrix != nullptr)
+        paths += states[j]->matrix->getPaths();
+  }
+  for(int i = 0; i < base_persons.size(); i++)
+  {
+    things.push_back(base_persons[i]);
+    QList<EditorMatrix*> states = base_persons[i]->getStates();
+    for(int j = 0; j < states.size(); j++)
+      if(states[j] != nullptr)
+        paths += states[j]->getPaths();
+  }
+  for(int i = 0; i < base_npcs.size(); i++)
+  {
+    things.push_back(base_npcs[i]);
+    QList<EditorMatrix*> states = base_npcs[i]->getStates();
+    for(int j = 0; j < states.size(); j++)
+      if(states[j] != nullptr)
+        paths += states[j]->getPaths();
+  }
+
+  for(int i = 0; i < things.size(); i++)
+  {
+    paths += things[i]->getDialogImage()->getPaths();
+    if(things[i]->getMatrix() != nullptr)
+      paths += things[i]->getMatrix()->getPaths();
+  }
+
+  return paths;
+}
+
+/*
+ * Description: Returns the image files used by the lay overs (over and under)
+ *              of all sub-maps, as full paths.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per lay over
+ */
+QStringList EditorMap::getLayPaths()
+{
+  QStringList paths;
+
+  for(int i = 0; i < sub_maps.size(); i++)
+  {
+    for(int j = 0; j < sub_maps[i]->lays_over.size(); j++)
+      if(!sub_maps[i]->lays_over[j].path.empty())
+        paths.push_back(EditorHelpers::getProjectPath(
+                    QString::fromStdString(sub_maps[i]->lays_over[j].path)));
+    for(int j = 0; j < sub_maps[i]->lays_under.size(); j++)
+      if(!sub_maps[i]->lays_under[j].path.empty())
+        paths.push_back(EditorHelpers::getProjectPath(
+                   QString::fromStdString(sub_maps[i]->lays_under[j].path)));
+  }
+
+  return paths;
+}
+
 /*
  * Description: Returns the map with the corresponding ID. NULL if ID doesn't
  *              match any map.
@@ -3200,7 +4174,37 @@ QString EditorMap::getName() const
  */
 QString EditorMap::getNameList()
 {
-  return EditorHelpers::getListString(id, name);
+  return EditorHelpers::getListString(id, name);
+}
+
+/*
+ * Description: Returns the check of the npc path against the passability of
+ *              the active sub-map, with blocked walks and the cycle time.
+ *              Only tiles changed since the last call are re-read and only
+ *              checks that read those tiles, or whose route changed, are
+ *              made again.
+ *
+ * Inputs: EditorMapNPC* npc - the npc instance on the active sub-map
+ * Output: PathCheck - the check of the npc path
+ */
+PathCheck EditorMap::getPathCheck(EditorMapNPC* npc)
+{
+  refreshPathGrid();
+  if(npc == nullptr)
+    return path_grid.checkPath(nullptr, 0);
+
+  /* Walking time per tile, as per the person speed */
+  int ms_per_tile = 0;
+  if(npc->getSpeed() > 0)
+    ms_per_tile = 4096 / npc->getSpeed();
+
+  /* Re-check only if not stored or the route changed */
+  EditorNPCPath* path = npc->getPath();
+  QHash<EditorNPCPath*, PathCheck>::iterator found = path_checks.find(path);
+  if(found == path_checks.end() ||
+     !EditorPathGrid::isSameRoute(found.value(), path, ms_per_tile))
+    found = path_checks.insert(path, path_grid.checkPath(path, ms_per_tile));
+  return found.value();
 }
 
 /*
@@ -3931,6 +4935,18 @@ QVector<EditorMapPerson*> EditorMap::getPersons(int sub_map)
   return blank_list;
 }
 
+/*
+ * Description: Returns the reachability overlay item. It is shared by all
+ *              sub-maps and always shows the active one.
+ *
+ * Inputs: none
+ * Output: EditorMapReach* - the overlay item. Do not delete
+ */
+EditorMapReach* EditorMap::getReachItem()
+{
+  return reach_item;
+}
+
 /*
  * Description: Returns the number of items that will be saved in the given
  *              map. Used for determing how far along the save process is.
@@ -4242,6 +5258,109 @@ TileIcons* EditorMap::getTileIcons()
   return tile_icons;
 }
 
+/*
+ * Description: Returns every game object reference in the map, across the
+ *              bases and all sub-maps: the battle scenes, music, tile events,
+ *              item instances and the sounds, locks and events of all things.
+ *              Base items are skipped since they mirror all game items.
+ *
+ * Inputs: none
+ * Output: QList<EditorUsage> - the references, with the place of each
+ */
+QList<EditorUsage> EditorMap::getUsages()
+{
+  QList<EditorUsage> usages;
+
+  /* Map battle scenes */
+  for(int i = 0; i < battle_scenes.size(); i++)
+    usages.push_back({EditorEnumDb::USE_BATTLESCENE, battle_scenes[i],
+                      "Battle Scenes"});
+
+  /* Bases */
+  for(int i = 0; i < base_ios.size(); i++)
+    addUsageIO(base_ios[i], "Base " + base_ios[i]->getNameList(), &usages);
+  for(int i = 0; i < base_npcs.size(); i++)
+    addUsageThing(base_npcs[i], "Base " + base_npcs[i]->getNameList(),
+                  &usages);
+  for(int i = 0; i < base_persons.size(); i++)
+    addUsageThing(base_persons[i], "Base " + base_persons[i]->getNameList(),
+                  &usages);
+  for(int i = 0; i < base_things.size(); i++)
+    addUsageThing(base_things[i], "Base " + base_things[i]->getNameList(),
+                  &usages);
+
+  /* Sub-maps */
+  for(int i = 0; i < sub_maps.size(); i++)
+  {
+    SubMapInfo* map = sub_maps[i];
+    QString sub = getMapNameList(i) + " - ";
+
+    /* Scenes and music */
+    for(int j = 0; j < map->battle_scenes.size(); j++)
+      usages.push_back({EditorEnumDb::USE_BATTLESCENE, map->battle_scenes[j],
+                        sub + "Battle Scenes"});
+    for(int j = 0; j < map->music.size(); j++)
+      usages.push_back({EditorEnumDb::USE_MUSIC, map->music[j],
+                        sub + "Music"});
+
+    /* Tile events */
+    for(int x = 0; x < map->tiles.size(); x++)
+    {
+      for(int y = 0; y < map->tiles[x].size(); y++)
+      {
+        EditorTile* tile = map->tiles[x][y];
+        if(!tile->getEventEnter()->isEmpty() ||
+           !tile->getEventExit()->isEmpty())
+        {
+          QString where = sub + "Tile (" + QString::number(x) + "," +
+                          QString::number(y) + ")";
+          addUsageEvents(tile->getEventEnter(), where + " Enter", &usages);
+          addUsageEvents(tile->getEventExit(), where + " Exit", &usages);
+        }
+      }
+    }
+
+    /* Instances */
+    for(int j = 0; j < map->ios.size(); j++)
+      addUsageIO(map->ios[j], sub + map->ios[j]->getNameList(), &usages);
+    for(int j = 0; j < map->items.size(); j++)
+    {
+      EditorMapItem* item = map->items[j];
+      QString where = sub + item->getNameList();
+      if(item->getBaseItem() != nullptr)
+      {
+        usages.push_back({EditorEnumDb::USE_ITEM, item->getBaseItem()->getID(),
+                          where});
+        usages.push_back({EditorEnumDb::USE_SOUND, item->getSoundID(),
+                          where + " Sound"});
+      }
+      addUsageThing(item, where, &usages);
+    }
+    for(int j = 0; j < map->npcs.size(); j++)
+      addUsageThing(map->npcs[j], sub + map->npcs[j]->getNameList(), &usages);
+    for(int j = 0; j < map->persons.size(); j++)
+      addUsageThing(map->persons[j], sub + map->persons[j]->getNameList(),
+                    &usages);
+    for(int j = 0; j < map->things.size(); j++)
+      addUsageThing(map->things[j], sub + map->things[j]->getNameList(),
+                    &usages);
+  }
+
+  return usages;
+}
+
+/*
+ * Description: Returns the visibility information of the map. It is shared by
+ *              all tiles in all sub-maps and read when painting.
+ *
+ * Inputs: none
+ * Output: VisibilityInfo* - ref to visibility info struct
+ */
+VisibilityInfo* EditorMap::getVisibilityInfo()
+{
+  return &visible_info;
+}
+
 /*
  * Description: Returns if there is space to add another IO, be it a base
  *              or an instance.
@@ -4405,139 +5524,391 @@ bool EditorMap::isSpaceForThing(bool instance)
 /*
  * Description: Loads the map data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMap::load(XmlData data, int index)
+void EditorMap::load(XmlData &data, int index)
 {
+  EditorEnumDb::XmlTag tag = EditorHelpers::getXmlTag(data.getElement(index));
+  bool has_id = (data.getKey(index) == "id");
+
   /* Parse the data for the map */
-  if(data.getElement(index) == "name")
+  switch(tag)
   {
-    setName(QString::fromStdString(data.getDataString()));
-  }
-  else if(data.getElement(index) == "battlescene")
-  {
-    int scene_id = data.getDataInteger();
-    if(scene_id >= 0)
-      battle_scenes.push_back(scene_id);
-  }
-  else if(data.getElement(index) == "sprite" && data.getKey(index) == "id")
-  {
-    int sprite_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorSprite* sprite = getSprite(sprite_id);
+    case EditorEnumDb::XML_NAME:
+    {
+      setName(QString::fromStdString(data.getDataString()));
+      break;
+    }
+    case EditorEnumDb::XML_BATTLESCENE:
+    {
+      int scene_id = data.getDataInteger();
+      if(scene_id >= 0)
+        battle_scenes.push_back(scene_id);
+      break;
+    }
+    case EditorEnumDb::XML_SPRITE:
+    {
+      if(!has_id)
+        break;
+      int sprite_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorSprite* sprite = getSprite(sprite_id);
+
+      /* Create new sprite if it doesn't exist */
+      if(sprite == NULL)
+      {
+        sprite = new EditorSprite();
+        sprite->setID(sprite_id);
+        setSprite(sprite);
+      }
 
-    /* Create new sprite if it doesn't exist */
-    if(sprite == NULL)
+      /* Continue to parse the data in the sprite */
+      sprite->load(data, index + 1);
+      break;
+    }
+    case EditorEnumDb::XML_MAPTHING:
     {
-      sprite = new EditorSprite();
-      sprite->setID(sprite_id);
-      setSprite(sprite);
+      if(!has_id)
+        break;
+      int thing_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapThing* thing = getThing(thing_id);
+
+      /* Create new thing if it doesn't exist */
+      if(thing == NULL)
+      {
+        thing = new EditorMapThing(thing_id);
+        thing->setTileIcons(getTileIcons());
+        setThing(thing);
+      }
+
+      /* Continue to parse the data in the thing */
+      thing->load(data, index + 1);
+      break;
     }
+    case EditorEnumDb::XML_MAPIO:
+    {
+      if(!has_id)
+        break;
+      int io_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapIO* io = getIO(io_id);
 
-    /* Continue to parse the data in the sprite */
-    sprite->load(data, index + 1);
-  }
-  else if(data.getElement(index) == "mapthing" && data.getKey(index) == "id")
-  {
-    int thing_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapThing* thing = getThing(thing_id);
+      /* Create new IO if it doesn't exist */
+      if(io == NULL)
+      {
+        io = new EditorMapIO(io_id);
+        io->setTileIcons(getTileIcons());
+        setIO(io);
+      }
+
+      /* Continue to parse the data in the IO */
+      io->load(data, index + 1);
+      break;
+    }
+    // Note: removed for new bases controlled by core group - delete future?
+    //case EditorEnumDb::XML_MAPITEM:
+    //{
+    //  if(!has_id)
+    //    break;
+    //  int item_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+    //  EditorMapItem* item = getItem(item_id);
+    //
+    //  /* Create new item if it doesn't exist */
+    //  if(item == NULL)
+    //  {
+    //    item = new EditorMapItem(item_id);
+    //    item->setTileIcons(getTileIcons());
+    //    setItem(item);
+    //  }
+    //
+    //  /* Continue to parse the data in the item */
+    //  item->load(data, index + 1);
+    //  break;
+    //}
+    case EditorEnumDb::XML_MAPPERSON:
+    {
+      if(!has_id)
+        break;
+      int person_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapPerson* person = getPerson(person_id);
+
+      /* Create new person if it doesn't exist */
+      if(person == NULL)
+      {
+        person = new EditorMapPerson(person_id);
+        person->setTileIcons(getTileIcons());
+        setPerson(person);
+      }
 
-    /* Create new thing if it doesn't exist */
-    if(thing == NULL)
+      /* Continue to parse the data in the person */
+      person->load(data, index + 1);
+      break;
+    }
+    case EditorEnumDb::XML_MAPNPC:
     {
-      thing = new EditorMapThing(thing_id);
-      thing->setTileIcons(getTileIcons());
-      setThing(thing);
+      if(!has_id)
+        break;
+      int npc_id = QString::fromStdString(data.getKeyValue(index)).toInt();
+      EditorMapNPC* npc = getNPC(npc_id);
+
+      /* Create new npc if it doesn't exist */
+      if(npc == NULL)
+      {
+        npc = new EditorMapNPC(npc_id);
+        npc->setTileIcons(getTileIcons());
+        setNPC(npc);
+      }
+
+      /* Continue to parse the data in the npc */
+      npc->load(data, index + 1);
+      break;
     }
+    case EditorEnumDb::XML_MAIN:
+    case EditorEnumDb::XML_SECTION:
+    {
+      if(tag == EditorEnumDb::XML_SECTION && !has_id)
+        break;
+      int id = 0;
+      if(tag == EditorEnumDb::XML_SECTION)
+        id = QString::fromStdString(data.getKeyValue(index)).toInt();
+
+      /* Attempt to get map. If it doesn't exist, make new */
+      SubMapInfo* access_map = getMap(id);
+      if(access_map == NULL)
+      {
+        int index = setMap(id, "TEMP", 1, 1, false);
+        access_map = getMapByIndex(index);
+      }
 
-    /* Continue to parse the data in the thing */
-    thing->load(data, index + 1);
+      /* Proceed to modify the map as needed */
+      loadSubMap(access_map, data, index + 1);
+      break;
+    }
+    default:
+      break;
   }
-  else if(data.getElement(index) == "mapio" && data.getKey(index) == "id")
-  {
-    int io_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapIO* io = getIO(io_id);
+}
+
+/*
+ * Description: Replaces the lay over image files (over and under) of all
+ *              sub-maps that are in the remap, keyed by full path.
+ *
+ * Inputs: const QHash<QString,QString> &remap - new paths, by old path
+ * Output: int - the number of lay overs remapped
+ */
+int EditorMap::remapLayPaths(const QHash<QString,QString> &remap)
+{
+  int count = 0;
 
-    /* Create new IO if it doesn't exist */
-    if(io == NULL)
+  for(int i = 0; i < sub_maps.size(); i++)
+  {
+    QVector<LayOver>* lay_sets[] = {&sub_maps[i]->lays_over,
+                                    &sub_maps[i]->lays_under};
+    for(QVector<LayOver>* lays : lay_sets)
     {
-      io = new EditorMapIO(io_id);
-      io->setTileIcons(getTileIcons());
-      setIO(io);
+      for(int j = 0; j < lays->size(); j++)
+      {
+        QString path = QDir::fromNativeSeparators(
+                         EditorHelpers::getProjectPath(
+                                   QString::fromStdString((*lays)[j].path)));
+        if(remap.contains(path))
+        {
+          (*lays)[j].path =
+                   EditorHelpers::trimPath(remap.value(path)).toStdString();
+          count++;
+        }
+      }
     }
-
-    /* Continue to parse the data in the IO */
-    io->load(data, index + 1);
   }
-  // Note: removed for new bases controlled by core group - delete future?
-  //else if(data.getElement(index) == "mapitem" && data.getKey(index) == "id")
-  //{
-  //  int item_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-  //  EditorMapItem* item = getItem(item_id);
-  //
-  //  /* Create new item if it doesn't exist */
-  //  if(item == NULL)
-  //  {
-  //    item = new EditorMapItem(item_id);
-  //    item->setTileIcons(getTileIcons());
-  //    setItem(item);
-  //  }
-  //
-  //  /* Continue to parse the data in the item */
-  //  item->load(data, index + 1);
-  //}
-  else if(data.getElement(index) == "mapperson" && data.getKey(index) == "id")
+
+  return count;
+}
+
+/*
+ * Description: Replays a tile or thing record of the edit journal onto the
+ *              map (see journalTiles(), journalThing() and journalRemove()).
+ *              Records that no longer apply, such as for a sub-map or base
+ *              thing that was not recovered, are skipped.
+ *
+ * Inputs: const EditorJournalRecord &record - the record to replay
+ * Output: bool - true if the record was replayed
+ */
+bool EditorMap::replayJournal(const EditorJournalRecord &record)
+{
+  ThingBase type = static_cast<ThingBase>(record.kind);
+
+  /* ---- TILE STATES ---- */
+  if(record.type == EditorEnumDb::JOURNAL_TILES)
   {
-    int person_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapPerson* person = getPerson(person_id);
+    SubMapInfo* map = getMap(record.sub_id);
+    QVector<EditorEnumDb::Layer> layers = getJournalLayers(false);
+    QVector<EditorEnumDb::Layer> pass_layers = getJournalLayers(true);
+    QRect rect = record.rect;
+    QByteArray states = qUncompress(record.data);
 
-    /* Create new person if it doesn't exist */
-    if(person == NULL)
+    if(map != nullptr && map->tiles.size() > 0 && !rect.isEmpty() &&
+       QRect(0, 0, map->tiles.size(),
+             map->tiles.front().size()).contains(rect) &&
+       states.size() == rect.width() * rect.height() *
+                        (layers.size() * 4 + pass_layers.size()))
     {
-      person = new EditorMapPerson(person_id);
-      person->setTileIcons(getTileIcons());
-      setPerson(person);
-    }
+      QDataStream in(states);
+      in.setVersion(QDataStream::Qt_5_0);
+      detachTiles(map, rect.x(), rect.y(), rect.width(), rect.height());
+
+      /* Sprites by ID */
+      QHash<int,EditorSprite*> sprite_set;
+      for(int i = 0; i < sprites.size(); i++)
+        sprite_set.insert(sprites[i]->getID(), sprites[i]);
+
+      for(int i = rect.left(); i <= rect.right(); i++)
+      {
+        for(int j = rect.top(); j <= rect.bottom(); j++)
+        {
+          EditorTile* tile = map->tiles[i][j];
+          for(int k = 0; k < layers.size(); k++)
+          {
+            qint32 sprite_id;
+            in >> sprite_id;
+            EditorSprite* sprite = sprite_set.value(sprite_id, nullptr);
+            if(sprite != nullptr)
+              tile->place(layers[k], sprite, true);
+            else
+              tile->unplace(layers[k]);
+          }
+          for(int k = 0; k < pass_layers.size(); k++)
+          {
+            quint8 pass_num;
+            in >> pass_num;
+            tile->setPassabilityNum(pass_layers[k], pass_num);
+          }
+        }
+      }
 
-    /* Continue to parse the data in the person */
-    person->load(data, index + 1);
+      resetAnimatedTiles(map);
+      updateTiles(map, rect.x(), rect.y(), rect.width(), rect.height());
+      return true;
+    }
   }
-  else if(data.getElement(index) == "mapnpc" && data.getKey(index) == "id")
+  /* ---- THING ADD ---- */
+  else if(record.type == EditorEnumDb::JOURNAL_THING_ADD)
   {
-    int npc_id = QString::fromStdString(data.getKeyValue(index)).toInt();
-    EditorMapNPC* npc = getNPC(npc_id);
+    SubMapInfo* map = getMap(record.sub_id);
+    EditorMapThing* thing = nullptr;
 
-    /* Create new npc if it doesn't exist */
-    if(npc == NULL)
+    if(map != nullptr &&
+       getThingGeneric(type, record.id, getMapIndex(record.sub_id)) == nullptr)
     {
-      npc = new EditorMapNPC(npc_id);
-      npc->setTileIcons(getTileIcons());
-      setNPC(npc);
+      if(type == ThingBase::THING && getThing(record.base_id) != nullptr)
+      {
+        thing = new EditorMapThing(record.id);
+        thing->setBase(getThing(record.base_id));
+      }
+      else if(type == ThingBase::ITEM && getItem(record.base_id) != nullptr)
+      {
+        EditorMapItem* item = new EditorMapItem(record.id);
+        item->setBase(getItem(record.base_id));
+        thing = item;
+      }
+      else if(type == ThingBase::INTERACTIVE &&
+              getIO(record.base_id) != nullptr)
+      {
+        EditorMapIO* io = new EditorMapIO(record.id);
+        io->setBase(getIO(record.base_id));
+        thing = io;
+      }
+      else if(type == ThingBase::PERSON &&
+              getPerson(record.base_id) != nullptr)
+      {
+        EditorMapPerson* person = new EditorMapPerson(record.id);
+        person->setBase(getPerson(record.base_id));
+        thing = person;
+      }
+      else if(type == ThingBase::NPC && getNPC(record.base_id) != nullptr)
+      {
+        EditorMapNPC* npc = new EditorMapNPC(record.id);
+        npc->setBase(getNPC(record.base_id));
+        thing = npc;
+      }
     }
 
-    /* Continue to parse the data in the npc */
-    npc->load(data, index + 1);
+    /* Attempt to place - if failed, delete */
+    if(thing != nullptr)
+    {
+      thing->setX(record.pos.x());
+      thing->setY(record.pos.y());
+      if(addThingGeneric(thing, map, false))
+        return true;
+      delete thing;
+    }
   }
-  else if(data.getElement(index) == "main" ||
-          (data.getElement(index) == "section" && data.getKey(index) == "id"))
+  /* ---- THING MOVE ---- */
+  else if(record.type == EditorEnumDb::JOURNAL_THING_MOVE)
   {
-    int id = -1;
-    if(data.getElement(index) == "main")
-      id = 0;
-    else
-      id = QString::fromStdString(data.getKeyValue(index)).toInt();
+    int index = getMapIndex(record.sub_id);
+    if(index >= 0)
+      return moveThing(getThingGeneric(type, record.id, index),
+                       record.pos.x(), record.pos.y(), sub_maps[index]);
+  }
+  /* ---- THING REMOVE ---- */
+  else if(record.type == EditorEnumDb::JOURNAL_THING_REMOVE)
+  {
+    if(type == ThingBase::THING)
+      return unsetThing(record.id, true);
+    else if(type == ThingBase::ITEM)
+      return unsetItem(record.id, true);
+    else if(type == ThingBase::INTERACTIVE)
+      return unsetIO(record.id, true);
+    else if(type == ThingBase::PERSON)
+      return unsetPerson(record.id, true);
+    else if(type == ThingBase::NPC)
+      return unsetNPC(record.id, true);
+  }
 
-    /* Attempt to get map. If it doesn't exist, make new */
-    SubMapInfo* access_map = getMap(id);
-    if(access_map == NULL)
-    {
-      int index = setMap(id, "TEMP", 1, 1, false);
-      access_map = getMapByIndex(index);
-    }
+  return false;
+}
+
+/*
+ * Description: Resets the index of the animated tiles of the sub-map, or all
+ *              sub-maps. It is rebuilt the next time it is used. Called after
+ *              tiles or things on the sub-map change.
+ *
+ * Inputs: SubMapInfo* map - the sub-map. NULL for all sub-maps
+ * Output: none
+ */
+void EditorMap::resetAnimatedTiles(SubMapInfo* map)
+{
+  if(map != nullptr)
+  {
+    map->animated_tiles.clear();
+    map->animated_valid = false;
+  }
+  else
+  {
+    for(int i = 0; i < sub_maps.size(); i++)
+      resetAnimatedTiles(sub_maps[i]);
+  }
+}
 
-    /* Proceed to modify the map as needed */
-    loadSubMap(access_map, data, index + 1);
+/*
+ * Description: Resets the index of the event tiles of the sub-map, or all
+ *              sub-maps. It is rebuilt the next time it is used. Called after
+ *              the tiles of the sub-map are replaced or loaded.
+ *
+ * Inputs: SubMapInfo* map - the sub-map. NULL for all sub-maps
+ * Output: none
+ */
+void EditorMap::resetEventTiles(SubMapInfo* map)
+{
+  if(map != nullptr)
+  {
+    map->event_tiles.clear();
+    map->event_valid = false;
+  }
+  else
+  {
+    for(int i = 0; i < sub_maps.size(); i++)
+      resetEventTiles(sub_maps[i]);
   }
 }
 
@@ -4639,6 +6010,19 @@ void EditorMap::save(FileHandler* fh, QProgressDialog* save_dialog,
   }
 }
 
+/*
+ * Description: Sets the animation clock time painted by the animated preview.
+ *              Tiles read it on paint; only the changed tiles are repainted by
+ *              the caller.
+ *
+ * Inputs: qint64 time - the animation clock time, in ms
+ * Output: none
+ */
+void EditorMap::setAnimationTime(qint64 time)
+{
+  visible_info.animate_time = time;
+}
+
 /*
  * Description: Sets the battle scene reference ID for the core base. This
  *              function is capable of replacing at index or inserting.
@@ -4682,9 +6066,6 @@ bool EditorMap::setCurrentIO(int index)
 {
   if(index >= -1 && index < base_ios.size())
   {
-    /* Unset the hover, if relevant */
-    updateHoverThing(true);
-
     /* If index is -1, unset the current IO */
     if(index == -1)
       active_info.active_io = NULL;
@@ -4692,8 +6073,8 @@ bool EditorMap::setCurrentIO(int index)
     else
       active_info.active_io = base_ios[index];
 
-    /* Set the hover, if relevant */
-    updateHoverThing();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4712,9 +6093,6 @@ bool EditorMap::setCurrentItem(int index)
 {
   if(index >= -1 && index < base_items.size())
   {
-    /* Unset the hover, if relevant */
-    updateHoverThing(true);
-
     /* If index is -1, unset the current item */
     if(index == -1)
       active_info.active_item = NULL;
@@ -4722,8 +6100,8 @@ bool EditorMap::setCurrentItem(int index)
     else
       active_info.active_item = base_items[index];
 
-    /* Set the hover, if relevant */
-    updateHoverThing();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4753,11 +6131,10 @@ bool EditorMap::setCurrentMap(int index)
     active_info.move_thing = nullptr;
     active_info.selected_thing = QRect();
 
-    /* Clear the new sub-map hover tiles */
-    if(active_submap != NULL)
-      for(int i = 0; i < sub_maps[index]->tiles.size(); i++)
-        for(int j = 0; j < sub_maps[index]->tiles[i].size(); j++)
-          sub_maps[index]->tiles[i][j]->setHover(false);
+    /* Point the hover preview and reachability at the new sub-map */
+    hover_item->setSubMap(active_submap);
+    reach_start = QPoint(-1, -1);
+    updateReach();
 
     /* Trigger all instance updates - connected in widgets */
     emit activeSubChanged();
@@ -4784,9 +6161,6 @@ bool EditorMap::setCurrentNPC(int index)
 {
   if(index >= -1 && index < base_npcs.size())
   {
-    /* Unset the hover, if relevant */
-    updateHoverThing(true);
-
     /* If index is -1, unset the current npc */
     if(index == -1)
       active_info.active_npc = NULL;
@@ -4794,8 +6168,8 @@ bool EditorMap::setCurrentNPC(int index)
     else
       active_info.active_npc = base_npcs[index];
 
-    /* Set the hover, if relevant */
-    updateHoverThing();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4814,9 +6188,6 @@ bool EditorMap::setCurrentPerson(int index)
 {
   if(index >= -1 && index < base_persons.size())
   {
-    /* Unset the hover, if relevant */
-    updateHoverThing(true);
-
     /* If index is -1, unset the current person */
     if(index == -1)
       active_info.active_person = NULL;
@@ -4824,8 +6195,8 @@ bool EditorMap::setCurrentPerson(int index)
     else
       active_info.active_person = base_persons[index];
 
-    /* Set the hover, if relevant */
-    updateHoverThing();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4851,9 +6222,8 @@ bool EditorMap::setCurrentSprite(int index)
     else
       active_info.active_sprite = sprites[index];
 
-    /* If the tile in the active info isn't null, update it */
-    if(active_info.hover_tile != NULL)
-      active_info.hover_tile->update();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4872,9 +6242,6 @@ bool EditorMap::setCurrentThing(int index)
 {
   if(index >= -1 && index < base_things.size())
   {
-    /* Unset the hover, if relevant */
-    updateHoverThing(true);
-
     /* If index is -1, unset the current thing */
     if(index == -1)
       active_info.active_thing = NULL;
@@ -4882,8 +6249,8 @@ bool EditorMap::setCurrentThing(int index)
     else
       active_info.active_thing = base_things[index];
 
-    /* Set the hover, if relevant */
-    updateHoverThing();
+    /* Update the hover preview */
+    updateHover();
 
     return true;
   }
@@ -4898,16 +6265,12 @@ bool EditorMap::setCurrentThing(int index)
  */
 void EditorMap::setHoverCursor(EditorEnumDb::CursorMode cursor)
 {
-  /* First, unset hover if relevant */
-  updateHoverThing(true);
-
   /* Set the cursor */
   active_info.active_cursor = cursor;
   active_info.move_thing = nullptr;
 
-  /* Try and set hover, if relevant */
-  if(!updateHoverThing() && active_info.hover_tile != NULL)
-    active_info.hover_tile->update();
+  /* Update the hover preview */
+  updateHover();
 }
 
 /*
@@ -4947,16 +6310,12 @@ bool EditorMap::setHoverItem(int id)
  */
 void EditorMap::setHoverLayer(EditorEnumDb::Layer layer)
 {
-  /* First, unset hover if relevant */
-  updateHoverThing(true);
-
   /* Set the layer */
   active_info.active_layer = layer;
   active_info.move_thing = nullptr;
 
-  /* Try and set hover, if relevant */
-  if(!updateHoverThing() && active_info.hover_tile != NULL)
-    active_info.hover_tile->update();
+  /* Update the hover preview */
+  updateHover();
 }
 
 /*
@@ -4982,13 +6341,10 @@ bool EditorMap::setHoverNPC(int id)
  */
 void EditorMap::setHoverPathMode(bool path_mode)
 {
-  /* First, unset hover if relevant */
-  updateHoverThing(true);
-
   active_info.path_edit_mode = path_mode;
 
-  if(active_info.hover_tile != NULL)
-    active_info.hover_tile->update();
+  /* Update the hover preview */
+  updateHover();
 }
 
 /*
@@ -5021,28 +6377,19 @@ bool EditorMap::setHoverThing(int id)
 
 /*
  * Description: Sets the hovering tile. If the pen is place and on thing layer,
- *              it hovers to the size of the placing thing. Otherwise, just
- *              a single tile. Always unsets the previous hovered tiles prior
- *              to proceeding.
+ *              the hover preview covers the size of the placing thing.
+ *              Otherwise, just a single tile.
  *
  * Inputs: EditorTile* tile - the new hover tile
  * Output: none
  */
 void EditorMap::setHoverTile(EditorTile* tile)
 {
-  /* First, unset hover if relevant */
-  updateHoverThing(true);
-
   /* Set the hover tile */
-  if(active_info.hover_tile != NULL)
-    active_info.hover_tile->setHover(false);
   active_info.hover_tile = tile;
-  if(active_info.hover_tile != NULL)
-    active_info.hover_tile->setHover(true);
 
-  /* Try and set hover, if relevant */
-  if(!updateHoverThing() && active_info.hover_tile != NULL)
-    active_info.hover_tile->update();
+  /* Update the hover preview */
+  updateHover();
 }
 
 /*
@@ -5146,6 +6493,8 @@ int EditorMap::setIO(EditorMapIO* io, int sub_map)
         }
 
         /* Add to tile */
+        detachTiles(sub_maps[sub_map], x_start, y_start,
+                    x_end - x_start, y_end - y_start);
         for(int i = x_start; i < x_end; i++)
           for(int j = y_start; j < y_end; j++)
             sub_maps[sub_map]->tiles[i][j]->setIO(io);
@@ -5243,6 +6592,8 @@ int EditorMap::setItem(EditorMapItem* item, int sub_map)
         }
 
         /* Add to tile */
+        detachTiles(sub_maps[sub_map], x_start, y_start,
+                    x_end - x_start, y_end - y_start);
         for(int i = x_start; i < x_end; i++)
         {
           for(int j = y_start; j < y_end; j++)
@@ -5351,11 +6702,10 @@ int EditorMap::setMap(int id, QString name,
       sub_maps[index]->name = name;
 
       /* Delete existing tiles */
-      for(int i = 0; i < sub_maps[index]->tiles.size(); i++)
-        for(int j = 0; j < sub_maps[index]->tiles[i].size(); j++)
-          delete sub_maps[index]->tiles[i][j];
+      releaseTiles(sub_maps[index]);
 
       sub_maps[index]->tiles = tiles;
+      resetEventTiles(sub_maps[index]);
     }
     else
     {
@@ -5366,6 +6716,8 @@ int EditorMap::setMap(int id, QString name,
       info->path_top = NULL;
       info->weather = -1;
       info->center_point = QPoint(0, 0);
+      info->animated_valid = false;
+      info->event_valid = false;
 
       /* If near, insert the information into the index */
       if(near)
@@ -5413,7 +6765,7 @@ int EditorMap::setMap(int id, QString name, int width, int height,
       for(int j = 0; j < height; j++)
       {
         row.push_back(new EditorTile(i, j, tile_icons));
-        row.last()->setHoverInfo(&active_info);
+        row.last()->setVisibilityInfo(&visible_info);
       }
 
       tiles.push_back(row);
@@ -5533,6 +6885,8 @@ int EditorMap::setNPC(EditorMapNPC* npc, int sub_map)
           emit npcPathAdd(npc->getPath());
 
         /* Add to tiles */
+        detachTiles(sub_maps[sub_map], x_start, y_start,
+                    x_end - x_start, y_end - y_start);
         for(int i = x_start; i < x_end; i++)
           for(int j = y_start; j < y_end; j++)
             sub_maps[sub_map]->tiles[i][j]->setNPC(npc);
@@ -5645,6 +6999,8 @@ int EditorMap::setPerson(EditorMapPerson* person, int sub_map)
         }
 
         /* Add to tile */
+        detachTiles(sub_maps[sub_map], x_start, y_start,
+                    x_end - x_start, y_end - y_start);
         for(int i = x_start; i < x_end; i++)
           for(int j = y_start; j < y_end; j++)
             sub_maps[sub_map]->tiles[i][j]->setPerson(person);
@@ -5656,6 +7012,21 @@ int EditorMap::setPerson(EditorMapPerson* person, int sub_map)
   return -1;
 }
 
+/*
+ * Description: Sets the tile the reachability of the active sub-map floods
+ *              from, along with the teleport targets into it. Cleared each
+ *              time the active sub-map changes.
+ *
+ * Inputs: int x - the x tile location. -1 to clear
+ *         int y - the y tile location. -1 to clear
+ * Output: none
+ */
+void EditorMap::setReachStart(int x, int y)
+{
+  reach_start = QPoint(x, y);
+  updateReach();
+}
+
 /*
  * Description: Sets the sprite in the set within the editor map. If a sprite,
  *              already exists with the ID, it deletes the existing one.
@@ -5794,6 +7165,8 @@ int EditorMap::setThing(EditorMapThing* thing, int sub_map)
         }
 
         /* Add to tile */
+        detachTiles(sub_maps[sub_map], x_start, y_start,
+                    x_end - x_start, y_end - y_start);
         for(int i = x_start; i < x_end; i++)
           for(int j = y_start; j < y_end; j++)
             sub_maps[sub_map]->tiles[i][j]->setThing(thing);
@@ -5822,7 +7195,8 @@ void EditorMap::setTileIcons(TileIcons* icons)
 }
 
 /*
- * Description: Sets the layer visibility in all tiles within the sub-maps.
+ * Description: Sets the layer visibility for all tiles within the sub-maps.
+ *              Only the shared state changes; tiles read it on paint.
  *
  * Inputs: EditorEnumDb::Layer layer - the layer to switch visibility on
  *         bool visible - true if the layer is visible
@@ -5830,14 +7204,12 @@ void EditorMap::setTileIcons(TileIcons* icons)
  */
 void EditorMap::setVisibility(EditorEnumDb::Layer layer, bool visible)
 {
-  /* Reference tile */
-  ref_tile.setVisibility(layer, visible);
-
-  /* Main tile set */
-  for(int i = 0; i < sub_maps.size(); i++)
-    for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
-      for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
-        sub_maps[i]->tiles[j][k]->setVisibility(layer, visible);
+  if(layer >= EditorEnumDb::BASE && layer < EditorEnumDb::NO_LAYER &&
+     visible_info.layers[layer] != visible)
+  {
+    visible_info.layers[layer] = visible;
+    emit visibilityChanged();
+  }
 
   /* If layer is npc, pass visibility to paths as well */
   // TODO: TEMP - this should eventually be handled by own enum and default to
@@ -5846,6 +7218,24 @@ void EditorMap::setVisibility(EditorEnumDb::Layer layer, bool visible)
       setVisibilityPaths(visible);
 }
 
+/*
+ * Description: Sets the animated preview on all sub-map tiles. While set,
+ *              animated sprites paint the frame of the animation clock time
+ *              instead of the active frame. Controlled by the map view.
+ *
+ * Inputs: bool visible - is the animation visible?
+ * Output: none
+ */
+void EditorMap::setVisibilityAnimate(bool visible)
+{
+  if(visible_info.animate != visible)
+  {
+    visible_info.animate = visible;
+    resetAnimatedTiles();
+    emit visibilityChanged();
+  }
+}
+
 /*
  * Description: Sets the event notifiers visibility on all sub-map tiles.
  *              Controlled by the map view.
@@ -5855,14 +7245,11 @@ void EditorMap::setVisibility(EditorEnumDb::Layer layer, bool visible)
  */
 void EditorMap::setVisibilityEvents(bool visible)
 {
-  /* Reference tile set */
-  ref_tile.setVisibilityEvents(visible);
-
-  /* Main tile set */
-  for(int i = 0; i < sub_maps.size(); i++)
-    for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
-      for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
-        sub_maps[i]->tiles[j][k]->setVisibilityEvents(visible);
+  if(visible_info.events != visible)
+  {
+    visible_info.events = visible;
+    emit visibilityChanged();
+  }
 }
 
 /*
@@ -5874,14 +7261,11 @@ void EditorMap::setVisibilityEvents(bool visible)
  */
 void EditorMap::setVisibilityGrid(bool visible)
 {
-  /* Reference tile set */
-  ref_tile.setVisibilityGrid(visible);
-
-  /* Main tile set */
-  for(int i = 0; i < sub_maps.size(); i++)
-    for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
-      for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
-        sub_maps[i]->tiles[j][k]->setVisibilityGrid(visible);
+  if(visible_info.grid != visible)
+  {
+    visible_info.grid = visible;
+    emit visibilityChanged();
+  }
 }
 
 /*
@@ -5893,14 +7277,11 @@ void EditorMap::setVisibilityGrid(bool visible)
  */
 void EditorMap::setVisibilityPass(bool visible)
 {
-  /* Reference tile set */
-  ref_tile.setVisibilityPass(visible);
-
-  /* Main tile set */
-  for(int i = 0; i < sub_maps.size(); i++)
-    for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
-      for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
-        sub_maps[i]->tiles[j][k]->setVisibilityPass(visible);
+  if(visible_info.passability != visible)
+  {
+    visible_info.passability = visible;
+    emit visibilityChanged();
+  }
 }
 
 /*
@@ -5923,26 +7304,34 @@ void EditorMap::setVisibilityPaths(bool visible)
 }
 
 /*
- * Description: Sets the visibility of all sub-maps based on reference
- *              internal tile.
+ * Description: Sets the reachability overlay visibility. The active sub-map
+ *              is flooded as it is shown. Controlled by the map view.
+ *
+ * Inputs: bool visible - is the reachability visible?
+ * Output: none
+ */
+void EditorMap::setVisibilityReach(bool visible)
+{
+  if(visible_info.reachability != visible)
+  {
+    visible_info.reachability = visible;
+    updateReach();
+    emit visibilityChanged();
+  }
+}
+
+/*
+ * Description: Sets the visibility of all sub-map npc paths based on the map
+ *              visibility. Tiles share the map visibility info directly.
  *
  * Inputs: none
  * Output: none
  */
 void EditorMap::setVisibilityRef()
 {
-  /* Main tile s*/
   for(int i = 0; i < sub_maps.size(); i++)
-  {
-    /* Main tile set */
-    for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
-      for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
-        sub_maps[i]->tiles[j][k]->setVisibilityTile(&ref_tile);
-
-    /* NPC paths */
     for(int j = 0; j < sub_maps[i]->npcs.size(); j++)
       sub_maps[i]->npcs[j]->getPath()->setVisibleControl(visible_path);
-  }
 }
 
 /*
@@ -6007,6 +7396,7 @@ void EditorMap::tilesIORemove(bool update_all)
   {
     for(int i = 0; i < sub_maps.size(); i++)
     {
+      markPassChanged(sub_maps[i]);
       for(int j = 0; j < sub_maps[i]->ios.size(); j++)
       {
         EditorMapIO* io = sub_maps[i]->ios[j];
@@ -6026,6 +7416,7 @@ void EditorMap::tilesIORemove(bool update_all)
   {
     if(active_submap != NULL)
     {
+      markPassChanged(active_submap);
       /* Clear selection */
       setHoverThing(-1);
 
@@ -6236,6 +7627,7 @@ void EditorMap::tilesNPCRemove(bool update_all)
   {
     for(int i = 0; i < sub_maps.size(); i++)
     {
+      markPassChanged(sub_maps[i]);
       for(int j = 0; j < sub_maps[i]->npcs.size(); j++)
       {
         EditorMapNPC* npc = sub_maps[i]->npcs[j];
@@ -6255,6 +7647,7 @@ void EditorMap::tilesNPCRemove(bool update_all)
   {
     if(active_submap != NULL)
     {
+      markPassChanged(active_submap);
       for(int i = 0; i < active_submap->npcs.size(); i++)
       {
         EditorMapNPC* npc = active_submap->npcs[i];
@@ -6334,6 +7727,7 @@ void EditorMap::tilesPersonRemove(bool update_all)
   {
     for(int i = 0; i < sub_maps.size(); i++)
     {
+      markPassChanged(sub_maps[i]);
       for(int j = 0; j < sub_maps[i]->persons.size(); j++)
       {
         EditorMapPerson* person = sub_maps[i]->persons[j];
@@ -6353,6 +7747,7 @@ void EditorMap::tilesPersonRemove(bool update_all)
   {
     if(active_submap != NULL)
     {
+      markPassChanged(active_submap);
       /* Clear selection */
       setHoverThing(-1);
 
@@ -6435,6 +7830,7 @@ void EditorMap::tilesThingRemove(bool update_all)
   {
     for(int i = 0; i < sub_maps.size(); i++)
     {
+      markPassChanged(sub_maps[i]);
       for(int j = 0; j < sub_maps[i]->things.size(); j++)
       {
         EditorMapThing* thing = sub_maps[i]->things[j];
@@ -6454,6 +7850,7 @@ void EditorMap::tilesThingRemove(bool update_all)
   {
     if(active_submap != NULL)
     {
+      markPassChanged(active_submap);
       /* Clear selection */
       setHoverThing(-1);
 
@@ -6475,19 +7872,53 @@ void EditorMap::tilesThingRemove(bool update_all)
 }
 
 /*
- * Description: Updates all tiles and forces a paint
+ * Description: Updates all tiles and forces a paint. Called after the sprite
+ *              and thing dialogs apply edits, which can change the frame
+ *              count or animation time of any sprite, so the animated tile
+ *              index is reset as well.
  *
  * Inputs: none
  * Output: none
  */
 void EditorMap::updateAll()
 {
+  resetAnimatedTiles();
   for(int i = 0; i < sub_maps.size(); i++)
     for(int j = 0; j < sub_maps[i]->tiles.size(); j++)
       for(int k = 0; k < sub_maps[i]->tiles[j].size(); k++)
         sub_maps[i]->tiles[j][k]->update();
 }
 
+/*
+ * Description: Updates the event tile index of the active sub-map for the
+ *              tile, after its enter or exit event was edited, and refreshes
+ *              the reachability.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ * Output: none
+ */
+void EditorMap::updateEventTile(int x, int y)
+{
+  SubMapInfo* map = active_submap;
+  if(map != nullptr && x >= 0 && x < map->tiles.size() &&
+     y >= 0 && y < map->tiles[x].size())
+  {
+    if(map->event_valid)
+    {
+      QPoint tile(x, y);
+      bool has_event = (!map->tiles[x][y]->getEventEnter()->isEmpty() ||
+                        !map->tiles[x][y]->getEventExit()->isEmpty());
+      int index = map->event_tiles.indexOf(tile);
+      if(has_event && index < 0)
+        map->event_tiles.push_back(tile);
+      else if(!has_event && index >= 0)
+        map->event_tiles.remove(index);
+    }
+    updateReach();
+  }
+}
+
 /*
  * Description: Update the lay overs on the active sub map being rendered.
  *
@@ -6568,6 +7999,8 @@ bool EditorMap::unsetIO(int id, bool from_sub)
       deleted |= unsetIOByIndex(index, i);
     }
 
+    if(deleted)
+      journalRemove(ThingBase::INTERACTIVE, id);
     return deleted;
   }
 }
@@ -6616,6 +8049,8 @@ bool EditorMap::unsetIOByIndex(int index, int sub_map)
       /* Remove the instances from tiles */
       int x = ref->getX();
       int y = ref->getY();
+      markPassChanged(sub_maps[sub_map], x, y, ref->getMatrix()->getWidth(),
+                      ref->getMatrix()->getHeight());
       for(int i = x; i < (ref->getMatrix()->getWidth() + x) &&
                      i < sub_maps[sub_map]->tiles.size(); i++)
       {
@@ -6694,6 +8129,8 @@ bool EditorMap::unsetItem(int id, bool from_sub)
       deleted |= unsetItemByIndex(index, i);
     }
 
+    if(deleted)
+      journalRemove(ThingBase::ITEM, id);
     return deleted;
   }
 }
@@ -6828,7 +8265,15 @@ bool EditorMap::unsetMapByIndex(int index)
     while(sub_maps[index]->npcs.size() > 0)
       unsetNPCByIndex(0, index);
 
-    /* Delete the sub-map */
+    /* Stop reading the sub-map for npc path checks */
+    if(path_grid.getSubMap() == sub_maps[index])
+    {
+      path_grid.setSubMap(nullptr);
+      path_checks.clear();
+    }
+
+    /* Leave any copy-on-write shares, then delete the sub-map */
+    releaseTiles(sub_maps[index], false);
     delete sub_maps[index];
     sub_maps.remove(index);
 
@@ -6878,6 +8323,8 @@ bool EditorMap::unsetNPC(int id, bool from_sub)
       deleted |= unsetNPCByIndex(index, i);
     }
 
+    if(deleted)
+      journalRemove(ThingBase::NPC, id);
     return deleted;
   }
 }
@@ -6926,6 +8373,8 @@ bool EditorMap::unsetNPCByIndex(int index, int sub_map)
       /* Remove the instances from tiles */
       int x = ref->getX();
       int y = ref->getY();
+      markPassChanged(sub_maps[sub_map], x, y, ref->getMatrix()->getWidth(),
+                      ref->getMatrix()->getHeight());
       for(int i = x; i < (ref->getMatrix()->getWidth() + x) &&
                      i < sub_maps[sub_map]->tiles.size(); i++)
       {
@@ -6941,6 +8390,7 @@ bool EditorMap::unsetNPCByIndex(int index, int sub_map)
         sub_maps[sub_map]->path_top = NULL;
       disconnect(ref->getPath(), SIGNAL(hoverInit(EditorNPCPath*)),
                  this, SLOT(npcHoverPathChanged(EditorNPCPath*)));
+      path_checks.remove(ref->getPath());
       if(sub_maps[sub_map] == active_submap)
         emit npcPathRemove(ref->getPath());
 
@@ -7012,6 +8462,8 @@ bool EditorMap::unsetPerson(int id, bool from_sub)
       deleted |= unsetPersonByIndex(index, i);
     }
 
+    if(deleted)
+      journalRemove(ThingBase::PERSON, id);
     return deleted;
   }
 }
@@ -7060,6 +8512,8 @@ bool EditorMap::unsetPersonByIndex(int index, int sub_map)
       /* Remove the instances from tiles */
       int x = ref->getX();
       int y = ref->getY();
+      markPassChanged(sub_maps[sub_map], x, y, ref->getMatrix()->getWidth(),
+                      ref->getMatrix()->getHeight());
       for(int i = x; i < (ref->getMatrix()->getWidth() + x) &&
                      i < sub_maps[sub_map]->tiles.size(); i++)
       {
@@ -7191,6 +8645,8 @@ bool EditorMap::unsetThing(int id, bool from_sub)
       deleted |= unsetThingByIndex(index, i);
     }
 
+    if(deleted)
+      journalRemove(ThingBase::THING, id);
     return deleted;
   }
 }
@@ -7239,6 +8695,8 @@ bool EditorMap::unsetThingByIndex(int index, int sub_map)
       /* Remove the instances from tiles */
       int x = ref->getX();
       int y = ref->getY();
+      markPassChanged(sub_maps[sub_map], x, y, ref->getMatrix()->getWidth(),
+                      ref->getMatrix()->getHeight());
       for(int i = x; i < (ref->getMatrix()->getWidth() + x) &&
                      i < sub_maps[sub_map]->tiles.size(); i++)
       {
@@ -0,0 +1,466 @@
+/*******************************************************************************
+ * Class Name: EditorMapClipboard
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: A region clipboard for the map editor. Captures all sprite
+ *              layers and the passability of a rectangle of tiles as packed
+ *              planes and stamps it back into any sub-map. The item itself
+ *              is the translucent paste preview, drawn from one cached
+ *              composite image instead of through the tile hover paints.
+ ******************************************************************************/
+#include "Database/EditorMapClipboard.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorMapClipboard::kNUM_PASS_LAYERS = 6;
+const int EditorMapClipboard::kNUM_SPRITE_LAYERS = 12;
+const EditorEnumDb::Layer EditorMapClipboard::kPASS_LAYERS[] =
+                      {EditorEnumDb::BASE, EditorEnumDb::LOWER1,
+                       EditorEnumDb::LOWER2, EditorEnumDb::LOWER3,
+                       EditorEnumDb::LOWER4, EditorEnumDb::LOWER5};
+const float EditorMapClipboard::kPREVIEW_ALPHA = 0.5;
+const int EditorMapClipboard::kPREVIEW_MAX = 2048;
+const EditorEnumDb::Layer EditorMapClipboard::kSPRITE_LAYERS[] =
+                      {EditorEnumDb::BASE, EditorEnumDb::ENHANCER,
+                       EditorEnumDb::LOWER1, EditorEnumDb::LOWER2,
+                       EditorEnumDb::LOWER3, EditorEnumDb::LOWER4,
+                       EditorEnumDb::LOWER5, EditorEnumDb::UPPER1,
+                       EditorEnumDb::UPPER2, EditorEnumDb::UPPER3,
+                       EditorEnumDb::UPPER4, EditorEnumDb::UPPER5};
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. Sets up an empty clipboard with a hidden
+ *              preview that never takes mouse input.
+ *
+ * Inputs: none
+ */
+EditorMapClipboard::EditorMapClipboard() : QGraphicsItem()
+{
+  setAcceptedMouseButtons(Qt::NoButton);
+  setAcceptHoverEvents(false);
+  setVisible(false);
+  setZValue(3);
+
+  clear();
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorMapClipboard::~EditorMapClipboard()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Builds the cached composite preview from the sprite planes.
+ *              Each sprite is rendered once at the composite tile size and
+ *              then blitted for every tile that references it. The composite
+ *              is capped at kPREVIEW_MAX pixels per side and scaled on paint.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMapClipboard::buildPreview()
+{
+  preview = QImage();
+  if(isEmpty() || source_map.isNull())
+    return;
+
+  /* Determine the composite tile size */
+  int tile_px = kPREVIEW_MAX / qMax(width, height);
+  if(tile_px > EditorHelpers::getTileSize())
+    tile_px = EditorHelpers::getTileSize();
+  if(tile_px < 1)
+    tile_px = 1;
+
+  /* Source sprite lookup */
+  QHash<int, EditorSprite*> sprites;
+  QVector<EditorSprite*> sprite_set = source_map->getSprites();
+  for(int i = 0; i < sprite_set.size(); i++)
+    sprites.insert(sprite_set[i]->getID(), sprite_set[i]);
+
+  /* Composite all layers, bottom up */
+  QHash<int, QImage> rendered;
+  preview = QImage(width * tile_px, height * tile_px,
+                   QImage::Format_ARGB32_Premultiplied);
+  preview.fill(Qt::transparent);
+  QPainter painter(&preview);
+  for(int l = 0; l < kNUM_SPRITE_LAYERS; l++)
+  {
+    for(int j = 0; j < height; j++)
+    {
+      for(int i = 0; i < width; i++)
+      {
+        int id = planes_sprite[l][j * width + i] - 1;
+        if(id >= 0)
+        {
+          /* Render the sprite once at the composite size */
+          if(!rendered.contains(id))
+          {
+            QImage sprite_img(tile_px, tile_px,
+                              QImage::Format_ARGB32_Premultiplied);
+            sprite_img.fill(Qt::transparent);
+            EditorSprite* sprite = sprites.value(id, NULL);
+            if(sprite != NULL)
+            {
+              QPainter sprite_painter(&sprite_img);
+              sprite->paint(&sprite_painter, 0, 0, tile_px, tile_px);
+            }
+            rendered.insert(id, sprite_img);
+          }
+
+          painter.drawImage(i * tile_px, j * tile_px, rendered.value(id));
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Description: Returns the mapping of clipboard sprite IDs to sprites in the
+ *              target map. In the source map, the IDs map directly. In any
+ *              other map, sprites are matched by their frame signature and any
+ *              sprite without a match is left out (and skipped on paste).
+ *
+ * Inputs: EditorMap* map - the target map for the paste
+ * Output: QHash<int, EditorSprite*> - clipboard ID to target sprite
+ */
+QHash<int, EditorSprite*> EditorMapClipboard::getSpriteMapping(EditorMap* map)
+{
+  QHash<int, EditorSprite*> mapping;
+  QVector<EditorSprite*> sprite_set = map->getSprites();
+
+  /* Same map: direct ID lookup. Null once the source map is deleted */
+  if(!source_map.isNull() && map == source_map.data())
+  {
+    for(int i = 0; i < sprite_set.size(); i++)
+      mapping.insert(sprite_set[i]->getID(), sprite_set[i]);
+  }
+  /* Different map: match by signature */
+  else
+  {
+    QHash<QString, EditorSprite*> signatures;
+    for(int i = 0; i < sprite_set.size(); i++)
+    {
+      QString signature = getSpriteSignature(sprite_set[i]);
+      if(!signatures.contains(signature))
+        signatures.insert(signature, sprite_set[i]);
+    }
+
+    QHash<int, QString>::const_iterator it;
+    for(it = source_sprites.constBegin(); it != source_sprites.constEnd(); ++it)
+    {
+      EditorSprite* match = signatures.value(it.value(), NULL);
+      if(match != NULL)
+        mapping.insert(it.key(), match);
+    }
+  }
+
+  return mapping;
+}
+
+/*
+ * Description: Returns the frame signature of the sprite. Two sprites with the
+ *              same frames, frame modifiers and color settings render the same
+ *              and are treated as equivalent when pasting across maps.
+ *
+ * Inputs: EditorSprite* sprite - the sprite to describe
+ * Output: QString - the signature string
+ */
+QString EditorMapClipboard::getSpriteSignature(EditorSprite* sprite)
+{
+  QString signature = "";
+  QList<QPair<QString,QString>> path_set = sprite->getPathSet();
+  for(int i = 0; i < path_set.size(); i++)
+    signature += path_set[i].first + ":" + path_set[i].second + ";";
+
+  signature += QString::number(sprite->getBrightness()) + "," +
+               QString::number(sprite->getColorRed()) + "," +
+               QString::number(sprite->getColorGreen()) + "," +
+               QString::number(sprite->getColorBlue()) + "," +
+               QString::number(sprite->getOpacity());
+  return signature;
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the bounding rectangle of the paste preview, in scene
+ *              pixels relative to the preview position.
+ *
+ * Inputs: none
+ * Output: QRectF - the bounding rectangle
+ */
+QRectF EditorMapClipboard::boundingRect() const
+{
+  return QRectF(0, 0, width * EditorHelpers::getTileSize(),
+                height * EditorHelpers::getTileSize());
+}
+
+/*
+ * Description: Clears the clipboard planes, preview and source reference.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMapClipboard::clear()
+{
+  prepareGeometryChange();
+
+  height = 0;
+  width = 0;
+  planes_pass.clear();
+  planes_sprite.clear();
+  preview = QImage();
+  source_map = NULL;
+  source_sprites.clear();
+}
+
+/*
+ * Description: Copies the region of the sub-map into the clipboard. The region
+ *              is clipped to the sub-map. Every sprite layer is stored as an
+ *              ID plane and every passable layer as a byte plane.
+ *
+ * Inputs: EditorMap* map - the map that owns the sub-map and sprites
+ *         SubMapInfo* sub_map - the sub-map to copy from
+ *         QRect region - the tile region to copy
+ * Output: bool - true if a region was copied
+ */
+bool EditorMapClipboard::copy(EditorMap* map, SubMapInfo* sub_map,
+                              QRect region)
+{
+  if(map == NULL || sub_map == NULL || sub_map->tiles.size() == 0)
+    return false;
+
+  /* Clip the region to the sub-map */
+  region = region.normalized().intersected(
+             QRect(0, 0, sub_map->tiles.size(), sub_map->tiles.front().size()));
+  if(region.isEmpty())
+    return false;
+
+  /* Size the planes */
+  clear();
+  width = region.width();
+  height = region.height();
+  planes_sprite.resize(kNUM_SPRITE_LAYERS);
+  for(int l = 0; l < kNUM_SPRITE_LAYERS; l++)
+    planes_sprite[l].fill(0, width * height);
+  planes_pass.resize(kNUM_PASS_LAYERS);
+  for(int p = 0; p < kNUM_PASS_LAYERS; p++)
+    planes_pass[p].fill(0, width * height);
+
+  /* Fill the planes */
+  source_map = map;
+  for(int j = 0; j < height; j++)
+  {
+    for(int i = 0; i < width; i++)
+    {
+      EditorTile* tile = sub_map->tiles[region.x() + i][region.y() + j];
+      int index = j * width + i;
+
+      for(int l = 0; l < kNUM_SPRITE_LAYERS; l++)
+      {
+        EditorSprite* sprite = tile->getSprite(kSPRITE_LAYERS[l]);
+        if(sprite != NULL && sprite->getID() >= 0 &&
+           sprite->getID() < 0xFFFF)
+        {
+          planes_sprite[l][index] = sprite->getID() + 1;
+          if(!source_sprites.contains(sprite->getID()))
+            source_sprites.insert(sprite->getID(),
+                                  getSpriteSignature(sprite));
+        }
+      }
+
+      for(int p = 0; p < kNUM_PASS_LAYERS; p++)
+        planes_pass[p][index] = tile->getPassabilityNum(kPASS_LAYERS[p]);
+    }
+  }
+
+  /* Rebuild the preview */
+  prepareGeometryChange();
+  buildPreview();
+  update();
+  return true;
+}
+
+/*
+ * Description: Returns the height of the clipboard region, in tiles.
+ *
+ * Inputs: none
+ * Output: int - the tile height
+ */
+int EditorMapClipboard::getHeight() const
+{
+  return height;
+}
+
+/*
+ * Description: Returns the width of the clipboard region, in tiles.
+ *
+ * Inputs: none
+ * Output: int - the tile width
+ */
+int EditorMapClipboard::getWidth() const
+{
+  return width;
+}
+
+/*
+ * Description: Returns if the clipboard holds no region.
+ *
+ * Inputs: none
+ * Output: bool - true if empty
+ */
+bool EditorMapClipboard::isEmpty() const
+{
+  return (width <= 0 || height <= 0);
+}
+
+/*
+ * Description: Paints the cached composite, translucent, over the target
+ *              region with an outline of the paste bounds.
+ *
+ * Inputs: QPainter* painter - the painter to render to
+ *         QStyleOptionGraphicsItem* option - not used
+ *         QWidget* widget - not used
+ * Output: none
+ */
+void EditorMapClipboard::paint(QPainter* painter,
+                               const QStyleOptionGraphicsItem* option,
+                               QWidget* widget)
+{
+  (void)option;
+  (void)widget;
+
+  if(!isEmpty())
+  {
+    QRectF bound = boundingRect();
+
+    painter->save();
+    painter->setOpacity(kPREVIEW_ALPHA);
+    if(!preview.isNull())
+      painter->drawImage(bound, preview);
+    painter->setOpacity(1.0);
+    painter->setPen(QPen(QColor(255, 255, 255), 1, Qt::DashLine));
+    painter->setBrush(Qt::NoBrush);
+    painter->drawRect(bound.adjusted(0, 0, -1, -1));
+    painter->restore();
+  }
+}
+
+/*
+ * Description: Pastes the clipboard into the sub-map with the top left corner
+ *              at the given tile. In stamp mode, empty cells of a layer leave
+ *              the target untouched and passability is only written where the
+ *              matching layer's sprite was placed (not where it was skipped as
+ *              unmapped in this map). Otherwise, the whole region is
+ *              replaced, including clearing layers that are empty.
+ *
+ * Inputs: EditorMap* map - the map that owns the sub-map
+ *         SubMapInfo* sub_map - the sub-map to paste into
+ *         int x - the top left tile x
+ *         int y - the top left tile y
+ *         bool stamp - true to only write set cells
+ * Output: int - the number of tiles modified
+ */
+int EditorMapClipboard::paste(EditorMap* map, SubMapInfo* sub_map,
+                              int x, int y, bool stamp)
+{
+  int count = 0;
+
+  if(!isEmpty() && map != NULL && sub_map != NULL &&
+     sub_map->tiles.size() > 0)
+  {
+    QHash<int, EditorSprite*> mapping = getSpriteMapping(map);
+    int map_w = sub_map->tiles.size();
+    int map_h = sub_map->tiles.front().size();
+    map->detachTiles(sub_map, x, y, width, height);
+
+    for(int i = 0; i < width; i++)
+    {
+      if(x + i < 0 || x + i >= map_w)
+        continue;
+
+      for(int j = 0; j < height; j++)
+      {
+        if(y + j < 0 || y + j >= map_h)
+          continue;
+
+        EditorTile* tile = sub_map->tiles[x + i][y + j];
+        int index = j * width + i;
+        bool changed = false;
+        QVector<bool> placed(kNUM_SPRITE_LAYERS, false);
+
+        /* Sprite layers */
+        for(int l = 0; l < kNUM_SPRITE_LAYERS; l++)
+        {
+          int id = planes_sprite[l][index] - 1;
+          if(id >= 0)
+          {
+            EditorSprite* sprite = mapping.value(id, NULL);
+            if(sprite != NULL)
+            {
+              tile->place(kSPRITE_LAYERS[l], sprite);
+              placed[l] = true;
+              changed = true;
+            }
+          }
+          else if(!stamp && tile->getSprite(kSPRITE_LAYERS[l]) != NULL)
+          {
+            tile->unplace(kSPRITE_LAYERS[l]);
+            changed = true;
+          }
+        }
+
+        /* Passability layers (BASE is sprite layer 0, LOWERn is n + 1) */
+        for(int p = 0; p < kNUM_PASS_LAYERS; p++)
+        {
+          int sprite_layer = (p == 0) ? 0 : p + 1;
+          if(!stamp || placed[sprite_layer])
+          {
+            tile->setPassabilityNum(kPASS_LAYERS[p], planes_pass[p][index]);
+            changed = true;
+          }
+        }
+
+        if(changed)
+          count++;
+      }
+    }
+  }
+
+  return count;
+}
+
+/*
+ * Description: Moves the preview so the top left is at the given tile.
+ *
+ * Inputs: int x - the top left tile x
+ *         int y - the top left tile y
+ * Output: none
+ */
+void EditorMapClipboard::setPreviewTile(int x, int y)
+{
+  setPos(x * EditorHelpers::getTileSize(), y * EditorHelpers::getTileSize());
+}
+
+/*
+ * Description: Returns an empty shape. The preview sits above the tiles and
+ *              must not be picked up by the hover tile search.
+ *
+ * Inputs: none
+ * Output: QPainterPath - the empty shape
+ */
+QPainterPath EditorMapClipboard::shape() const
+{
+  return QPainterPath();
+}
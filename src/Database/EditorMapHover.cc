@@ -0,0 +1,344 @@
+/*******************************************************************************
+ * Class Name: EditorMapHover
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: The hover preview overlay for the map editor. Paints the sprite
+ *              or thing about to be placed, the eraser and placement tint and
+ *              the selected thing border above the tiles. Only its own bound
+ *              is repainted as the cursor moves, so tiles do not need to know
+ *              about the hover state.
+ ******************************************************************************/
+#include "Database/EditorMapHover.h"
+#include "Database/EditorMap.h"
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The overlay sits above the tiles but
+ *              below the npc paths and never takes mouse input.
+ *
+ * Inputs: HoverInfo* info - the hover information from the editor map
+ *         VisibilityInfo* visibility - the visibility info from the editor map
+ */
+EditorMapHover::EditorMapHover(HoverInfo* info, VisibilityInfo* visibility)
+              : QGraphicsItem()
+{
+  setAcceptedMouseButtons(Qt::NoButton);
+  setAcceptHoverEvents(false);
+  setZValue(0.5);
+
+  hover_info = info;
+  region = QRect();
+  sub_map = NULL;
+  visibility_info = visibility;
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorMapHover::~EditorMapHover()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the tile region of the hover footprint. This is the
+ *              size of the previewed thing matrix if one is active, otherwise
+ *              the single hover tile. It is clipped to the sub-map.
+ *
+ * Inputs: none
+ * Output: QRect - the footprint, in tiles. Empty if nothing is hovered
+ */
+QRect EditorMapHover::getHoverRegion()
+{
+  if(hover_info == NULL || hover_info->hover_tile == NULL || sub_map == NULL ||
+     sub_map->tiles.isEmpty())
+    return QRect();
+
+  QRect footprint(hover_info->hover_tile->getX(),
+                  hover_info->hover_tile->getY(), 1, 1);
+  EditorMapThing* thing = getHoverThing();
+  if(thing != NULL)
+    footprint.setSize(QSize(thing->getMatrix()->getWidth(),
+                            thing->getMatrix()->getHeight()));
+
+  return footprint.intersected(QRect(0, 0, sub_map->tiles.size(),
+                                     sub_map->tiles.front().size()));
+}
+
+/*
+ * Description: Returns the thing being previewed under the cursor. This is the
+ *              active thing of the active layer for the basic cursor or the
+ *              thing being moved for the move cursor.
+ *
+ * Inputs: none
+ * Output: EditorMapThing* - the previewed thing. NULL if none
+ */
+EditorMapThing* EditorMapHover::getHoverThing()
+{
+  EditorMapThing* thing = NULL;
+
+  if(hover_info != NULL && hover_info->hover_tile != NULL &&
+     !hover_info->path_edit_mode)
+  {
+    if(hover_info->active_cursor == EditorEnumDb::BASIC)
+    {
+      if(hover_info->active_layer == EditorEnumDb::THING)
+        thing = hover_info->active_thing;
+      else if(hover_info->active_layer == EditorEnumDb::IO)
+        thing = hover_info->active_io;
+      else if(hover_info->active_layer == EditorEnumDb::ITEM)
+        thing = hover_info->active_item;
+      else if(hover_info->active_layer == EditorEnumDb::PERSON)
+        thing = hover_info->active_person;
+      else if(hover_info->active_layer == EditorEnumDb::NPC)
+        thing = hover_info->active_npc;
+    }
+    else if(hover_info->active_cursor == EditorEnumDb::MOVE)
+    {
+      thing = hover_info->move_thing;
+    }
+  }
+
+  if(thing != NULL && thing->getMatrix() == NULL)
+    thing = NULL;
+  return thing;
+}
+
+/*
+ * Description: Returns if the tile at the render depth already holds something
+ *              that blocks the previewed thing. When moving, the thing being
+ *              moved does not block itself.
+ *
+ * Inputs: EditorTile* tile - the tile to check
+ *         EditorMapThing* thing - the previewed thing
+ *         int depth - the render depth of the thing in the tile
+ * Output: bool - true if the placement is blocked
+ */
+bool EditorMapHover::isBlocked(EditorTile* tile, EditorMapThing* thing,
+                               int depth)
+{
+  EditorMapThing* ref_thing = NULL;
+  if(hover_info->active_cursor == EditorEnumDb::MOVE)
+    ref_thing = thing;
+
+  ThingBase type = thing->getClass();
+  if(type == ThingBase::THING)
+    return (tile->getThing(depth) != NULL && tile->getThing(depth) != ref_thing);
+  else if(type == ThingBase::INTERACTIVE)
+    return (tile->getIO(depth) != NULL && tile->getIO(depth) != ref_thing);
+  else if(type == ThingBase::ITEM)
+    return (tile->getItems().size() >= EditorTile::kMAX_ITEMS);
+  else if(type == ThingBase::PERSON)
+    return ((tile->getPerson(depth) != NULL &&
+             tile->getPerson(depth) != ref_thing) ||
+            tile->getNPC(depth) != NULL);
+  else if(type == ThingBase::NPC)
+    return ((tile->getNPC(depth) != NULL && tile->getNPC(depth) != ref_thing) ||
+            tile->getPerson(depth) != NULL);
+  return false;
+}
+
+/*
+ * Description: Returns if there is a valid hover sprite, the active layer is
+ *              a sprite layer, and the placing pen is a sprite placement.
+ *
+ * Inputs: none
+ * Output: bool - true if the hover sprite should be shown
+ */
+bool EditorMapHover::isHoverSprite()
+{
+  if(hover_info->hover_tile != NULL && hover_info->active_sprite != NULL &&
+     (hover_info->active_cursor == EditorEnumDb::BASIC ||
+      hover_info->active_cursor == EditorEnumDb::FILL ||
+      hover_info->active_cursor == EditorEnumDb::BLOCKPLACE) &&
+     (hover_info->active_layer == EditorEnumDb::BASE ||
+      hover_info->active_layer == EditorEnumDb::ENHANCER ||
+      hover_info->active_layer == EditorEnumDb::LOWER1 ||
+      hover_info->active_layer == EditorEnumDb::LOWER2 ||
+      hover_info->active_layer == EditorEnumDb::LOWER3 ||
+      hover_info->active_layer == EditorEnumDb::LOWER4 ||
+      hover_info->active_layer == EditorEnumDb::LOWER5 ||
+      hover_info->active_layer == EditorEnumDb::UPPER1 ||
+      hover_info->active_layer == EditorEnumDb::UPPER2 ||
+      hover_info->active_layer == EditorEnumDb::UPPER3 ||
+      hover_info->active_layer == EditorEnumDb::UPPER4 ||
+      hover_info->active_layer == EditorEnumDb::UPPER5) &&
+     !hover_info->path_edit_mode)
+  {
+    return true;
+  }
+  return false;
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the bounding rectangle of the covered region, in scene
+ *              pixels.
+ *
+ * Inputs: none
+ * Output: QRectF - the bounding rectangle
+ */
+QRectF EditorMapHover::boundingRect() const
+{
+  int size = EditorHelpers::getTileSize();
+  return QRectF(region.x() * size, region.y() * size,
+                region.width() * size, region.height() * size);
+}
+
+/*
+ * Description: Paints the hover preview. The previewed thing or sprite is
+ *              drawn on each footprint tile followed by a tint: green if the
+ *              placement is valid, red if it is blocked or erasing and grey
+ *              otherwise. The selected thing border is drawn with the grid.
+ *
+ * Inputs: QPainter* painter - the painter to render to
+ *         QStyleOptionGraphicsItem* option - not used
+ *         QWidget* widget - not used
+ * Output: none
+ */
+void EditorMapHover::paint(QPainter* painter,
+                           const QStyleOptionGraphicsItem* option,
+                           QWidget* widget)
+{
+  (void)option;
+  (void)widget;
+
+  if(hover_info == NULL || sub_map == NULL)
+    return;
+  int size = EditorHelpers::getTileSize();
+
+  /* Render the hover footprint */
+  QRect footprint = getHoverRegion();
+  if(!footprint.isEmpty())
+  {
+    EditorTile* hover_tile = hover_info->hover_tile;
+    EditorMapThing* thing = getHoverThing();
+
+    /* -- HOVER THING CONTROL -- */
+    if(thing != NULL)
+    {
+      EditorMatrix* matrix = thing->getMatrix();
+      bool invalid = (hover_tile->getX() + matrix->getWidth() >
+                      sub_map->tiles.size()) ||
+                     (hover_tile->getY() + matrix->getHeight() >
+                      sub_map->tiles.front().size());
+
+      for(int i = footprint.left(); i <= footprint.right(); i++)
+      {
+        for(int j = footprint.top(); j <= footprint.bottom(); j++)
+        {
+          int diff_x = i - hover_tile->getX();
+          int diff_y = j - hover_tile->getY();
+          QRect bound(i * size, j * size, size, size);
+          QColor color(200, 200, 200, 128);
+
+          if(!thing->isAllNull(diff_x, diff_y))
+          {
+            thing->paint(painter, bound, diff_x, diff_y);
+
+            if((invalid && thing->getClass() != ThingBase::ITEM) ||
+               isBlocked(sub_map->tiles[i][j], thing,
+                         matrix->getRenderDepth(diff_x, diff_y)))
+              color = QColor(200, 0, 0, 128);
+            else
+              color = QColor(0, 200, 0, 128);
+          }
+
+          painter->fillRect(bound.x() + 1, bound.y() + 1, size - 2, size - 2,
+                            color);
+        }
+      }
+    }
+    /* -- HOVER SPRITE AND ERASER CONTROL -- */
+    else
+    {
+      QRect bound(hover_tile->getX() * size, hover_tile->getY() * size,
+                  size, size);
+      QColor color(200, 200, 200, 128);
+
+      if(isHoverSprite())
+      {
+        hover_info->active_sprite->paint(painter, bound);
+      }
+      else if(hover_info->active_cursor == EditorEnumDb::ERASER &&
+              !hover_info->path_edit_mode)
+      {
+        EditorEnumDb::Layer layer = hover_info->active_layer;
+        if(hover_tile->getSprite(layer) != NULL ||
+           hover_tile->getThingTop(layer) != NULL)
+          color = QColor(200, 0, 0, 128);
+      }
+
+      painter->fillRect(bound.x() + 1, bound.y() + 1, size - 2, size - 2,
+                        color);
+    }
+  }
+
+  /* Render the selected thing border */
+  QRect selected = hover_info->selected_thing;
+  if(!selected.isEmpty() &&
+     (visibility_info == NULL || visibility_info->grid))
+  {
+    painter->setPen(QColor(255, 255, 0, 255));
+    painter->setBrush(Qt::NoBrush);
+    painter->drawRect(selected.x() * size + 1, selected.y() * size + 1,
+                      selected.width() * size - 2,
+                      selected.height() * size - 2);
+  }
+}
+
+/*
+ * Description: Sets the sub-map being hovered. Called when the active sub-map
+ *              of the editor map changes.
+ *
+ * Inputs: SubMapInfo* map - the active sub-map. NULL to clear
+ * Output: none
+ */
+void EditorMapHover::setSubMap(SubMapInfo* map)
+{
+  sub_map = map;
+  updateHover();
+}
+
+/*
+ * Description: Returns an empty shape. The overlay sits above the tiles and
+ *              must not be picked up by the hover tile search.
+ *
+ * Inputs: none
+ * Output: QPainterPath - the empty shape
+ */
+QPainterPath EditorMapHover::shape() const
+{
+  return QPainterPath();
+}
+
+/*
+ * Description: Recalculates the covered region from the hover footprint and
+ *              the selected thing, then repaints it. The old region is
+ *              repainted as well when the geometry changes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMapHover::updateHover()
+{
+  QRect new_region = getHoverRegion();
+  if(hover_info != NULL && sub_map != NULL)
+    new_region = new_region.united(hover_info->selected_thing);
+
+  if(new_region != region)
+  {
+    prepareGeometryChange();
+    region = new_region;
+  }
+  update();
+}
@@ -667,11 +667,11 @@ bool EditorMapIO::isBaseLock() const
 /*
  * Description: Loads the IO data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMapIO::load(XmlData data, int index)
+void EditorMapIO::load(XmlData &data, int index)
 {
   QString element = QString::fromStdString(data.getElement(index));
 
@@ -168,11 +168,11 @@ bool EditorMapItem::isWalkover()
 /*
  * Description: Loads the item data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMapItem::load(XmlData data, int index)
+void EditorMapItem::load(XmlData &data, int index)
 {
   QString element = QString::fromStdString(data.getElement(index));
 
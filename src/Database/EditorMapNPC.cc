@@ -133,11 +133,11 @@ EditorNPCPath* EditorMapNPC::getPath()
 /*
  * Description: Loads the npc data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMapNPC::load(XmlData data, int index)
+void EditorMapNPC::load(XmlData &data, int index)
 {
   /* Check for path items - if not, send to person */
   if(!path.load(data, index))
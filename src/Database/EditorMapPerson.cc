@@ -358,11 +358,11 @@ bool EditorMapPerson::isBaseSpeed() const
 /*
  * Description: Loads the person data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree entry
+ * Inputs: XmlData &data - the XML data tree entry
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMapPerson::load(core::XmlData data, int index)
+void EditorMapPerson::load(core::XmlData &data, int index)
 {
   QString element = QString::fromStdString(data.getElement(index));
 
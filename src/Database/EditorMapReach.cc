@@ -0,0 +1,157 @@
+/*******************************************************************************
+ * Class Name: EditorMapReach
+ * Date Created: October 19, 2026
+ * Inheritance: QGraphicsItem
+ * Description: The reachability overlay for the map editor. Tints the walkable
+ *              tiles of the active sub-map that can not be walked to and marks
+ *              the event tiles that lead nowhere or can never be used.
+ ******************************************************************************/
+#include "Database/EditorMapReach.h"
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The overlay sits above the hover preview
+ *              but below the npc paths and never takes mouse input.
+ *
+ * Inputs: EditorReachability* reach - the reachability of the editor map
+ *         VisibilityInfo* visibility - the visibility info from the editor map
+ */
+EditorMapReach::EditorMapReach(EditorReachability* reach,
+                               VisibilityInfo* visibility)
+              : QGraphicsItem()
+{
+  setAcceptedMouseButtons(Qt::NoButton);
+  setAcceptHoverEvents(false);
+  setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
+  setZValue(0.6);
+
+  this->reach = reach;
+  region = QSize();
+  visibility_info = visibility;
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorMapReach::~EditorMapReach()
+{
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the bounding rectangle of the analyzed sub-map, in
+ *              scene pixels.
+ *
+ * Inputs: none
+ * Output: QRectF - the bounding rectangle
+ */
+QRectF EditorMapReach::boundingRect() const
+{
+  int size = EditorHelpers::getTileSize();
+  return QRectF(0, 0, region.width() * size, region.height() * size);
+}
+
+/*
+ * Description: Paints the exposed part of the overlay. Unreachable tiles in
+ *              a row are tinted orange as one run and dead end event tiles are
+ *              crossed out in red.
+ *
+ * Inputs: QPainter* painter - the painter to render to
+ *         QStyleOptionGraphicsItem* option - the exposed rect
+ *         QWidget* widget - not used
+ * Output: none
+ */
+void EditorMapReach::paint(QPainter* painter,
+                           const QStyleOptionGraphicsItem* option,
+                           QWidget* widget)
+{
+  (void)widget;
+
+  if(reach == NULL || region.isEmpty() ||
+     (visibility_info != NULL && !visibility_info->reachability))
+    return;
+  int size = EditorHelpers::getTileSize();
+
+  /* Exposed tiles */
+  QRect exposed = option->exposedRect.toAlignedRect();
+  int x_min = qMax(exposed.left() / size, 0);
+  int x_max = qMin(exposed.right() / size, region.width() - 1);
+  int y_min = qMax(exposed.top() / size, 0);
+  int y_max = qMin(exposed.bottom() / size, region.height() - 1);
+
+  /* Unreachable runs */
+  QColor tint(255, 128, 0, 96);
+  for(int j = y_min; j <= y_max; j++)
+  {
+    int start = -1;
+    for(int i = x_min; i <= x_max + 1; i++)
+    {
+      bool unreachable = (i <= x_max && reach->isUnreachable(i, j));
+      if(unreachable && start < 0)
+      {
+        start = i;
+      }
+      else if(!unreachable && start >= 0)
+      {
+        painter->fillRect(start * size, j * size, (i - start) * size, size,
+                          tint);
+        start = -1;
+      }
+    }
+  }
+
+  /* Dead end events */
+  QList<QPoint> dead_ends = reach->getDeadEnds();
+  painter->setPen(QPen(QColor(200, 0, 0, 255), 3));
+  painter->setBrush(Qt::NoBrush);
+  for(int i = 0; i < dead_ends.size(); i++)
+  {
+    QRect bound(dead_ends[i].x() * size + 4, dead_ends[i].y() * size + 4,
+                size - 8, size - 8);
+    if(bound.intersects(exposed))
+    {
+      painter->drawRect(bound);
+      painter->drawLine(bound.topLeft(), bound.bottomRight());
+      painter->drawLine(bound.topRight(), bound.bottomLeft());
+    }
+  }
+}
+
+/*
+ * Description: Returns an empty shape. The overlay sits above the tiles and
+ *              must not be picked up by the hover tile search.
+ *
+ * Inputs: none
+ * Output: QPainterPath - the empty shape
+ */
+QPainterPath EditorMapReach::shape() const
+{
+  return QPainterPath();
+}
+
+/*
+ * Description: Recalculates the covered region from the size of the analysis,
+ *              then repaints it. Called after every new flood.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMapReach::updateReach()
+{
+  QSize new_region;
+  if(reach != NULL)
+    new_region = QSize(reach->getWidth(), reach->getHeight());
+
+  if(new_region != region)
+  {
+    prepareGeometryChange();
+    region = new_region;
+  }
+  update();
+}
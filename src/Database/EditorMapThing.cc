@@ -153,8 +153,10 @@ void EditorMapThing::saveData(core::XmlWriter* writer, bool game_only, bool inc_
 
     /* Save the dialog image */
     if(!dialog_image.isAllNull() && dialog_image.frameCount() == 1)
-      writer->writeData("image",
-                EditorHelpers::trimPath(dialog_image.getPath(0)).toStdString());
+    {
+      QString path = EditorAtlas::getExportPath(dialog_image.getPath(0));
+      writer->writeData("image", EditorHelpers::trimPath(path).toStdString());
+    }
 
     /* Matrix save */
     if(inc_matrix)
@@ -470,77 +472,70 @@ bool EditorMapThing::isVisible() const
 /*
  * Description: Loads the thing data from the XML struct and offset index.
  *
- * Inputs: core::XmlData data - the XML data tree entry
+ * Inputs: core::XmlData &data - the XML data tree entry
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMapThing::load(core::XmlData data, int index)
+void EditorMapThing::load(core::XmlData &data, int index)
 {
-  QString element = QString::fromStdString(data.getElement(index));
-
   /* Parse elements */
-  if(element == "active")
-  {
-    setActive(data.getDataBoolean());
-  }
-  else if(element == "activetime")
-  {
-    setActiveRespawn(data.getDataInteger());
-  }
-  else if(element == "description")
+  switch(EditorHelpers::getXmlTag(data.getElement(index)))
   {
-    setDescription(QString::fromStdString(data.getDataString()));
-  }
-  else if(element == "event")
-  {
-    set.load(data, index);
-    event_base = false;
-  }
-  else if(element == "eventset")
-  {
-    set.load(data, index + 1);
-    event_base = false;
-  }
-  else if(element == "game_id" || element == "core_id")
-  {
-    setGameID(data.getDataInteger());
-  }
-  else if(element == "image")
-  {
-    dialog_image.deleteAllFrames();
-    dialog_image.setPath(0, EditorHelpers::getProjectDir() +
+    case EditorEnumDb::XML_ACTIVE:
+      setActive(data.getDataBoolean());
+      break;
+    case EditorEnumDb::XML_ACTIVETIME:
+      setActiveRespawn(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_DESCRIPTION:
+      setDescription(QString::fromStdString(data.getDataString()));
+      break;
+    case EditorEnumDb::XML_EVENT:
+      set.load(data, index);
+      event_base = false;
+      break;
+    case EditorEnumDb::XML_EVENTSET:
+      set.load(data, index + 1);
+      event_base = false;
+      break;
+    case EditorEnumDb::XML_GAME_ID:
+    case EditorEnumDb::XML_CORE_ID:
+      setGameID(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_IMAGE:
+      dialog_image.deleteAllFrames();
+      dialog_image.setPath(0, EditorHelpers::getProjectDir() +
               QDir::separator() + QString::fromStdString(data.getDataString()));
-  }
-  else if(element == "name")
-  {
-    setName(QString::fromStdString(data.getDataString()));
-  }
-  else if(element == "rendermatrix")
-  {
-    matrix->load(data, index);
-  }
-  else if(element == "sprites")
-  {
-    matrix->load(data, index + 1);
-  }
-  else if(element == "sound_id")
-  {
-    setSoundID(data.getDataInteger());
-  }
-  else if(element == "startpoint")
-  {
-    QString set = QString::fromStdString(data.getDataString());
-    QStringList split = set.split(",");
-    if(split.size() == 2 && split.front().toInt() >= 0 &&
-                            split.back().toInt() >= 0)
+      break;
+    case EditorEnumDb::XML_NAME:
+      setName(QString::fromStdString(data.getDataString()));
+      break;
+    case EditorEnumDb::XML_RENDERMATRIX:
+      matrix->load(data, index);
+      break;
+    case EditorEnumDb::XML_SPRITES:
+      matrix->load(data, index + 1);
+      break;
+    case EditorEnumDb::XML_SOUND_ID:
+      setSoundID(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_STARTPOINT:
     {
-      setX(split.front().toInt());
-      setY(split.back().toInt());
+      QString set = QString::fromStdString(data.getDataString());
+      QStringList split = set.split(",");
+      if(split.size() == 2 && split.front().toInt() >= 0 &&
+                              split.back().toInt() >= 0)
+      {
+        setX(split.front().toInt());
+        setY(split.back().toInt());
+      }
+      break;
     }
-  }
-  else if(element == "visible")
-  {
-    setVisibility(data.getDataBoolean());
+    case EditorEnumDb::XML_VISIBLE:
+      setVisibility(data.getDataBoolean());
+      break;
+    default:
+      break;
   }
 }
 
@@ -8,6 +8,12 @@
 #include "Database/EditorMatrix.h"
 //#include <QDebug>
 
+/* Constant Implementation - see header file for descriptions */
+const int EditorMatrix::kSNAPSHOT_CACHE_KB = 32 * 1024;
+
+/* Static Implementation */
+QCache<QString, QPixmap> EditorMatrix::snapshots(kSNAPSHOT_CACHE_KB);
+
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *===========================================================================*/
@@ -158,6 +164,113 @@ bool EditorMatrix::decrementDepthOnActive(bool min)
   return active_sprite->decrementRenderDepth();
 }
 
+/*
+ * Description: Collects everything needed to render a snapshot of the matrix,
+ *              so it can be rendered apart from the scene (and off the GUI
+ *              thread). Only tiles with a valid image in the frame are kept.
+ *
+ * Inputs: int width - the max width of the snapshot. -1 for no max
+ *         int height - the max height of the snapshot. -1 for no max
+ *         int frame - the frame index for all tiles. -1 for the active frame
+ *         QString* key - set to the snapshot cache key, if not null
+ * Output: EditorSnapshotJob - the snapshot render data
+ */
+EditorSnapshotJob EditorMatrix::getSnapshotJob(int width, int height,
+                                               int frame, QString* key)
+{
+  EditorSnapshotJob job;
+  job.background = Qt::transparent;
+  if(backgroundBrush().style() != Qt::NoBrush)
+    job.background = backgroundBrush().color();
+  job.height = height;
+  job.tile_size = EditorHelpers::getTileSize();
+  job.tiles_h = getHeight();
+  job.tiles_w = getWidth();
+  job.width = width;
+
+  for(int i = 0; i < matrix.size(); i++)
+  {
+    for(int j = 0; j < matrix[i].size(); j++)
+    {
+      int index = frame;
+      if(index < 0)
+        index = matrix[i][j]->getActiveFrameIndex();
+
+      if(index >= 0 && index < matrix[i][j]->frameCount())
+      {
+        EditorSnapshotCell cell;
+        cell.x = matrix[i][j]->getX();
+        cell.y = matrix[i][j]->getY();
+        cell.frame = matrix[i][j]->getFrameRender(index);
+        if(!cell.frame.image.isNull())
+          job.cells.push_back(cell);
+      }
+    }
+  }
+
+  if(key != nullptr)
+    *key = getSnapshotKey(getContentVersion(), width, height, frame);
+
+  return job;
+}
+
+/*
+ * Description: Returns the snapshot cache key, of the content version, the
+ *              size and the frame.
+ *
+ * Inputs: quint64 version - the content version of the matrix
+ *         int width - the max width of the snapshot. -1 for full size
+ *         int height - the max height of the snapshot. -1 for full size
+ *         int frame - the frame index. -1 for the active frames
+ * Output: QString - the cache key
+ */
+QString EditorMatrix::getSnapshotKey(quint64 version, int width, int height,
+                                     int frame)
+{
+  return QString::number(version) + "_" + QString::number(width) + "_" +
+         QString::number(height) + "_" + QString::number(frame);
+}
+
+/*
+ * Description: Returns the region of a tile frame in a sprite sheet. Each
+ *              frame is a block of the layout tiles; the blocks fill the sheet
+ *              across then down, or down then across if frames_down is set.
+ *
+ * Inputs: QSize sheet - the size of the sheet image
+ *         EditorSheetLayout layout - the cell layout of the sheet
+ *         int frame - the frame index
+ *         int x - the tile x location in the frame
+ *         int y - the tile y location in the frame
+ * Output: QRect - the region in the sheet. Null if the layout is invalid
+ */
+QRect EditorMatrix::getSheetRect(QSize sheet, EditorSheetLayout layout,
+                                 int frame, int x, int y)
+{
+  int block_h = layout.cell_height * layout.tiles_h;
+  int block_w = layout.cell_width * layout.tiles_w;
+  if(block_h <= 0 || block_w <= 0 || frame < 0)
+    return QRect();
+
+  int block_x = 0;
+  int block_y = 0;
+  if(layout.frames_down)
+  {
+    int per_column = qMax(1, sheet.height() / block_h);
+    block_x = frame / per_column;
+    block_y = frame % per_column;
+  }
+  else
+  {
+    int per_row = qMax(1, sheet.width() / block_w);
+    block_x = frame % per_row;
+    block_y = frame / per_row;
+  }
+
+  return QRect(block_x * block_w + x * layout.cell_width,
+               block_y * block_h + y * layout.cell_height,
+               layout.cell_width, layout.cell_height);
+}
+
 /*
  * Description: Returns the first valid sprite. It attempts to find one with
  *              frames first. If there are none, returns first non-NULL sprite.
@@ -259,6 +372,45 @@ void EditorMatrix::removeFramesOnActive()
   emit matrixChange();
 }
 
+/*
+ * Description: Renders the snapshot of the matrix from the collected tile
+ *              data, the same as the scene would paint it with the grid, pass
+ *              and render depth hidden. Then scales it down to fit the max
+ *              size, if set. Only uses the job data, so it is safe to call off
+ *              the GUI thread.
+ *
+ * Inputs: EditorSnapshotJob job - the snapshot render data
+ * Output: QImage - the snapshot. Null if the matrix is empty
+ */
+QImage EditorMatrix::renderSnapshot(EditorSnapshotJob job)
+{
+  int size = job.tile_size;
+  QImage image(job.tiles_w * size, job.tiles_h * size, QImage::Format_ARGB32);
+  if(image.isNull())
+    return image;
+
+  /* Scene background, then the tile backgrounds */
+  image.fill(job.background);
+  QPainter painter(&image);
+  painter.fillRect(image.rect(), QColor(0, 0, 0, 64));
+
+  /* Tile frames */
+  for(int i = 0; i < job.cells.size(); i++)
+  {
+    const EditorSnapshotCell &cell = job.cells[i];
+    painter.setOpacity(cell.frame.opacity);
+    painter.drawImage(QRect(cell.x * size, cell.y * size, size, size),
+                      EditorSprite::renderFrame(cell.frame, size, size));
+  }
+  painter.end();
+
+  /* Scale to fit */
+  if((job.width > 0 && image.width() > job.width) ||
+     (job.height > 0 && image.height() > job.height))
+    return image.scaled(job.width, job.height, Qt::KeepAspectRatio);
+  return image;
+}
+
 /*
  * Description: Sets a new origin. This involves removes rows on the top and
  *              columns on the left to rebase the matrix.
@@ -493,6 +645,48 @@ void EditorMatrix::matrixPlace(QString result_path, bool hflip, bool vflip)
   }
 }
 
+/*
+ * Description: Places a sliced sprite sheet at the place x and y location in
+ *              class, with the sheet layout, horizontal flip, and vertical
+ *              flip status.
+ *
+ * Inputs: QString sheet_path - the path to the sprite sheet file
+ *         EditorSheetLayout layout - the cell layout of the sheet
+ *         bool hflip - are they all horizontally flipped?
+ *         bool vflip - are they all vertically flipped?
+ * Output: none
+ */
+void EditorMatrix::sheetPlace(QString sheet_path, EditorSheetLayout layout,
+                              bool hflip, bool vflip)
+{
+  if(!sheet_path.isEmpty() && place_x >= 0 && place_y >= 0)
+    addSheet(sheet_path, layout, place_x, place_y, hflip, vflip, false, true);
+}
+
+/*
+ * Description: Called when a background snapshot render finishes. Caches the
+ *              snapshot and emits snapshotReady(), so views can request it
+ *              again.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorMatrix::snapshotFinished()
+{
+  QFutureWatcher<QImage>* watcher =
+                                 static_cast<QFutureWatcher<QImage>*>(sender());
+  if(watcher != nullptr && snapshot_jobs.contains(watcher))
+  {
+    QString key = snapshot_jobs.take(watcher);
+    QImage image = watcher->result();
+    snapshots.insert(key, new QPixmap(QPixmap::fromImage(image)),
+                     qMax(1, (int)(image.sizeInBytes() / 1024)));
+    watcher->deleteLater();
+
+    emit snapshotReady();
+  }
+}
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -529,7 +723,9 @@ bool EditorMatrix::addPath(QString path, int x, int y, bool hflip,
  * Description: Adds path at x and y location. This takes a root path, filename,
  *              and horizontal flip, vertical flip. It puts the matrix of
  *              sprites starting ata the x and y location in the matrix and will
- *              reset it first if reset is set (empty the matrix).
+ *              reset it first if reset is set (empty the matrix). All frame
+ *              files are decoded first, concurrently, with a cancellable
+ *              progress dialog for large sets.
  *
  * Inputs: QString root_path - the path to where the file is (needs to end in /)
  *         QString file_name - the name of the sprite file
@@ -540,7 +736,7 @@ bool EditorMatrix::addPath(QString path, int x, int y, bool hflip,
  *         bool reset - true if the entire matrix should be cleared first
  *         bool clear_modified - should the sprites being modified by the matrix
  *                               be cleared prior to the modification
- * Output: bool - true if it was added
+ * Output: bool - true if it was added. false if invalid or cancelled
  */
 bool EditorMatrix::addPath(QString root_path, QString file_name,
                            int x, int y, bool hflip, bool vflip, bool reset,
@@ -548,13 +744,28 @@ bool EditorMatrix::addPath(QString root_path, QString file_name,
 {
   if(!root_path.isEmpty() && !file_name.isEmpty() && x >= 0 && y >= 0)
   {
-    /* If reset, clear the scene */
-    if(reset)
-      decreaseWidth(getWidth());
-
     /* Split up the set of frames for the matrix */
     std::vector<std::vector<std::string>> name_set =
                                core::FilePath::separateOnRanges(file_name.toStdString());
+    if(name_set.empty() || name_set.front().empty())
+      return false;
+
+    /* Decode every frame file up front on the thread pool. Cancel aborts */
+    QStringList frame_paths;
+    for(uint16_t i = 0; i < name_set.size(); i++)
+      for(uint16_t j = 0; j < name_set[i].size(); j++)
+        frame_paths += EditorHelpers::splitPath(root_path +
+                                      QString::fromStdString(name_set[i][j]));
+    QWidget* parent = nullptr;
+    if(!views().isEmpty())
+      parent = views().first();
+    if(!EditorImageStore::getShared()->loadImages(frame_paths, parent,
+                                                tr("Loading matrix frames...")))
+      return false;
+
+    /* If reset, clear the scene */
+    if(reset)
+      decreaseWidth(getWidth());
 
     /* Ensure the matrix is large enough */
     if((x + (int)name_set.size()) > getWidth())
@@ -562,7 +773,7 @@ bool EditorMatrix::addPath(QString root_path, QString file_name,
     if((y + (int)name_set.front().size()) > getHeight())
       increaseHeight(y + name_set.front().size() - getHeight());
 
-    /* Go through paths and add them */
+    /* Go through paths and add them. Frames come from the image store */
     for(uint16_t i = 0; i < name_set.size(); i++)
     {
       for(uint16_t j = 0; j < name_set[i].size(); j++)
@@ -582,6 +793,74 @@ bool EditorMatrix::addPath(QString root_path, QString file_name,
   return false;
 }
 
+/*
+ * Description: Adds a sprite sheet at x and y location. The sheet is decoded
+ *              once and sliced in memory by the layout: every tile frame is a
+ *              region path referencing the sheet, so all the slices share the
+ *              one decoded image instead of a file each. A region of the whole
+ *              sheet uses the sheet path. Frames that do not fit are dropped.
+ *
+ * Inputs: QString sheet_path - the path to the sprite sheet file
+ *         EditorSheetLayout layout - the cell layout of the sheet
+ *         int x - the top left x location of the matrix of sprites
+ *         int y - the top left y location of the matrix of sprites
+ *         bool hflip - true if all the sprites should be horizontally flipped
+ *         bool vflip - true if all the sprites should be vertically flipped
+ *         bool reset - true if the entire matrix should be cleared first
+ *         bool clear_modified - should the sprites being modified by the matrix
+ *                               be cleared prior to the modification
+ * Output: bool - true if it was added. false if invalid or it fails to decode
+ */
+bool EditorMatrix::addSheet(QString sheet_path, EditorSheetLayout layout,
+                            int x, int y, bool hflip, bool vflip, bool reset,
+                            bool clear_modified)
+{
+  if(!sheet_path.isEmpty() && x >= 0 && y >= 0 &&
+     layout.tiles_w > 0 && layout.tiles_h > 0)
+  {
+    /* Decode the sheet, the one image for every slice */
+    sheet_path = EditorImageStore::splitRegionPath(sheet_path);
+    QImage sheet = EditorImageStore::getShared()->getImage(sheet_path);
+    int frames = getSheetFrames(sheet.size(), layout);
+    if(sheet.isNull() || frames <= 0)
+      return false;
+
+    /* If reset, clear the scene */
+    if(reset)
+      decreaseWidth(getWidth());
+
+    /* Ensure the matrix is large enough */
+    if((x + layout.tiles_w) > getWidth())
+      increaseWidth(x + layout.tiles_w - getWidth());
+    if((y + layout.tiles_h) > getHeight())
+      increaseHeight(y + layout.tiles_h - getHeight());
+
+    /* Go through the tiles and add a region of the sheet per frame */
+    for(int i = 0; i < layout.tiles_w; i++)
+    {
+      for(int j = 0; j < layout.tiles_h; j++)
+      {
+        if(clear_modified)
+          matrix[x + i][y + j]->deleteAllFrames();
+        for(int k = 0; k < frames; k++)
+        {
+          QRect rect = getSheetRect(sheet.size(), layout, k, i, j);
+          if(rect == sheet.rect())
+            matrix[x + i][y + j]->addPath(sheet_path, hflip, vflip);
+          else
+            matrix[x + i][y + j]->addPath(
+                 EditorImageStore::getRegionPath(sheet_path, rect), hflip, vflip);
+        }
+      }
+    }
+
+    emit matrixChange();
+    return true;
+  }
+
+  return false;
+}
+
 /*
  * Description: Cleans the scene. Used for when moving it to a new view.
  *
@@ -724,6 +1003,119 @@ int EditorMatrix::getActiveFrameIndex()
   return active_frame;
 }
 
+/*
+ * Description: Returns the animation frame time of the matrix, which is the
+ *              time of the first valid sprite.
+ *
+ * Inputs: none
+ * Output: int - the frame time, in ms. 0 if no valid sprite or not animated
+ */
+int EditorMatrix::getAnimationTime()
+{
+  EditorTileSprite* sprite = getValidSprite();
+  if(sprite != nullptr)
+    return sprite->getAnimationTime().toInt();
+  return 0;
+}
+
+/*
+ * Description: Returns the content version of the matrix. It is derived from
+ *              everything a snapshot renders (size, frames and their images,
+ *              flips, rotation and sprite colors), so any edit changes it,
+ *              including direct sprite edits that do not signal the matrix.
+ *
+ * Inputs: none
+ * Output: quint64 - the content version
+ */
+quint64 EditorMatrix::getContentVersion()
+{
+  quint64 version = 1469598103934665603ULL;
+  auto mix = [&version](quint64 value)
+  {
+    version = (version ^ value) * 1099511628211ULL;
+  };
+
+  mix(getWidth());
+  mix(getHeight());
+  mix(EditorHelpers::getTileSize());
+  mix(backgroundBrush().style() == Qt::NoBrush ? 0 :
+                                          backgroundBrush().color().rgba());
+  for(int i = 0; i < matrix.size(); i++)
+  {
+    for(int j = 0; j < matrix[i].size(); j++)
+    {
+      EditorTileSprite* sprite = matrix[i][j];
+      mix(sprite->getActiveFrameIndex());
+      mix(sprite->frameCount());
+      for(int k = 0; k < sprite->frameCount(); k++)
+      {
+        FrameRender frame = sprite->getFrameRender(k);
+        mix(frame.image.cacheKey());
+        mix((frame.hflip ? 1 : 0) | (frame.vflip ? 2 : 0));
+        mix(qRound(frame.angle * 1000));
+        mix(frame.brightness);
+        mix(frame.color_r | (frame.color_g << 8) | (frame.color_b << 16));
+        mix(qRound(frame.opacity * 1000));
+      }
+    }
+  }
+
+  return version;
+}
+
+/*
+ * Description: Returns the composited snapshots of the first frames of the
+ *              matrix, for playback. Frames not cached for the current content
+ *              are rendered together on the thread pool, so each frame is a
+ *              single image no matter how many tiles the matrix has.
+ *
+ * Inputs: int count - the number of frames, from frame 0
+ *         int width - the max width of the snapshots. -1 for full size
+ *         int height - the max height of the snapshots. -1 for full size
+ * Output: QVector<QPixmap> - the snapshots, by frame index
+ */
+QVector<QPixmap> EditorMatrix::getFrameSnapshots(int count, int width,
+                                                 int height)
+{
+  QVector<QPixmap> frames(qMax(count, 0));
+  QVector<EditorSnapshotJob> jobs;
+  QVector<int> job_frames;
+  quint64 version = getContentVersion();
+
+  /* Cached frames, and the render data for the rest */
+  for(int i = 0; i < frames.size(); i++)
+  {
+    QPixmap* cached = snapshots.object(getSnapshotKey(version, width, height,
+                                                      i));
+    if(cached != nullptr)
+    {
+      frames[i] = *cached;
+    }
+    else
+    {
+      jobs.push_back(getSnapshotJob(width, height, i, nullptr));
+      job_frames.push_back(i);
+    }
+  }
+
+  /* Render the rest concurrently */
+  if(!jobs.isEmpty())
+  {
+    QVector<QImage> images = QtConcurrent::blockingMapped<QVector<QImage>>(
+                                           jobs, &EditorMatrix::renderSnapshot);
+    for(int i = 0; i < images.size(); i++)
+    {
+      QPixmap snapshot = QPixmap::fromImage(images[i]);
+      frames[job_frames[i]] = snapshot;
+      snapshots.insert(getSnapshotKey(version, width, height, job_frames[i]),
+                       new QPixmap(snapshot),
+                       qMax(1, (int)(images[i].sizeInBytes() / 1024)));
+    }
+  }
+
+  return frames;
+}
+
 /*
  * Description: Returns the height of the matrix, in tiles.
  *
@@ -737,6 +1129,24 @@ int EditorMatrix::getHeight() const
   return 0;
 }
 
+/*
+ * Description: Returns the frame image files of all sprites in the matrix.
+ *              Sheet region paths give their sheet file.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorMatrix::getPaths()
+{
+  QStringList paths;
+
+  for(int i = 0; i < matrix.size(); i++)
+    for(int j = 0; j < matrix[i].size(); j++)
+      paths += matrix[i][j]->getPaths();
+
+  return paths;
+}
+
 /*
  * Description: Returns the render depth of the sprite at the x and y location
  *              in the matrix.
@@ -768,54 +1178,29 @@ EditorTileSprite* EditorMatrix::getRightClicked()
 /*
  * Description: Returns an image snapshot of the scene without any grid,
  *              passability, or render depths. Can pass in a width and height
- *              to scale the pixmap down.
+ *              to scale the pixmap down. Rendered from the tile data (not
+ *              the scene) and cached by content version, size and frame, so
+ *              repeated calls on an unchanged matrix are a lookup.
  *
  * Inputs: int width - the max width of the pixmap
  *         int height - the max height of the pixmap
+ *         int frame - the frame index for all tiles. -1 for the active frame
  * Output: QPixmap - the resulting pixmap
  */
-QPixmap EditorMatrix::getSnapshot(int width, int height)
+QPixmap EditorMatrix::getSnapshot(int width, int height, int frame)
 {
-  /* Disable all visibility */
-  bool visible_grid = this->visible_grid;
-  bool visible_passability = this->visible_passability;
-  bool visible_render = this->visible_render;
-  setVisibilityGrid(false, true);
-  setVisibilityPass(false, true);
-  setVisibilityRender(false, true);
-
-  /* Set-up the scene */
-  QPixmap final_pixmap;
-  cleanScene();
-  clearSelection();
-  setSceneRect(itemsBoundingRect());
-  QImage image(sceneRect().size().toSize(), QImage::Format_ARGB32);
-  image.fill(Qt::transparent);
-
-  /* If the image is NULL, attempt to scale */
-  if(!image.isNull())
-  {
-    QPainter painter(&image);
-    render(&painter);
-    if((width > 0 && image.width() > width) ||
-       (height > 0 && image.height() > height))
-    {
-      QImage scaled_image = image.scaled(width, height,
-                                         Qt::KeepAspectRatio);
-      final_pixmap = QPixmap::fromImage(scaled_image);
-    }
-    else
-    {
-      final_pixmap = QPixmap::fromImage(image);
-    }
-  }
-
-  /* Re-enable visibility */
-  setVisibilityGrid(visible_grid, true);
-  setVisibilityPass(visible_passability, true);
-  setVisibilityRender(visible_render, true);
-
-  return final_pixmap;
+  QString key;
+  EditorSnapshotJob job = getSnapshotJob(width, height, frame, &key);
+
+  QPixmap* cached = snapshots.object(key);
+  if(cached != nullptr)
+    return *cached;
+
+  QImage image = renderSnapshot(job);
+  QPixmap snapshot = QPixmap::fromImage(image);
+  snapshots.insert(key, new QPixmap(snapshot),
+                   qMax(1, (int)(image.sizeInBytes() / 1024)));
+  return snapshot;
 }
 
 /*
@@ -1129,11 +1514,11 @@ void EditorMatrix::increaseWidth(int count)
  * Description: Loads the matrix data from the XML struct and offset index. Uses
  *              existing functions in game EventHandler class.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorMatrix::load(core::XmlData data, int index)
+void EditorMatrix::load(core::XmlData &data, int index)
 {
   QString element = QString::fromStdString(data.getElement(index));
 
@@ -1425,6 +1810,38 @@ void EditorMatrix::removeAll()
   emit matrixChange();
 }
 
+/*
+ * Description: Returns the snapshot if cached. Otherwise, starts rendering it
+ *              on the thread pool and returns a null pixmap. snapshotReady() is
+ *              emitted once it is cached, to request it again. See
+ *              getSnapshot().
+ *
+ * Inputs: int width - the max width of the pixmap
+ *         int height - the max height of the pixmap
+ *         int frame - the frame index for all tiles. -1 for the active frame
+ * Output: QPixmap - the cached snapshot. Null if rendering
+ */
+QPixmap EditorMatrix::requestSnapshot(int width, int height, int frame)
+{
+  QString key;
+  EditorSnapshotJob job = getSnapshotJob(width, height, frame, &key);
+
+  QPixmap* cached = snapshots.object(key);
+  if(cached != nullptr)
+    return *cached;
+
+  /* Start the render, unless already running */
+  if(!snapshot_jobs.values().contains(key))
+  {
+    QFutureWatcher<QImage>* watcher = new QFutureWatcher<QImage>(this);
+    connect(watcher, SIGNAL(finished()), this, SLOT(snapshotFinished()));
+    snapshot_jobs.insert(watcher, key);
+    watcher->setFuture(QtConcurrent::run(&EditorMatrix::renderSnapshot, job));
+  }
+
+  return QPixmap();
+}
+
 /*
  * Description: Saves the matrix data to the file handling pointer.
  *
@@ -1448,7 +1865,7 @@ void EditorMatrix::save(core::XmlWriter* writer, bool game_only, bool no_render)
       QList<bool> row_skip;
       for(int j = 0; j < matrix[i].size(); j++)
       {
-        row_set.push_back(matrix[i][j]->getPathSet());
+        row_set.push_back(matrix[i][j]->getPathSet(game_only));
         row_skip.push_back(false);
       }
       set.push_back(row_set);
@@ -1971,3 +2388,28 @@ EditorMatrix& EditorMatrix::operator= (const EditorMatrix &source)
   /* Return the copied object */
   return *this;
 }
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the number of frames of the layout that fit whole in
+ *              the sheet, capped to the layout frame count if it is set.
+ *
+ * Inputs: QSize sheet - the size of the sheet image
+ *         EditorSheetLayout layout - the cell layout of the sheet
+ * Output: int - the frame count. 0 if none fit or the layout is invalid
+ */
+int EditorMatrix::getSheetFrames(QSize sheet, EditorSheetLayout layout)
+{
+  int block_h = layout.cell_height * layout.tiles_h;
+  int block_w = layout.cell_width * layout.tiles_w;
+  if(block_h <= 0 || block_w <= 0)
+    return 0;
+
+  int count = (sheet.width() / block_w) * (sheet.height() / block_h);
+  if(layout.frames > 0)
+    count = qMin(count, layout.frames);
+  return count;
+}
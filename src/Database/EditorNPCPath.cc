@@ -35,6 +35,7 @@ EditorNPCPath::EditorNPCPath(int x, int y, int delay, bool xy_flip)
   /* Initial settings */
   setAcceptHoverEvents(true);
   setEnabled(true);
+  setFlag(QGraphicsItem::ItemUsesExtendedStyleOption);
   setZValue(1);
 
   /* Set up color presets */
@@ -52,6 +53,7 @@ EditorNPCPath::EditorNPCPath(int x, int y, int delay, bool xy_flip)
   color_presets.push_back(QColor(0, 128, 0, kCOLOR_ALPHA));
 
   /* Initial values */
+  cache_valid = false;
   setColorPreset(0);
   hovered = false;
   index_move = -2;
@@ -116,75 +118,24 @@ EditorNPCPath::~EditorNPCPath()
  *===========================================================================*/
 
 /*
- * Description: The copy function that is called by any copying methods in the
- *              class. Utilized by the copy constructor and the copy operator.
- *
- * Inputs: const EditorNPCPath &source - the reference npc path class
- * Output: none
- */
-void EditorNPCPath::copySelf(const EditorNPCPath &source)
-{
-  prepareGeometryChange();
-
-  color_r = source.color_r;
-  color_g = source.color_g;
-  color_b = source.color_b;
-  color_a = source.color_a;
-
-  interact = source.interact;
-  nodes = source.nodes;
-  start_node = source.start_node;
-  state = source.state;
-  track_dist_max = source.track_dist_max;
-  track_dist_min = source.track_dist_min;
-  track_dist_run = source.track_dist_run;
-  tracking = source.tracking;
-
-  update();
-}
-
-/*
- * Description: Returns the hover color. If hovered is true, border color is
- *              white. Otherwise, border color is black.
+ * Description: Adds the corner of a path between nodes to the cached line
+ *              geometry, when the delta x and y between nodes are both not 0.
+ *              The corners are dependent on the entering and exit directions
+ *              of the feeders.
  *
- * Inputs: bool hover_node - is the node to get the border for a hover node
- * Output: QColor - the color to be used for borders
- */
-QColor EditorNPCPath::getHoverColor(bool hover_node)
-{
-  if(hover_node)
-  {
-    return QColor(0, 0, 0, 255 * kHOVER_ALPHA);
-  }
-  else
-  {
-    if(hovered)
-      return QColor(225, 225, 225);
-    return QColor(0, 0, 0);
-  }
-}
-
-/*
- * Description: Paints the corner of a path between nodes, when the delta
- *              x and y between nodes are both not 0. The corners are dependent
- *              on the entering and exit directions of the feeders.
- *
- * Inputs: QPainter* painter - the painting engine
- *         int x - the x tile location for the corner
+ * Inputs: int x - the x tile location for the corner
  *         int y - the y tile location for the corner
  *         Direction enter - the side of the tile the entering line comes from
  *         Direction exit - the side of the tile the exiting line leaves from
- *         QColor color - the color to paint the colored portion of path
  * Output: none
  */
-void EditorNPCPath::paintCorner(QPainter* painter, int x, int y,
-                                Direction enter, Direction exit, QColor color)
+void EditorNPCPath::buildCorner(int x, int y, Direction enter,
+                                Direction exit) const
 {
   int size = EditorHelpers::getTileSize();
   int line_w = kLINE_W + kBORDER_W;
   int delta_line = (kRECT_W - line_w) / 2;
   int delta_rect = (size - kRECT_W) / 2;
-  QColor hover_color = getHoverColor();
   int start_x = x * size + delta_rect;
   int start_y = y * size + delta_rect;
 
@@ -193,92 +144,237 @@ void EditorNPCPath::paintCorner(QPainter* painter, int x, int y,
      (enter == Direction::EAST && exit == Direction::NORTH))
   {
     /* North line */
-    painter->fillRect(start_x + delta_line, start_y,
-                      kLINE_W, delta_line, color);
-    painter->fillRect(start_x + delta_line + kLINE_W, start_y,
-                      kBORDER_W, delta_line, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line, start_y,
+                                       kLINE_W, delta_line), false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W, start_y,
+                                       kBORDER_W, delta_line), true));
 
     /* East line */
-    painter->fillRect(start_x + delta_line, start_y + delta_line,
-                      delta_line + line_w, kLINE_W, color);
-    painter->fillRect(start_x + delta_line, start_y + delta_line + kLINE_W,
-                      delta_line + line_w, kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line,
+                                       delta_line + line_w, kLINE_W), false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line + kLINE_W,
+                                       delta_line + line_w, kBORDER_W), true));
   }
   /* --- SE corner --- */
   else if((enter == Direction::EAST && exit == Direction::SOUTH) ||
           (enter == Direction::SOUTH && exit == Direction::EAST))
   {
     /* East line */
-    painter->fillRect(start_x + delta_line + kLINE_W, start_y + delta_line,
-                      delta_line + kBORDER_W, kLINE_W, color);
-    painter->fillRect(start_x + delta_line + kLINE_W,
-                      start_y + delta_line + kLINE_W,
-                      delta_line + kBORDER_W, kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W,
+                                       start_y + delta_line,
+                                       delta_line + kBORDER_W, kLINE_W),
+                                 false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W,
+                                       start_y + delta_line + kLINE_W,
+                                       delta_line + kBORDER_W, kBORDER_W),
+                                 true));
 
     /* South line */
-    painter->fillRect(start_x + delta_line, start_y + delta_line + kLINE_W,
-                      kLINE_W, delta_line + kBORDER_W, color);
-    painter->fillRect(start_x + delta_line + kLINE_W,
-                      start_y + delta_line + kLINE_W, kBORDER_W,
-                      delta_line + kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line + kLINE_W,
+                                       kLINE_W, delta_line + kBORDER_W),
+                                 false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W,
+                                       start_y + delta_line + kLINE_W,
+                                       kBORDER_W, delta_line + kBORDER_W),
+                                 true));
 
     /* Corner rect */
-    painter->fillRect(start_x + delta_line, start_y + delta_line,
-                      kLINE_W, kLINE_W, color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line,
+                                       kLINE_W, kLINE_W), false));
   }
   /* --- SW corner --- */
   else if((enter == Direction::SOUTH && exit == Direction::WEST) ||
           (enter == Direction::WEST && exit == Direction::SOUTH))
   {
     /* West line */
-    painter->fillRect(start_x, start_y + delta_line, delta_line,
-                      kLINE_W, color);
-    painter->fillRect(start_x, start_y + delta_line + kLINE_W, delta_line,
-                      kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x, start_y + delta_line,
+                                       delta_line, kLINE_W), false));
+    cache_lines.append(qMakePair(QRect(start_x, start_y + delta_line + kLINE_W,
+                                       delta_line, kBORDER_W), true));
 
     /* South line */
-    painter->fillRect(start_x + delta_line, start_y + delta_line, kLINE_W,
-                      delta_line + line_w, color);
-    painter->fillRect(start_x + delta_line + kLINE_W, start_y + delta_line,
-                      kBORDER_W, delta_line + line_w, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line, kLINE_W,
+                                       delta_line + line_w), false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W,
+                                       start_y + delta_line, kBORDER_W,
+                                       delta_line + line_w), true));
   }
   /* --- NW corner --- */
   else if((enter == Direction::WEST && exit == Direction::NORTH) ||
           (enter == Direction::NORTH && exit == Direction::WEST))
   {
     /* North line */
-    painter->fillRect(start_x + delta_line, start_y,
-                      kLINE_W, delta_line + line_w, color);
-    painter->fillRect(start_x + delta_line + kLINE_W, start_y,
-                      kBORDER_W, delta_line + line_w, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line, start_y,
+                                       kLINE_W, delta_line + line_w), false));
+    cache_lines.append(qMakePair(QRect(start_x + delta_line + kLINE_W, start_y,
+                                       kBORDER_W, delta_line + line_w), true));
 
     /* West line */
-    painter->fillRect(start_x, start_y + delta_line, delta_line,
-                      kLINE_W, color);
-    painter->fillRect(start_x, start_y + delta_line + kLINE_W, delta_line,
-                      kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x, start_y + delta_line,
+                                       delta_line, kLINE_W), false));
+    cache_lines.append(qMakePair(QRect(start_x, start_y + delta_line + kLINE_W,
+                                       delta_line, kBORDER_W), true));
 
     /* Bottom border */
-    painter->fillRect(start_x + delta_line, start_y + delta_line + kLINE_W,
-                      line_w, kBORDER_W, hover_color);
+    cache_lines.append(qMakePair(QRect(start_x + delta_line,
+                                       start_y + delta_line + kLINE_W,
+                                       line_w, kBORDER_W), true));
   }
 }
 
 /*
- * Description: Paints the defined border line for the path between nodes. This
- *              can only handle a straight line on the horizontal or vertical.
- *              Paints the width as per the defined constants.
+ * Description: Rebuilds all cached geometry from the node set: the tile bound,
+ *              the line and node rects, the hover shape and the tile index for
+ *              hover state lookups. Only called on the first use after the
+ *              path structure has changed.
  *
- * Inputs: QPainter* painter - the painting engine
- *         int x1 - the starting x tile point of the line
+ * Inputs: none
+ * Output: none
+ */
+void EditorNPCPath::buildGeometry() const
+{
+  int size = EditorHelpers::getTileSize();
+  cache_hover.clear();
+  cache_lines.clear();
+  cache_nodes.clear();
+  cache_shape = QPainterPath();
+
+  /* Find the lowest and highest nodes */
+  int min_x = start_node.x;
+  int max_x = start_node.x;
+  int min_y = start_node.y;
+  int max_y = start_node.y;
+  for(int i = 0; i < nodes.size(); i++)
+  {
+    if(min_x < 0 || nodes[i].x < min_x)
+      min_x = nodes[i].x;
+    if(max_x < 0 || nodes[i].x > max_x)
+      max_x = nodes[i].x;
+    if(min_y < 0 || nodes[i].y < min_y)
+      min_y = nodes[i].y;
+    if(max_y < 0 || nodes[i].y > max_y)
+      max_y = nodes[i].y;
+  }
+  cache_bound.setCoords(min_x, min_y, max_x, max_y);
+
+  /* Parse all paths */
+  bool looped = ((state == MapNPC::LOOPED || state == MapNPC::RANDOMRANGE) &&
+                 nodes.size() > 1);
+  if(nodes.size() > 0)
+    buildLines(&start_node, &nodes.front());
+  for(int i = 0; i < nodes.size(); i++)
+  {
+    const Path* next = NULL;
+    if(i < (nodes.size() - 1))
+      next = &nodes[i+1];
+    else if(looped)
+      next = &nodes.front();
+    buildLines(&nodes[i], next);
+  }
+
+  /* Parse the start node and all nodes */
+  if(nodes.size() > 0)
+    cache_nodes.push_back(buildNode(NULL, &start_node, &nodes.front(),
+                                    kNODE_START));
+  else
+    cache_nodes.push_back(buildNode(NULL, &start_node, NULL, kNODE_START));
+  for(int i = 0; i < nodes.size(); i++)
+  {
+    const Path* prev = NULL;
+    if(i > 0)
+      prev = &nodes[i-1];
+    else if(looped)
+      prev = &nodes.last();
+    const Path* next = NULL;
+    if(i < (nodes.size() - 1))
+      next = &nodes[i+1];
+    else if(looped)
+      next = &nodes.front();
+    cache_nodes.push_back(buildNode(prev, &nodes[i], next, i));
+  }
+
+  /* Hover shape, around the start node and all nodes */
+  int rect = kRECT_W + kLINE_W * 2;
+  int offset = (size - rect) / 2;
+  cache_shape.addRect(start_node.x * size + offset,
+                      start_node.y * size + offset, rect, rect);
+  for(int i = 0; i < nodes.size(); i++)
+    cache_shape.addRect(nodes[i].x * size + offset,
+                        nodes[i].y * size + offset, rect, rect);
+
+  /* Hover index. The first node to claim a tile keeps it */
+  for(int i = 0; i < nodes.size(); i++)
+  {
+    QPair<int,int> key(nodes[i].x, nodes[i].y);
+    if(!cache_hover.contains(key))
+      cache_hover.insert(key, qMakePair(static_cast<int>(ON_NODE), i));
+    if(i > 0)
+      buildHoverIndex(&nodes[i-1], &nodes[i], i);
+  }
+
+  cache_valid = true;
+}
+
+/*
+ * Description: Adds the tiles of the path between the previous and current
+ *              node to the hover index, following the parsing direction of
+ *              the previous node. Tiles already in the index are not replaced.
+ *
+ * Inputs: const Path* prev - the previous path node
+ *         const Path* curr - the current path node
+ *         int index - the node index of the current node
+ * Output: none
+ */
+void EditorNPCPath::buildHoverIndex(const Path* prev, const Path* curr,
+                                    int index) const
+{
+  QPair<int,int> value(static_cast<int>(ON_PATH), index);
+  int delta_x = curr->x - prev->x;
+  int delta_y = curr->y - prev->y;
+  int step_x = (delta_x > 0) ? 1 : -1;
+  int step_y = (delta_y > 0) ? 1 : -1;
+
+  /* Direction parsing, depending on flip. The first leg includes the corner */
+  if(prev->xy_flip)
+  {
+    for(int y = prev->y + step_y; delta_y != 0 && y != curr->y + step_y;
+        y += step_y)
+      if(!cache_hover.contains(qMakePair(prev->x, y)))
+        cache_hover.insert(qMakePair(prev->x, y), value);
+    for(int x = prev->x + step_x; delta_x != 0 && x != curr->x; x += step_x)
+      if(!cache_hover.contains(qMakePair(x, curr->y)))
+        cache_hover.insert(qMakePair(x, curr->y), value);
+  }
+  else
+  {
+    for(int x = prev->x + step_x; delta_x != 0 && x != curr->x + step_x;
+        x += step_x)
+      if(!cache_hover.contains(qMakePair(x, prev->y)))
+        cache_hover.insert(qMakePair(x, prev->y), value);
+    for(int y = prev->y + step_y; delta_y != 0 && y != curr->y; y += step_y)
+      if(!cache_hover.contains(qMakePair(curr->x, y)))
+        cache_hover.insert(qMakePair(curr->x, y), value);
+  }
+}
+
+/*
+ * Description: Adds the defined border line for the path between nodes to the
+ *              cached line geometry. This can only handle a straight line on
+ *              the horizontal or vertical. Uses the width as per the defined
+ *              constants.
+ *
+ * Inputs: int x1 - the starting x tile point of the line
  *         int y1 - the starting y tile point of the line
  *         int x2 - the ending x tile point of the line
  *         int y2 - the ending y tile point of the line
- *         QColor color - the color to paint the colored portion of the path
  * Output: none
  */
-void EditorNPCPath::paintLine(QPainter* painter, int x1, int y1, int x2, int y2,
-                              QColor color)
+void EditorNPCPath::buildLine(int x1, int y1, int x2, int y2) const
 {
   int line_w = kLINE_W + kBORDER_W;
   int size = EditorHelpers::getTileSize();
@@ -296,15 +392,16 @@ void EditorNPCPath::paintLine(QPainter* painter, int x1, int y1, int x2, int y2,
       x2 = temp;
     }
 
-    /* Painting calculation ranges */
+    /* Geometry calculation ranges */
     int x_start = x1 * size + (size - tile_w) - 1;
     int x_end = x2 * size + tile_w;
     int y_start = y1 * size + tile_w2;
 
-    /* Paint the rects */
-    painter->fillRect(x_start, y_start, x_end - x_start, kLINE_W, color);
-    painter->fillRect(x_start, y_start + kLINE_W,
-                      x_end - x_start, kBORDER_W, getHoverColor());
+    /* Add the rects */
+    cache_lines.append(qMakePair(QRect(x_start, y_start,
+                                       x_end - x_start, kLINE_W), false));
+    cache_lines.append(qMakePair(QRect(x_start, y_start + kLINE_W,
+                                       x_end - x_start, kBORDER_W), true));
   }
   else if(y1 != y2)
   {
@@ -316,58 +413,56 @@ void EditorNPCPath::paintLine(QPainter* painter, int x1, int y1, int x2, int y2,
       y2 = temp;
     }
 
-    /* Painting calculation ranges */
+    /* Geometry calculation ranges */
     int y_start = y1 * size + (size - tile_w) - 1;
     int y_end = y2 * size + tile_w;
     int x_start = x1 * size + tile_w2;
 
-    /* Paint the rects */
-    painter->fillRect(x_start, y_start, kLINE_W, y_end - y_start, color);
-    painter->fillRect(x_start + kLINE_W, y_start,
-                      kBORDER_W, y_end - y_start, getHoverColor());
+    /* Add the rects */
+    cache_lines.append(qMakePair(QRect(x_start, y_start,
+                                       kLINE_W, y_end - y_start), false));
+    cache_lines.append(qMakePair(QRect(x_start + kLINE_W, y_start,
+                                       kBORDER_W, y_end - y_start), true));
   }
 }
 
 /*
- * Description: Paints all the lines between two nodes. This will handle
- *              painting the horizontal, vertical, and corner portion if
- *              necessary. If the nodes are directly across from each other (
- *              either vertical or horizontal), it just paints the straight
- *              line.
+ * Description: Adds all the lines between two nodes to the cached line
+ *              geometry. This will handle the horizontal, vertical, and corner
+ *              portion if necessary. If the nodes are directly across from
+ *              each other (either vertical or horizontal), it just adds the
+ *              straight line.
  *
- * Inputs: QPainter* painter - the painting engine
- *         Path* curr - the current path node
- *         Path* next - the next path node
- *         QColor color - the color to paint the colored portion of the path
+ * Inputs: const Path* curr - the current path node
+ *         const Path* next - the next path node
  * Output: none
  */
-void EditorNPCPath::paintLines(QPainter* painter, Path* curr, Path* next,
-                               QColor color)
+void EditorNPCPath::buildLines(const Path* curr, const Path* next) const
 {
   if(next != NULL)
   {
     int delta_x = next->x - curr->x;
     int delta_y = next->y - curr->y;
-    bool x_paint = false;
-    bool y_paint = false;
+    bool x_line = false;
+    bool y_line = false;
 
-    /* Paint the first line */
+    /* Add the first line */
     if(delta_x != 0 && (!curr->xy_flip || delta_y == 0))
     {
-      paintLine(painter, curr->x, curr->y, next->x, curr->y, color);
-      x_paint = true;
+      buildLine(curr->x, curr->y, next->x, curr->y);
+      x_line = true;
     }
     else if(delta_y != 0 && (curr->xy_flip || delta_x == 0))
     {
-      paintLine(painter, curr->x, curr->y, curr->x, next->y, color);
-      y_paint = true;
+      buildLine(curr->x, curr->y, curr->x, next->y);
+      y_line = true;
     }
 
-    /* Paint the second line */
-    if(x_paint && delta_y != 0)
+    /* Add the second line */
+    if(x_line && delta_y != 0)
     {
-      /* Paint line */
-      paintLine(painter, next->x, curr->y, next->x, next->y, color);
+      /* Add line */
+      buildLine(next->x, curr->y, next->x, next->y);
 
       /* Direction decision */
       Direction enter = Direction::WEST;
@@ -377,13 +472,13 @@ void EditorNPCPath::paintLines(QPainter* painter, Path* curr, Path* next,
       if(delta_y < 0)
         exit = Direction::NORTH;
 
-      /* Paint corner */
-      paintCorner(painter, next->x, curr->y, enter, exit, color);
+      /* Add corner */
+      buildCorner(next->x, curr->y, enter, exit);
     }
-    else if(y_paint && delta_x != 0)
+    else if(y_line && delta_x != 0)
     {
-      /* Paint line */
-      paintLine(painter, curr->x, next->y, next->x, next->y, color);
+      /* Add line */
+      buildLine(curr->x, next->y, next->x, next->y);
 
       /* Direction decision */
       Direction enter = Direction::NORTH;
@@ -393,63 +488,44 @@ void EditorNPCPath::paintLines(QPainter* painter, Path* curr, Path* next,
       if(delta_x < 0)
         exit = Direction::WEST;
 
-      /* Paint corner */
-      paintCorner(painter, curr->x, next->y, enter, exit, color);
+      /* Add corner */
+      buildCorner(curr->x, next->y, enter, exit);
     }
   }
 }
 
 /*
- * Description: Paints the relevant node point. Pass in the current, next, and
- *              previous nodes to allow the border to be painted with holes to
- *              allow for the line penetrations. If node_num is set, it paints
- *              a node number on top of the node.
+ * Description: Returns the geometry of the relevant node point. Pass in the
+ *              current, next, and previous nodes to allow the border to be
+ *              built with holes for the line penetrations.
  *
- * Inputs: QPainter* painter - the painting engine
- *         Path* prev - the previous path node
- *         Path* curr - the current path node
- *         Path* next - the next path node
- *         QColor color - the color to paint the colored center of the node
- *         int node_num - the number of the node. Defaults to unused and paints
- *                        nothing. -1 is hover node. -2 is start node
- * Output: none
+ * Inputs: const Path* prev - the previous path node
+ *         const Path* curr - the current path node
+ *         const Path* next - the next path node
+ *         int node_num - the number of the node. Defaults to the hover node.
+ *                        -1 is the start node
+ * Output: PathNodeRender - the node rect and the border rects
  */
-void EditorNPCPath::paintNode(QPainter* painter, Path* prev, Path* curr,
-                              Path* next, QColor color, int node_num)
+PathNodeRender EditorNPCPath::buildNode(const Path* prev, const Path* curr,
+                                        const Path* next, int node_num) const
 {
+  PathNodeRender node;
   int size = EditorHelpers::getTileSize();
-  int tile_x = curr->x * size;
-  int tile_y = curr->y * size;
 
-  /* Paint color rect */
+  /* Color rect */
   int offset = (size - kRECT_W) / 2;
-  int rect_x = tile_x + offset;
-  int rect_y = tile_y + offset;
-  QRect rect(rect_x, rect_y, kRECT_W, kRECT_W);
-  if(node_num == -2)
-  {
-    color.setRgb(color.red(), color.green(),
-                 color.blue(), color.alpha() * kHOVER_ALPHA);
-  }
-  else
-  {
-    if(node_num == index_select)
-      color.setRgb(255, 255, 255, color.alpha());
-    if(node_num == index_move)
-      color.setRgb(color.red(), color.green(),
-                   color.blue(), color.alpha() * 0.25);
-  }
-  painter->fillRect(rect, color);
-
-  /* Paint border corners */
-  QColor hover_color = getHoverColor(node_num == -2);
-  painter->fillRect(rect_x - 1, rect_y - 1, kBORDER_W, kBORDER_W, hover_color);
-  painter->fillRect(rect_x + kRECT_W - 1, rect_y - 1,
-                    kBORDER_W, kBORDER_W, hover_color);
-  painter->fillRect(rect_x - 1, rect_y + kRECT_W - 1,
-                    kBORDER_W, kBORDER_W, hover_color);
-  painter->fillRect(rect_x + kRECT_W - 1, rect_y + kRECT_W - 1,
-                    kBORDER_W, kBORDER_W, hover_color);
+  int rect_x = curr->x * size + offset;
+  int rect_y = curr->y * size + offset;
+  node.rect = QRect(rect_x, rect_y, kRECT_W, kRECT_W);
+
+  /* Border corners */
+  node.borders.append(QRect(rect_x - 1, rect_y - 1, kBORDER_W, kBORDER_W));
+  node.borders.append(QRect(rect_x + kRECT_W - 1, rect_y - 1,
+                            kBORDER_W, kBORDER_W));
+  node.borders.append(QRect(rect_x - 1, rect_y + kRECT_W - 1,
+                            kBORDER_W, kBORDER_W));
+  node.borders.append(QRect(rect_x + kRECT_W - 1, rect_y + kRECT_W - 1,
+                            kBORDER_W, kBORDER_W));
 
   /* Check where the penetrations are */
   bool bottom = false;
@@ -527,71 +603,170 @@ void EditorNPCPath::paintNode(QPainter* painter, Path* prev, Path* curr,
   int line_w = kLINE_W + kBORDER_W;
   int chunk_w = (kRECT_W - line_w) / 2;
 
-  /* Paint top border */
+  /* Top border */
   if(top)
   {
-    painter->fillRect(rect_x, rect_y - kBORDER_W, chunk_w,
-                      kBORDER_W, hover_color);
-    painter->fillRect(rect_x + chunk_w + line_w, rect_y - kBORDER_W, chunk_w,
-                      kBORDER_W, hover_color);
+    node.borders.append(QRect(rect_x, rect_y - kBORDER_W, chunk_w, kBORDER_W));
+    node.borders.append(QRect(rect_x + chunk_w + line_w, rect_y - kBORDER_W,
+                              chunk_w, kBORDER_W));
   }
   else
   {
-    painter->fillRect(rect_x, rect_y - kBORDER_W, kRECT_W,
-                      kBORDER_W, hover_color);
+    node.borders.append(QRect(rect_x, rect_y - kBORDER_W, kRECT_W, kBORDER_W));
   }
 
-  /* Paint bottom border */
+  /* Bottom border */
   if(bottom)
   {
-    painter->fillRect(rect_x, rect_y + kRECT_W, chunk_w,
-                      kBORDER_W, hover_color);
-    painter->fillRect(rect_x + chunk_w + line_w, rect_y + kRECT_W, chunk_w,
-                      kBORDER_W, hover_color);
+    node.borders.append(QRect(rect_x, rect_y + kRECT_W, chunk_w, kBORDER_W));
+    node.borders.append(QRect(rect_x + chunk_w + line_w, rect_y + kRECT_W,
+                              chunk_w, kBORDER_W));
   }
   else
   {
-    painter->fillRect(rect_x, rect_y + kRECT_W, kRECT_W,
-                      kBORDER_W, hover_color);
+    node.borders.append(QRect(rect_x, rect_y + kRECT_W, kRECT_W, kBORDER_W));
   }
 
-  /* Paint left border */
+  /* Left border */
   if(left)
   {
-    painter->fillRect(rect_x - kBORDER_W, rect_y,
-                      kBORDER_W, chunk_w, hover_color);
-    painter->fillRect(rect_x - kBORDER_W, rect_y + chunk_w + line_w, kBORDER_W,
-                      chunk_w, hover_color);
+    node.borders.append(QRect(rect_x - kBORDER_W, rect_y, kBORDER_W, chunk_w));
+    node.borders.append(QRect(rect_x - kBORDER_W, rect_y + chunk_w + line_w,
+                              kBORDER_W, chunk_w));
   }
   else
   {
-    painter->fillRect(rect_x - kBORDER_W, rect_y, kBORDER_W,
-                      kRECT_W, hover_color);
+    node.borders.append(QRect(rect_x - kBORDER_W, rect_y, kBORDER_W, kRECT_W));
   }
 
-  /* Paint right border */
+  /* Right border */
   if(right)
   {
-    painter->fillRect(rect_x + kRECT_W, rect_y, kBORDER_W,
-                      chunk_w, hover_color);
-    painter->fillRect(rect_x + kRECT_W, rect_y + chunk_w + line_w, kBORDER_W,
-                      chunk_w, hover_color);
+    node.borders.append(QRect(rect_x + kRECT_W, rect_y, kBORDER_W, chunk_w));
+    node.borders.append(QRect(rect_x + kRECT_W, rect_y + chunk_w + line_w,
+                              kBORDER_W, chunk_w));
   }
   else
   {
-    painter->fillRect(rect_x + kRECT_W, rect_y, kBORDER_W,
-                      kRECT_W, hover_color);
+    node.borders.append(QRect(rect_x + kRECT_W, rect_y, kBORDER_W, kRECT_W));
   }
 
+  return node;
+}
+
+/*
+ * Description: The copy function that is called by any copying methods in the
+ *              class. Utilized by the copy constructor and the copy operator.
+ *
+ * Inputs: const EditorNPCPath &source - the reference npc path class
+ * Output: none
+ */
+void EditorNPCPath::copySelf(const EditorNPCPath &source)
+{
+  invalidateGeometry();
+
+  color_r = source.color_r;
+  color_g = source.color_g;
+  color_b = source.color_b;
+  color_a = source.color_a;
+
+  interact = source.interact;
+  nodes = source.nodes;
+  start_node = source.start_node;
+  state = source.state;
+  track_dist_max = source.track_dist_max;
+  track_dist_min = source.track_dist_min;
+  track_dist_run = source.track_dist_run;
+  tracking = source.tracking;
+
+  update();
+}
+
+/*
+ * Description: Returns the hover color. If hovered is true, border color is
+ *              white. Otherwise, border color is black.
+ *
+ * Inputs: bool hover_node - is the node to get the border for a hover node
+ * Output: QColor - the color to be used for borders
+ */
+QColor EditorNPCPath::getHoverColor(bool hover_node)
+{
+  if(hover_node)
+  {
+    return QColor(0, 0, 0, 255 * kHOVER_ALPHA);
+  }
+  else
+  {
+    if(hovered)
+      return QColor(225, 225, 225);
+    return QColor(0, 0, 0);
+  }
+}
+
+/*
+ * Description: Invalidates the cached geometry. Called on any change to the
+ *              node structure or the parsing state, before the change is made.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorNPCPath::invalidateGeometry()
+{
+  prepareGeometryChange();
+  cache_valid = false;
+}
+
+/*
+ * Description: Paints the relevant node point from its cached geometry. If
+ *              node_num is set, it paints a node number on top of the node.
+ *              Skipped if the node is outside of the exposed area.
+ *
+ * Inputs: QPainter* painter - the painting engine
+ *         const PathNodeRender& node - the node rect and border rects
+ *         const QRectF& exposed - the exposed area being repainted
+ *         QColor color - the color to paint the colored center of the node
+ *         int node_num - the number of the node. Defaults to the hover node.
+ *                        -1 is the start node
+ * Output: none
+ */
+void EditorNPCPath::paintNode(QPainter* painter, const PathNodeRender& node,
+                              const QRectF& exposed, QColor color,
+                              int node_num)
+{
+  if(!exposed.intersects(QRectF(node.rect.adjusted(-kBORDER_W, -kBORDER_W,
+                                                   kBORDER_W, kBORDER_W))))
+    return;
+
+  /* Paint color rect */
+  if(node_num == -2)
+  {
+    color.setRgb(color.red(), color.green(),
+                 color.blue(), color.alpha() * kHOVER_ALPHA);
+  }
+  else
+  {
+    if(node_num == index_select)
+      color.setRgb(255, 255, 255, color.alpha());
+    if(node_num == index_move)
+      color.setRgb(color.red(), color.green(),
+                   color.blue(), color.alpha() * 0.25);
+  }
+  painter->fillRect(node.rect, color);
+
+  /* Paint the borders */
+  QColor hover_color = getHoverColor(node_num == -2);
+  for(int i = 0; i < node.borders.size(); i++)
+    painter->fillRect(node.borders[i], hover_color);
+
   /* Paint the node number */
   painter->setFont(QFont("Helvetica", 10, QFont::Bold));
   painter->setPen(hover_color);
   if(node_num >= 0)
-    painter->drawText(rect, Qt::AlignCenter, QString::number(node_num));
+    painter->drawText(node.rect, Qt::AlignCenter, QString::number(node_num));
   else if(node_num == kNODE_START)
-    painter->drawText(rect, Qt::AlignCenter, "S");
+    painter->drawText(node.rect, Qt::AlignCenter, "S");
   else
-    painter->drawText(rect, Qt::AlignCenter, "H");
+    painter->drawText(node.rect, Qt::AlignCenter, "H");
 }
 
 /*
@@ -658,7 +833,7 @@ bool EditorNPCPath::appendNode(int x, int y, int delay, bool xy_flip)
   if(x >= 0 && y >= 0 && delay >= 0 && (state == MapNPC::LOOPED ||
      state == MapNPC::BACKANDFORTH || state == MapNPC::RANDOMRANGE))
   {
-    prepareGeometryChange();
+    invalidateGeometry();
 
     Path new_node;
     new_node.x = x;
@@ -684,41 +859,21 @@ bool EditorNPCPath::appendNode(int x, int y, int delay, bool xy_flip)
 }
 
 /*
- * Description: Returns the bounding rectangle (Needed by API)
+ * Description: Returns the bounding rectangle (Needed by API). The node
+ *              range is cached and only the hover node is added per call.
  *
  * Inputs: none
  * Output: QRectF - a float rect struct
  */
 QRectF EditorNPCPath::boundingRect() const
 {
-  int min_x = start_node.x;
-  int max_x = start_node.x;
-  int min_y = start_node.y;
-  int max_y = start_node.y;
-
-  /* Find the lowest and highest x nodes */
-  for(int i = 0; i < nodes.size(); i++)
-  {
-    /* Check min */
-    if(min_x < 0 || nodes[i].x < min_x)
-      min_x = nodes[i].x;
-
-    /* Check max */
-    if(max_x < 0 || nodes[i].x > max_x)
-      max_x = nodes[i].x;
-  }
-
-  /* Find the lowest and highest y nodes */
-  for(int i = 0; i < nodes.size(); i++)
-  {
-    /* Check min */
-    if(min_y < 0 || nodes[i].y < min_y)
-      min_y = nodes[i].y;
+  if(!cache_valid)
+    buildGeometry();
 
-    /* Check max */
-    if(max_y < 0 || nodes[i].y > max_y)
-      max_y = nodes[i].y;
-  }
+  int min_x = cache_bound.left();
+  int max_x = cache_bound.right();
+  int min_y = cache_bound.top();
+  int max_y = cache_bound.bottom();
 
   /* Modifications for adding hover node, if relevant */
   if(hover_used)
@@ -780,7 +935,7 @@ bool EditorNPCPath::deleteNode(int index)
 {
   if(index >= 0 && index < nodes.size())
   {
-    prepareGeometryChange();
+    invalidateGeometry();
 
     nodes.removeAt(index);
 
@@ -799,7 +954,7 @@ bool EditorNPCPath::deleteNode(int index)
  */
 void EditorNPCPath::deleteNodes()
 {
-  prepareGeometryChange();
+  invalidateGeometry();
 
   while(nodes.size() > 0)
     nodes.removeLast();
@@ -824,7 +979,7 @@ bool EditorNPCPath::editNode(int index, int x, int y, int delay, bool xy_flip)
   Path* node = getNode(index);
   if(node != NULL && x >= 0 && y >= 0)
   {
-    prepareGeometryChange();
+    invalidateGeometry();
 
     node->x = x;
     node->y = y;
@@ -851,7 +1006,7 @@ bool EditorNPCPath::editNode(int index, int x, int y, int delay, bool xy_flip)
  */
 void EditorNPCPath::editStartNode(int delay, bool xy_flip)
 {
-  prepareGeometryChange();
+  invalidateGeometry();
 
   /* Set the node settings */
   if(delay >= 0)
@@ -924,81 +1079,15 @@ EditorNPCPath::HoverState EditorNPCPath::getHoverState(int &index, int hx,
       y = hy;
     }
 
-    /* Loop through all nodes */
-    for(int i = 0; (hover_state == NO_HOVER) && (i < nodes.size()); i++)
+    /* Look up the tile in the node and path index */
+    if(!cache_valid)
+      buildGeometry();
+    QHash<QPair<int,int>, QPair<int,int>>::const_iterator it =
+                                       cache_hover.constFind(qMakePair(x, y));
+    if(it != cache_hover.constEnd())
     {
-      /* First check if it's on the node */
-      if(nodes[i].x == x && nodes[i].y == y)
-        hover_state = ON_NODE;
-
-      /* Second, check if it's on the path */
-      if(hover_state == NO_HOVER && i > 0)
-      {
-        int curr_x = nodes[i].x;
-        int curr_y = nodes[i].y;
-        int prev_x = nodes[i-1].x;
-        int prev_y = nodes[i-1].y;
-        int delta_x = curr_x - prev_x;
-        int delta_y = curr_y - prev_y;
-
-        /* Direction parsing, depending on flip */
-        if(nodes[i-1].xy_flip)
-        {
-          /* Check y first */
-          if(delta_y > 0)
-          {
-            if(prev_x == x && (y - prev_y ) > 0 && (y - prev_y) <= delta_y)
-              hover_state = ON_PATH;
-          }
-          else if(delta_y < 0)
-          {
-            if(prev_x == x && (y - prev_y) < 0 && (y - prev_y) >= delta_y)
-              hover_state = ON_PATH;
-          }
-
-          /* Check x next */
-          if(delta_x > 0)
-          {
-            if(y == curr_y && (x - prev_x) > 0 && (x - prev_x) < delta_x)
-              hover_state = ON_PATH;
-          }
-          else if(delta_x < 0)
-          {
-            if(y == curr_y && (x - prev_x) < 0 && (x - prev_x) > delta_x)
-              hover_state = ON_PATH;
-          }
-        }
-        else
-        {
-          /* Check x first */
-          if(delta_x > 0)
-          {
-            if(prev_y == y && (x - prev_x) > 0 && (x - prev_x) <= delta_x)
-              hover_state = ON_PATH;
-          }
-          else if(delta_x < 0)
-          {
-            if(prev_y == y && (x - prev_x) < 0 && (x - prev_x) >= delta_x)
-              hover_state = ON_PATH;
-          }
-
-          /* Check y next */
-          if(delta_y > 0)
-          {
-            if(x == curr_x && (y - prev_y) > 0 && (y - prev_y) < delta_y)
-              hover_state = ON_PATH;
-          }
-          else if(delta_y < 0)
-          {
-            if(x == curr_x && (y - prev_y) < 0 && (y - prev_y) > delta_y)
-              hover_state = ON_PATH;
-          }
-        }
-      }
-
-      /* If the hover state is valid now, set index */
-      if(hover_state != NO_HOVER)
-        index = i;
+      hover_state = static_cast<HoverState>(it.value().first);
+      index = it.value().second;
     }
 
     /* If not no hover, set as general hover */
@@ -1344,7 +1433,7 @@ bool EditorNPCPath::insertNodeBefore(int index, int x, int y,
     {
       if(x >= 0 && y >= 0 && delay >= 0)
       {
-        prepareGeometryChange();
+        invalidateGeometry();
 
         Path new_node;
         new_node.x = x;
@@ -1417,180 +1506,169 @@ bool EditorNPCPath::isVisibleEdit()
 /*
  * Description: Loads the path data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: bool - returns true if category found
  */
-bool EditorNPCPath::load(XmlData data, int index)
+bool EditorNPCPath::load(XmlData &data, int index)
 {
-  QString element = QString::fromStdString(data.getElement(index));
-  std::vector<std::string> elements = data.getTailElements(index);
+  EditorEnumDb::XmlTag tag = EditorHelpers::getXmlTag(data.getElement(index));
+
+  /* Node elements are only followed by the node field */
+  bool node_line = (data.getNumElements() == index + 2);
+  EditorEnumDb::XmlTag field = EditorEnumDb::XML_NONE;
+  if(node_line)
+    field = EditorHelpers::getXmlTag(data.getElement(index + 1));
 
-  /* -- INDIVIDUAL NODE ELEMENTS -- */
-  if(element == "node" && elements.size() == 2)
+  switch(tag)
   {
-    int node_index = std::stoi(data.getKeyValue(index));
-    if(node_index >= 0 && state != MapNPC::RANDOM && state != MapNPC::LOCKED)
+    /* -- INDIVIDUAL NODE ELEMENTS -- */
+    case EditorEnumDb::XML_NODE:
     {
-      /* Ensure there are enough nodes for the index */
-      while(node_index >= nodes.size())
-        appendNode(0, 0);
-
-      /* Insert element information */
-      /* -- X -- */
-      if(elements.back() == "x")
-      {
-        editNode(node_index, data.getDataInteger(), nodes[node_index].y,
-                 nodes[node_index].delay, nodes[node_index].xy_flip);
-      }
-      /* -- Y -- */
-      else if(elements.back() == "y")
-      {
-        editNode(node_index, nodes[node_index].x, data.getDataInteger(),
-                 nodes[node_index].delay, nodes[node_index].xy_flip);
-      }
-      /* -- DELAY -- */
-      else if(elements.back() == "delay")
-      {
-        editNode(node_index, nodes[node_index].x, nodes[node_index].y,
-                 data.getDataInteger(), nodes[node_index].xy_flip);
-      }
-      /* -- XY FLIP -- */
-      else if(elements.back() == "xyflip")
+      if(!node_line)
+        return false;
+      int node_index = std::stoi(data.getKeyValue(index));
+      if(node_index >= 0 && state != MapNPC::RANDOM &&
+         state != MapNPC::LOCKED)
       {
-        editNode(node_index, nodes[node_index].x, nodes[node_index].y,
-                 nodes[node_index].delay, data.getDataBool());
+        /* Ensure there are enough nodes for the index */
+        while(node_index >= nodes.size())
+          appendNode(0, 0);
+
+        /* Insert element information */
+        /* -- X -- */
+        if(field == EditorEnumDb::XML_X)
+        {
+          editNode(node_index, data.getDataInteger(), nodes[node_index].y,
+                   nodes[node_index].delay, nodes[node_index].xy_flip);
+        }
+        /* -- Y -- */
+        else if(field == EditorEnumDb::XML_Y)
+        {
+          editNode(node_index, nodes[node_index].x, data.getDataInteger(),
+                   nodes[node_index].delay, nodes[node_index].xy_flip);
+        }
+        /* -- DELAY -- */
+        else if(field == EditorEnumDb::XML_DELAY)
+        {
+          editNode(node_index, nodes[node_index].x, nodes[node_index].y,
+                   data.getDataInteger(), nodes[node_index].xy_flip);
+        }
+        /* -- XY FLIP -- */
+        else if(field == EditorEnumDb::XML_XYFLIP)
+        {
+          editNode(node_index, nodes[node_index].x, nodes[node_index].y,
+                   nodes[node_index].delay, data.getDataBool());
+        }
       }
+      break;
     }
-  }
-  /* START NODE ELEMENTS */
-  else if(element == "startnode" && elements.size() == 2)
-  {
-    if(elements.back() == "delay")
+    /* START NODE ELEMENTS */
+    case EditorEnumDb::XML_STARTNODE:
     {
-      editStartNode(data.getDataInteger(), start_node.xy_flip);
+      if(!node_line)
+        return false;
+      if(field == EditorEnumDb::XML_DELAY)
+        editStartNode(data.getDataInteger(), start_node.xy_flip);
+      else if(field == EditorEnumDb::XML_XYFLIP)
+        editStartNode(start_node.delay, data.getDataBool());
+      break;
     }
-    else if(elements.back() == "xyflip")
+    /* -- NODE STATE -- */
+    case EditorEnumDb::XML_NODESTATE:
     {
-      editStartNode(start_node.delay, data.getDataBool());
+      QString state = QString::fromStdString(data.getDataString());
+      if(state == "looped")
+        setState(MapNPC::LOOPED);
+      else if(state == "backandforth")
+        setState(MapNPC::BACKANDFORTH);
+      else if(state == "randomrange")
+        setState(MapNPC::RANDOMRANGE);
+      else if(state == "random")
+        setState(MapNPC::RANDOM);
+      else if(state == "locked")
+        setState(MapNPC::LOCKED);
+      break;
     }
-  }
-  /* -- NODE STATE -- */
-  else if(element == "nodestate")
-  {
-    QString state = QString::fromStdString(data.getDataString());
-    if(state == "looped")
-      setState(MapNPC::LOOPED);
-    else if(state == "backandforth")
-      setState(MapNPC::BACKANDFORTH);
-    else if(state == "randomrange")
-      setState(MapNPC::RANDOMRANGE);
-    else if(state == "random")
-      setState(MapNPC::RANDOM);
-    else if(state == "locked")
-      setState(MapNPC::LOCKED);
-  }
-  /* -- TRACKING DIST MAX -- */
-  else if(element == "trackmax")
-  {
-    setTrackDistMax(data.getDataInteger());
-  }
-  /* -- TRACKING DIST MIN -- */
-  else if(element == "trackmin")
-  {
-    setTrackDistMin(data.getDataInteger());
-  }
-  /* -- TRACKING DIST RUN -- */
-  else if(element == "trackrun")
-  {
-    setTrackDistRun(data.getDataInteger());
-  }
-  /* -- TRACKING STATE -- */
-  else if(element == "tracking")
-  {
-    QString tracking = QString::fromStdString(data.getDataString());
-    if(tracking == "none")
-      setTracking(TrackingState::NOTRACK);
-    else if(tracking == "toplayer")
-      setTracking(TrackingState::TOPLAYER);
-    else if(tracking == "avoidplayer")
-      setTracking(TrackingState::AVOIDPLAYER);
-  }
-  /* -- FORCED INTERACTION -- */
-  else if(element == "forcedinteraction")
-  {
-    setForcedInteraction(data.getDataBool());
-  }
-  else
-  {
-    return false;
+    /* -- TRACKING DIST MAX -- */
+    case EditorEnumDb::XML_TRACKMAX:
+      setTrackDistMax(data.getDataInteger());
+      break;
+    /* -- TRACKING DIST MIN -- */
+    case EditorEnumDb::XML_TRACKMIN:
+      setTrackDistMin(data.getDataInteger());
+      break;
+    /* -- TRACKING DIST RUN -- */
+    case EditorEnumDb::XML_TRACKRUN:
+      setTrackDistRun(data.getDataInteger());
+      break;
+    /* -- TRACKING STATE -- */
+    case EditorEnumDb::XML_TRACKING:
+    {
+      QString tracking = QString::fromStdString(data.getDataString());
+      if(tracking == "none")
+        setTracking(TrackingState::NOTRACK);
+      else if(tracking == "toplayer")
+        setTracking(TrackingState::TOPLAYER);
+      else if(tracking == "avoidplayer")
+        setTracking(TrackingState::AVOIDPLAYER);
+      break;
+    }
+    /* -- FORCED INTERACTION -- */
+    case EditorEnumDb::XML_FORCEDINTERACTION:
+      setForcedInteraction(data.getDataBool());
+      break;
+    default:
+      return false;
   }
   return true;
 }
 
 /*
- * Description: Paints the path node set
+ * Description: Paints the path node set from the cached geometry. Only the
+ *              lines and nodes within the exposed area are painted.
  *
  * Input: QPainter* painter - the painting engine
- *        const QStyleOptionGraphcisItem* - not used
+ *        const QStyleOptionGraphcisItem* option - the exposed area
  *        QWidget* - not used
  * Output: none
  */
-void EditorNPCPath::paint(QPainter* painter, const QStyleOptionGraphicsItem*,
-                          QWidget*)
+void EditorNPCPath::paint(QPainter* painter,
+                          const QStyleOptionGraphicsItem* option, QWidget*)
 {
   if(isVisible())
   {
-    /* Determine the color */
+    if(!cache_valid)
+      buildGeometry();
+
+    /* Determine the colors and the area to repaint */
     QColor color(color_r, color_g, color_b, color_a);
+    QColor hover_color = getHoverColor();
+    QRectF exposed = boundingRect();
+    if(option != NULL)
+      exposed = option->exposedRect;
 
     /* Paint the hover node */
     if(hover_used && index_move < 0)
-      paintNode(painter, NULL, &hover_node, NULL, color);
+      paintNode(painter, buildNode(NULL, &hover_node, NULL), exposed, color);
 
-    /* Parse all paths */
-    if(nodes.size() > 0)
-      paintLines(painter, &start_node, &nodes.front(), color);
-    for(int i = 0; i < nodes.size(); i++)
+    /* Paint the path between nodes */
+    for(int i = 0; i < cache_lines.size(); i++)
     {
-      Path* curr = &nodes[i];
-      Path* next = NULL;
-      if(i < (nodes.size() - 1))
-        next = &nodes[i+1];
-      else if(i == (nodes.size() - 1) && (state == MapNPC::LOOPED ||
-              state == MapNPC::RANDOMRANGE) && nodes.size() > 1)
-        next = &nodes.front();
-
-      /* Paint the path between nodes */
-      paintLines(painter, curr, next, color);
+      const QRect& rect = cache_lines[i].first;
+      if(exposed.intersects(QRectF(rect)))
+      {
+        if(cache_lines[i].second)
+          painter->fillRect(rect, hover_color);
+        else
+          painter->fillRect(rect, color);
+      }
     }
 
-    /* Paint the start node */
-    if(nodes.size() > 0)
-      paintNode(painter, NULL, &start_node, &nodes.front(), color, kNODE_START);
-    else
-      paintNode(painter, NULL, &start_node, NULL, color, kNODE_START);
-
-    /* Parse all nodes */
-    for(int i = 0; i < nodes.size(); i++)
-    {
-      Path* curr = &nodes[i];
-      Path* prev = NULL;
-      if(i > 0)
-        prev = &nodes[i-1];
-      else if(i == 0 && (state == MapNPC::LOOPED ||
-              state == MapNPC::RANDOMRANGE) && nodes.size() > 1)
-        prev = &nodes.last();
-      Path* next = NULL;
-      if(i < (nodes.size() - 1))
-        next = &nodes[i+1];
-      else if(i == (nodes.size() - 1) && (state == MapNPC::LOOPED ||
-              state == MapNPC::RANDOMRANGE) && nodes.size() > 1)
-        next = &nodes.front();
-
-      /* Paint node rect */
-      paintNode(painter, prev, curr, next, color, i);
-    }
+    /* Paint the start node and all nodes */
+    paintNode(painter, cache_nodes.front(), exposed, color, kNODE_START);
+    for(int i = 1; i < cache_nodes.size(); i++)
+      paintNode(painter, cache_nodes[i], exposed, color, i - 1);
   }
 }
 
@@ -1779,6 +1857,7 @@ void EditorNPCPath::setHoverNode(int x, int y)
     /* If move cycle, move that node to the new location */
     if(index_move >= 0)
     {
+      cache_valid = false;
       nodes[index_move].x = x;
       nodes[index_move].y = y;
     }
@@ -1848,7 +1927,7 @@ bool EditorNPCPath::setStartNode(int x, int y)
 {
   if(x >= 0 && y >= 0)
   {
-    prepareGeometryChange();
+    invalidateGeometry();
 
     start_node.x = x;
     start_node.y = y;
@@ -1871,7 +1950,7 @@ void EditorNPCPath::setState(MapNPC::NodeState state)
   if(this->state != state)
   {
     this->state = state;
-    prepareGeometryChange();
+    invalidateGeometry();
 
     /* Update the node count depending on the state change */
     if(state == MapNPC::RANDOMRANGE)
@@ -2011,24 +2090,9 @@ void EditorNPCPath::setVisibleEdit(bool visible)
  */
 QPainterPath EditorNPCPath::shape() const
 {
-  QPainterPath path;
-  int size = EditorHelpers::getTileSize();
-  int rect = kRECT_W + kLINE_W * 2;
-  int offset = (size - rect) / 2;
-
-  /* Start node */
-  path.addRect(start_node.x * size + offset, start_node.y * size + offset,
-               rect, rect);
-
-  /* Nodes */
-  for(int i = 0; i < nodes.size(); i++)
-  {
-    int x = nodes[i].x * size + offset;
-    int y = nodes[i].y * size + offset;
-    path.addRect(x, y, rect, rect);
-  }
-
-  return path;
+  if(!cache_valid)
+    buildGeometry();
+  return cache_shape;
 }
 
 /*
@@ -2045,7 +2109,7 @@ void EditorNPCPath::unsetIndexMove(bool cancel, bool allow_update)
     /* If cancel, reset the location */
     if(cancel)
     {
-      prepareGeometryChange();
+      invalidateGeometry();
       nodes[index_move].x = move_node.x;
       nodes[index_move].y = move_node.y;
     }
@@ -23,9 +23,8 @@ EditorParty::EditorParty(QWidget *parent) : QWidget(parent)
   name_base = "Blank";
   name_curr = name_base;
 
-  /* Layout */
-  createLayout();
-  loadWorkingInfo();
+  /* Layout - created on the first show */
+  layout_created = false;
 }
 
 /*
@@ -264,8 +263,15 @@ EditorItem* EditorParty::getItem(int id)
  */
 void EditorParty::loadWorkingInfo()
 {
-  /* ID */
+  if(!layout_created)
+    return;
+
+  /* ID - the core parties are locked */
+  bool locked = (id == (int)Party::kID_SLEUTH ||
+                 id == (int)Party::kID_BEARACKS);
   edit_id->setText(QString::number(id));
+  combo_classify->setDisabled(locked);
+  edit_name->setDisabled(locked);
 
   /* Name */
   edit_name->setText(getName());
@@ -286,6 +292,25 @@ void EditorParty::loadWorkingInfo()
   updatePersonList();
 }
 
+/*
+ * Description: The re-implementation of the show event. The widget layout is
+ *              only created on the first show, so parties that are never
+ *              opened hold no widgets.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorParty::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
+}
+
 /*
  * Description: Sorts the list of working persons set first by ID from least
  *              to greatest and then by level, from lowest to highest.
@@ -876,14 +901,35 @@ QString EditorParty::getNameList()
   return EditorHelpers::getListString(getID(), getName());
 }
 
+/*
+ * Description: Returns the items and persons of the saved party, for the usage
+ *              index. The working set is not included until saved.
+ *
+ * Inputs: none
+ * Output: QList<EditorUsage> - the references, with the place of each
+ */
+QList<EditorUsage> EditorParty::getUsages()
+{
+  QList<EditorUsage> usages;
+
+  QList<int> item_ids = item_set_base.keys();
+  for(int i = 0; i < item_ids.size(); i++)
+    usages.push_back({EditorEnumDb::USE_ITEM, item_ids[i], "Inventory"});
+  for(int i = 0; i < person_set_base.size(); i++)
+    usages.push_back({EditorEnumDb::USE_PERSON, person_set_base[i].first,
+                      "Persons"});
+
+  return usages;
+}
+
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorParty::load(XmlData data, int index)
+void EditorParty::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "name")
@@ -1007,6 +1053,9 @@ void EditorParty::save(FileHandler* fh, bool game_only)
  */
 void EditorParty::saveWorking()
 {
+  bool usage_changed = (item_set_base != item_set ||
+                        person_set_base != person_set);
+
   /* Save the data */
   party_base = party_curr;
   item_set_base = item_set;
@@ -1014,6 +1063,9 @@ void EditorParty::saveWorking()
   if(name_base != name_curr)
     emit nameChange(name_curr);
   name_base = name_curr;
+  if(usage_changed)
+    emit usageChange(id);
+  emit dataSaved();
 }
 
 /*
@@ -1025,24 +1077,14 @@ void EditorParty::saveWorking()
 void EditorParty::setID(int id)
 {
   this->id = id;
-  edit_id->setText(QString::number(id));
 
   /* ID checks for data not allowed to be changed */
-  if(id == (int)Party::kID_SLEUTH ||
-     id == (int)Party::kID_BEARACKS)
-  {
-    if(id == (int)Party::kID_SLEUTH)
-      combo_classify->setCurrentIndex((int)PartyType::SLEUTH);
-    else
-      combo_classify->setCurrentIndex((int)PartyType::BEARACKS);
-    combo_classify->setDisabled(true);
-    edit_name->setDisabled(true);
-  }
-  else
-  {
-    combo_classify->setEnabled(true);
-    edit_name->setEnabled(true);
-  }
+  if(id == (int)Party::kID_SLEUTH)
+    party_curr.setPartyType(PartyType::SLEUTH);
+  else if(id == (int)Party::kID_BEARACKS)
+    party_curr.setPartyType(PartyType::BEARACKS);
+
+  loadWorkingInfo();
 }
 
 /*
@@ -1055,7 +1097,7 @@ void EditorParty::setID(int id)
 void EditorParty::setName(QString name, bool update)
 {
   name_curr = name;
-  if(update)
+  if(update && layout_created)
     edit_name->setText(name);
   //emit nameChange(name);
 }
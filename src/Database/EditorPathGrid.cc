@@ -0,0 +1,599 @@
+/*******************************************************************************
+ * Class Name: EditorPathGrid
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: A packed passability grid of a sub-map, used to validate and
+ *              time npc paths. Each tile keeps the exit passability of all
+ *              static layers (base, lower, thing, IO and person) as a 4 bit
+ *              number. Tiles are only re-read once they are marked dirty, so
+ *              an edit only costs the tiles it touched.
+ ******************************************************************************/
+#include "Database/EditorPathGrid.h"
+#include "Database/EditorMap.h"
+#include <queue>
+
+/* Constant Implementation - see header file for descriptions */
+const uint8_t EditorPathGrid::kDIRTY = 0x10;
+const uint8_t EditorPathGrid::kPASS_MASK = 0x0F;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The grid is empty until a sub-map is set
+ *              and refreshed.
+ *
+ * Inputs: none
+ */
+EditorPathGrid::EditorPathGrid()
+{
+  height = 0;
+  map = NULL;
+  rebuild = true;
+  width = 0;
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorPathGrid::~EditorPathGrid()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Checks the walk between two nodes of the route stored in the
+ *              check and adds it to the segment list. A reverse walk follows
+ *              the tiles of the forward walk back, as a back and forth path
+ *              does.
+ *
+ * Inputs: PathCheck &check - the check being built
+ *         int from - the node index the walk leaves. -1 is the start node
+ *         int to - the node index the walk ends on
+ *         bool reverse - true if the walk is the forward walk, taken back
+ * Output: none
+ */
+void EditorPathGrid::addSegment(PathCheck &check, int from, int to,
+                                bool reverse)
+{
+  const Path &from_node = (from < 0) ? check.start_node : check.nodes[from];
+  const Path &to_node = check.nodes[to];
+
+  PathSegmentCheck segment;
+  if(reverse)
+    segment = checkSegment(to_node, from_node, true, &check.bound);
+  else
+    segment = checkSegment(from_node, to_node, false, &check.bound);
+  segment.from = from;
+  segment.to = to;
+
+  if(segment.blocked)
+    check.blocked_count++;
+  check.segments.push_back(segment);
+}
+
+/*
+ * Description: Returns the bit of the direction in a cell. Matches the order
+ *              of EditorHelpers::getPassabilityNum().
+ *
+ * Inputs: Direction dir - the direction
+ * Output: uint8_t - the bit of the direction. 0 if directionless
+ */
+uint8_t EditorPathGrid::getDirectionBit(Direction dir)
+{
+  if(dir == Direction::NORTH)
+    return 8;
+  else if(dir == Direction::EAST)
+    return 4;
+  else if(dir == Direction::SOUTH)
+    return 2;
+  else if(dir == Direction::WEST)
+    return 1;
+  return 0;
+}
+
+/*
+ * Description: Returns the list of tiles walked between two nodes, including
+ *              both ends. The walk goes x then y, or y then x if the leaving
+ *              node is flipped. Matches the line painting of the npc path.
+ *
+ * Inputs: const Path &from - the node the walk leaves
+ *         const Path &to - the node the walk ends on
+ * Output: QList<QPoint> - the tiles of the walk, in order
+ */
+QList<QPoint> EditorPathGrid::getWalk(const Path &from, const Path &to)
+{
+  QList<QPoint> walk;
+  QPoint tile(from.x, from.y);
+  int step_x = (to.x > from.x) ? 1 : -1;
+  int step_y = (to.y > from.y) ? 1 : -1;
+
+  walk.push_back(tile);
+  if(from.xy_flip)
+  {
+    while(tile.y() != to.y)
+    {
+      tile.ry() += step_y;
+      walk.push_back(tile);
+    }
+    while(tile.x() != to.x)
+    {
+      tile.rx() += step_x;
+      walk.push_back(tile);
+    }
+  }
+  else
+  {
+    while(tile.x() != to.x)
+    {
+      tile.rx() += step_x;
+      walk.push_back(tile);
+    }
+    while(tile.y() != to.y)
+    {
+      tile.ry() += step_y;
+      walk.push_back(tile);
+    }
+  }
+
+  return walk;
+}
+
+/*
+ * Description: Returns if the two nodes are at the same place with the same
+ *              delay and parsing direction.
+ *
+ * Inputs: const Path &a - the first node
+ *         const Path &b - the second node
+ * Output: bool - true if the same
+ */
+bool EditorPathGrid::isSameNode(const Path &a, const Path &b)
+{
+  return (a.x == b.x && a.y == b.y && a.delay == b.delay &&
+          a.xy_flip == b.xy_flip);
+}
+
+/*
+ * Description: Reads the exit passability of a single tile from the sub-map.
+ *              A direction is passable only if every static layer allows it.
+ *              Npcs are left out, since they move.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ * Output: uint8_t - the passability bits of the tile
+ */
+uint8_t EditorPathGrid::readTile(int x, int y)
+{
+  const EditorEnumDb::Layer layers[] = {EditorEnumDb::BASE,
+                                        EditorEnumDb::LOWER1,
+                                        EditorEnumDb::LOWER2,
+                                        EditorEnumDb::LOWER3,
+                                        EditorEnumDb::LOWER4,
+                                        EditorEnumDb::LOWER5,
+                                        EditorEnumDb::THING,
+                                        EditorEnumDb::IO,
+                                        EditorEnumDb::PERSON};
+  const Direction dirs[] = {Direction::NORTH, Direction::EAST,
+                            Direction::SOUTH, Direction::WEST};
+  EditorTile* tile = map->tiles[x][y];
+  uint8_t cell = 0;
+
+  for(int i = 0; i < 4; i++)
+  {
+    bool passable = true;
+    for(int j = 0; passable && j < 9; j++)
+      passable = tile->getPassability(layers[j], dirs[i]);
+    if(passable)
+      cell |= getDirectionBit(dirs[i]);
+  }
+
+  return cell;
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns if the move out of the tile in the direction is
+ *              possible. The tile must allow the exit and the next tile must
+ *              allow the entry from the opposite side. Call refresh() first.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ *         Direction dir - the direction of the move
+ * Output: bool - true if the move is possible
+ */
+bool EditorPathGrid::canMove(int x, int y, Direction dir)
+{
+  int next_x = x;
+  int next_y = y;
+  Direction entry = Direction::NORTH;
+  if(dir == Direction::NORTH)
+  {
+    next_y--;
+    entry = Direction::SOUTH;
+  }
+  else if(dir == Direction::EAST)
+  {
+    next_x++;
+    entry = Direction::WEST;
+  }
+  else if(dir == Direction::SOUTH)
+  {
+    next_y++;
+  }
+  else if(dir == Direction::WEST)
+  {
+    next_x--;
+    entry = Direction::EAST;
+  }
+  else
+  {
+    return false;
+  }
+
+  if(x < 0 || y < 0 || x >= width || y >= height || next_x < 0 ||
+     next_y < 0 || next_x >= width || next_y >= height)
+    return false;
+
+  return ((cells[x * height + y] & getDirectionBit(dir)) != 0 &&
+          (cells[next_x * height + next_y] & getDirectionBit(entry)) != 0);
+}
+
+/*
+ * Description: Checks every walk of the path against the grid and times one
+ *              full cycle. Looped paths walk back to the first node and back
+ *              and forth paths walk every segment in reverse. The cycle is
+ *              only timed if nothing is blocked and the npc moves. Random
+ *              and locked paths are not walked. Call refresh() first.
+ *
+ * Inputs: EditorNPCPath* path - the npc path to check
+ *         int ms_per_tile - the time the npc takes to walk a tile, in ms
+ * Output: PathCheck - the check of the path
+ */
+PathCheck EditorPathGrid::checkPath(EditorNPCPath* path, int ms_per_tile)
+{
+  PathCheck check;
+  check.blocked_count = 0;
+  check.cycle_ms = -1;
+  check.ms_per_tile = ms_per_tile;
+  check.state = MapNPC::LOCKED;
+
+  if(path != NULL)
+  {
+    check.nodes = path->getNodes();
+    check.start_node = path->getStartNode();
+    check.state = path->getState();
+  }
+
+  if(map != NULL && check.nodes.size() > 0 &&
+     (check.state == MapNPC::LOOPED || check.state == MapNPC::BACKANDFORTH))
+  {
+    int count = check.nodes.size();
+
+    /* The walk from the start location onto the path */
+    if(check.start_node.x >= 0 && check.start_node.y >= 0)
+      addSegment(check, -1, 0);
+
+    /* The walks of one cycle */
+    for(int i = 1; i < count; i++)
+      addSegment(check, i - 1, i);
+    if(check.state == MapNPC::LOOPED && count > 1)
+      addSegment(check, count - 1, 0);
+    else if(check.state == MapNPC::BACKANDFORTH)
+      for(int i = count - 1; i > 0; i--)
+        addSegment(check, i, i - 1, true);
+
+    /* Time the cycle - the walks and the delays on each node reached */
+    if(check.blocked_count == 0 && ms_per_tile > 0 && count > 1)
+    {
+      check.cycle_ms = 0;
+      for(int i = 0; i < check.segments.size(); i++)
+      {
+        if(check.segments[i].from >= 0)
+        {
+          check.cycle_ms += check.segments[i].steps * ms_per_tile;
+          check.cycle_ms += check.nodes[check.segments[i].to].delay;
+        }
+      }
+    }
+  }
+
+  return check;
+}
+
+/*
+ * Description: Checks the walk between two nodes, tile by tile. If a tile
+ *              cannot be entered, the walk is blocked and an A* search finds
+ *              the shortest walk around it, if any.
+ *
+ * Inputs: const Path &from - the node the walk leaves
+ *         const Path &to - the node the walk ends on
+ *         bool reverse - true to take the walk from the end back to the start
+ *         QRect* bound - united with the tiles read. Default NULL
+ * Output: PathSegmentCheck - the check of the walk. Node indexes are not set
+ */
+PathSegmentCheck EditorPathGrid::checkSegment(const Path &from, const Path &to,
+                                              bool reverse, QRect* bound)
+{
+  PathSegmentCheck check;
+  check.from = -1;
+  check.to = -1;
+  check.blocked = false;
+  check.block_tile = QPoint();
+  check.detour = -1;
+
+  /* Get the tiles walked, in the walk order */
+  QList<QPoint> walk = getWalk(from, to);
+  if(reverse)
+    for(int i = 0; i < walk.size() / 2; i++)
+      walk.swap(i, walk.size() - 1 - i);
+  check.steps = walk.size() - 1;
+
+  if(bound != NULL)
+    *bound |= QRect(QPoint(qMin(from.x, to.x), qMin(from.y, to.y)),
+                    QPoint(qMax(from.x, to.x), qMax(from.y, to.y)));
+
+  /* Walk each tile */
+  for(int i = 1; !check.blocked && i < walk.size(); i++)
+  {
+    QPoint delta = walk[i] - walk[i - 1];
+    Direction dir = Direction::NORTH;
+    if(delta.x() > 0)
+      dir = Direction::EAST;
+    else if(delta.x() < 0)
+      dir = Direction::WEST;
+    else if(delta.y() > 0)
+      dir = Direction::SOUTH;
+
+    if(!canMove(walk[i - 1].x(), walk[i - 1].y(), dir))
+    {
+      check.blocked = true;
+      check.block_tile = walk[i];
+    }
+  }
+
+  /* If blocked, find the way around */
+  if(check.blocked)
+    check.detour = findPath(walk.front(), walk.back(), bound);
+
+  return check;
+}
+
+/*
+ * Description: A* search between two tiles on the grid, with 4 way moves and
+ *              the manhattan distance as the heuristic. Jump point search is
+ *              not used since the passability is per direction. Call
+ *              refresh() first.
+ *
+ * Inputs: QPoint start - the start tile
+ *         QPoint end - the end tile
+ *         QRect* bound - united with the tiles read. Default NULL
+ * Output: int - the number of steps of the shortest walk. -1 if unreachable
+ */
+int EditorPathGrid::findPath(QPoint start, QPoint end, QRect* bound)
+{
+  const Direction dirs[] = {Direction::NORTH, Direction::EAST,
+                            Direction::SOUTH, Direction::WEST};
+  const int delta_x[] = {0, 1, 0, -1};
+  const int delta_y[] = {-1, 0, 1, 0};
+  QRect grid_rect(0, 0, width, height);
+  int steps = -1;
+
+  if(!grid_rect.contains(start) || !grid_rect.contains(end))
+    return -1;
+
+  /* Open set, sorted by lowest estimated cost */
+  QVector<int> cost(width * height, -1);
+  std::priority_queue<std::pair<int,int>, std::vector<std::pair<int,int>>,
+                      std::greater<std::pair<int,int>>> open;
+  QRect explored(start, start);
+  cost[start.x() * height + start.y()] = 0;
+  open.push(std::make_pair((end - start).manhattanLength(),
+                           start.x() * height + start.y()));
+
+  while(steps < 0 && !open.empty())
+  {
+    std::pair<int,int> top = open.top();
+    open.pop();
+    int x = top.second / height;
+    int y = top.second % height;
+    int g = cost[top.second];
+
+    /* Skip entries replaced by a cheaper one */
+    if(top.first > g + (end - QPoint(x, y)).manhattanLength())
+      continue;
+
+    if(x == end.x() && y == end.y())
+    {
+      steps = g;
+    }
+    else
+    {
+      explored |= QRect(x, y, 1, 1);
+      for(int i = 0; i < 4; i++)
+      {
+        if(canMove(x, y, dirs[i]))
+        {
+          QPoint next(x + delta_x[i], y + delta_y[i]);
+          int index = next.x() * height + next.y();
+          if(cost[index] < 0 || g + 1 < cost[index])
+          {
+            cost[index] = g + 1;
+            open.push(std::make_pair(g + 1 + (end - next).manhattanLength(),
+                                     index));
+          }
+        }
+      }
+    }
+  }
+
+  if(bound != NULL)
+    *bound |= explored.adjusted(-1, -1, 1, 1);
+  return steps;
+}
+
+/*
+ * Description: Returns the height of the grid.
+ *
+ * Inputs: none
+ * Output: int - the height, in tiles
+ */
+int EditorPathGrid::getHeight()
+{
+  return height;
+}
+
+/*
+ * Description: Returns the sub-map being read.
+ *
+ * Inputs: none
+ * Output: SubMapInfo* - the sub-map. NULL if none
+ */
+SubMapInfo* EditorPathGrid::getSubMap()
+{
+  return map;
+}
+
+/*
+ * Description: Returns the width of the grid.
+ *
+ * Inputs: none
+ * Output: int - the width, in tiles
+ */
+int EditorPathGrid::getWidth()
+{
+  return width;
+}
+
+/*
+ * Description: Returns if the check was made on the same route as the path
+ *              has now, at the same walking speed.
+ *
+ * Inputs: const PathCheck &check - the previous check
+ *         EditorNPCPath* path - the npc path
+ *         int ms_per_tile - the time the npc takes to walk a tile, in ms
+ * Output: bool - true if the route has not changed
+ */
+bool EditorPathGrid::isSameRoute(const PathCheck &check, EditorNPCPath* path,
+                                 int ms_per_tile)
+{
+  if(path == NULL || check.ms_per_tile != ms_per_tile ||
+     check.state != path->getState() ||
+     !isSameNode(check.start_node, path->getStartNode()) ||
+     check.nodes.size() != path->getNodes().size())
+    return false;
+
+  for(int i = 0; i < check.nodes.size(); i++)
+    if(!isSameNode(check.nodes[i], *path->getNode(i)))
+      return false;
+  return true;
+}
+
+/*
+ * Description: Marks the full grid to be re-read on the next refresh.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorPathGrid::markDirty()
+{
+  rebuild = true;
+}
+
+/*
+ * Description: Marks the tile range to be re-read on the next refresh. Can be
+ *              called before the tiles are modified.
+ *
+ * Inputs: int x - the x tile location of the range
+ *         int y - the y tile location of the range
+ *         int w - the width of the range, in tiles
+ *         int h - the height of the range, in tiles
+ * Output: none
+ */
+void EditorPathGrid::markDirty(int x, int y, int w, int h)
+{
+  QRect range = QRect(x, y, w, h).intersected(QRect(0, 0, width, height));
+  if(!range.isEmpty())
+  {
+    for(int i = range.left(); i <= range.right(); i++)
+      for(int j = range.top(); j <= range.bottom(); j++)
+        cells[i * height + j] |= kDIRTY;
+    dirty_rect |= range;
+  }
+}
+
+/*
+ * Description: Re-reads the dirty tiles from the sub-map. The full grid is
+ *              read if it was never built, the sub-map changed or the sub-map
+ *              size no longer matches.
+ *
+ * Inputs: none
+ * Output: QRect - the bound of the tiles whose passability changed
+ */
+QRect EditorPathGrid::refresh()
+{
+  QRect changed;
+
+  /* No sub-map - empty the grid */
+  if(map == NULL || map->tiles.isEmpty())
+  {
+    cells.clear();
+    dirty_rect = QRect();
+    height = 0;
+    width = 0;
+    return changed;
+  }
+
+  /* Rebuild the full grid */
+  if(rebuild || map->tiles.size() != width ||
+     map->tiles.front().size() != height)
+  {
+    width = map->tiles.size();
+    height = map->tiles.front().size();
+    cells.fill(kDIRTY, width * height);
+    dirty_rect = QRect(0, 0, width, height);
+    changed = dirty_rect;
+    rebuild = false;
+  }
+
+  /* Re-read the dirty tiles */
+  if(!dirty_rect.isEmpty())
+  {
+    for(int i = dirty_rect.left(); i <= dirty_rect.right(); i++)
+    {
+      for(int j = dirty_rect.top(); j <= dirty_rect.bottom(); j++)
+      {
+        uint8_t &cell = cells[i * height + j];
+        if((cell & kDIRTY) != 0)
+        {
+          uint8_t pass = readTile(i, j);
+          if(pass != (cell & kPASS_MASK))
+            changed |= QRect(i, j, 1, 1);
+          cell = pass;
+        }
+      }
+    }
+    dirty_rect = QRect();
+  }
+
+  return changed;
+}
+
+/*
+ * Description: Sets the sub-map to read. The grid is rebuilt on the next
+ *              refresh.
+ *
+ * Inputs: SubMapInfo* map - the sub-map. NULL to clear
+ * Output: none
+ */
+void EditorPathGrid::setSubMap(SubMapInfo* map)
+{
+  this->map = map;
+  rebuild = true;
+}
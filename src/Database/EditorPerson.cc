@@ -33,9 +33,8 @@ EditorPerson::EditorPerson(QWidget* parent) : QWidget(parent)
   race_id = -1;
   race_id_base = -1;
 
-  /* Layout */
-  createLayout();
-  loadWorkingInfo();
+  /* Layout - created on the first show */
+  layout_created = false;
 }
 
 /*
@@ -417,6 +416,24 @@ int EditorPerson::getElementIndex(Element ele, ElementCurve curve)
  */
 void EditorPerson::loadWorkingInfo()
 {
+  /* Check the class and race are still available, with or without widgets */
+  int class_index = -1;
+  for(int i = 0; i < class_total.size(); i++)
+    if(class_total[i]->getID() == class_id)
+      class_index = i + 1;
+  if(class_index < 0)
+    class_id = -1;
+  int race_index = -1;
+  for(int i = 0; i < race_total.size(); i++)
+    if(race_total[i]->getID() == race_id)
+      race_index = i + 1;
+  if(race_index < 0)
+    race_id = -1;
+
+  /* The rest is only the widgets */
+  if(!layout_created)
+    return;
+
   /* ID */
   edit_id->setText(QString::number(id));
 
@@ -435,34 +452,20 @@ void EditorPerson::loadWorkingInfo()
   combo_class->blockSignals(true);
   combo_class->clear();
   combo_class->addItem("None");
-  int class_index = -1;
   for(int i = 0; i < class_total.size(); i++)
-  {
     combo_class->addItem(class_total[i]->getNameList());
-    if(class_total[i]->getID() == class_id)
-      class_index = i + 1;
-  }
   if(class_index > 0)
     combo_class->setCurrentIndex(class_index);
-  else
-    class_id = -1;
   combo_class->blockSignals(false);
 
   /* Race */
   combo_race->blockSignals(true);
   combo_race->clear();
   combo_race->addItem("None");
-  int race_index = -1;
   for(int i = 0; i < race_total.size(); i++)
-  {
     combo_race->addItem(race_total[i]->getNameList());
-    if(race_total[i]->getID() == race_id)
-      race_index = i + 1;
-  }
   if(race_index > 0)
     combo_race->setCurrentIndex(race_index);
-  else
-    race_id = -1;
   combo_race->blockSignals(false);
 
   /* Flags */
@@ -494,6 +497,25 @@ void EditorPerson::loadWorkingInfo()
   spin_xp->setValue(person_curr.getExpDrop());
 }
 
+/*
+ * Description: Creates the widget layout the first time the person is shown,
+ *              so persons that are never opened hold no widgets.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorPerson::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    setID(id);
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
+}
+
 /*
  * Description: Updates the used working item list to cross reference with the
  *              selected indexes in the item array. If the index is not found
@@ -1246,6 +1268,30 @@ int EditorPerson::getID() const
   return id;
 }
 
+/*
+ * Description: Returns the image files of the sprites of the person that a
+ *              game export writes, matching save(): the saved ally, dialog
+ *              and face sprites and the foe sprites.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorPerson::getImagePaths()
+{
+  QStringList paths;
+
+  paths += sprite_ally_base.getPaths();
+  paths += sprite_ally_def_base.getPaths();
+  paths += sprite_ally_off_base.getPaths();
+  paths += sprite_dialog_base.getPaths();
+  paths += sprite_face_base.getPaths();
+  paths += sprite_foe.getPaths();
+  paths += sprite_foe_def.getPaths();
+  paths += sprite_foe_off.getPaths();
+
+  return paths;
+}
+
 /*
  * Description: Returns the name of the person
  *
@@ -1271,11 +1317,11 @@ QString EditorPerson::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorPerson::load(XmlData data, int index)
+void EditorPerson::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "class")
@@ -1534,6 +1580,7 @@ void EditorPerson::saveWorking()
   class_id_base = class_id;
   item_ids_base = item_ids;
   race_id_base = race_id;
+  emit dataSaved();
 }
 
 /*
@@ -1545,6 +1592,8 @@ void EditorPerson::saveWorking()
 void EditorPerson::setID(int id)
 {
   this->id = id;
+  if(!layout_created)
+    return;
   edit_id->setText(QString::number(id));
 
   /* ID checks for data not allowed to be changed */
@@ -1578,7 +1627,7 @@ void EditorPerson::setID(int id)
 void EditorPerson::setName(QString name, bool update)
 {
   person_curr.setName(name.toStdString());
-  if(update)
+  if(update && layout_created)
     edit_name->setText(name);
   //emit nameChange(name);
 }
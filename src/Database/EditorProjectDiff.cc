@@ -0,0 +1,997 @@
+/*******************************************************************************
+ * Class Name: EditorProjectDiff
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Structural diff and three-way merge of saved projects (.usv).
+ *              Each version is read into its objects (core objects, map
+ *              bases, sub-maps and thing instances, by ID) and the tile
+ *              planes of its sub-maps. Tile planes are held in chunks that
+ *              are hashed on load, so only the chunks whose hashes differ
+ *              are compared tile by tile.
+ ******************************************************************************/
+#include "Database/EditorProjectDiff.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorProjectDiff::kCHUNK_SIZE = 16;
+const int EditorProjectDiff::kLAYERS = 12;
+const int EditorProjectDiff::kMAX_ENTRIES = 10000;
+const QString EditorProjectDiff::kMISSING = "(none)";
+const int EditorProjectDiff::kPROGRESS_DELAY = 500;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. Nothing compared or merged.
+ *
+ * Inputs: none
+ */
+EditorProjectDiff::EditorProjectDiff()
+{
+  entry_count = 0;
+  merged.valid = false;
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorProjectDiff::~EditorProjectDiff()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Adds a change (diff) or conflict (merge). All are counted, but
+ *              only the first kMAX_ENTRIES are listed, so a full repaint of a
+ *              large map does not build a list of every tile.
+ *
+ * Inputs: QString object - the object or sub-map key
+ *         QString field - the field or tile. Empty for the whole object
+ *         QString base - the value in the base version
+ *         QString ours - the value in our version
+ *         QString theirs - the value in their version
+ * Output: none
+ */
+void EditorProjectDiff::addEntry(QString object, QString field, QString base,
+                                 QString ours, QString theirs)
+{
+  entry_count++;
+  if(entries.size() < kMAX_ENTRIES)
+  {
+    EditorDiffEntry entry;
+    entry.object = object;
+    entry.field = field;
+    entry.base = base;
+    entry.ours = ours;
+    entry.theirs = theirs;
+    entries.push_back(entry);
+  }
+}
+
+/*
+ * Description: Compares the tile planes of the two projects. Chunks with the
+ *              same hash are skipped. The rest are compared cell by cell, and
+ *              each changed tile layer is added as a change.
+ *
+ * Inputs: const EditorDiffProject &ours - our project
+ *         const EditorDiffProject &theirs - their project
+ * Output: none
+ */
+void EditorProjectDiff::diffPlanes(const EditorDiffProject &ours,
+                                   const EditorDiffProject &theirs)
+{
+  QStringList keys = mergeOrder(ours.planes.keys(), theirs.planes.keys(),
+                                QSet<QString>());
+  for(int i = 0; i < keys.size(); i++)
+  {
+    QHash<quint32,EditorDiffChunk> plane_ours = ours.planes.value(keys[i]);
+    QHash<quint32,EditorDiffChunk> plane_theirs = theirs.planes.value(keys[i]);
+
+    /* Every chunk in either plane, in order */
+    QList<quint32> indexes = plane_ours.keys() + plane_theirs.keys();
+    std::sort(indexes.begin(), indexes.end());
+    indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+
+    for(int j = 0; j < indexes.size(); j++)
+    {
+      const EditorDiffChunk &chunk_ours = getChunk(plane_ours, indexes[j]);
+      const EditorDiffChunk &chunk_theirs = getChunk(plane_theirs, indexes[j]);
+      if(chunk_ours.hash != chunk_theirs.hash)
+      {
+        int x = (indexes[j] >> 16) * kCHUNK_SIZE;
+        int y = (indexes[j] & 0xFFFF) * kCHUNK_SIZE;
+        for(int k = 0; k < chunk_ours.cells.size(); k++)
+        {
+          if(chunk_ours.cells[k] != chunk_theirs.cells[k])
+          {
+            int tile = k / kLAYERS;
+            addEntry(keys[i], QString::number(x + tile / kCHUNK_SIZE) + "," +
+                              QString::number(y + tile % kCHUNK_SIZE) + "/" +
+                              getLayerSegment(k % kLAYERS),
+                     "", getCellString(chunk_ours.cells[k]),
+                     getCellString(chunk_theirs.cells[k]));
+          }
+        }
+      }
+    }
+  }
+}
+
+/*
+ * Description: Reads the project versions on the thread pool, one file per
+ *              thread, with progress shown if it takes longer than
+ *              kPROGRESS_DELAY.
+ *
+ * Inputs: QStringList paths - the project files
+ *         QList<EditorDiffProject>* projects - the read projects, in order
+ *         QWidget* parent - the parent of the progress dialog
+ * Output: bool - true if all were read
+ */
+bool EditorProjectDiff::loadAll(QStringList paths,
+                                QList<EditorDiffProject>* projects,
+                                QWidget* parent)
+{
+  QProgressDialog dialog("Reading projects...", "Cancel", 0, paths.size(),
+                         parent);
+  dialog.setWindowModality(Qt::WindowModal);
+  dialog.setMinimumDuration(kPROGRESS_DELAY);
+  dialog.setValue(0);
+
+  QEventLoop loop;
+  QFutureWatcher<EditorDiffProject> watcher;
+  QObject::connect(&watcher, SIGNAL(finished()), &loop, SLOT(quit()));
+  QObject::connect(&watcher, SIGNAL(progressValueChanged(int)),
+                   &dialog, SLOT(setValue(int)));
+  QObject::connect(&dialog, SIGNAL(canceled()), &watcher, SLOT(cancel()));
+  watcher.setFuture(QtConcurrent::mapped(paths,
+                                         &EditorProjectDiff::loadProject));
+  loop.exec();
+  watcher.waitForFinished();
+
+  bool success = !watcher.isCanceled();
+  projects->clear();
+  for(int i = 0; success && i < paths.size(); i++)
+  {
+    projects->push_back(watcher.resultAt(i));
+    success = projects->last().valid;
+  }
+  return success;
+}
+
+/*
+ * Description: Merges an object that both versions changed, field by field.
+ *              A field changed in one version takes that change. A field
+ *              changed differently in both is a conflict, and keeps ours.
+ *
+ * Inputs: QString key - the object key
+ *         const EditorDiffObject &base - the object in the base version
+ *         const EditorDiffObject &ours - the object in our version
+ *         const EditorDiffObject &theirs - the object in their version
+ * Output: EditorDiffObject - the merged object
+ */
+EditorDiffObject EditorProjectDiff::mergeFields(QString key,
+                                                const EditorDiffObject &base,
+                                                const EditorDiffObject &ours,
+                                                const EditorDiffObject &theirs)
+{
+  EditorDiffObject result;
+  QStringList fields = mergeOrder(ours.order, theirs.order, QSet<QString>());
+
+  for(int i = 0; i < fields.size(); i++)
+  {
+    bool in_base = base.fields.contains(fields[i]);
+    bool in_ours = ours.fields.contains(fields[i]);
+    bool in_theirs = theirs.fields.contains(fields[i]);
+    QString value_base = base.fields.value(fields[i]);
+    QString value_ours = ours.fields.value(fields[i]);
+    QString value_theirs = theirs.fields.value(fields[i]);
+
+    if((in_ours == in_theirs && value_ours == value_theirs) ||
+       (in_base == in_theirs && value_base == value_theirs))
+    {
+      if(in_ours)
+        result.fields.insert(fields[i], value_ours);
+    }
+    else if(in_base == in_ours && value_base == value_ours)
+    {
+      if(in_theirs)
+        result.fields.insert(fields[i], value_theirs);
+    }
+    else
+    {
+      addEntry(key, fields[i], in_base ? value_base : kMISSING,
+               in_ours ? value_ours : kMISSING,
+               in_theirs ? value_theirs : kMISSING);
+      if(in_ours)
+        result.fields.insert(fields[i], value_ours);
+    }
+  }
+
+  for(int i = 0; i < fields.size(); i++)
+    if(result.fields.contains(fields[i]))
+      result.order.push_back(fields[i]);
+  return result;
+}
+
+/*
+ * Description: Merges the tile planes of the three projects into the merged
+ *              project, chunk by chunk. A chunk only changed in one version
+ *              (by hash) is taken whole. A chunk changed in both is merged
+ *              cell by cell, with each tile layer changed differently in both
+ *              added as a conflict.
+ *
+ * Inputs: const EditorDiffProject &base - the base project
+ *         const EditorDiffProject &ours - our project
+ *         const EditorDiffProject &theirs - their project
+ * Output: none
+ */
+void EditorProjectDiff::mergePlanes(const EditorDiffProject &base,
+                                    const EditorDiffProject &ours,
+                                    const EditorDiffProject &theirs)
+{
+  const EditorDiffChunk &empty = getChunk(QHash<quint32,EditorDiffChunk>(),
+                                          0);
+  QStringList keys = mergeOrder(ours.planes.keys(), theirs.planes.keys(),
+                                QSet<QString>());
+
+  for(int i = 0; i < keys.size(); i++)
+  {
+    QHash<quint32,EditorDiffChunk> plane_base = base.planes.value(keys[i]);
+    QHash<quint32,EditorDiffChunk> plane_ours = ours.planes.value(keys[i]);
+    QHash<quint32,EditorDiffChunk> plane_theirs = theirs.planes.value(keys[i]);
+    QHash<quint32,EditorDiffChunk> plane;
+
+    /* Every chunk in any plane, in order */
+    QList<quint32> indexes = plane_base.keys() + plane_ours.keys() +
+                             plane_theirs.keys();
+    std::sort(indexes.begin(), indexes.end());
+    indexes.erase(std::unique(indexes.begin(), indexes.end()), indexes.end());
+
+    for(int j = 0; j < indexes.size(); j++)
+    {
+      const EditorDiffChunk &chunk_base = getChunk(plane_base, indexes[j]);
+      const EditorDiffChunk &chunk_ours = getChunk(plane_ours, indexes[j]);
+      const EditorDiffChunk &chunk_theirs = getChunk(plane_theirs, indexes[j]);
+
+      /* Changed in one version only, or the same in both */
+      if(chunk_ours.hash == chunk_theirs.hash ||
+         chunk_theirs.hash == chunk_base.hash)
+      {
+        if(chunk_ours.hash != empty.hash)
+          plane.insert(indexes[j], chunk_ours);
+      }
+      else if(chunk_ours.hash == chunk_base.hash)
+      {
+        if(chunk_theirs.hash != empty.hash)
+          plane.insert(indexes[j], chunk_theirs);
+      }
+      /* Changed in both: merge cells */
+      else
+      {
+        EditorDiffChunk chunk = chunk_ours;
+        int x = (indexes[j] >> 16) * kCHUNK_SIZE;
+        int y = (indexes[j] & 0xFFFF) * kCHUNK_SIZE;
+        for(int k = 0; k < chunk.cells.size(); k++)
+        {
+          quint32 cell_base = chunk_base.cells[k];
+          quint32 cell_ours = chunk_ours.cells[k];
+          quint32 cell_theirs = chunk_theirs.cells[k];
+          if(cell_ours == cell_theirs || cell_theirs == cell_base)
+            continue;
+
+          if(cell_ours == cell_base)
+          {
+            chunk.cells[k] = cell_theirs;
+          }
+          else
+          {
+            int tile = k / kLAYERS;
+            addEntry(keys[i], QString::number(x + tile / kCHUNK_SIZE) + "," +
+                              QString::number(y + tile % kCHUNK_SIZE) + "/" +
+                              getLayerSegment(k % kLAYERS),
+                     getCellString(cell_base), getCellString(cell_ours),
+                     getCellString(cell_theirs));
+          }
+        }
+        chunk.hash = hashChunk(chunk.cells);
+        if(chunk.hash != empty.hash)
+          plane.insert(indexes[j], chunk);
+      }
+    }
+
+    if(!plane.isEmpty())
+      merged.planes.insert(keys[i], plane);
+  }
+}
+
+/*============================================================================
+ * PRIVATE STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Adds a line of the save file to the project. Each element of
+ *              the line is a segment ("name" or "name[key=value]"). Tile
+ *              sprite and passability lines are expanded into the tile plane
+ *              of the sub-map. All other lines are a field of the object they
+ *              are within: a core object, a map, a map sprite or base thing,
+ *              a sub-map, or a thing instance in a sub-map. A field repeated
+ *              in the object (such as a list) is keyed by occurrence.
+ *
+ * Inputs: EditorDiffProject* project - the project to add to
+ *         XmlData &data - the line of the save file
+ * Output: none
+ */
+void EditorProjectDiff::addLine(EditorDiffProject* project, XmlData &data)
+{
+  int count = data.getNumElements();
+  if(count < 1)
+    return;
+
+  QStringList segments;
+  QStringList names;
+  for(int i = 0; i < count; i++)
+  {
+    QString name = QString::fromStdString(data.getElement(i));
+    QString key = QString::fromStdString(data.getKey(i));
+    names.push_back(name);
+    if(key.isEmpty())
+      segments.push_back(name);
+    else
+      segments.push_back(name + "[" + key + "=" +
+                         QString::fromStdString(data.getKeyValue(i)) + "]");
+  }
+  QString value = QString::fromStdString(data.getDataString());
+
+  /* Find the object the line is within */
+  int prefix = 2;
+  if(count > 3 && names[0] == "game" && names[1] == "core")
+  {
+    prefix = 3;
+  }
+  else if(count > 3 && names[0] == "game" && names[1] == "map")
+  {
+    if(names[2] == "main" || names[2] == "section")
+    {
+      prefix = 3;
+
+      /* Tile sprite and passability: into the tile plane */
+      int layer = -1;
+      int layer_index = QString::fromStdString(data.getKeyValue(3)).toInt();
+      if(names[3] == "base")
+        layer = 0;
+      else if(names[3] == "enhancer")
+        layer = 1;
+      else if(names[3] == "lower" && layer_index >= 0 && layer_index < 5)
+        layer = 2 + layer_index;
+      else if(names[3] == "upper" && layer_index >= 0 && layer_index < 5)
+        layer = 7 + layer_index;
+
+      if(layer >= 0 && count == 7 && names[4] == "x" && names[5] == "y" &&
+         (names[6] == "sprite_id" || names[6] == "passability"))
+      {
+        bool sprite = (names[6] == "sprite_id");
+        quint32 number = 0;
+        if(sprite)
+        {
+          number = static_cast<quint32>(qMax(value.toInt() + 1, 0));
+        }
+        else
+        {
+          bool north, east, south, west;
+          EditorHelpers::getPassability(value, north, east, south, west);
+          number = EditorHelpers::getPassabilityNum(north, east, south, west);
+        }
+
+        QHash<quint32,EditorDiffChunk> &plane =
+                           project->planes[segments.mid(0, 3).join("/")];
+        QStringList x_list = QString::fromStdString(data.getKeyValue(4))
+                              .split(",");
+        QStringList y_list = QString::fromStdString(data.getKeyValue(5))
+                              .split(",");
+        for(int i = 0; i < x_list.size() && i < y_list.size(); i++)
+        {
+          QStringList x_pair = x_list[i].split("-");
+          QStringList y_pair = y_list[i].split("-");
+          int x_end = qMin(x_pair.back().toInt(), 0xFFFF * kCHUNK_SIZE);
+          int y_end = qMin(y_pair.back().toInt(), 0xFFFF * kCHUNK_SIZE);
+
+          for(int x = qMax(x_pair.front().toInt(), 0); x <= x_end; x++)
+          {
+            for(int y = qMax(y_pair.front().toInt(), 0); y <= y_end; y++)
+            {
+              quint32 index = ((x / kCHUNK_SIZE) << 16) | (y / kCHUNK_SIZE);
+              EditorDiffChunk &chunk = plane[index];
+              if(chunk.cells.isEmpty())
+                chunk.cells.fill(0, kCHUNK_SIZE * kCHUNK_SIZE * kLAYERS);
+
+              quint32 &cell = chunk.cells[((x % kCHUNK_SIZE) * kCHUNK_SIZE +
+                                           y % kCHUNK_SIZE) * kLAYERS + layer];
+              if(sprite)
+                cell = (cell & 0xF) | (number << 4);
+              else
+                cell = (cell & ~0xFu) | (number & 0xF);
+            }
+          }
+        }
+        return;
+      }
+
+      /* Thing instances in the sub-map */
+      if(names[3] == "mapthing" || names[3] == "mapio" ||
+         names[3] == "mapitem" || names[3] == "mapperson" ||
+         names[3] == "mapnpc")
+        prefix = 4;
+    }
+    /* Map sprites and base things */
+    else if(segments[2] != names[2])
+    {
+      prefix = 3;
+    }
+  }
+  prefix = qMin(prefix, count - 1);
+
+  /* Add the field to the object */
+  QString key = segments.mid(0, prefix).join("/");
+  if(!project->objects.contains(key))
+    project->order.push_back(key);
+  EditorDiffObject &object = project->objects[key];
+
+  QString field = segments.mid(prefix).join("/");
+  QString field_key = field;
+  for(int i = 1; object.fields.contains(field_key); i++)
+    field_key = field + "\t" + QString::number(i);
+  object.order.push_back(field_key);
+  object.fields.insert(field_key, value);
+}
+
+/*
+ * Description: Returns the cell value listed in an entry: the sprite ID and
+ *              the passability, if any.
+ *
+ * Inputs: quint32 cell - the cell value
+ * Output: QString - the listed value
+ */
+QString EditorProjectDiff::getCellString(quint32 cell)
+{
+  QString text = kMISSING;
+  if((cell >> 4) > 0)
+    text = "sprite " + QString::number((cell >> 4) - 1);
+  if((cell & 0xF) > 0)
+    text += " pass " + EditorHelpers::getPassabilityStr(cell & 0xF);
+  return text;
+}
+
+/*
+ * Description: Returns the chunk of the plane. Chunks not in the plane have
+ *              no sprites or passability, so the shared empty chunk is
+ *              returned for them.
+ *
+ * Inputs: const QHash<quint32,EditorDiffChunk> &plane - the tile plane
+ *         quint32 index - the chunk index
+ * Output: const EditorDiffChunk& - the chunk
+ */
+const EditorDiffChunk &EditorProjectDiff::getChunk(
+                              const QHash<quint32,EditorDiffChunk> &plane,
+                              quint32 index)
+{
+  static const EditorDiffChunk empty = []()
+  {
+    EditorDiffChunk chunk;
+    chunk.cells.fill(0, kCHUNK_SIZE * kCHUNK_SIZE * kLAYERS);
+    chunk.hash = hashChunk(chunk.cells);
+    return chunk;
+  }();
+
+  QHash<quint32,EditorDiffChunk>::const_iterator it = plane.constFind(index);
+  if(it != plane.constEnd())
+    return it.value();
+  return empty;
+}
+
+/*
+ * Description: Returns the layer element of the cell layer, as written in
+ *              the save file.
+ *
+ * Inputs: int layer - the cell layer (0 to kLAYERS - 1)
+ * Output: QString - the layer segment
+ */
+QString EditorProjectDiff::getLayerSegment(int layer)
+{
+  if(layer == 0)
+    return "base";
+  else if(layer == 1)
+    return "enhancer";
+  else if(layer < 7)
+    return "lower[index=" + QString::number(layer - 2) + "]";
+  return "upper[index=" + QString::number(layer - 7) + "]";
+}
+
+/*
+ * Description: Returns the 64-bit FNV-1a hash of the chunk cells. Wide enough
+ *              that chunks with the same hash are treated as equal.
+ *
+ * Inputs: const QVector<quint32> &cells - the chunk cells
+ * Output: quint64 - the hash
+ */
+quint64 EditorProjectDiff::hashChunk(const QVector<quint32> &cells)
+{
+  quint64 hash = Q_UINT64_C(14695981039346656037);
+  for(int i = 0; i < cells.size(); i++)
+  {
+    for(int j = 0; j < 32; j += 8)
+    {
+      hash ^= (cells[i] >> j) & 0xFF;
+      hash *= Q_UINT64_C(1099511628211);
+    }
+  }
+  return hash;
+}
+
+/*
+ * Description: Reads the project file into its objects and tile planes, and
+ *              hashes the tile plane chunks. Run on the thread pool.
+ *
+ * Inputs: const QString &path - the project file
+ * Output: EditorDiffProject - the project. Not valid if the read failed
+ */
+EditorDiffProject EditorProjectDiff::loadProject(const QString &path)
+{
+  EditorDiffProject project;
+  project.path = path;
+  project.valid = false;
+
+  FileHandler fh(path.toStdString(), false, true);
+  if(fh.start())
+  {
+    bool done = false;
+    bool success = true;
+    do
+    {
+      bool read_success = true;
+      XmlData data = fh.readXmlData(&done, &read_success);
+      success &= read_success;
+      if(success)
+        addLine(&project, data);
+    } while(success && !done);
+    fh.stop();
+
+    /* Hash the chunks */
+    QHash<QString,QHash<quint32,EditorDiffChunk>>::iterator plane;
+    for(plane = project.planes.begin(); plane != project.planes.end(); plane++)
+    {
+      QHash<quint32,EditorDiffChunk>::iterator chunk;
+      for(chunk = plane->begin(); chunk != plane->end(); chunk++)
+        chunk->hash = hashChunk(chunk->cells);
+    }
+
+    project.valid = success;
+  }
+
+  return project;
+}
+
+/*
+ * Description: Merges the order of the keys of two versions. Ours keep their
+ *              order, and each key only in theirs goes after the key before
+ *              it in theirs (or first, if none).
+ *
+ * Inputs: const QStringList &ours - the keys of our version, in order
+ *         const QStringList &theirs - the keys of their version, in order
+ *         const QSet<QString> &kept - the keys to keep. Empty to keep all
+ * Output: QStringList - the merged order
+ */
+QStringList EditorProjectDiff::mergeOrder(const QStringList &ours,
+                                          const QStringList &theirs,
+                                          const QSet<QString> &kept)
+{
+  QStringList order;
+  QSet<QString> added;
+  for(int i = 0; i < ours.size(); i++)
+  {
+    if((kept.isEmpty() || kept.contains(ours[i])) && !added.contains(ours[i]))
+    {
+      order.push_back(ours[i]);
+      added.insert(ours[i]);
+    }
+  }
+
+  int position = 0;
+  for(int i = 0; i < theirs.size(); i++)
+  {
+    if(added.contains(theirs[i]))
+    {
+      position = order.indexOf(theirs[i]) + 1;
+    }
+    else if(kept.isEmpty() || kept.contains(theirs[i]))
+    {
+      order.insert(position, theirs[i]);
+      added.insert(theirs[i]);
+      position++;
+    }
+  }
+
+  return order;
+}
+
+/*
+ * Description: Writes a line to the file. Open elements that the line is not
+ *              within are closed, and the elements of the line that are not
+ *              open are opened, so consecutive lines share their elements.
+ *
+ * Inputs: FileHandler* fh - the file handling control pointer
+ *         QStringList* open - the elements open in the file
+ *         QStringList segments - the line elements. The last holds the data
+ *         QString value - the line data
+ * Output: none
+ */
+void EditorProjectDiff::writeLine(FileHandler* fh, QStringList* open,
+                                  QStringList segments, QString value)
+{
+  int last = segments.size() - 1;
+  if(last < 0)
+    return;
+
+  /* Close the elements the line is not within */
+  int common = 0;
+  while(common < open->size() && common < last &&
+        open->at(common) == segments[common])
+    common++;
+  while(open->size() > common)
+  {
+    fh->writeXmlElementEnd();
+    open->removeLast();
+  }
+
+  /* Open the rest */
+  for(int i = common; i < last; i++)
+  {
+    int bracket = segments[i].indexOf('[');
+    if(bracket >= 0 && segments[i].endsWith(']'))
+    {
+      QString key_set = segments[i].mid(bracket + 1,
+                                        segments[i].size() - bracket - 2);
+      fh->writeXmlElement(segments[i].left(bracket).toStdString(),
+                          key_set.section('=', 0, 0).toStdString(),
+                          key_set.section('=', 1).toStdString());
+    }
+    else
+    {
+      fh->writeXmlElement(segments[i].toStdString());
+    }
+    open->push_back(segments[i]);
+  }
+
+  fh->writeXmlData(segments[last].section('[', 0, 0).toStdString(),
+                   value.toStdString());
+}
+
+/*
+ * Description: Writes the tile plane into the sub-map, in the form the map
+ *              saves it: per layer, the optimized point sets of each sprite
+ *              ID and of each passability.
+ *
+ * Inputs: FileHandler* fh - the file handling control pointer
+ *         QStringList* open - the elements open in the file
+ *         QString key - the sub-map key
+ *         const QHash<quint32,EditorDiffChunk> &plane - the tile plane
+ * Output: none
+ */
+void EditorProjectDiff::writePlane(FileHandler* fh, QStringList* open,
+                                   QString key,
+                                   const QHash<quint32,EditorDiffChunk> &plane)
+{
+  QStringList prefix = key.split("/");
+  int max_pass = EditorHelpers::getPassabilityNum(true, true, true, true);
+
+  /* Chunk bounds */
+  int chunks_x = 0;
+  int chunks_y = 0;
+  QHash<quint32,EditorDiffChunk>::const_iterator it;
+  for(it = plane.constBegin(); it != plane.constEnd(); it++)
+  {
+    chunks_x = qMax(chunks_x, static_cast<int>(it.key() >> 16) + 1);
+    chunks_y = qMax(chunks_y, static_cast<int>(it.key() & 0xFFFF) + 1);
+  }
+
+  for(int layer = 0; layer < kLAYERS; layer++)
+  {
+    QList<QList<QPoint>> sprite_set;
+    QList<QList<QPoint>> pass_set;
+    for(int i = 0; i <= max_pass; i++)
+      pass_set.push_back(QList<QPoint>());
+
+    /* Sort the points by x, then y */
+    for(int cx = 0; cx < chunks_x; cx++)
+    {
+      for(int i = 0; i < kCHUNK_SIZE; i++)
+      {
+        for(int cy = 0; cy < chunks_y; cy++)
+        {
+          it = plane.constFind((static_cast<quint32>(cx) << 16) | cy);
+          if(it == plane.constEnd())
+            continue;
+
+          for(int j = 0; j < kCHUNK_SIZE; j++)
+          {
+            quint32 cell = it->cells[(i * kCHUNK_SIZE + j) * kLAYERS + layer];
+            QPoint point(cx * kCHUNK_SIZE + i, cy * kCHUNK_SIZE + j);
+
+            int sprite = static_cast<int>(cell >> 4);
+            if(sprite > 0)
+            {
+              while(sprite_set.size() < sprite)
+                sprite_set.push_back(QList<QPoint>());
+              sprite_set[sprite - 1].push_back(point);
+            }
+            if((cell & 0xF) > 0)
+              pass_set[cell & 0xF].push_back(point);
+          }
+        }
+      }
+    }
+
+    /* Write the optimized sets */
+    QList<QPair<QString,QString>> sprite_pairs =
+                                 EditorHelpers::optimizePoints(sprite_set);
+    for(int i = 0; i < sprite_pairs.size(); i++)
+      if(!sprite_pairs[i].first.isEmpty())
+        writeLine(fh, open, QStringList(prefix) << getLayerSegment(layer)
+                            << "x[index=" + sprite_pairs[i].first + "]"
+                            << "y[index=" + sprite_pairs[i].second + "]"
+                            << "sprite_id", QString::number(i));
+
+    QList<QPair<QString,QString>> pass_pairs =
+                                 EditorHelpers::optimizePoints(pass_set);
+    for(int i = 1; i < pass_pairs.size(); i++)
+      if(!pass_pairs[i].first.isEmpty())
+        writeLine(fh, open, QStringList(prefix) << getLayerSegment(layer)
+                            << "x[index=" + pass_pairs[i].first + "]"
+                            << "y[index=" + pass_pairs[i].second + "]"
+                            << "passability",
+                  EditorHelpers::getPassabilityStr(i));
+  }
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Compares our project to theirs. Each object added, removed or
+ *              with a changed field, and each changed tile layer, is a change
+ *              (see getEntries()).
+ *
+ * Inputs: QString ours_path - our project file
+ *         QString theirs_path - their project file
+ *         QWidget* parent - the parent of the progress dialog
+ * Output: bool - true if both projects were read
+ */
+bool EditorProjectDiff::diff(QString ours_path, QString theirs_path,
+                             QWidget* parent)
+{
+  entries.clear();
+  entry_count = 0;
+  merged = EditorDiffProject();
+  merged.valid = false;
+
+  QList<EditorDiffProject> projects;
+  if(!loadAll(QStringList() << ours_path << theirs_path, &projects, parent))
+    return false;
+  const EditorDiffProject &ours = projects[0];
+  const EditorDiffProject &theirs = projects[1];
+
+  /* Objects */
+  QStringList keys = mergeOrder(ours.order, theirs.order, QSet<QString>());
+  for(int i = 0; i < keys.size(); i++)
+  {
+    EditorDiffObject object_ours = ours.objects.value(keys[i]);
+    EditorDiffObject object_theirs = theirs.objects.value(keys[i]);
+
+    if(!ours.objects.contains(keys[i]))
+    {
+      addEntry(keys[i], "", "", kMISSING,
+               QString::number(object_theirs.fields.size()) + " fields");
+    }
+    else if(!theirs.objects.contains(keys[i]))
+    {
+      addEntry(keys[i], "", "",
+               QString::number(object_ours.fields.size()) + " fields",
+               kMISSING);
+    }
+    else if(object_ours.fields != object_theirs.fields)
+    {
+      QStringList fields = mergeOrder(object_ours.order, object_theirs.order,
+                                      QSet<QString>());
+      for(int j = 0; j < fields.size(); j++)
+      {
+        bool in_ours = object_ours.fields.contains(fields[j]);
+        bool in_theirs = object_theirs.fields.contains(fields[j]);
+        QString value_ours = object_ours.fields.value(fields[j]);
+        QString value_theirs = object_theirs.fields.value(fields[j]);
+        if(in_ours != in_theirs || value_ours != value_theirs)
+          addEntry(keys[i], fields[j], "", in_ours ? value_ours : kMISSING,
+                   in_theirs ? value_theirs : kMISSING);
+      }
+    }
+  }
+
+  /* Tiles */
+  diffPlanes(ours, theirs);
+  return true;
+}
+
+/*
+ * Description: Returns the listed changes (diff) or conflicts (merge).
+ *
+ * Inputs: none
+ * Output: QList<EditorDiffEntry> - the entries, up to kMAX_ENTRIES
+ */
+QList<EditorDiffEntry> EditorProjectDiff::getEntries() const
+{
+  return entries;
+}
+
+/*
+ * Description: Returns the number of changes (diff) or conflicts (merge),
+ *              including those past the listed max.
+ *
+ * Inputs: none
+ * Output: int - the count
+ */
+int EditorProjectDiff::getEntryCount() const
+{
+  return entry_count;
+}
+
+/*
+ * Description: Merges our and their changes since the common base project.
+ *              An object changed in one version only takes that version, one
+ *              changed in both is merged by field (see mergeFields()), and the
+ *              tile planes are merged by chunk (see mergePlanes()). Anything
+ *              changed differently in both is a conflict (see getEntries()),
+ *              and the merged project keeps our value for it.
+ *
+ * Inputs: QString base_path - the common base project file
+ *         QString ours_path - our project file
+ *         QString theirs_path - their project file
+ *         QWidget* parent - the parent of the progress dialog
+ * Output: bool - true if all projects were read and merged
+ */
+bool EditorProjectDiff::merge(QString base_path, QString ours_path,
+                              QString theirs_path, QWidget* parent)
+{
+  entries.clear();
+  entry_count = 0;
+  merged = EditorDiffProject();
+  merged.valid = false;
+
+  QList<EditorDiffProject> projects;
+  if(!loadAll(QStringList() << base_path << ours_path << theirs_path,
+              &projects, parent))
+    return false;
+  const EditorDiffProject &base = projects[0];
+  const EditorDiffProject &ours = projects[1];
+  const EditorDiffProject &theirs = projects[2];
+
+  /* Objects */
+  QStringList keys = mergeOrder(ours.order, theirs.order, QSet<QString>());
+  for(int i = 0; i < keys.size(); i++)
+  {
+    bool in_base = base.objects.contains(keys[i]);
+    bool in_ours = ours.objects.contains(keys[i]);
+    bool in_theirs = theirs.objects.contains(keys[i]);
+    EditorDiffObject object_base = base.objects.value(keys[i]);
+    EditorDiffObject object_ours = ours.objects.value(keys[i]);
+    EditorDiffObject object_theirs = theirs.objects.value(keys[i]);
+
+    /* Changed in one version only, or the same in both */
+    if((in_ours == in_theirs &&
+        object_ours.fields == object_theirs.fields) ||
+       (in_base == in_theirs && object_base.fields == object_theirs.fields))
+    {
+      if(in_ours)
+        merged.objects.insert(keys[i], object_ours);
+    }
+    else if(in_base == in_ours && object_base.fields == object_ours.fields)
+    {
+      if(in_theirs)
+        merged.objects.insert(keys[i], object_theirs);
+    }
+    /* Changed in both */
+    else if(in_ours && in_theirs)
+    {
+      merged.objects.insert(keys[i], mergeFields(keys[i], object_base,
+                                                 object_ours, object_theirs));
+    }
+    /* Removed in one, changed in the other */
+    else
+    {
+      addEntry(keys[i], "",
+               in_base ? QString::number(object_base.fields.size()) +
+                         " fields" : kMISSING,
+               in_ours ? QString::number(object_ours.fields.size()) +
+                         " fields" : kMISSING,
+               in_theirs ? QString::number(object_theirs.fields.size()) +
+                           " fields" : kMISSING);
+      if(in_ours)
+        merged.objects.insert(keys[i], object_ours);
+    }
+  }
+  for(int i = 0; i < keys.size(); i++)
+    if(merged.objects.contains(keys[i]))
+      merged.order.push_back(keys[i]);
+
+  /* Tiles */
+  mergePlanes(base, ours, theirs);
+  merged.valid = true;
+  return true;
+}
+
+/*
+ * Description: Saves the merged project to the file. Each object is written
+ *              with its fields in order, and each sub-map with its tile plane
+ *              after its fields, so the file loads as a save of the editor.
+ *
+ * Inputs: QString path - the file to save to
+ * Output: bool - true if saved
+ */
+bool EditorProjectDiff::saveMerge(QString path) const
+{
+  if(!merged.valid)
+    return false;
+
+  FileHandler fh(path.toStdString(), true, true);
+  if(!fh.start())
+    return false;
+
+  QStringList open;
+  for(int i = 0; i < merged.order.size(); i++)
+  {
+    QString key = merged.order[i];
+    EditorDiffObject object = merged.objects.value(key);
+    QStringList prefix;
+    if(!key.isEmpty())
+      prefix = key.split("/");
+
+    for(int j = 0; j < object.order.size(); j++)
+      writeLine(&fh, &open,
+                prefix + object.order[j].section('\t', 0, 0).split("/"),
+                object.fields.value(object.order[j]));
+    if(merged.planes.contains(key))
+      writePlane(&fh, &open, key, merged.planes.value(key));
+  }
+
+  while(!open.isEmpty())
+  {
+    fh.writeXmlElementEnd();
+    open.removeLast();
+  }
+  fh.stop();
+  return true;
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the entry as a line of text, for listing: the object,
+ *              the field or tile, and the value in each version.
+ *
+ * Inputs: const EditorDiffEntry &entry - the entry
+ * Output: QString - the line of text
+ */
+QString EditorProjectDiff::getEntryString(const EditorDiffEntry &entry)
+{
+  QString text = entry.object;
+  if(!entry.field.isEmpty())
+    text += " : " + QString(entry.field).replace('\t', " #");
+  if(!entry.base.isEmpty())
+    text += "   base: " + entry.base;
+  text += "   ours: " + entry.ours + "   theirs: " + entry.theirs;
+  return text;
+}
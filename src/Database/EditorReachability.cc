@@ -0,0 +1,393 @@
+/*******************************************************************************
+ * Class Name: EditorReachability
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Bit packed reachability analysis of a sub-map. The moves that
+ *              are possible out of every tile are packed into one bit plane
+ *              per direction, 64 tiles to a word, and the flood from the start
+ *              tiles is spread a full row of words at a time. Walkable tiles
+ *              that the flood never gets to are unreachable.
+ ******************************************************************************/
+#include "Database/EditorReachability.h"
+#include <QtAlgorithms>
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The planes are empty until built.
+ *
+ * Inputs: none
+ */
+EditorReachability::EditorReachability()
+{
+  clear();
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorReachability::~EditorReachability()
+{
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Spreads the reached tiles of the row along the east and west
+ *              moves. Each word is filled with a shift and mask ladder, which
+ *              walks up to 63 open moves in six steps, and the last tile of
+ *              the word carries into the next. East runs low to high words and
+ *              west high to low. Once both are done, the row is complete.
+ *
+ * Inputs: int y - the row to fill
+ * Output: bool - true if any tile was newly reached
+ */
+bool EditorReachability::fillRow(int y)
+{
+  int row = y * words;
+  bool changed = false;
+
+  /* East - toward the high bits */
+  quint64 carry = 0;
+  for(int i = row; i < row + words; i++)
+  {
+    quint64 gen = reached[i] | carry;
+    quint64 pro = move_east[i] << 1;
+    gen |= pro & (gen << 1);
+    pro &= pro << 1;
+    gen |= pro & (gen << 2);
+    pro &= pro << 2;
+    gen |= pro & (gen << 4);
+    pro &= pro << 4;
+    gen |= pro & (gen << 8);
+    pro &= pro << 8;
+    gen |= pro & (gen << 16);
+    pro &= pro << 16;
+    gen |= pro & (gen << 32);
+
+    carry = (gen & move_east[i]) >> 63;
+    if(gen != reached[i])
+    {
+      reached[i] = gen;
+      changed = true;
+    }
+  }
+
+  /* West - toward the low bits */
+  carry = 0;
+  for(int i = row + words - 1; i >= row; i--)
+  {
+    quint64 gen = reached[i] | carry;
+    quint64 pro = move_west[i] >> 1;
+    gen |= pro & (gen >> 1);
+    pro &= pro >> 1;
+    gen |= pro & (gen >> 2);
+    pro &= pro >> 2;
+    gen |= pro & (gen >> 4);
+    pro &= pro >> 4;
+    gen |= pro & (gen >> 8);
+    pro &= pro >> 8;
+    gen |= pro & (gen >> 16);
+    pro &= pro >> 16;
+    gen |= pro & (gen >> 32);
+
+    carry = (gen & move_west[i] & 1) << 63;
+    if(gen != reached[i])
+    {
+      reached[i] = gen;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+/*
+ * Description: Returns if the bit of the tile is set in the plane. Tiles
+ *              outside of the plane are never set.
+ *
+ * Inputs: const QVector<quint64> &plane - the plane to check
+ *         int x - the x tile location
+ *         int y - the y tile location
+ * Output: bool - true if the bit is set
+ */
+bool EditorReachability::isSet(const QVector<quint64> &plane, int x,
+                               int y) const
+{
+  if(x < 0 || y < 0 || x >= width || y >= height)
+    return false;
+  return ((plane[y * words + x / 64] >> (x % 64)) & 1) != 0;
+}
+
+/*
+ * Description: Spreads the reached tiles of the neighbouring row into the
+ *              row, along the vertical moves out of the neighbouring row.
+ *
+ * Inputs: int y - the row to spread into
+ *         int from_y - the neighbouring row
+ *         const QVector<quint64> &moves - the move plane toward the row
+ * Output: bool - true if any tile was newly reached
+ */
+bool EditorReachability::spreadRow(int y, int from_y,
+                                   const QVector<quint64> &moves)
+{
+  int row = y * words;
+  int from_row = from_y * words;
+  bool changed = false;
+
+  for(int i = 0; i < words; i++)
+  {
+    quint64 gen = reached[row + i] |
+                  (reached[from_row + i] & moves[from_row + i]);
+    if(gen != reached[row + i])
+    {
+      reached[row + i] = gen;
+      changed = true;
+    }
+  }
+
+  return changed;
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Builds the move planes from the passability grid. A move is
+ *              open if the tile allows the exit and the next tile allows the
+ *              entry. A tile is walkable if any move out of it or into it is
+ *              open. The last flood is cleared.
+ *
+ * Inputs: EditorPathGrid* grid - the refreshed passability grid
+ * Output: none
+ */
+void EditorReachability::build(EditorPathGrid* grid)
+{
+  clear();
+  if(grid == NULL || grid->getWidth() <= 0 || grid->getHeight() <= 0)
+    return;
+
+  height = grid->getHeight();
+  width = grid->getWidth();
+  words = (width + 63) / 64;
+  move_east.fill(0, words * height);
+  move_north.fill(0, words * height);
+  move_south.fill(0, words * height);
+  move_west.fill(0, words * height);
+  reached.fill(0, words * height);
+  walkable.fill(0, words * height);
+
+  /* Pack the moves */
+  for(int y = 0; y < height; y++)
+  {
+    for(int x = 0; x < width; x++)
+    {
+      int index = y * words + x / 64;
+      quint64 bit = (quint64)1 << (x % 64);
+
+      if(grid->canMove(x, y, Direction::EAST))
+        move_east[index] |= bit;
+      if(grid->canMove(x, y, Direction::NORTH))
+        move_north[index] |= bit;
+      if(grid->canMove(x, y, Direction::SOUTH))
+        move_south[index] |= bit;
+      if(grid->canMove(x, y, Direction::WEST))
+        move_west[index] |= bit;
+    }
+  }
+
+  /* Walkable is any move out of the tile or into it from a neighbour */
+  for(int y = 0; y < height; y++)
+  {
+    for(int w = 0; w < words; w++)
+    {
+      int i = y * words + w;
+      quint64 moves_in = (move_east[i] << 1) | (move_west[i] >> 1);
+      if(w > 0)
+        moves_in |= move_east[i - 1] >> 63;
+      if(w < words - 1)
+        moves_in |= move_west[i + 1] << 63;
+      if(y > 0)
+        moves_in |= move_south[i - words];
+      if(y < height - 1)
+        moves_in |= move_north[i + words];
+
+      walkable[i] = moves_in | move_east[i] | move_north[i] | move_south[i] |
+                    move_west[i];
+    }
+  }
+}
+
+/*
+ * Description: Returns if any move out of the tile is open.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ * Output: bool - true if the tile can be left
+ */
+bool EditorReachability::canLeave(int x, int y) const
+{
+  return (isSet(move_east, x, y) || isSet(move_north, x, y) ||
+          isSet(move_south, x, y) || isSet(move_west, x, y));
+}
+
+/*
+ * Description: Clears the planes, the flood and the dead ends.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorReachability::clear()
+{
+  dead_ends.clear();
+  move_east.clear();
+  move_north.clear();
+  move_south.clear();
+  move_west.clear();
+  reached.clear();
+  walkable.clear();
+
+  height = 0;
+  width = 0;
+  words = 0;
+}
+
+/*
+ * Description: Floods from the start tiles. Every row is spread from the row
+ *              above and filled on a sweep down, then spread from the row
+ *              below and filled on a sweep up. The sweeps repeat until nothing
+ *              new is reached, so only walks that turn back vertically need
+ *              another pass. Start tiles outside of the planes are skipped.
+ *
+ * Inputs: QList<QPoint> starts - the tiles to flood from
+ * Output: none
+ */
+void EditorReachability::flood(QList<QPoint> starts)
+{
+  reached.fill(0);
+
+  bool changed = false;
+  for(int i = 0; i < starts.size(); i++)
+  {
+    int x = starts[i].x();
+    int y = starts[i].y();
+    if(x >= 0 && y >= 0 && x < width && y < height)
+    {
+      reached[y * words + x / 64] |= (quint64)1 << (x % 64);
+      changed = true;
+    }
+  }
+
+  while(changed)
+  {
+    changed = false;
+
+    /* Sweep down */
+    for(int y = 0; y < height; y++)
+    {
+      if(y > 0 && spreadRow(y, y - 1, move_south))
+        changed = true;
+      if(fillRow(y))
+        changed = true;
+    }
+
+    /* Sweep up */
+    for(int y = height - 1; y >= 0; y--)
+    {
+      if(y < height - 1 && spreadRow(y, y + 1, move_north))
+        changed = true;
+      if(fillRow(y))
+        changed = true;
+    }
+  }
+}
+
+/*
+ * Description: Returns the event tiles that lead nowhere or can never be used,
+ *              as set by the map after the flood.
+ *
+ * Inputs: none
+ * Output: QList<QPoint> - the dead end tiles
+ */
+QList<QPoint> EditorReachability::getDeadEnds() const
+{
+  return dead_ends;
+}
+
+/*
+ * Description: Returns the height of the planes.
+ *
+ * Inputs: none
+ * Output: int - the height, in tiles
+ */
+int EditorReachability::getHeight() const
+{
+  return height;
+}
+
+/*
+ * Description: Returns the width of the planes.
+ *
+ * Inputs: none
+ * Output: int - the width, in tiles
+ */
+int EditorReachability::getWidth() const
+{
+  return width;
+}
+
+/*
+ * Description: Returns the number of walkable tiles that the last flood did
+ *              not reach.
+ *
+ * Inputs: none
+ * Output: int - the unreachable tile count
+ */
+int EditorReachability::getUnreachableCount() const
+{
+  int count = 0;
+  for(int i = 0; i < walkable.size(); i++)
+    count += qPopulationCount(walkable[i] & ~reached[i]);
+  return count;
+}
+
+/*
+ * Description: Returns if the tile was reached by the last flood.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ * Output: bool - true if reached
+ */
+bool EditorReachability::isReached(int x, int y) const
+{
+  return isSet(reached, x, y);
+}
+
+/*
+ * Description: Returns if the tile is walkable but was not reached by the
+ *              last flood.
+ *
+ * Inputs: int x - the x tile location
+ *         int y - the y tile location
+ * Output: bool - true if unreachable
+ */
+bool EditorReachability::isUnreachable(int x, int y) const
+{
+  return (isSet(walkable, x, y) && !isSet(reached, x, y));
+}
+
+/*
+ * Description: Sets the event tiles that lead nowhere or can never be used.
+ *
+ * Inputs: QList<QPoint> tiles - the dead end tiles
+ * Output: none
+ */
+void EditorReachability::setDeadEnds(QList<QPoint> tiles)
+{
+  dead_ends = tiles;
+}
@@ -26,6 +26,85 @@ EditorSkill::EditorSkill(QWidget *parent) : QWidget(parent)
   if(sprite_thumb_base.frameCount() == 0)
     sprite_thumb_base.setPath(0, "");
 
+  /* Layout - created on the first show */
+  layout_created = false;
+
+  /* Set-up the skill */
+  setBaseSkill(Skill());
+  getEditedSkill();
+}
+
+/*
+ * Description: Second constructor function, with ID and name parameters.
+ *
+ * Inputs: int id - the id of the skill
+ *         QString name - the name of the skill
+ *         QWidget* parent - the parent widget. Default to NULL
+ */
+EditorSkill::EditorSkill(int id, QString name, QWidget* parent)
+           : EditorSkill(parent)
+{
+  setID(id);
+  setName(name);
+  getEditedSkill();
+}
+
+/*
+ * Description: Copy constructor. Calls the blank constructor and then copies
+ *              the data from the source.
+ *
+ * Inputs: const EditorSkill &source - the source object to copy
+ */
+EditorSkill::EditorSkill(const EditorSkill &source) : EditorSkill()
+{
+  copySelf(source);
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorSkill::~EditorSkill()
+{
+  resetWorkingSkill();
+}
+
+/*============================================================================
+ * PROTECTED FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Copies all data from source editor object to this editor
+ *              object.
+ *
+ * Inputs: EditorSkill &source - the source to copy from
+ * Output: none
+ */
+void EditorSkill::copySelf(const EditorSkill &source)
+{
+  id = source.id;
+  name = source.name;
+  test_string = source.test_string;
+
+  /* Action lists */
+  actions_total = source.actions_total;
+  actions_sel_base = source.actions_sel_base;
+
+  /* Frame connections */
+  sprite_anim_base = source.sprite_anim_base;
+  sprite_thumb_base = source.sprite_thumb_base;
+
+  setBaseSkill(source.base);
+  loadWorkingInfo();
+}
+
+/*
+ * Description: Creates the skill layout with QT functional widgets.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSkill::createLayout()
+{
   /* Layout */
   QGridLayout* layout = new QGridLayout(this);
   layout->setColumnStretch(7, 1);
@@ -170,73 +249,164 @@ EditorSkill::EditorSkill(QWidget *parent) : QWidget(parent)
   save_skill = new QPushButton("Save",this);
   layout->addWidget(save_skill, 12, 6);
   connect(save_skill,SIGNAL(clicked()),this,SLOT(getEditedSkill()));
-
-  /* Set-up the skill */
-  setBaseSkill(Skill());
-  getEditedSkill();
 }
 
 /*
- * Description: Second constructor function, with ID and name parameters.
+ * Description: Returns the index of the scope in the scope drop down.
  *
- * Inputs: int id - the id of the skill
- *         QString name - the name of the skill
- *         QWidget* parent - the parent widget. Default to NULL
+ * Inputs: ActionScope scope - the action scope
+ * Output: int - the drop down index. -1 if the scope is not listed
  */
-EditorSkill::EditorSkill(int id, QString name, QWidget* parent)
-           : EditorSkill(parent)
+int EditorSkill::getScopeIndex(ActionScope scope)
 {
-  setID(id);
-  setName(name);
-  getEditedSkill();
+  if(scope == ActionScope::USER)
+    return 0;
+  else if(scope == ActionScope::ONE_TARGET)
+    return 1;
+  else if(scope == ActionScope::ONE_ENEMY)
+    return 2;
+  else if(scope == ActionScope::TWO_ENEMIES)
+    return 3;
+  else if(scope == ActionScope::ALL_ENEMIES)
+    return 4;
+  else if(scope == ActionScope::ONE_ALLY)
+    return 5;
+  else if(scope == ActionScope::ONE_ALLY_NOT_USER)
+    return 6;
+  else if(scope == ActionScope::TWO_ALLIES)
+    return 7;
+  else if(scope == ActionScope::ALL_ALLIES)
+    return 8;
+  else if(scope == ActionScope::ONE_ALLY_KO)
+    return 9;
+  else if(scope == ActionScope::ALL_ALLIES_KO)
+    return 10;
+  else if(scope == ActionScope::ONE_PARTY)
+    return 11;
+  else if(scope == ActionScope::ALL_TARGETS)
+    return 12;
+  else if(scope == ActionScope::NOT_USER)
+    return 13;
+  else if(scope == ActionScope::ALL_NOT_USER)
+    return 14;
+  //else if(scope == ActionScope::NO_SCOPE)
+  //  return 15;
+  return -1;
 }
 
 /*
- * Description: Copy constructor. Calls the blank constructor and then copies
- *              the data from the source.
+ * Description: Reads all the GUI element contents back into the working
+ *              Skill class. Only valid once the layout is created.
  *
- * Inputs: const EditorSkill &source - the source object to copy
+ * Inputs: none
+ * Output: none
  */
-EditorSkill::EditorSkill(const EditorSkill &source) : EditorSkill()
+void EditorSkill::readWorkingInfo()
 {
-  copySelf(source);
-}
+  name = name_edit->text();
 
-/*
- * Description: Destructor function
- */
-EditorSkill::~EditorSkill()
-{
-  resetWorkingSkill();
-}
+  //working.setName(name_edit->text().toStdString());
+  working.setMessage(message_edit->toPlainText().toStdString());
+  working.setDescription(descrip_edit->toPlainText().toStdString());
+  working.setCost(cost_edit->text().toInt());
+  working.setChance(chance_edit->text().toFloat());
+  working.setCooldown(cooldown_edit->text().toInt());
+  working.setValue(value_edit->text().toInt());
 
-/*============================================================================
- * PROTECTED FUNCTIONS
- *===========================================================================*/
+  /* Flags */
+  //if(!skill_offensive->isChecked() && !skill_defensive->isChecked() &&
+  //   !skill_neutral->isChecked())
+  //{
+  //  skill_offensive->setChecked(true);
+  //}
+  working.setFlag(SkillFlags::OFFENSIVE, skill_offensive->isChecked());
+  working.setFlag(SkillFlags::DEFENSIVE, skill_defensive->isChecked());
+  working.setFlag(SkillFlags::NEUTRAL, skill_neutral->isChecked());
+
+  if(primary_flag->currentIndex() == 0)
+    working.setPrimary(Element::PHYSICAL);
+  else if(primary_flag->currentIndex() == 1)
+    working.setPrimary(Element::FIRE);
+  else if(primary_flag->currentIndex() == 2)
+    working.setPrimary(Element::ICE);
+  else if(primary_flag->currentIndex() == 3)
+    working.setPrimary(Element::FOREST);
+  else if(primary_flag->currentIndex() == 4)
+    working.setPrimary(Element::ELECTRIC);
+  else if(primary_flag->currentIndex() == 5)
+    working.setPrimary(Element::DIGITAL);
+  else if(primary_flag->currentIndex() == 6)
+    working.setPrimary(Element::NIHIL);
+  else if(primary_flag->currentIndex() == 7)
+    working.setPrimary(Element::NONE);
+
+  if(secondary_flag->currentIndex() == 0)
+    working.setSecondary(Element::PHYSICAL);
+  else if(secondary_flag->currentIndex() == 1)
+    working.setSecondary(Element::FIRE);
+  else if(secondary_flag->currentIndex() == 2)
+    working.setSecondary(Element::ICE);
+  else if(secondary_flag->currentIndex() == 3)
+    working.setSecondary(Element::FOREST);
+  else if(secondary_flag->currentIndex() == 4)
+    working.setSecondary(Element::ELECTRIC);
+  else if(secondary_flag->currentIndex() == 5)
+    working.setSecondary(Element::DIGITAL);
+  else if(secondary_flag->currentIndex() == 6)
+    working.setSecondary(Element::NIHIL);
+  else if(secondary_flag->currentIndex() == 7)
+    working.setSecondary(Element::NONE);
+
+  if(scope_flag->currentIndex() == 0)
+    working.setScope(ActionScope::USER);
+  else if(scope_flag->currentIndex() == 1)
+    working.setScope(ActionScope::ONE_TARGET);
+  else if(scope_flag->currentIndex() == 2)
+    working.setScope(ActionScope::ONE_ENEMY);
+  else if(scope_flag->currentIndex() == 3)
+    working.setScope(ActionScope::TWO_ENEMIES);
+  else if(scope_flag->currentIndex() == 4)
+    working.setScope(ActionScope::ALL_ENEMIES);
+  else if(scope_flag->currentIndex() == 5)
+    working.setScope(ActionScope::ONE_ALLY);
+  else if(scope_flag->currentIndex() == 6)
+    working.setScope(ActionScope::ONE_ALLY_NOT_USER);
+  else if(scope_flag->currentIndex() == 7)
+    working.setScope(ActionScope::TWO_ALLIES);
+  else if(scope_flag->currentIndex() == 8)
+    working.setScope(ActionScope::ALL_ALLIES);
+  else if(scope_flag->currentIndex() == 9)
+    working.setScope(ActionScope::ONE_ALLY_KO);
+  else if(scope_flag->currentIndex() == 10)
+    working.setScope(ActionScope::ALL_ALLIES_KO);
+  else if(scope_flag->currentIndex() == 11)
+    working.setScope(ActionScope::ONE_PARTY);
+  else if(scope_flag->currentIndex() == 12)
+    working.setScope(ActionScope::ALL_TARGETS);
+  else if(scope_flag->currentIndex() == 13)
+    working.setScope(ActionScope::NOT_USER);
+  else if(scope_flag->currentIndex() == 14)
+    working.setScope(ActionScope::ALL_NOT_USER);
+  //else if(scope_flag->currentIndex() == 15)
+  //  working.setScope(ActionScope::NO_SCOPE);
+}
 
 /*
- * Description: Copies all data from source editor object to this editor
- *              object.
+ * Description: Creates the widget layout the first time the skill is shown,
+ *              so skills that are never opened hold no widgets.
  *
- * Inputs: EditorSkill &source - the source to copy from
+ * Inputs: QShowEvent* event - the show event
  * Output: none
  */
-void EditorSkill::copySelf(const EditorSkill &source)
+void EditorSkill::showEvent(QShowEvent* event)
 {
-  id = source.id;
-  name = source.name;
-  test_string = source.test_string;
-
-  /* Action lists */
-  actions_total = source.actions_total;
-  actions_sel_base = source.actions_sel_base;
-
-  /* Frame connections */
-  sprite_anim_base = source.sprite_anim_base;
-  sprite_thumb_base = source.sprite_thumb_base;
-
-  setBaseSkill(source.base);
-  loadWorkingInfo();
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
 }
 
 /*============================================================================
@@ -350,8 +520,11 @@ Skill EditorSkill::getEditedSkill()
   buttonAnimEdit(true);
   buttonThumbEdit(true);
 
+  /* Read the widgets, only if created */
+  if(layout_created)
+    readWorkingInfo();
+
   QString full_name = "";
-  name = name_edit->text();
   if(working.getID() < 10)
     full_name.append("0");
   full_name.append(QString::number(working.getID()));
@@ -359,95 +532,11 @@ Skill EditorSkill::getEditedSkill()
   full_name.append(name);
   emit nameChange(full_name);
 
-  //working.setName(name_edit->text().toStdString());
-  working.setMessage(message_edit->toPlainText().toStdString());
-  working.setDescription(descrip_edit->toPlainText().toStdString());
-  working.setCost(cost_edit->text().toInt());
-  working.setChance(chance_edit->text().toFloat());
-  working.setCooldown(cooldown_edit->text().toInt());
-  working.setValue(value_edit->text().toInt());
-
-  /* Flags */
-  //if(!skill_offensive->isChecked() && !skill_defensive->isChecked() &&
-  //   !skill_neutral->isChecked())
-  //{
-  //  skill_offensive->setChecked(true);
-  //}
-  working.setFlag(SkillFlags::OFFENSIVE, skill_offensive->isChecked());
-  working.setFlag(SkillFlags::DEFENSIVE, skill_defensive->isChecked());
-  working.setFlag(SkillFlags::NEUTRAL, skill_neutral->isChecked());
-
-  if(primary_flag->currentIndex() == 0)
-    working.setPrimary(Element::PHYSICAL);
-  else if(primary_flag->currentIndex() == 1)
-    working.setPrimary(Element::FIRE);
-  else if(primary_flag->currentIndex() == 2)
-    working.setPrimary(Element::ICE);
-  else if(primary_flag->currentIndex() == 3)
-    working.setPrimary(Element::FOREST);
-  else if(primary_flag->currentIndex() == 4)
-    working.setPrimary(Element::ELECTRIC);
-  else if(primary_flag->currentIndex() == 5)
-    working.setPrimary(Element::DIGITAL);
-  else if(primary_flag->currentIndex() == 6)
-    working.setPrimary(Element::NIHIL);
-  else if(primary_flag->currentIndex() == 7)
-    working.setPrimary(Element::NONE);
-
-  if(secondary_flag->currentIndex() == 0)
-    working.setSecondary(Element::PHYSICAL);
-  else if(secondary_flag->currentIndex() == 1)
-    working.setSecondary(Element::FIRE);
-  else if(secondary_flag->currentIndex() == 2)
-    working.setSecondary(Element::ICE);
-  else if(secondary_flag->currentIndex() == 3)
-    working.setSecondary(Element::FOREST);
-  else if(secondary_flag->currentIndex() == 4)
-    working.setSecondary(Element::ELECTRIC);
-  else if(secondary_flag->currentIndex() == 5)
-    working.setSecondary(Element::DIGITAL);
-  else if(secondary_flag->currentIndex() == 6)
-    working.setSecondary(Element::NIHIL);
-  else if(secondary_flag->currentIndex() == 7)
-    working.setSecondary(Element::NONE);
-
-  if(scope_flag->currentIndex() == 0)
-    working.setScope(ActionScope::USER);
-  else if(scope_flag->currentIndex() == 1)
-    working.setScope(ActionScope::ONE_TARGET);
-  else if(scope_flag->currentIndex() == 2)
-    working.setScope(ActionScope::ONE_ENEMY);
-  else if(scope_flag->currentIndex() == 3)
-    working.setScope(ActionScope::TWO_ENEMIES);
-  else if(scope_flag->currentIndex() == 4)
-    working.setScope(ActionScope::ALL_ENEMIES);
-  else if(scope_flag->currentIndex() == 5)
-    working.setScope(ActionScope::ONE_ALLY);
-  else if(scope_flag->currentIndex() == 6)
-    working.setScope(ActionScope::ONE_ALLY_NOT_USER);
-  else if(scope_flag->currentIndex() == 7)
-    working.setScope(ActionScope::TWO_ALLIES);
-  else if(scope_flag->currentIndex() == 8)
-    working.setScope(ActionScope::ALL_ALLIES);
-  else if(scope_flag->currentIndex() == 9)
-    working.setScope(ActionScope::ONE_ALLY_KO);
-  else if(scope_flag->currentIndex() == 10)
-    working.setScope(ActionScope::ALL_ALLIES_KO);
-  else if(scope_flag->currentIndex() == 11)
-    working.setScope(ActionScope::ONE_PARTY);
-  else if(scope_flag->currentIndex() == 12)
-    working.setScope(ActionScope::ALL_TARGETS);
-  else if(scope_flag->currentIndex() == 13)
-    working.setScope(ActionScope::NOT_USER);
-  else if(scope_flag->currentIndex() == 14)
-    working.setScope(ActionScope::ALL_NOT_USER);
-  //else if(scope_flag->currentIndex() == 15)
-  //  working.setScope(ActionScope::NO_SCOPE);
-
   base = working;
   sprite_anim_base = sprite_anim;
   sprite_thumb_base = sprite_thumb;
   actions_sel_base = actions_sel;
+  emit dataSaved();
 
   return base;
 }
@@ -461,6 +550,17 @@ Skill EditorSkill::getEditedSkill()
  */
 void EditorSkill::loadWorkingInfo()
 {
+  /* Default to ONE_ENEMY if no listed scope is set */
+  if(getScopeIndex(working.getScope()) < 0)
+    working.setScope(ActionScope::ONE_ENEMY);
+
+  /* Drop the actions no longer available */
+  updateActions(actions_total);
+
+  /* The rest is only the widgets */
+  if(!layout_created)
+    return;
+
   name_edit->setText(name);
   message_edit->setText(QString::fromStdString(working.getMessage()));
   descrip_edit->setText(QString::fromStdString(working.getDescription()));
@@ -513,48 +613,11 @@ void EditorSkill::loadWorkingInfo()
   else if(working.getSecondary() == Element::NONE)
     secondary_flag->setCurrentIndex(7);
 
-  if(working.getScope() == ActionScope::USER)
-    scope_flag->setCurrentIndex(0);
-  else if(working.getScope() == ActionScope::ONE_TARGET)
-    scope_flag->setCurrentIndex(1);
-  else if(working.getScope() == ActionScope::ONE_ENEMY)
-    scope_flag->setCurrentIndex(2);
-  else if(working.getScope() == ActionScope::TWO_ENEMIES)
-    scope_flag->setCurrentIndex(3);
-  else if(working.getScope() == ActionScope::ALL_ENEMIES)
-    scope_flag->setCurrentIndex(4);
-  else if(working.getScope() == ActionScope::ONE_ALLY)
-    scope_flag->setCurrentIndex(5);
-  else if(working.getScope() == ActionScope::ONE_ALLY_NOT_USER)
-    scope_flag->setCurrentIndex(6);
-  else if(working.getScope() == ActionScope::TWO_ALLIES)
-    scope_flag->setCurrentIndex(7);
-  else if(working.getScope() == ActionScope::ALL_ALLIES)
-    scope_flag->setCurrentIndex(8);
-  else if(working.getScope() == ActionScope::ONE_ALLY_KO)
-    scope_flag->setCurrentIndex(9);
-  else if(working.getScope() == ActionScope::ALL_ALLIES_KO)
-    scope_flag->setCurrentIndex(10);
-  else if(working.getScope() == ActionScope::ONE_PARTY)
-    scope_flag->setCurrentIndex(11);
-  else if(working.getScope() == ActionScope::ALL_TARGETS)
-    scope_flag->setCurrentIndex(12);
-  else if(working.getScope() == ActionScope::NOT_USER)
-    scope_flag->setCurrentIndex(13);
-  else if(working.getScope() == ActionScope::ALL_NOT_USER)
-    scope_flag->setCurrentIndex(14);
-  else
-  {
-    scope_flag->setCurrentIndex(2); /* Default to ONE_ENEMY if non set */
-    working.setScope(ActionScope::ONE_ENEMY);
-  }
-  //else if(working.getScope() == ActionScope::NO_SCOPE)
-  //  scope_flag->setCurrentIndex(15);
+  scope_flag->setCurrentIndex(getScopeIndex(working.getScope()));
 
   /* Update sprite data */
   updateAnimation();
   updateThumb();
-  updateActions(actions_total);
 }
 
 /*
@@ -628,7 +691,8 @@ void EditorSkill::setNameAndID(QString str)
 {
   base.setID(str.split(" : ").at(0).toInt());
   name = str.split(" : ").at(1);
-  name_edit->setText(name);
+  if(layout_created)
+    name_edit->setText(name);
   setWorkingSkill(base);
 }
 
@@ -729,6 +793,19 @@ int EditorSkill::getID() const
   return id;
 }
 
+/*
+ * Description: Returns the image files of the saved sprites of the skill, the
+ *              ones a game export writes. The working sprites of the open
+ *              editor are not included.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorSkill::getImagePaths()
+{
+  return sprite_thumb_base.getPaths() + sprite_anim_base.getPaths();
+}
+
 /*
  * Description: Returns the name of the skill
  *
@@ -754,11 +831,11 @@ QString EditorSkill::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorSkill::load(XmlData data, int index)
+void EditorSkill::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "name")
@@ -859,8 +936,10 @@ void EditorSkill::save(FileHandler* fh, bool game_only)
 
     /* Save the thumbnail */
     if(!sprite_thumb_base.isAllNull() && sprite_thumb_base.frameCount() == 1)
-      fh->writeXmlData("thumb",
-           EditorHelpers::trimPath(sprite_thumb_base.getPath(0)).toStdString());
+    {
+      QString path = EditorAtlas::getExportPath(sprite_thumb_base.getPath(0));
+      fh->writeXmlData("thumb", EditorHelpers::trimPath(path).toStdString());
+    }
 
     /* Save the animation data */
     if(!sprite_anim_base.isAllNull())
@@ -891,7 +970,7 @@ void EditorSkill::setID(int id)
 void EditorSkill::setName(QString name, bool update)
 {
   this->name = name;
-  if(update)
+  if(update && layout_created)
     name_edit->setText(name);
 }
 
@@ -907,6 +986,21 @@ void EditorSkill::setName(QString name, bool update)
 void EditorSkill::updateActions(QVector<EditorAction*> actions)
 {
   actions_total = actions;
+
+  /* Remaining IDs that aren't available, remove */
+  for(int i = actions_sel.size() - 1; i >= 0; i--)
+  {
+    bool found = false;
+    for(int j = 0; (j < actions.size() && !found); j++)
+      if(actions_sel[i] == actions[j]->getID())
+        found = true;
+    if(!found)
+      actions_sel.remove(i);
+  }
+
+  /* The lists are only updated if created */
+  if(!layout_created)
+    return;
   int index_skill = skill_actions->currentRow();
   int index_total = total_actions->currentRow();
 
@@ -918,34 +1012,11 @@ void EditorSkill::updateActions(QVector<EditorAction*> actions)
   for(int i = 0; i < actions.size(); i++)
     total_actions->addItem(actions[i]->getNameList());
 
-  /* Found stack based on ID of skill */
-  QVector<bool> actions_found;
-  for(int i = 0; i < actions_sel.size(); i++)
-    actions_found.push_back(false);
-
-  /* Loop through all actions in stack and add */
+  /* Add the actions in the skill, by ID */
   for(int i = 0; i < actions_sel.size(); i++)
-  {
-    bool found = false;
-
-    /* Loop through the action set and see if the ID exists */
-    for(int j = 0; (j < actions.size() && !found); j++)
-    {
+    for(int j = 0; j < actions.size(); j++)
       if(actions_sel[i] == actions[j]->getID())
-      {
-        found = true;
-        actions_found[i] = true;
         skill_actions->addItem(actions[j]->getNameList());
-      }
-    }
-  }
-
-  /* Remaining IDs that weren't found, remove */
-  for(int i = actions_found.size() - 1; i >= 0; i--)
-  {
-    if(!actions_found[i])
-      actions_sel.remove(i);
-  }
 
   /* Restore index if relevant */
   if(index_skill >= 0)
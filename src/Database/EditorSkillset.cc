@@ -21,51 +21,8 @@ EditorSkillset::EditorSkillset(QWidget *parent) : QWidget(parent)
   name_base = "New Skill Set";
   name_curr = name_base;
 
-  /* Setup layout */
-  QGridLayout* main_layout = new QGridLayout(this);
-  main_layout->setColumnStretch(0, 1);
-  main_layout->setColumnStretch(3, 2);
-
-  /* Name */
-  edit_name = new QLineEdit(this);
-  edit_name->setPlaceholderText("Name");
-  edit_name->setAlignment(Qt::AlignHCenter);
-  connect(edit_name, SIGNAL(textEdited(QString)),
-          this, SLOT(nameEdited(QString)));
-  main_layout->addWidget(edit_name, 1, 1, 1, 2);
-
-  /* Available List */
-  QLabel* lbl_avail = new QLabel("Available Skills", this);
-  main_layout->addWidget(lbl_avail, 2, 1, Qt::AlignHCenter);
-  list_available = new QListWidget(this);
-  list_available->setMaximumWidth(350);
-  main_layout->addWidget(list_available, 3, 1);
-
-  /* Used set list */
-  QLabel* lbl_used = new QLabel("Used Skills", this);
-  main_layout->addWidget(lbl_used, 2, 2, Qt::AlignHCenter);
-  list_used = new QListWidget(this);
-  list_used->setMaximumWidth(350);
-  main_layout->addWidget(list_used, 3, 2);
-
-  /* Add Remove Buttons of skills*/
-  btn_add = new QPushButton("Add To Skillset",this);
-  connect(btn_add, SIGNAL(clicked()), this, SLOT(addSkill()));
-  main_layout->addWidget(btn_add, 4, 1);
-  btn_remove = new QPushButton("Remove From Skill Set",this);
-  connect(btn_remove, SIGNAL(clicked()), this, SLOT(removeSkill()));
-  main_layout->addWidget(btn_remove, 4, 2);
-
-  /* 4th row spacer */
-  main_layout->setRowMinimumHeight(5, 25);
-
-  /* Setup Buttons */
-  QPushButton* btn_reset = new QPushButton("Reset",this);
-  connect(btn_reset, SIGNAL(clicked()), this, SLOT(resetWorking()));
-  main_layout->addWidget(btn_reset, 6, 1);
-  QPushButton* btn_save = new QPushButton("Save",this);
-  connect(btn_save, SIGNAL(clicked()), this, SLOT(saveWorking()));
-  main_layout->addWidget(btn_save, 6, 2);
+  /* Layout - created on the first show */
+  layout_created = false;
 }
 
 /*
@@ -125,6 +82,61 @@ void EditorSkillset::copySelf(const EditorSkillset &source)
   resetWorking();
 }
 
+/*
+ * Description: Creates the skill set layout with QT functional widgets.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSkillset::createLayout()
+{
+  /* Setup layout */
+  QGridLayout* main_layout = new QGridLayout(this);
+  main_layout->setColumnStretch(0, 1);
+  main_layout->setColumnStretch(3, 2);
+
+  /* Name */
+  edit_name = new QLineEdit(this);
+  edit_name->setPlaceholderText("Name");
+  edit_name->setAlignment(Qt::AlignHCenter);
+  connect(edit_name, SIGNAL(textEdited(QString)),
+          this, SLOT(nameEdited(QString)));
+  main_layout->addWidget(edit_name, 1, 1, 1, 2);
+
+  /* Available List */
+  QLabel* lbl_avail = new QLabel("Available Skills", this);
+  main_layout->addWidget(lbl_avail, 2, 1, Qt::AlignHCenter);
+  list_available = new QListWidget(this);
+  list_available->setMaximumWidth(350);
+  main_layout->addWidget(list_available, 3, 1);
+
+  /* Used set list */
+  QLabel* lbl_used = new QLabel("Used Skills", this);
+  main_layout->addWidget(lbl_used, 2, 2, Qt::AlignHCenter);
+  list_used = new QListWidget(this);
+  list_used->setMaximumWidth(350);
+  main_layout->addWidget(list_used, 3, 2);
+
+  /* Add Remove Buttons of skills*/
+  btn_add = new QPushButton("Add To Skillset",this);
+  connect(btn_add, SIGNAL(clicked()), this, SLOT(addSkill()));
+  main_layout->addWidget(btn_add, 4, 1);
+  btn_remove = new QPushButton("Remove From Skill Set",this);
+  connect(btn_remove, SIGNAL(clicked()), this, SLOT(removeSkill()));
+  main_layout->addWidget(btn_remove, 4, 2);
+
+  /* 4th row spacer */
+  main_layout->setRowMinimumHeight(5, 25);
+
+  /* Setup Buttons */
+  QPushButton* btn_reset = new QPushButton("Reset",this);
+  connect(btn_reset, SIGNAL(clicked()), this, SLOT(resetWorking()));
+  main_layout->addWidget(btn_reset, 6, 1);
+  QPushButton* btn_save = new QPushButton("Save",this);
+  connect(btn_save, SIGNAL(clicked()), this, SLOT(saveWorking()));
+  main_layout->addWidget(btn_save, 6, 2);
+}
+
 /*
  * Description: Returns the stored Editor Skill by the given ID. Null if not
  *              found.
@@ -149,8 +161,25 @@ EditorSkill* EditorSkillset::getByID(int id)
  */
 void EditorSkillset::loadWorkingInfo()
 {
+  /* Check info to assert it is valid. Skills no longer available and repeats
+   * are removed, with or without the widgets */
+  QVector<int> working_ids;
+  for(int i = 0; i < set_working.size(); i++)
+  {
+    int skill_id = set_working[i].first;
+    if(getByID(skill_id) == NULL || working_ids.contains(skill_id))
+      set_working.remove(i--);
+    else
+      working_ids.push_back(skill_id);
+  }
+
+  /* The rest is only the widgets */
+  if(!layout_created)
+    return;
+
   /* Name */
   edit_name->setText(getName());
+  edit_name->setDisabled(id == (int)SkillSet::kID_BUBBIFIED);
 
   /* Get indexes and Clear existing sets */
   int index_avail = list_available->currentRow();
@@ -158,29 +187,13 @@ void EditorSkillset::loadWorkingInfo()
   list_available->clear();
   list_used->clear();
 
-  /* Checking array stack */
-  QVector<bool> working_used;
-  for(int i = 0; i < set_working.size(); i++)
-    working_used.push_back(false);
-
   /* Set split info */
   for(int i = 0; i < set_total.size(); i++)
   {
-    bool found = false;
-
-    /* Loop through and see if it exists in stored array */
-    for(int j = 0; !found && j < set_working.size(); j++)
-    {
-      if(set_total[i]->getID() == set_working[j].first)
-      {
-        found = true;
-        working_used[j] = true;
-        list_used->addItem(skillString(set_total[i], set_working[j].second));
-      }
-    }
-
-    /* If not found, put in other array */
-    if(!found)
+    int index = working_ids.indexOf(set_total[i]->getID());
+    if(index >= 0)
+      list_used->addItem(skillString(set_total[i], set_working[index].second));
+    else
       list_available->addItem(skillString(set_total[i]));
   }
 
@@ -203,11 +216,24 @@ void EditorSkillset::loadWorkingInfo()
     else
       list_used->setCurrentRow(list_used->count() - 1);
   }
+}
 
-  /* Check info to assert it is valid */
-  for(int i = working_used.size() - 1; i >= 0; i--)
-    if(!working_used[i])
-      set_working.remove(i);
+/*
+ * Description: Creates the widget layout the first time the skill set is
+ *              shown, so skill sets that are never opened hold no widgets.
+ *
+ * Inputs: QShowEvent* event - the show event
+ * Output: none
+ */
+void EditorSkillset::showEvent(QShowEvent* event)
+{
+  if(!layout_created)
+  {
+    createLayout();
+    layout_created = true;
+    loadWorkingInfo();
+  }
+  QWidget::showEvent(event);
 }
 
 /*
@@ -357,6 +383,7 @@ void EditorSkillset::saveWorking()
   if(name_base != name_curr)
     emit nameChange(name_curr);
   name_base = name_curr;
+  emit dataSaved();
 }
 
 /*
@@ -413,11 +440,11 @@ QString EditorSkillset::getNameList()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorSkillset::load(XmlData data, int index)
+void EditorSkillset::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "name")
@@ -485,14 +512,8 @@ void EditorSkillset::setID(int id)
   this->id = id;
 
   /* ID checks for data not allowed to be changed */
-  if(id == (int)SkillSet::kID_BUBBIFIED)
-  {
-    edit_name->setDisabled(true);
-  }
-  else
-  {
-    edit_name->setEnabled(true);
-  }
+  if(layout_created)
+    edit_name->setDisabled(id == (int)SkillSet::kID_BUBBIFIED);
 }
 
 /*
@@ -116,6 +116,20 @@ QString EditorSound::getFileName() const
   return file_name;
 }
 
+/*
+ * Description: Returns the full path of the sound file, with the project
+ *              directory in front of the trimmed file name.
+ *
+ * Inputs: none
+ * Output: QString - the full file path. Empty if there is no file
+ */
+QString EditorSound::getFileNameFull() const
+{
+  if(file_name.isEmpty())
+    return "";
+  return EditorHelpers::getProjectDir() + "/" + file_name;
+}
+
 /*
  * Description: Returns the ID of the sound
  *
@@ -185,11 +199,11 @@ bool EditorSound::isNameLocked()
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: bool - true if name was updated
  */
-bool EditorSound::load(XmlData data, int index)
+bool EditorSound::load(XmlData &data, int index)
 {
   bool name_updated = false;
 
@@ -0,0 +1,553 @@
+/*******************************************************************************
+ * Class Name: EditorSoundCache
+ * Date Created: October 19, 2026
+ * Inheritance: QObject
+ * Description: Analysis of the sound and music files, decoded once each in the
+ *              background. Keeps the length, loudness and a downsampled
+ *              waveform of every file (stored on disk between sessions) and
+ *              the decoded samples of short files, so they play instantly.
+ ******************************************************************************/
+#include "Database/EditorSoundCache.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int EditorSoundCache::kCACHE_VERSION = 1;
+const int EditorSoundCache::kPCM_CACHE_BYTES = 16 * 1024 * 1024;
+const int EditorSoundCache::kPCM_MAX_LENGTH = 5000;
+const int EditorSoundCache::kWAVE_BLOCK = 10;
+const int EditorSoundCache::kWAVE_POINTS = 256;
+
+/* Static Implementation */
+EditorSoundCache* EditorSoundCache::shared_cache = nullptr;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. Loads the analysis saved by the last
+ *              session. Nothing is decoded until a file is requested.
+ *
+ * Inputs: QObject* parent - the parent object
+ */
+EditorSoundCache::EditorSoundCache(QObject* parent) : QObject(parent)
+{
+  block_frames = 0;
+  block_peak = 0.0;
+  decode_frames = 0;
+  decode_pcm_keep = false;
+  decode_rate = 0;
+  decode_samples = 0;
+  decode_square_sum = 0.0;
+  infos_changed = false;
+  pcms.setMaxCost(kPCM_CACHE_BYTES);
+
+  connect(&decoder, SIGNAL(bufferReady()), this, SLOT(decoderBufferReady()));
+  connect(&decoder, SIGNAL(error(QAudioDecoder::Error)),
+          this, SLOT(decoderError(QAudioDecoder::Error)));
+  connect(&decoder, SIGNAL(finished()), this, SLOT(decoderFinished()));
+
+  loadCache();
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorSoundCache::~EditorSoundCache()
+{
+  queue.clear();
+  decoder.stop();
+  saveCache();
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Starts decoding the next file in the queue, resetting the
+ *              running totals. When the queue runs out, the disk cache is
+ *              saved.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSoundCache::decodeNext()
+{
+  if(!decode_file.isEmpty())
+    return;
+
+  if(queue.isEmpty())
+  {
+    saveCache();
+    return;
+  }
+
+  decode_file = queue.takeFirst();
+  QFileInfo file_info(decode_file);
+
+  decode_blocks.clear();
+  decode_frames = 0;
+  decode_info.duration = -1;
+  decode_info.modified = file_info.lastModified();
+  decode_info.size = file_info.size();
+  decode_info.peak = 0.0;
+  decode_info.rms = 0.0;
+  decode_info.waveform.clear();
+  decode_pcm.clear();
+  decode_pcm_format = QAudioFormat();
+  decode_pcm_keep = !pcms_failed.contains(decode_file);
+  decode_rate = 0;
+  decode_samples = 0;
+  decode_square_sum = 0.0;
+  block_frames = 0;
+  block_peak = 0.0;
+
+  decoder.setSourceFilename(decode_file);
+  decoder.start();
+}
+
+/*
+ * Description: Completes the file being decoded. On success, the totals are
+ *              reduced to the info and the samples kept if short enough. On
+ *              failure, the info is stored with a duration of -1, so the file
+ *              is not retried until it changes on disk.
+ *
+ * Inputs: bool success - true if the whole file was decoded
+ * Output: none
+ */
+void EditorSoundCache::finishDecode(bool success)
+{
+  if(decode_file.isEmpty())
+    return;
+  decoder.stop();
+
+  if(success && decode_rate > 0)
+  {
+    if(block_frames > 0)
+      decode_blocks.push_back(block_peak);
+
+    decode_info.duration = decode_frames * 1000 / decode_rate;
+    if(decode_samples > 0)
+      decode_info.rms = qSqrt(decode_square_sum / decode_samples);
+
+    /* Reduce the blocks to the waveform points, keeping the peak of each */
+    int points = qMin(kWAVE_POINTS, decode_blocks.size());
+    decode_info.waveform.resize(points);
+    for(int i = 0; i < points; i++)
+    {
+      int first = i * decode_blocks.size() / points;
+      int last = (i + 1) * decode_blocks.size() / points;
+      float peak = 0.0;
+      for(int j = first; j < last; j++)
+        peak = qMax(peak, decode_blocks[j]);
+      decode_info.waveform[i] = static_cast<quint8>(qMin(peak, 1.0f) * 255);
+    }
+
+    /* Keep the samples of the short files */
+    if(decode_pcm_keep && !decode_pcm.isEmpty())
+    {
+      EditorSoundPcm* pcm = new EditorSoundPcm;
+      pcm->data = decode_pcm;
+      pcm->format = decode_pcm_format;
+      if(!pcms.insert(decode_file, pcm, decode_pcm.size()))
+        pcms_failed.insert(decode_file);
+    }
+    else
+    {
+      pcms_failed.insert(decode_file);
+    }
+  }
+  else
+  {
+    decode_info.duration = -1;
+    decode_info.waveform.clear();
+    pcms_failed.insert(decode_file);
+  }
+
+  QString file = decode_file;
+  infos.insert(file, decode_info);
+  infos_changed = true;
+
+  decode_blocks.clear();
+  decode_file = "";
+  decode_pcm.clear();
+
+  emit infoReady(file);
+  decodeNext();
+}
+
+/*
+ * Description: Returns the path of the disk cache, in the user cache folder.
+ *
+ * Inputs: none
+ * Output: QString - the cache file path
+ */
+QString EditorSoundCache::getCachePath()
+{
+  return QStandardPaths::writableLocation(QStandardPaths::CacheLocation) +
+         "/sound_info.dat";
+}
+
+/*
+ * Description: Returns if the info was taken from the file as it is on disk
+ *              now, by size and modified time.
+ *
+ * Inputs: const QString &file - the full file path
+ *         const EditorSoundInfo &info - the stored info
+ * Output: bool - true if current
+ */
+bool EditorSoundCache::isCurrent(const QString &file,
+                                 const EditorSoundInfo &info)
+{
+  QFileInfo file_info(file);
+  return (file_info.exists() && file_info.size() == info.size &&
+          file_info.lastModified() == info.modified);
+}
+
+/*
+ * Description: Loads the disk cache. A missing file or a different version is
+ *              ignored, and everything is decoded again as requested.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSoundCache::loadCache()
+{
+  QFile file(getCachePath());
+  if(!file.open(QIODevice::ReadOnly))
+    return;
+
+  QDataStream stream(&file);
+  qint32 version = 0;
+  qint32 count = 0;
+  stream >> version >> count;
+  if(version != kCACHE_VERSION)
+    return;
+
+  for(int i = 0; i < count && stream.status() == QDataStream::Ok; i++)
+  {
+    QString path;
+    EditorSoundInfo info;
+    stream >> path >> info.duration >> info.modified >> info.size
+           >> info.peak >> info.rms >> info.waveform;
+    if(stream.status() == QDataStream::Ok)
+      infos.insert(path, info);
+  }
+}
+
+/*
+ * Description: Reads a single sample and scales it from -1 to 1. Handles the
+ *              8, 16 and 32 bit integer and 32 bit float formats.
+ *
+ * Inputs: const char* data - the sample data
+ *         const QAudioFormat &format - the sample format
+ * Output: float - the sample. 0 if the format is not handled
+ */
+float EditorSoundCache::readSample(const char* data,
+                                   const QAudioFormat &format)
+{
+  bool big = (format.byteOrder() == QAudioFormat::BigEndian);
+  int size = format.sampleSize();
+
+  if(format.sampleType() == QAudioFormat::Float)
+  {
+    if(size == 32)
+    {
+      quint32 bits = big ? qFromBigEndian<quint32>(data)
+                         : qFromLittleEndian<quint32>(data);
+      float value;
+      memcpy(&value, &bits, sizeof(value));
+      return value;
+    }
+  }
+  else if(format.sampleType() == QAudioFormat::SignedInt)
+  {
+    if(size == 8)
+      return static_cast<qint8>(data[0]) / 128.0f;
+    else if(size == 16)
+      return (big ? qFromBigEndian<qint16>(data)
+                  : qFromLittleEndian<qint16>(data)) / 32768.0f;
+    else if(size == 32)
+      return (big ? qFromBigEndian<qint32>(data)
+                  : qFromLittleEndian<qint32>(data)) / 2147483648.0f;
+  }
+  else if(format.sampleType() == QAudioFormat::UnSignedInt)
+  {
+    if(size == 8)
+      return (static_cast<quint8>(data[0]) - 128) / 128.0f;
+    else if(size == 16)
+      return ((big ? qFromBigEndian<quint16>(data)
+                   : qFromLittleEndian<quint16>(data)) - 32768) / 32768.0f;
+  }
+
+  return 0.0;
+}
+
+/*
+ * Description: Saves the disk cache, if changed. Files no longer on disk are
+ *              dropped.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSoundCache::saveCache()
+{
+  if(!infos_changed)
+    return;
+
+  QString path = getCachePath();
+  QDir().mkpath(QFileInfo(path).absolutePath());
+  QFile file(path);
+  if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+    return;
+
+  QList<QString> paths;
+  for(auto it = infos.constBegin(); it != infos.constEnd(); it++)
+    if(QFileInfo::exists(it.key()))
+      paths.push_back(it.key());
+
+  QDataStream stream(&file);
+  stream << static_cast<qint32>(kCACHE_VERSION)
+         << static_cast<qint32>(paths.size());
+  for(int i = 0; i < paths.size(); i++)
+  {
+    const EditorSoundInfo &info = infos[paths[i]];
+    stream << paths[i] << info.duration << info.modified << info.size
+           << info.peak << info.rms << info.waveform;
+  }
+
+  infos_changed = false;
+}
+
+/*============================================================================
+ * PUBLIC SLOTS
+ *===========================================================================*/
+
+/*
+ * Description: Triggered when the decoder has a buffer. Adds it to the running
+ *              totals and the kept samples, if still short enough.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSoundCache::decoderBufferReady()
+{
+  QAudioBuffer buffer = decoder.read();
+  if(decode_file.isEmpty() || !buffer.isValid())
+    return;
+
+  QAudioFormat format = buffer.format();
+  int channels = format.channelCount();
+  int sample_bytes = format.sampleSize() / 8;
+  if(channels <= 0 || sample_bytes <= 0 || format.sampleRate() <= 0)
+    return;
+
+  if(decode_rate == 0)
+  {
+    decode_rate = format.sampleRate();
+    decode_pcm_format = format;
+  }
+  qint64 block_length = qMax(1, decode_rate * kWAVE_BLOCK / 1000);
+
+  /* Loudness and waveform, from the peak channel of each frame */
+  const char* data = buffer.constData<char>();
+  int frames = buffer.frameCount();
+  for(int i = 0; i < frames; i++)
+  {
+    float frame_peak = 0.0;
+    for(int j = 0; j < channels; j++)
+    {
+      float sample = readSample(data, format);
+      frame_peak = qMax(frame_peak, qAbs(sample));
+      decode_square_sum += sample * sample;
+      data += sample_bytes;
+    }
+
+    decode_info.peak = qMax(decode_info.peak, frame_peak);
+    block_peak = qMax(block_peak, frame_peak);
+    if(++block_frames >= block_length)
+    {
+      decode_blocks.push_back(block_peak);
+      block_frames = 0;
+      block_peak = 0.0;
+    }
+  }
+  decode_frames += frames;
+  decode_samples += frames * channels;
+
+  /* Samples are only kept while the file is short and the format holds */
+  if(decode_pcm_keep)
+  {
+    if(format != decode_pcm_format ||
+       decode_frames * 1000 / decode_rate > kPCM_MAX_LENGTH)
+    {
+      decode_pcm_keep = false;
+      decode_pcm.clear();
+    }
+    else
+    {
+      decode_pcm.append(buffer.constData<char>(), buffer.byteCount());
+    }
+  }
+}
+
+/*
+ * Description: Triggered when the decoder fails. If there is no decoder at all
+ *              the queue is dropped, otherwise only the file is marked failed.
+ *
+ * Inputs: QAudioDecoder::Error error - the decoder error
+ * Output: none
+ */
+void EditorSoundCache::decoderError(QAudioDecoder::Error error)
+{
+  if(error == QAudioDecoder::ServiceMissingError)
+  {
+    queue.clear();
+    decoder.stop();
+    decode_file = "";
+  }
+  else
+  {
+    finishDecode(false);
+  }
+}
+
+/*
+ * Description: Triggered when the decoder reaches the end of the file.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSoundCache::decoderFinished()
+{
+  finishDecode(true);
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Queues the file to be decoded, unless it already is or is
+ *              being decoded now.
+ *
+ * Inputs: QString file - the full file path
+ * Output: none
+ */
+void EditorSoundCache::analyze(QString file)
+{
+  if(file.isEmpty() || file == decode_file || queue.contains(file))
+    return;
+
+  queue.push_back(file);
+  decodeNext();
+}
+
+/*
+ * Description: Returns the analysis of the file. If missing or the file has
+ *              changed since, the file is queued and infoReady() emitted when
+ *              done. Changed files also drop any kept samples.
+ *
+ * Inputs: QString file - the full file path
+ *         EditorSoundInfo* info - set to the analysis, if found
+ * Output: bool - true if the analysis is current
+ */
+bool EditorSoundCache::getInfo(QString file, EditorSoundInfo* info)
+{
+  if(file.isEmpty())
+    return false;
+
+  auto found = infos.constFind(file);
+  if(found != infos.constEnd() && isCurrent(file, found.value()))
+  {
+    if(info != nullptr)
+      *info = found.value();
+    return true;
+  }
+
+  pcms.remove(file);
+  pcms_failed.remove(file);
+  analyze(file);
+  return false;
+}
+
+/*
+ * Description: Returns the decoded samples of the file, if short and kept. If
+ *              short but dropped from the cache, it is decoded again. The
+ *              pointer is only valid until the next call into the cache.
+ *
+ * Inputs: QString file - the full file path
+ * Output: const EditorSoundPcm* - the samples. Null if not kept
+ */
+const EditorSoundPcm* EditorSoundCache::getPcm(QString file)
+{
+  EditorSoundInfo info;
+  if(!getInfo(file, &info))
+    return nullptr;
+
+  EditorSoundPcm* pcm = pcms.object(file);
+  if(pcm == nullptr && info.duration >= 0 &&
+     info.duration <= kPCM_MAX_LENGTH && !pcms_failed.contains(file))
+  {
+    analyze(file);
+  }
+  return pcm;
+}
+
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the length and loudness as a display string, in the
+ *              form "Length 0:01.5  Peak -3.0 dB  RMS -18.2 dB".
+ *
+ * Inputs: const EditorSoundInfo &info - the analysis
+ * Output: QString - the display string
+ */
+QString EditorSoundCache::getInfoString(const EditorSoundInfo &info)
+{
+  if(info.duration < 0)
+    return "Unreadable";
+
+  QString peak = "-inf";
+  if(info.peak > 0.0)
+    peak = QString::number(20.0 * log10(info.peak), 'f', 1);
+  QString rms = "-inf";
+  if(info.rms > 0.0)
+    rms = QString::number(20.0 * log10(info.rms), 'f', 1);
+
+  return "Length " + getLengthString(info.duration) + "  Peak " + peak +
+         " dB  RMS " + rms + " dB";
+}
+
+/*
+ * Description: Returns the length as a "m:ss.s" string.
+ *
+ * Inputs: qint64 duration - the length, in milliseconds
+ * Output: QString - the length string. "?" if unknown
+ */
+QString EditorSoundCache::getLengthString(qint64 duration)
+{
+  if(duration < 0)
+    return "?";
+
+  qint64 minutes = duration / 60000;
+  double seconds = (duration % 60000) / 1000.0;
+  return QString::number(minutes) + ":" +
+         QString("%1").arg(seconds, 4, 'f', 1, QChar('0'));
+}
+
+/*
+ * Description: Returns the shared cache. Created on the first call and kept
+ *              for the life of the application.
+ *
+ * Inputs: none
+ * Output: EditorSoundCache* - the shared cache
+ */
+EditorSoundCache* EditorSoundCache::getShared()
+{
+  if(shared_cache == nullptr)
+    shared_cache = new EditorSoundCache();
+  return shared_cache;
+}
@@ -247,7 +247,10 @@ void EditorSoundDb::createLayout()
   view_sound = new SoundView(this);
   connect(view_sound, SIGNAL(nameChange(QString)),
           this, SLOT(changedName(QString)));
+  connect(view_sound, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   layout->addWidget(view_sound, 5, 0, 1, 9, Qt::AlignHCenter);
+  connect(EditorSoundCache::getShared(), SIGNAL(infoReady(QString)),
+          this, SLOT(soundInfoReady(QString)));
 
   /* Create reserved data */
   createReserved();
@@ -431,7 +434,8 @@ void EditorSoundDb::loadList(QListWidget* list, QVector<EditorSound*>* chunks,
   /* Load new data */
   for(int i = 0; i < chunks->size(); i++)
   {
-    list->addItem(chunks->at(i)->getNameList());
+    list->addItem("");
+    loadItem(list->item(list->count() - 1), chunks->at(i));
     if(chunks->at(i) == current)
     {
       QFont bold_font;
@@ -450,6 +454,30 @@ void EditorSoundDb::loadList(QListWidget* list, QVector<EditorSound*>* chunks,
   }
 }
 
+/*
+ * Description: Loads the list item with the list name of the chunk and, once
+ *              the sound cache has analyzed the file, its length (with the
+ *              loudness in the tooltip). Files not analyzed yet are queued.
+ *
+ * Inputs: QListWidgetItem* item - the list item to load
+ *         EditorSound* chunk - the sound chunk of the item
+ * Output: none
+ */
+void EditorSoundDb::loadItem(QListWidgetItem* item, EditorSound* chunk)
+{
+  QString text = chunk->getNameList();
+  QString tooltip = "";
+  EditorSoundInfo info;
+  if(EditorSoundCache::getShared()->getInfo(chunk->getFileNameFull(), &info))
+  {
+    text += "  [" + EditorSoundCache::getLengthString(info.duration) + "]";
+    tooltip = EditorSoundCache::getInfoString(info);
+  }
+
+  item->setText(text);
+  item->setToolTip(tooltip);
+}
+
 /*
  * Description: Loads all the UI elements with the contents from the working
  *              Editor Sound chunk stacks.
@@ -887,6 +915,31 @@ void EditorSoundDb::listSoundReserveDouble(QListWidgetItem*)
   }
 }
 
+/*
+ * Description: Slot triggered when the sound cache finishes analyzing a file.
+ *              Only the list items of chunks using the file are reloaded.
+ *
+ * Inputs: QString file - the full path of the analyzed file
+ * Output: none
+ */
+void EditorSoundDb::soundInfoReady(QString file)
+{
+  QList<QPair<QListWidget*, QVector<EditorSound*>*>> lists;
+  lists.push_back(qMakePair(list_m_custom, &music_custom));
+  lists.push_back(qMakePair(list_m_reserve, &music_reserved));
+  lists.push_back(qMakePair(list_s_custom, &sound_custom));
+  lists.push_back(qMakePair(list_s_reserve, &sound_reserved));
+
+  for(int i = 0; i < lists.size(); i++)
+  {
+    QListWidget* list = lists[i].first;
+    QVector<EditorSound*>* chunks = lists[i].second;
+    for(int j = 0; j < chunks->size() && j < list->count(); j++)
+      if(chunks->at(j)->getFileNameFull() == file)
+        loadItem(list->item(j), chunks->at(j));
+  }
+}
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -976,14 +1029,46 @@ int EditorSoundDb::getSaveCount()
   return count;
 }
 
+/*
+ * Description: Returns the ID of the selected row in the four lists. Only one
+ *              list has a selection at a time.
+ *
+ * Inputs: bool* is_music - set true if the selection is music. Optional
+ * Output: int - the selected music or sound ID. -1 if none selected
+ */
+int EditorSoundDb::getSelectedID(bool* is_music)
+{
+  EditorSound* selected = nullptr;
+  bool music = true;
+
+  if(list_m_custom->currentRow() >= 0)
+    selected = music_custom[list_m_custom->currentRow()];
+  else if(list_m_reserve->currentRow() >= 0)
+    selected = music_reserved[list_m_reserve->currentRow()];
+  else
+  {
+    music = false;
+    if(list_s_custom->currentRow() >= 0)
+      selected = sound_custom[list_s_custom->currentRow()];
+    else if(list_s_reserve->currentRow() >= 0)
+      selected = sound_reserved[list_s_reserve->currentRow()];
+  }
+
+  if(is_music != nullptr)
+    *is_music = music;
+  if(selected != nullptr)
+    return selected->getID();
+  return -1;
+}
+
 /*
  * Description: Loads the object data from the XML struct and offset index.
  *
- * Inputs: XmlData data - the XML data tree struct
+ * Inputs: XmlData &data - the XML data tree struct
  *         int index - the offset index into the struct
  * Output: none
  */
-void EditorSoundDb::load(XmlData data, int index)
+void EditorSoundDb::load(XmlData &data, int index)
 {
   /* Parse elements */
   if(data.getElement(index) == "music")
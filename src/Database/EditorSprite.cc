@@ -11,6 +11,9 @@
 /* Constant Implementation - see header file for descriptions */
 const float EditorSprite::kREF_RGB = 255.0;
 
+/* Static Implementation */
+QSet<EditorSprite*> EditorSprite::live_sprites;
+
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *===========================================================================*/
@@ -27,6 +30,8 @@ EditorSprite::EditorSprite(QString img_path) : QObject()
   name = "Default";
   if(img_path != "")
     setPath(0, img_path);
+
+  live_sprites.insert(this);
 }
 
 /*
@@ -44,6 +49,7 @@ EditorSprite::EditorSprite(const EditorSprite &source) : EditorSprite()
  */
 EditorSprite::~EditorSprite()
 {
+  live_sprites.remove(this);
 }
 
 /*============================================================================
@@ -99,6 +105,24 @@ QString EditorSprite::getFrameMods(int index)
   return temp;
 }
 
+/*
+ * Description: Attaches the image of the frame, if its decode was deferred to
+ *              the image store while loading. By then it has been decoded, so
+ *              this is only a lookup.
+ *
+ * Inputs: int index - the index of the frame data
+ * Output: none
+ */
+void EditorSprite::resolveFrame(int index)
+{
+  if(index >= 0 && index < frame_info.size() && frame_info[index].pending)
+  {
+    frame_info[index].image =
+               EditorImageStore::getShared()->getImage(frame_info[index].path);
+    frame_info[index].pending = false;
+  }
+}
+
 /*
  * Description: Returns the transformed pixmap, with all necessary sprite mods.
  *
@@ -112,110 +136,8 @@ QString EditorSprite::getFrameMods(int index)
 QPixmap EditorSprite::transformPixmap(int index, int w, int h, bool shadow,
                                       QColor shadow_color)
 {
-  QTransform transform;
-  qreal m11 = transform.m11();    /* Horizontal scaling */
-  qreal m12 = transform.m12();    /* Vertical shearing */
-  qreal m13 = transform.m13();    /* Horizontal Projection */
-  qreal m21 = transform.m21();    /* Horizontal shearing */
-  qreal m22 = transform.m22();    /* vertical scaling */
-  qreal m23 = transform.m23();    /* Vertical Projection */
-  qreal m31 = transform.m31();    /* Horizontal Position (DX) */
-  qreal m32 = transform.m32();    /* Vertical Position (DY) */
-  qreal m33 = transform.m33();    /* Addtional Projection Factor */
-
-  /* Execute horizontal flip */
-  if(getHorizontalFlip(index))
-  {
-    qreal scale = m11;
-
-    m11 = -m11;
-
-    /* Re-position back to origin */
-    if(m31 > 0)
-      m31 = 0;
-    else
-      m31 = (w * scale);
-  }
-
-  /* Execute vertical flip */
-  if(getVerticalFlip(index))
-  {
-    qreal scale = m22;
-    m22 = -m22;
-
-    /* Re-position back to origin */
-    if(m32 > 0)
-      m32 = 0;
-    else
-      m32 = (h * scale);
-  }
-
-  /* Transform */
-  transform.setMatrix(m11, m12, m13, m21, m22, m23, m31, m32, m33);
-  transform.rotate(getFrameAngle(index) + sprite.getRotationDegrees());
-
-  /* Modify brightness and color values */
-  QImage editing_image = getImage(index);
-  QColor old_color;
-  int r_mod = getColorRed();
-  int g_mod = getColorGreen();
-  int b_mod = getColorBlue();
-  int r,g,b;
-
-  for(int i = 0; i < editing_image.width(); i++)
-  {
-    for(int j = 0; j < editing_image.height(); j++)
-    {
-      if(qAlpha(editing_image.pixel(i, j)) > 0)
-      {
-        if(shadow)
-        {
-          r = shadow_color.red();
-          g = shadow_color.green();
-          b = shadow_color.blue();
-        }
-        else
-        {
-          old_color = QColor(editing_image.pixel(i, j));
-          r = old_color.red();
-          g = old_color.green();
-          b = old_color.blue();
-
-          /* Brightness value */
-          float delta_mod = (getBrightness() / kREF_RGB);
-          if(delta_mod < 1.0)
-          {
-            r *= delta_mod;
-            g *= delta_mod;
-            b *= delta_mod;
-          }
-          else if(delta_mod > 1.0)
-          {
-            int bright_value = getBrightness() - kREF_RGB;
-            r += bright_value;
-            g += bright_value;
-            b += bright_value;
-
-            /* Bound the values */
-            r = qBound(0, r, (int)kREF_RGB);
-            g = qBound(0, g, (int)kREF_RGB);
-            b = qBound(0, b, (int)kREF_RGB);
-          }
-
-          /* Then, modify the color */
-          r *= (r_mod / kREF_RGB);
-          g *= (g_mod / kREF_RGB);
-          b *= (b_mod / kREF_RGB);
-        }
-
-        editing_image.setPixel(i, j, qRgba(r, g, b,
-                                           qAlpha(editing_image.pixel(i, j))));
-      }
-    }
-  }
-
-  /* Return the pixmap */
-  return QPixmap::fromImage(editing_image).transformed(transform);
+  return QPixmap::fromImage(renderFrame(getFrameRender(index), w, h, shadow,
+                                        shadow_color));
 }
 
 /*============================================================================
@@ -462,7 +384,9 @@ void EditorSprite::setFramePath(int frame_num, QString newpath)
   if(frame_num >= 0 && frame_num < frame_info.size())
   {
     frame_info[frame_num].path = QDir::toNativeSeparators(newpath);
-    frame_info[frame_num].image = QImage(newpath);
+    frame_info[frame_num].image =
+                           EditorImageStore::getShared()->getImage(newpath);
+    frame_info[frame_num].pending = false;
 
     emit spriteChanged();
   }
@@ -687,6 +611,26 @@ int EditorSprite::getActiveFrameIndex()
   return active_frame;
 }
 
+/*
+ * Description: Returns the frame index the animation shows at the clock time.
+ *              Each frame is shown for the animation time, in the sprite
+ *              direction, looping. If the sprite does not animate, this is the
+ *              active frame.
+ *
+ * Inputs: qint64 time - the animation clock time, in ms
+ * Output: int - the frame index
+ */
+int EditorSprite::getAnimationFrame(qint64 time)
+{
+  if(!isAnimated() || time < 0)
+    return active_frame;
+
+  int index = (time / sprite.getAnimationTimeMs()) % frame_info.size();
+  if(sprite.getAnimationSequence() == core::Sequence::REVERSE)
+    index = frame_info.size() - 1 - index;
+  return index;
+}
+
 /*
  * Description: Gets the frame angle
  *
@@ -706,6 +650,29 @@ int EditorSprite::getFrameAngle(int frame_num)
   return 0;
 }
 
+/*
+ * Description: Returns the frame image and all the sprite mods that apply to
+ *              it, for rendering with renderFrame(). The image is shared, not
+ *              copied.
+ *
+ * Inputs: int frame_num - the frame index
+ * Output: FrameRender - the frame render data. Null image if out of range
+ */
+FrameRender EditorSprite::getFrameRender(int frame_num)
+{
+  FrameRender frame;
+  frame.image = getImage(frame_num);
+  frame.hflip = getHorizontalFlip(frame_num);
+  frame.vflip = getVerticalFlip(frame_num);
+  frame.angle = getFrameAngle(frame_num) + sprite.getRotationDegrees();
+  frame.brightness = getBrightness();
+  frame.color_b = getColorBlue();
+  frame.color_g = getColorGreen();
+  frame.color_r = getColorRed();
+  frame.opacity = getOpacity() / kREF_RGB;
+  return frame;
+}
+
 /*
  * Description: Gets the frame horizonal flip
  *
@@ -739,7 +706,10 @@ int EditorSprite::getID() const
 QImage EditorSprite::getImage(int frame_num)
 {
   if(frame_num >= 0 && frame_num < frame_info.size())
+  {
+    resolveFrame(frame_num);
     return frame_info[frame_num].image;
+  }
   return QImage();
 }
 
@@ -755,8 +725,11 @@ int EditorSprite::getLastValidFrame()
   int last_valid = -1;
 
   for(int i = 0; i < frame_info.size(); i++)
+  {
+    resolveFrame(i);
     if(!frame_info[i].image.isNull())
       last_valid = i;
+  }
 
   return last_valid;
 }
@@ -801,17 +774,22 @@ QString EditorSprite::getPath(int frame_num)
  * Description: Returns the set of paths as a simplified representation of the
  *              frames within the sprite. The stack includes a string pair
  *              where the first is the frame delimiter (what simplifications it
- *              has) and the second is the actual path.
+ *              has) and the second is the actual path. While exporting into
+ *              an atlas, each frame is its own atlas path. For the game, sheet
+ *              regions not in an atlas are written out as their own files,
+ *              since region paths are only understood by the editor.
  *
- * Inputs: none
+ * Inputs: bool game_only - true if the paths are for the game. Default false
  * Output: QList<QPair<QString,QString>> - the returned path list
  */
-QList<QPair<QString,QString>> EditorSprite::getPathSet()
+QList<QPair<QString,QString>> EditorSprite::getPathSet(bool game_only)
 {
   QList<QPair<QString,QString>> frame_stack;
 
   /* Try to execute a smart parse first */
-  int index = getSmartCount();
+  int index = 0;
+  if(!EditorAtlas::isExporting())
+    index = getSmartCount();
 
   if(index > 0)
   {
@@ -826,13 +804,34 @@ QList<QPair<QString,QString>> EditorSprite::getPathSet()
   /* Finally, proceed to add all remaining tiles */
   for(int i = index; i < frame_info.size(); i++)
   {
+    QString path = EditorAtlas::getExportPath(frame_info[i].path);
+    if(game_only && path == frame_info[i].path)
+      EditorImageStore::getShared()->saveRegion(path, &path);
     frame_stack.push_back(QPair<QString,QString>(getFrameMods(i),
-                                EditorHelpers::trimPath(frame_info[i].path)));
+                                EditorHelpers::trimPath(path)));
   }
 
   return frame_stack;
 }
 
+/*
+ * Description: Returns the image files of the frames in the sprite. Sheet
+ *              region paths give their sheet file.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorSprite::getPaths() const
+{
+  QStringList paths;
+
+  for(int i = 0; i < frame_info.size(); i++)
+    if(!frame_info[i].path.isEmpty())
+      paths.push_back(EditorImageStore::splitRegionPath(frame_info[i].path));
+
+  return paths;
+}
+
 /*
  * Description: Returns the pixmap of the given frame index scaled with the
  *              sprite settings.
@@ -854,7 +853,7 @@ QPixmap EditorSprite::getPixmap(int index, int w, int h)
 
 /*
  * Description: Returns the number of frames at the start of the sprite that
- *              can be lumped together.
+ *              can be lumped together. Sheet regions are never lumped.
  *
  * Inputs: none
  * Output: int - a count of number of frames to lump together. 0 if none
@@ -864,8 +863,9 @@ int EditorSprite::getSmartCount()
   bool finished = false;
   int png_width = 4;
 
-  /* Only proceed checks if there is more than one frame */
-  if(frame_info.size() > 1)
+  /* Only proceed checks if there is more than one file frame */
+  if(frame_info.size() > 1 &&
+     !EditorImageStore::isRegionPath(frame_info.front().path))
   {
     int size = frame_info.front().path.size();
     QString no_end = frame_info.front().path.left(size - png_width);
@@ -956,92 +956,111 @@ bool EditorSprite::isAllNull()
   bool all_null = true;
 
   for(int i = 0; all_null && (i < frame_info.size()); i++)
+  {
+    resolveFrame(i);
     if(!frame_info[i].image.isNull())
       all_null = false;
+  }
 
   return all_null;
 }
 
+/*
+ * Description: Returns true if the sprite animates, which needs more than one
+ *              frame and a frame time above 0.
+ *
+ * Inputs: none
+ * Output: bool - true if animated
+ */
+bool EditorSprite::isAnimated()
+{
+  return (frame_info.size() > 1 && sprite.getAnimationTimeMs() > 0);
+}
+
 /*
  * Description: Loads the game data from file.
  *
- * Inputs: XmlData data - the data struct from the XML
+ * Inputs: XmlData &data - the data struct from the XML
  *         int index - the offset index into the XML stack.
  * Output: none
  */
-void EditorSprite::load(core::XmlData data, int index)
+void EditorSprite::load(core::XmlData &data, int index)
 {
-  QString element = QString::fromStdString(data.getElement(index));
-  QStringList elements = element.split("_");
+  std::string element = data.getElement(index);
+  EditorEnumDb::XmlTag tag = EditorHelpers::getXmlTag(element);
 
-  if(element == "name")
-  {
-    setName(QString::fromStdString(data.getDataString()));
-  }
-  else if(element == "animation")
-  {
-    setAnimationTime(QString::number(data.getDataInteger()));
-  }
-  else if(element == "rotation")
-  {
-    setRotation(QString::number(data.getDataFloat()));
-  }
-  else if(element == "brightness")
-  {
-    setBrightness(static_cast<int>(data.getDataFloat() * kREF_RGB));
-  }
-  else if(element == "color_r")
-  {
-    setColorRed(data.getDataInteger());
-  }
-  else if(element == "color_g")
-  {
-    setColorGreen(data.getDataInteger());
-  }
-  else if(element == "color_b")
-  {
-    setColorBlue(data.getDataInteger());
-  }
-  else if(element == "opacity")
-  {
-    setOpacity(data.getDataInteger());
-  }
-  else if(element == "forward")
-  {
-    if(data.getDataBoolean())
-      setDirectionForward();
-    else
-      setDirectionReverse();
-  }
-  else if(elements.front() == "path")
+  /* Paths with frame adjustments are "path_" and the adjustments */
+  if(tag == EditorEnumDb::XML_NONE && element.compare(0, 5, "path_") == 0)
+    tag = EditorEnumDb::XML_PATH;
+
+  switch(tag)
   {
-    /* Add the path(s) */
-    int start_point = frameCount();
-    addPath(EditorHelpers::getProjectDir() + QDir::separator() +
-            QString::fromStdString(data.getDataString()));
-    int end_point = frameCount();
-
-    /* Add adjustments */
-    for(int i = 0; i < elements.size(); i++)
+    case EditorEnumDb::XML_NAME:
+      setName(QString::fromStdString(data.getDataString()));
+      break;
+    case EditorEnumDb::XML_ANIMATION:
+      setAnimationTime(QString::number(data.getDataInteger()));
+      break;
+    case EditorEnumDb::XML_ROTATION:
+      setRotation(QString::number(data.getDataFloat()));
+      break;
+    case EditorEnumDb::XML_BRIGHTNESS:
+      setBrightness(static_cast<int>(data.getDataFloat() * kREF_RGB));
+      break;
+    case EditorEnumDb::XML_COLOR_R:
+      setColorRed(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_COLOR_G:
+      setColorGreen(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_COLOR_B:
+      setColorBlue(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_OPACITY:
+      setOpacity(data.getDataInteger());
+      break;
+    case EditorEnumDb::XML_FORWARD:
+      if(data.getDataBoolean())
+        setDirectionForward();
+      else
+        setDirectionReverse();
+      break;
+    case EditorEnumDb::XML_PATH:
     {
-      for(int j = start_point; j < end_point; j++)
+      /* Add the path(s) */
+      int start_point = frameCount();
+      addPath(EditorHelpers::getProjectDir() + QDir::separator() +
+              QString::fromStdString(data.getDataString()));
+      int end_point = frameCount();
+
+      /* Add adjustments, from each "_" split of the element */
+      size_t split = element.find('_');
+      while(split != std::string::npos)
       {
-        if(elements[i] == "hf")
-          frame_info[j].hflip = true;
-        else if(elements[i] == "vf")
-          frame_info[j].vflip = true;
-        else if(elements[i] == "90")
-          frame_info[j].rotate90 = true;
-        else if(elements[i] == "180")
-          frame_info[j].rotate180 = true;
-        else if(elements[i] == "270")
-          frame_info[j].rotate270 = true;
+        size_t next = element.find('_', split + 1);
+        std::string adjust = element.substr(split + 1, next - split - 1);
+        for(int j = start_point; j < end_point; j++)
+        {
+          if(adjust == "hf")
+            frame_info[j].hflip = true;
+          else if(adjust == "vf")
+            frame_info[j].vflip = true;
+          else if(adjust == "90")
+            frame_info[j].rotate90 = true;
+          else if(adjust == "180")
+            frame_info[j].rotate180 = true;
+          else if(adjust == "270")
+            frame_info[j].rotate270 = true;
+        }
+        split = next;
       }
+      break;
     }
-  }
-  else if(element == "sound_id")
-  {
-    setSoundID(data.getDataInteger());
+    case EditorEnumDb::XML_SOUND_ID:
+      setSoundID(data.getDataInteger());
+      break;
+    default:
+      break;
   }
 }
 
@@ -1136,6 +1155,43 @@ bool EditorSprite::paint(int index, QPainter* painter, int x, int y,
   return false;
 }
 
+/*
+ * Description: Replaces the frame paths that are in the remap with their
+ *              remapped path, keeping the frame mods. Sheet region paths are
+ *              remapped by their sheet file. The images come from the image
+ *              store, so remapped frames share the decoded image.
+ *
+ * Inputs: const QHash<QString,QString> &remap - new paths, by old path
+ * Output: int - the number of frames remapped
+ */
+int EditorSprite::remapPaths(const QHash<QString,QString> &remap)
+{
+  int count = 0;
+
+  for(int i = 0; i < frame_info.size(); i++)
+  {
+    QRect rect;
+    QString file = QDir::fromNativeSeparators(
+                  EditorImageStore::splitRegionPath(frame_info[i].path, &rect));
+    if(remap.contains(file))
+    {
+      QString path = remap.value(file);
+      if(!rect.isNull())
+        path = EditorImageStore::getRegionPath(path, rect);
+
+      frame_info[i].path = QDir::toNativeSeparators(path);
+      frame_info[i].image =
+               EditorImageStore::getShared()->getImage(frame_info[i].path);
+      frame_info[i].pending = false;
+      count++;
+    }
+  }
+
+  if(count > 0)
+    emit spriteChanged();
+  return count;
+}
+
 /*
  * Description: Saves the data of this sprite to the file handler pointer.
  *              Game only toggle removes editor only data.
@@ -1205,7 +1261,7 @@ void EditorSprite::save(core::XmlWriter* writer, bool game_only, bool core_only,
     /* Write frame data */
     if(!core_only)
     {
-      QList<QPair<QString,QString>> frame_set = getPathSet();
+      QList<QPair<QString,QString>> frame_set = getPathSet(game_only);
       for(int i = 0; i < frame_set.size(); i++)
         writer->writeData(frame_set[i].first.toStdString(),
                           frame_set[i].second.toStdString());
@@ -1270,10 +1326,8 @@ void EditorSprite::setPath(int index, QString path)
 {
   FrameInfo info;
   info.path = QDir::toNativeSeparators(path);
-  if(path.isEmpty())
-    info.image = QImage();
-  else
-    info.image = QImage(path);
+  info.image = EditorImageStore::getShared()->getImage(info.path,
+                                                       &info.pending);
   info.hflip = false;
   info.vflip = false;
   info.rotate90 = false;
@@ -1300,6 +1354,183 @@ void EditorSprite::setSoundID(int id)
   sprite.setSoundId(id);
 }
 
+/*============================================================================
+ * PUBLIC STATIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns the frame image files used by all constructed sprites,
+ *              which covers every sprite, matrix and image in the project,
+ *              including the working copies of the open editors. Sheet region
+ *              paths give their sheet file.
+ *
+ * Inputs: none
+ * Output: QStringList - the image file paths, one per frame that uses it
+ */
+QStringList EditorSprite::getLivePaths()
+{
+  QStringList paths;
+
+  for(auto it = live_sprites.constBegin(); it != live_sprites.constEnd(); it++)
+    paths += (*it)->getPaths();
+
+  return paths;
+}
+
+/*
+ * Description: Replaces the frame paths in the remap, in all constructed
+ *              sprites. See remapPaths().
+ *
+ * Inputs: const QHash<QString,QString> &remap - new paths, by old path
+ * Output: int - the number of frames remapped
+ */
+int EditorSprite::remapLivePaths(const QHash<QString,QString> &remap)
+{
+  int count = 0;
+
+  for(auto it = live_sprites.constBegin(); it != live_sprites.constEnd(); it++)
+    count += (*it)->remapPaths(remap);
+
+  return count;
+}
+
+/*
+ * Description: Returns the transformed image of the frame, with all the
+ *              sprite mods (flips, rotation, brightness and color). Only uses
+ *              the frame data, so it is safe to call off the GUI thread.
+ *
+ * Inputs: const FrameRender &frame - the frame and its sprite mods
+ *         int w - the width of the image
+ *         int h - the height of the image
+ *         bool shadow - render as shadow. false by default
+ *         QColor shadow_color - the color to render the shadow if true
+ * Output: QImage - the transformed image
+ */
+QImage EditorSprite::renderFrame(const FrameRender &frame, int w, int h,
+                                 bool shadow, QColor shadow_color)
+{
+  QTransform transform;
+  qreal m11 = transform.m11();    /* Horizontal scaling */
+  qreal m12 = transform.m12();    /* Vertical shearing */
+  qreal m13 = transform.m13();    /* Horizontal Projection */
+  qreal m21 = transform.m21();    /* Horizontal shearing */
+  qreal m22 = transform.m22();    /* vertical scaling */
+  qreal m23 = transform.m23();    /* Vertical Projection */
+  qreal m31 = transform.m31();    /* Horizontal Position (DX) */
+  qreal m32 = transform.m32();    /* Vertical Position (DY) */
+  qreal m33 = transform.m33();    /* Addtional Projection Factor */
+
+  /* Execute horizontal flip */
+  if(frame.hflip)
+  {
+    qreal scale = m11;
+
+    m11 = -m11;
+
+    /* Re-position back to origin */
+    if(m31 > 0)
+      m31 = 0;
+    else
+      m31 = (w * scale);
+  }
+
+  /* Execute vertical flip */
+  if(frame.vflip)
+  {
+    qreal scale = m22;
+    m22 = -m22;
+
+    /* Re-position back to origin */
+    if(m32 > 0)
+      m32 = 0;
+    else
+      m32 = (h * scale);
+  }
+
+  /* Transform */
+  transform.setMatrix(m11, m12, m13, m21, m22, m23, m31, m32, m33);
+  transform.rotate(frame.angle);
+
+  /* Modify brightness and color values */
+  QImage editing_image = frame.image;
+  QColor old_color;
+  int r_mod = frame.color_r;
+  int g_mod = frame.color_g;
+  int b_mod = frame.color_b;
+  int r,g,b;
+
+  for(int i = 0; i < editing_image.width(); i++)
+  {
+    for(int j = 0; j < editing_image.height(); j++)
+    {
+      if(qAlpha(editing_image.pixel(i, j)) > 0)
+      {
+        if(shadow)
+        {
+          r = shadow_color.red();
+          g = shadow_color.green();
+          b = shadow_color.blue();
+        }
+        else
+        {
+          old_color = QColor(editing_image.pixel(i, j));
+          r = old_color.red();
+          g = old_color.green();
+          b = old_color.blue();
+
+          /* Brightness value */
+          float delta_mod = (frame.brightness / kREF_RGB);
+          if(delta_mod < 1.0)
+          {
+            r *= delta_mod;
+            g *= delta_mod;
+            b *= delta_mod;
+          }
+          else if(delta_mod > 1.0)
+          {
+            int bright_value = frame.brightness - kREF_RGB;
+            r += bright_value;
+            g += bright_value;
+            b += bright_value;
+
+            /* Bound the values */
+            r = qBound(0, r, (int)kREF_RGB);
+            g = qBound(0, g, (int)kREF_RGB);
+            b = qBound(0, b, (int)kREF_RGB);
+          }
+
+          /* Then, modify the color */
+          r *= (r_mod / kREF_RGB);
+          g *= (g_mod / kREF_RGB);
+          b *= (b_mod / kREF_RGB);
+        }
+
+        editing_image.setPixel(i, j, qRgba(r, g, b,
+                                           qAlpha(editing_image.pixel(i, j))));
+      }
+    }
+  }
+
+  /* Return the image */
+  return editing_image.transformed(transform);
+}
+
+/*
+ * Description: Attaches the images of all the frames deferred while loading,
+ *              in all constructed sprites. Called after the image store ends
+ *              the deferred decode, while the decoded images are pinned, so
+ *              none are decoded again on the GUI thread.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorSprite::resolveLiveFrames()
+{
+  for(auto it = live_sprites.constBegin(); it != live_sprites.constEnd(); it++)
+    for(int i = 0; i < (*it)->frame_info.size(); i++)
+      (*it)->resolveFrame(i);
+}
+
 /*=============================================================================
  * OPERATOR FUNCTIONS
  *============================================================================*/
@@ -28,11 +28,8 @@ EditorTile::EditorTile(int x, int y, TileIcons* icons)
   setAcceptHoverEvents(true);
 
   /* Class control */
-  hovered = false;
   tile.setStatus(Tile::ACTIVE);
-  visible_events = false;
-  visible_grid = true;
-  visible_passability = false;
+  visibility_info = NULL;
   x_pos = x;
   y_pos = y;
 
@@ -40,13 +37,10 @@ EditorTile::EditorTile(int x, int y, TileIcons* icons)
   TileRenderInfo temp;
   temp.sprite = NULL;
   temp.thing = NULL;
-  temp.visible = true;
 
   /* Prep editor sprites in tile */
   layer_base.sprite = NULL;
-  layer_base.visible = true;
   layer_enhancer.sprite = NULL;
-  layer_enhancer.visible = true;
   for(int i = 0; i < kLOWER_COUNT_MAX; i++)
     layers_lower.push_back(temp);
   for(int i = 0; i < kUPPER_COUNT_MAX; i++)
@@ -104,197 +98,143 @@ EditorTile::~EditorTile()
 }
 
 /*============================================================================
- * PROTECTED FUNCTIONS
+ * PRIVATE FUNCTIONS
  *===========================================================================*/
 
 /*
- * Description: The copy function that is called by any copying methods in the
- *              class. Utilized by the copy constructor and the copy operator.
+ * Description: Returns the sprites painted on the tile: the layer sprites and
+ *              the sprite of each thing (and child) that covers the tile.
  *
- * Inputs: const EditorTile &source - the reference tile class
- * Output: none
+ * Inputs: none
+ * Output: QList<EditorSprite*> - the painted sprites. May contain repeats
  */
-void EditorTile::copySelf(const EditorTile &source)
+QList<EditorSprite*> EditorTile::getRenderSprites()
 {
-  /* Copy normal variables */
-  hovered = false;
-  tile = source.tile;
-  visible_grid = source.visible_grid;
-  visible_passability = source.visible_passability;
-  x_pos = source.x_pos;
-  y_pos = source.y_pos;
-
-  /* Copy events */
-  setEventEnter(source.set_enter);
-  setEventExit(source.set_exit);
+  QList<EditorSprite*> sprites;
 
-  /* Copy base */
-  layer_base.sprite = source.layer_base.sprite;
-  layer_base.visible = source.layer_base.visible;
+  /* Layers */
+  if(layer_base.sprite != NULL)
+    sprites.push_back(layer_base.sprite);
+  if(layer_enhancer.sprite != NULL)
+    sprites.push_back(layer_enhancer.sprite);
+  for(int i = 0; i < layers_lower.size(); i++)
+    if(layers_lower[i].sprite != NULL)
+      sprites.push_back(layers_lower[i].sprite);
+  for(int i = 0; i < layers_upper.size(); i++)
+    if(layers_upper[i].sprite != NULL)
+      sprites.push_back(layers_upper[i].sprite);
 
-  /* Copy enhancer */
-  layer_enhancer.sprite = source.layer_enhancer.sprite;
-  layer_enhancer.visible = source.layer_enhancer.visible;
+  /* Things (and children) */
+  QList<EditorMapThing*> tile_things;
+  for(int i = 0; i < things.size(); i++)
+    tile_things.push_back(things[i].thing);
+  for(int i = 0; i < ios.size(); i++)
+    tile_things.push_back(ios[i].thing);
+  for(int i = 0; i < persons.size(); i++)
+    tile_things.push_back(persons[i].thing);
+  for(int i = 0; i < npcs.size(); i++)
+    tile_things.push_back(npcs[i].thing);
 
-  /* Copy lower */
-  for(int i = 0; i < layers_lower.size(); i++)
+  for(int i = 0; i < tile_things.size(); i++)
   {
-    layers_lower[i].sprite = source.layers_lower[i].sprite;
-    layers_lower[i].visible = source.layers_lower[i].visible;
+    if(tile_things[i] != NULL)
+    {
+      EditorSprite* sprite = getThingSprite(tile_things[i],
+                                            x_pos - tile_things[i]->getX(),
+                                            y_pos - tile_things[i]->getY());
+      if(sprite != NULL)
+        sprites.push_back(sprite);
+    }
   }
 
-  /* Copy upper */
-  for(int i = 0; i < layers_upper.size(); i++)
+  /* Only the top item is painted, from its top left */
+  if(items.size() > 0 && items.last().thing != NULL)
   {
-    layers_upper[i].sprite = source.layers_upper[i].sprite;
-    layers_upper[i].visible = source.layers_upper[i].visible;
+    EditorSprite* sprite = getThingSprite(items.last().thing, 0, 0);
+    if(sprite != NULL)
+      sprites.push_back(sprite);
   }
 
-  // TODO: ADD THING, PERSON, NPC, ITEM, AND IO. No, handled in map.
+  return sprites;
 }
 
 /*
- * Description: Returns if there is a valid hover IO, the active layer is
- *              a IO layer, and the placing pen is a IO placement.
+ * Description: Returns the frame of the thing to paint on the tile. Things
+ *              paint the base frame, unless the preview is animated and the
+ *              sprite of the thing on this tile animates.
  *
- * Inputs: none
- * Output: bool - true if the hover IO should be shown
+ * Inputs: EditorMapThing* thing - the thing on the tile
+ *         int offset_x - the offset from left of the sprite in the thing
+ *         int offset_y - the offset from top of the sprite in the thing
+ *         qint64 time - the animation clock time. Less than 0 if not animated
+ * Output: int - the frame index
  */
-bool EditorTile::isHoverIO()
+int EditorTile::getThingFrame(EditorMapThing* thing, int offset_x,
+                              int offset_y, qint64 time)
 {
-  if(hover_info->hover_tile != NULL && hover_info->active_io != NULL &&
-     hover_info->active_cursor == EditorEnumDb::BASIC &&
-     hover_info->active_layer == EditorEnumDb::IO &&
-     !hover_info->path_edit_mode)
+  if(time >= 0)
   {
-    return true;
+    EditorSprite* sprite = getThingSprite(thing, offset_x, offset_y);
+    if(sprite != NULL && sprite->isAnimated())
+      return sprite->getAnimationFrame(time);
   }
-  return false;
+  return 0;
 }
 
 /*
- * Description: Returns if there is a valid hover item, the active layer is
- *              a item layer, and the placing pen is an item placement.
+ * Description: Returns the sprite of the thing at the offset in its matrix.
  *
- * Inputs: none
- * Output: bool - true if the hover item should be shown
+ * Inputs: EditorMapThing* thing - the thing on the tile
+ *         int offset_x - the offset from left of the sprite in the thing
+ *         int offset_y - the offset from top of the sprite in the thing
+ * Output: EditorSprite* - the sprite. NULL if none
  */
-bool EditorTile::isHoverItem()
+EditorSprite* EditorTile::getThingSprite(EditorMapThing* thing, int offset_x,
+                                         int offset_y)
 {
-  if(hover_info->hover_tile == this && hover_info->active_item != NULL &&
-     hover_info->active_cursor == EditorEnumDb::BASIC &&
-     hover_info->active_layer == EditorEnumDb::ITEM &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
+  if(thing != NULL && thing->getMatrix() != NULL)
+    return thing->getMatrix()->getSprite(offset_x, offset_y);
+  return NULL;
 }
 
-/*
- * Description: Returns if there is a valid hover move thing.
- *
- * Inputs: none
- * Output: bool - true if the hover move thing should be shown
- */
-bool EditorTile::isHoverMove()
-{
-  if(hover_info->hover_tile != nullptr && hover_info->move_thing != nullptr &&
-     hover_info->active_cursor == EditorEnumDb::MOVE &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
-}
+/*============================================================================
+ * PROTECTED FUNCTIONS
+ *===========================================================================*/
 
 /*
- * Description: Returns if there is a valid hover npc, the active layer is
- *              a npc layer, and the placing pen is a npc placement.
+ * Description: The copy function that is called by any copying methods in the
+ *              class. Utilized by the copy constructor and the copy operator.
  *
- * Inputs: none
- * Output: bool - true if the hover npc should be shown
+ * Inputs: const EditorTile &source - the reference tile class
+ * Output: none
  */
-bool EditorTile::isHoverNPC()
+void EditorTile::copySelf(const EditorTile &source)
 {
-  if(hover_info->hover_tile != NULL && hover_info->active_npc != NULL &&
-     hover_info->active_cursor == EditorEnumDb::BASIC &&
-     hover_info->active_layer == EditorEnumDb::NPC &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
-}
+  /* Copy normal variables */
+  tile = source.tile;
+  visibility_info = source.visibility_info;
+  x_pos = source.x_pos;
+  y_pos = source.y_pos;
 
-/*
- * Description: Returns if there is a valid hover person, the active layer is
- *              a person layer, and the placing pen is a person placement.
- *
- * Inputs: none
- * Output: bool - true if the hover person should be shown
- */
-bool EditorTile::isHoverPerson()
-{
-  if(hover_info->hover_tile != NULL && hover_info->active_person != NULL &&
-     hover_info->active_cursor == EditorEnumDb::BASIC &&
-     hover_info->active_layer == EditorEnumDb::PERSON &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
-}
+  /* Copy events */
+  setEventEnter(source.set_enter);
+  setEventExit(source.set_exit);
 
-/*
- * Description: Returns if there is a valid hover sprite, the active layer is
- *              a sprite layer, and the placing pen is a sprite placement.
- *
- * Inputs: none
- * Output: bool - true if the hover sprite should be shown
- */
-bool EditorTile::isHoverSprite()
-{
-  if(hovered && hover_info->active_sprite != NULL &&
-     (hover_info->active_cursor == EditorEnumDb::BASIC ||
-      hover_info->active_cursor == EditorEnumDb::FILL ||
-      hover_info->active_cursor == EditorEnumDb::BLOCKPLACE) &&
-     (hover_info->active_layer == EditorEnumDb::BASE ||
-      hover_info->active_layer == EditorEnumDb::ENHANCER ||
-      hover_info->active_layer == EditorEnumDb::LOWER1 ||
-      hover_info->active_layer == EditorEnumDb::LOWER2 ||
-      hover_info->active_layer == EditorEnumDb::LOWER3 ||
-      hover_info->active_layer == EditorEnumDb::LOWER4 ||
-      hover_info->active_layer == EditorEnumDb::LOWER5 ||
-      hover_info->active_layer == EditorEnumDb::UPPER1 ||
-      hover_info->active_layer == EditorEnumDb::UPPER2 ||
-      hover_info->active_layer == EditorEnumDb::UPPER3 ||
-      hover_info->active_layer == EditorEnumDb::UPPER4 ||
-      hover_info->active_layer == EditorEnumDb::UPPER5) &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
-}
+  /* Copy base */
+  layer_base.sprite = source.layer_base.sprite;
 
-/*
- * Description: Returns if there is a valid hover thing, the active layer is
- *              a thing layer, and the placing pen is a thing placement.
- *
- * Inputs: none
- * Output: bool - true if the hover thing should be shown
- */
-bool EditorTile::isHoverThing()
-{
-  if(hover_info->hover_tile != NULL && hover_info->active_thing != NULL &&
-     hover_info->active_cursor == EditorEnumDb::BASIC &&
-     hover_info->active_layer == EditorEnumDb::THING &&
-     !hover_info->path_edit_mode)
-  {
-    return true;
-  }
-  return false;
+  /* Copy enhancer */
+  layer_enhancer.sprite = source.layer_enhancer.sprite;
+
+  /* Copy lower */
+  for(int i = 0; i < layers_lower.size(); i++)
+    layers_lower[i].sprite = source.layers_lower[i].sprite;
+
+  /* Copy upper */
+  for(int i = 0; i < layers_upper.size(); i++)
+    layers_upper[i].sprite = source.layers_upper[i].sprite;
+
+  // TODO: ADD THING, PERSON, NPC, ITEM, AND IO. No, handled in map.
 }
 
 /*============================================================================
@@ -321,7 +261,6 @@ bool EditorTile::addItem(EditorMapItem* item)
       TileRenderInfo temp;
       temp.sprite = NULL;
       temp.thing = item;
-      temp.visible = items.front().visible;
 
       items.push_back(temp);
     }
@@ -451,17 +390,6 @@ Tile* EditorTile::getGameTile()
   return &tile;
 }
 
-/*
- * Description: Returns the hover information for the tile.
- *
- * Inputs: none
- * Output: HoverInfo* - hover information struct reference. do not delete.
- */
-HoverInfo* EditorTile::getHoverInfo()
-{
-  return hover_info;
-}
-
 /*
  * Description: Returns the map IO pointer for the IO at the rendering
  *              level.
@@ -760,25 +688,22 @@ bool EditorTile::getPassabilityVisible(Direction direction)
 {
   bool passable = true;
 
-  if(layer_base.visible)
+  if(getVisibility(EditorEnumDb::BASE))
     passable &= getPassability(EditorEnumDb::BASE, direction);
-  if(layers_lower[0].visible)
-    passable &= getPassability(EditorEnumDb::LOWER1, direction);
-  if(layers_lower[1].visible)
-    passable &= getPassability(EditorEnumDb::LOWER2, direction);
-  if(layers_lower[2].visible)
-    passable &= getPassability(EditorEnumDb::LOWER3, direction);
-  if(layers_lower[3].visible)
-    passable &= getPassability(EditorEnumDb::LOWER4, direction);
-  if(layers_lower[4].visible)
-    passable &= getPassability(EditorEnumDb::LOWER5, direction);
-  if(things[0].visible)
+  for(int i = 0; i < kLOWER_COUNT_MAX; i++)
+  {
+    EditorEnumDb::Layer layer =
+                           (EditorEnumDb::Layer)((int)EditorEnumDb::LOWER1 + i);
+    if(getVisibility(layer))
+      passable &= getPassability(layer, direction);
+  }
+  if(getVisibility(EditorEnumDb::THING))
     passable &= getPassability(EditorEnumDb::THING, direction);
-  if(ios[0].visible)
+  if(getVisibility(EditorEnumDb::IO))
     passable &= getPassability(EditorEnumDb::IO, direction);
-  if(persons[0].visible)
+  if(getVisibility(EditorEnumDb::PERSON))
     passable &= getPassability(EditorEnumDb::PERSON, direction);
-  if(npcs[0].visible)
+  if(getVisibility(EditorEnumDb::NPC))
     passable &= getPassability(EditorEnumDb::NPC, direction);
 
   return passable;
@@ -947,123 +872,56 @@ EditorMapThing* EditorTile::getThingTop(EditorEnumDb::Layer layer)
 }
 
 /*
- * Description: Returns the visibility of the passed in layer.
+ * Description: Returns the visibility of the passed in layer. Read from the
+ *              map level visibility information, visible if none is set.
  *
  * Inputs: EditorEnumDb::Layer layer - the layer to get visibility for
  * Output: bool - true if that layer is visible
  */
 bool EditorTile::getVisibility(EditorEnumDb::Layer layer)
 {
-  if(layer == EditorEnumDb::BASE)
-    return layer_base.visible;
-  else if(layer == EditorEnumDb::ENHANCER)
-    return layer_enhancer.visible;
-  else if(layer == EditorEnumDb::LOWER1)
-    return layers_lower[0].visible;
-  else if(layer == EditorEnumDb::LOWER2)
-    return layers_lower[1].visible;
-  else if(layer == EditorEnumDb::LOWER3)
-    return layers_lower[2].visible;
-  else if(layer == EditorEnumDb::LOWER4)
-    return layers_lower[3].visible;
-  else if(layer == EditorEnumDb::LOWER5)
-    return layers_lower[4].visible;
-  else if(layer == EditorEnumDb::UPPER1)
-    return layers_upper[0].visible;
-  else if(layer == EditorEnumDb::UPPER2)
-    return layers_upper[1].visible;
-  else if(layer == EditorEnumDb::UPPER3)
-    return layers_upper[2].visible;
-  else if(layer == EditorEnumDb::UPPER4)
-    return layers_upper[3].visible;
-  else if(layer == EditorEnumDb::UPPER5)
-    return layers_upper[4].visible;
+  if(visibility_info != NULL && layer >= EditorEnumDb::BASE &&
+     layer < EditorEnumDb::NO_LAYER)
+    return visibility_info->layers[layer];
   return true;
 }
 
 /*
- * Description: Returns the visibility of the IO render level
- *
- * Inputs: int render_level - the render level to acquire the visibility
- * Output: bool - true if the IO layer is visible
- */
-bool EditorTile::getVisibilityIO(int render_level)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-    return ios[render_level].visible;
-  return false;
-}
-
-/*
- * Description: Returns the visibility of the item stack
+ * Description: Returns if the event notifiers are visible on the tile.
  *
  * Inputs: none
- * Output: bool - true if the item stack is visible
- */
-bool EditorTile::getVisibilityItems()
-{
-  return items.front().visible;
-}
-
-/*
- * Description: Returns the visibility of the npc render level
- *
- * Inputs: int render_level - the render level to acquire the visibility
- * Output: bool - true if the npc layer is visible
- */
-bool EditorTile::getVisibilityNPC(int render_level)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-    return npcs[render_level].visible;
-  return false;
-}
-
-/*
- * Description: Returns the visibility of the person render level
- *
- * Inputs: int render_level - the render level to acquire the visibility
- * Output: bool - true if the person layer is visible
- */
-bool EditorTile::getVisibilityPerson(int render_level)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-    return persons[render_level].visible;
-  return false;
-}
-
-/*
- * Description: Returns the visibility of the thing render level
- *
- * Inputs: int render_level - the render level to acquire the visibility
- * Output: bool - true if the thing layer is visible
+ * Output: bool - true if event notifiers are visible
  */
-bool EditorTile::getVisibilityThing(int render_level)
+bool EditorTile::getVisibilityEvents()
 {
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-    return things[render_level].visible;
+  if(visibility_info != NULL)
+    return visibility_info->events;
   return false;
 }
 
 /*
- * Description: Returns if the event notifiers are visible on the tile.
+ * Description: Returns if the grid is visible on the tile.
  *
  * Inputs: none
- * Output: bool - true if event notifiers are visible
+ * Output: bool - true if grid is visible
  */
-bool EditorTile::getVisibilityEvents()
+bool EditorTile::getVisibilityGrid()
 {
-  return visible_events;
+  if(visibility_info != NULL)
+    return visibility_info->grid;
+  return true;
 }
 
 /*
- * Description: Returns if the grid is visible on the tile.
+ * Description: Returns the visibility information struct, shared by all tiles
+ *              in the map.
  *
  * Inputs: none
- * Output: bool - true if grid is visible
+ * Output: VisibilityInfo* - the visibility information pointer
  */
-bool EditorTile::getVisibilityGrid()
+VisibilityInfo* EditorTile::getVisibilityInfo()
 {
-  return visible_grid;
+  return visibility_info;
 }
 
 /*
@@ -1074,7 +932,9 @@ bool EditorTile::getVisibilityGrid()
  */
 bool EditorTile::getVisibilityPass()
 {
-  return visible_passability;
+  if(visibility_info != NULL)
+    return visibility_info->passability;
+  return false;
 }
 
 /*
@@ -1099,6 +959,42 @@ int EditorTile::getY()
   return y_pos;
 }
 
+/*
+ * Description: Returns true if any sprite painted on the tile animates. Used
+ *              to build the index of animated tiles on each sub-map.
+ *
+ * Inputs: none
+ * Output: bool - true if animated
+ */
+bool EditorTile::isAnimated()
+{
+  QList<EditorSprite*> sprites = getRenderSprites();
+  for(int i = 0; i < sprites.size(); i++)
+    if(sprites[i]->isAnimated())
+      return true;
+  return false;
+}
+
+/*
+ * Description: Returns true if any animated sprite on the tile shows a
+ *              different frame at the two clock times, so the tile only needs
+ *              a repaint when its content changes.
+ *
+ * Inputs: qint64 from_time - the previous clock time painted, in ms
+ *         qint64 to_time - the new clock time, in ms
+ * Output: bool - true if the painted frames changed
+ */
+bool EditorTile::isAnimationChanged(qint64 from_time, qint64 to_time)
+{
+  QList<EditorSprite*> sprites = getRenderSprites();
+  for(int i = 0; i < sprites.size(); i++)
+    if(sprites[i]->isAnimated() &&
+       sprites[i]->getAnimationFrame(from_time) !=
+       sprites[i]->getAnimationFrame(to_time))
+      return true;
+  return false;
+}
+
 /*
  * Description: Returns true if the enter event set is a valid event and is not
  *              empty.
@@ -1135,55 +1031,21 @@ void EditorTile::paint(QPainter *painter,
   int size = EditorHelpers::getTileSize();
   QRect bound(x_pos * size, y_pos * size, size, size);
 
-  /* Determine if it's a hover thing - special state */
-  int diff_x = 0;
-  int diff_y = 0;
-  bool hover_io = isHoverIO();
-  bool hover_item = isHoverItem();
-  bool hover_move = isHoverMove();
-  bool hover_npc = isHoverNPC();
-  bool hover_person = isHoverPerson();
-  bool hover_sprite = isHoverSprite();
-  bool hover_thing = isHoverThing();
-  if(hover_thing || hover_io || hover_person || hover_npc || hover_move)
-  {
-    diff_x = x_pos - hover_info->hover_tile->getX();
-    diff_y = y_pos - hover_info->hover_tile->getY();
-
-    /* Use the differential to make sure the sprite is valid */
-    if(hover_thing && hover_info->active_thing->isAllNull(diff_x, diff_y))
-      hover_thing = false;
-    if(hover_io && hover_info->active_io->isAllNull(diff_x, diff_y))
-      hover_io = false;
-    else if(hover_move && hover_info->move_thing->isAllNull(diff_x, diff_y))
-      hover_move = false;
-    if(hover_person && hover_info->active_person->isAllNull(diff_x, diff_y))
-      hover_person = false;
-    if(hover_npc && hover_info->active_npc->isAllNull(diff_x, diff_y))
-      hover_npc = false;
-  }
+  /* The animation clock time, if the preview is animated */
+  qint64 time = -1;
+  if(visibility_info != NULL && visibility_info->animate)
+    time = visibility_info->animate_time;
 
   /* Render the base */
-  if(layer_base.visible &&
-     (!hovered || hover_info->active_layer != EditorEnumDb::BASE ||
-      hover_info->active_cursor != EditorEnumDb::ERASER))
-  {
-    if(hover_sprite && hover_info->active_layer == EditorEnumDb::BASE)
-      hover_info->active_sprite->paint(painter, bound);
-    else if(layer_base.sprite != NULL)
-      layer_base.sprite->paint(painter, bound);
-  }
+  if(getVisibility(EditorEnumDb::BASE) && layer_base.sprite != NULL)
+    layer_base.sprite->paint(layer_base.sprite->getAnimationFrame(time),
+                             painter, bound);
 
   /* Render the enhancer */
-  if(layer_enhancer.visible &&
-     (!hovered || hover_info->active_layer != EditorEnumDb::ENHANCER ||
-      hover_info->active_cursor != EditorEnumDb::ERASER))
-  {
-    if(hover_sprite && hover_info->active_layer == EditorEnumDb::ENHANCER)
-      hover_info->active_sprite->paint(painter, bound);
-    else if(layer_enhancer.sprite != NULL)
-      layer_enhancer.sprite->paint(painter, bound);
-  }
+  if(getVisibility(EditorEnumDb::ENHANCER) && layer_enhancer.sprite != NULL)
+    layer_enhancer.sprite->paint(
+                      layer_enhancer.sprite->getAnimationFrame(time),
+                      painter, bound);
 
   /* Render the lower */
   for(int i = 0; i < layers_lower.size(); i++)
@@ -1191,242 +1053,95 @@ void EditorTile::paint(QPainter *painter,
     EditorEnumDb::Layer layer =
                            (EditorEnumDb::Layer)((int)EditorEnumDb::LOWER1 + i);
 
-    if(layers_lower[i].visible &&
-       (!hovered || hover_info->active_layer != layer ||
-        hover_info->active_cursor != EditorEnumDb::ERASER))
-    {
-      if(hover_sprite && hover_info->active_layer == layer)
-        hover_info->active_sprite->paint(painter, bound);
-      else if(layers_lower[i].sprite != NULL)
-        layers_lower[i].sprite->paint(painter, bound);
-    }
+    if(getVisibility(layer) && layers_lower[i].sprite != NULL)
+      layers_lower[i].sprite->paint(
+                        layers_lower[i].sprite->getAnimationFrame(time),
+                        painter, bound);
   }
 
   /* Render the things (and children) */
+  bool visible_io = getVisibility(EditorEnumDb::IO);
+  bool visible_item = getVisibility(EditorEnumDb::ITEM);
+  bool visible_npc = getVisibility(EditorEnumDb::NPC);
+  bool visible_person = getVisibility(EditorEnumDb::PERSON);
+  bool visible_thing = getVisibility(EditorEnumDb::THING);
   for(uint8_t i = 0; i < Helpers::getRenderDepth(); i++)
   {
     /* Paint the thing */
-    if(things[i].visible && things[i].thing != NULL)
-      things[i].thing->paint(0, painter, bound, x_pos - things[i].thing->getX(),
-                             y_pos - things[i].thing->getY());
+    if(visible_thing && things[i].thing != NULL)
+    {
+      int dx = x_pos - things[i].thing->getX();
+      int dy = y_pos - things[i].thing->getY();
+      things[i].thing->paint(getThingFrame(things[i].thing, dx, dy, time),
+                             painter, bound, dx, dy);
+    }
 
     /* Paint the io */
-    if(ios[i].visible && ios[i].thing != NULL)
-      ios[i].thing->paint(0, painter, bound, x_pos - ios[i].thing->getX(),
-                          y_pos - ios[i].thing->getY());
+    if(visible_io && ios[i].thing != NULL)
+    {
+      int dx = x_pos - ios[i].thing->getX();
+      int dy = y_pos - ios[i].thing->getY();
+      ios[i].thing->paint(getThingFrame(ios[i].thing, dx, dy, time),
+                          painter, bound, dx, dy);
+    }
 
     /* Paint the top item */
-    if(i == 0 && items.front().visible && items.last().thing != NULL)
-      items.last().thing->paint(0, painter, bound);
+    if(i == 0 && visible_item && items.last().thing != NULL)
+      items.last().thing->paint(getThingFrame(items.last().thing, 0, 0, time),
+                                painter, bound);
 
     /* Paint the person */
-    if(persons[i].visible && persons[i].thing != NULL)
-      persons[i].thing->paint(0, painter, bound,
-                              x_pos - persons[i].thing->getX(),
-                              y_pos - persons[i].thing->getY());
+    if(visible_person && persons[i].thing != NULL)
+    {
+      int dx = x_pos - persons[i].thing->getX();
+      int dy = y_pos - persons[i].thing->getY();
+      persons[i].thing->paint(getThingFrame(persons[i].thing, dx, dy, time),
+                              painter, bound, dx, dy);
+    }
 
     /* Paint the npc */
-    else if(npcs[i].visible && npcs[i].thing != NULL)
-      npcs[i].thing->paint(0, painter, bound,
-                           x_pos - npcs[i].thing->getX(),
-                           y_pos - npcs[i].thing->getY());
+    else if(visible_npc && npcs[i].thing != NULL)
+    {
+      int dx = x_pos - npcs[i].thing->getX();
+      int dy = y_pos - npcs[i].thing->getY();
+      npcs[i].thing->paint(getThingFrame(npcs[i].thing, dx, dy, time),
+                           painter, bound, dx, dy);
+    }
   }
 
-  /* If hover thing is true, render it */
-  if(hover_thing)
-    hover_info->active_thing->paint(painter, bound, diff_x, diff_y);
-  /* If hover npc is true, render it */
-  else if(hover_io)
-    hover_info->active_io->paint(painter, bound, diff_x, diff_y);
-  /* If hover item is true, render it */
-  else if(hover_item)
-    hover_info->active_item->paint(painter, bound);
-  /* If hover person is true, render it */
-  else if(hover_person)
-    hover_info->active_person->paint(painter, bound, diff_x, diff_y);
-  /* If hover npc is true, render it */
-  else if(hover_npc)
-    hover_info->active_npc->paint(painter, bound, diff_x, diff_y);
-  else if(hover_move)
-    hover_info->move_thing->paint(painter, bound, diff_x, diff_y);
-
   /* Render the upper */
   for(int i = 0; i < layers_upper.size(); i++)
   {
     EditorEnumDb::Layer layer =
                            (EditorEnumDb::Layer)((int)EditorEnumDb::UPPER1 + i);
 
-    if(layers_upper[i].visible &&
-       (!hovered || hover_info->active_layer != layer ||
-        hover_info->active_cursor != EditorEnumDb::ERASER))
-    {
-      if(hover_sprite && hover_info->active_layer == layer)
-        hover_info->active_sprite->paint(painter, bound);
-      else if(layers_upper[i].sprite != NULL)
-        layers_upper[i].sprite->paint(painter, bound);
-    }
+    if(getVisibility(layer) && layers_upper[i].sprite != NULL)
+      layers_upper[i].sprite->paint(
+                        layers_upper[i].sprite->getAnimationFrame(time),
+                        painter, bound);
   }
 
   /* Render the grid */
-  if(visible_grid)
+  if(getVisibilityGrid())
   {
-    QRect rect(bound.x() + 1, bound.y() + 1,
-                      bound.width() - 2, bound.height() - 2);
     painter->setPen(QColor(255, 255, 255, 128));
-    painter->drawRect(rect);
-
-    /* Thing border points */
-    int x1 = hover_info->selected_thing.x();
-    int y1 = hover_info->selected_thing.y();
-    int x2 = x1 + hover_info->selected_thing.width() - 1;
-    int y2 = y1 + hover_info->selected_thing.height() - 1;
-
-    /* Draw border */
-    if(x_pos >= x1 && x_pos <= x2 && y_pos >= y1 && y_pos <= y2)
-    {
-      painter->setPen(QColor(255, 255, 0, 255));
-      if(x_pos == x1)
-        painter->drawLine(rect.x(), rect.y(),
-                          rect.x(), rect.y() + rect.height());
-      if(x_pos == x2)
-        painter->drawLine(rect.x() + rect.width(), rect.y(),
-                          rect.x() + rect.width(), rect.y() + rect.height());
-      if(y_pos == y1)
-        painter->drawLine(rect.x(), rect.y(),
-                          rect.x() + rect.width(), rect.y());
-      if(y_pos == y2)
-        painter->drawLine(rect.x(), rect.y() + rect.height(),
-                          rect.x() + rect.width(), rect.y() + rect.height());
-    }
-  }
-  if(hovered)
-  {
-    QColor color(200, 200, 200, 128);
-    /* -- HOVER THING CONTROL -- */
-    if(hover_thing)
-    {
-      EditorMatrix* matrix = hover_info->active_thing->getMatrix();
-      int depth = matrix->getRenderDepth(diff_x, diff_y);
-
-      if(hovered_invalid || getThing(depth) != NULL)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    /* -- HOVER IO CONTROL -- */
-    if(hover_io)
-    {
-      EditorMatrix* matrix = hover_info->active_io->getMatrix();
-      int depth = matrix->getRenderDepth(diff_x, diff_y);
-
-      if(hovered_invalid || getIO(depth) != NULL)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    /* -- HOVER ITEM CONTROL -- */
-    else if(hover_item)
-    {
-      if(items.size() >= kMAX_ITEMS)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    /* -- HOVER PERSON CONTROL -- */
-    else if(hover_person)
-    {
-      EditorMatrix* matrix = hover_info->active_person->getMatrix();
-      int depth = matrix->getRenderDepth(diff_x, diff_y);
-
-      if(hovered_invalid || getPerson(depth) != NULL || getNPC(depth) != NULL)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    /* -- HOVER NPC CONTROL -- */
-    else if(hover_npc)
-    {
-      EditorMatrix* matrix = hover_info->active_npc->getMatrix();
-      int depth = matrix->getRenderDepth(diff_x, diff_y);
-
-      if(hovered_invalid || getPerson(depth) != NULL || getNPC(depth) != NULL)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    /* -- HOVER MOVE CONTROL -- */
-    else if(hover_move)
-    {
-      EditorMapThing* ref_thing = hover_info->move_thing;
-      int depth = ref_thing->getMatrix()->getRenderDepth(diff_x, diff_y);
-
-      /* Determine type and if valid */
-      bool invalid = hovered_invalid;
-      if(!invalid)
-      {
-        ThingBase type = hover_info->move_thing->getClass();
-        if(type == ThingBase::THING)
-          invalid = (getThing(depth) != NULL && getThing(depth) != ref_thing);
-        else if(type == ThingBase::INTERACTIVE)
-          invalid = (getIO(depth) != NULL && getIO(depth) != ref_thing);
-        else if(type == ThingBase::ITEM)
-          invalid = (items.size() >= kMAX_ITEMS);
-        else if(type == ThingBase::PERSON)
-          invalid = ((getPerson(depth) != NULL &&
-                      getPerson(depth) != ref_thing) || getNPC(depth) != NULL);
-        else if(type == ThingBase::NPC)
-          invalid = ((getNPC(depth) != NULL &&
-                      getNPC(depth) != ref_thing) || getPerson(depth) != NULL);
-      }
-
-      /* Final decision */
-      if(invalid)
-        color = QColor(200, 0, 0, 128);
-      else
-        color = QColor(0, 200, 0, 128);
-    }
-    painter->fillRect(x_pos * size + 1, y_pos * size + 1, size - 2, size - 2,
-                      color);
+    painter->drawRect(bound.x() + 1, bound.y() + 1,
+                      bound.width() - 2, bound.height() - 2);
   }
 
   /* Render the passability */
-  if(visible_passability && tile_icons != NULL)
+  if(getVisibilityPass() && tile_icons != NULL)
   {
-    /* North Passability */
-    if(getPassabilityVisible(Direction::NORTH))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passN);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassN);
-
-    /* East Passability */
-    if(getPassabilityVisible(Direction::EAST))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passE);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassE);
-
-    /* South Passability */
-    if(getPassabilityVisible(Direction::SOUTH))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passS);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassS);
-
-    /* West Passability */
-    if(getPassabilityVisible(Direction::WEST))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passW);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassW);
+    int pass_num = EditorHelpers::getPassabilityNum(
+                                  getPassabilityVisible(Direction::NORTH),
+                                  getPassabilityVisible(Direction::EAST),
+                                  getPassabilityVisible(Direction::SOUTH),
+                                  getPassabilityVisible(Direction::WEST));
+    EditorHelpers::paintPassability(painter, tile_icons, bound, pass_num);
   }
 
   /* Render the event notification */
-  if(visible_events)
+  if(getVisibilityEvents())
   {
     bool enter = isEventEnterSet();
     bool exit = isEventExitSet();
@@ -1447,21 +1162,6 @@ void EditorTile::paint(QPainter *painter,
   }
 }
 
-/*
- * Description: Places the currently selected sprite onto the active map layer.
- *              Only relevant if the tile is currently being hovered and the
- *              hover information has been set.
- *
- * Inputs: none
- * Output: bool - true if the sprite was changed
- */
-bool EditorTile::place()
-{
-  if(hovered && hover_info != NULL)
-    return place(hover_info->active_layer, hover_info->active_sprite);
-  return false;
-}
-
 /*
  * Description: Places the currently selected sprite onto the active map layer
  *
@@ -1567,48 +1267,6 @@ void EditorTile::setEventExit(EditorEventSet set)
   update();
 }
 
-/*
- * Description: Sets the hover state of the QGraphicsItem.
- *
- * Inputs: bool hover - is it being hovered on?
- *         bool hover_invalid - is the hovering tile un-setable (default false)
- * Output: none
- */
-void EditorTile::setHover(bool hover, bool hover_invalid)
-{
-  hovered = hover;
-  hovered_invalid = hover_invalid;
-  update();
-}
-
-/*
- * Description: Sets the hover info of the tile - pointer reference from
- *              EditorMap (this class will not delete it)
- *
- * Inputs: HoverInfo* new_info - a struct with the hover information
- * Output: none
- */
-void EditorTile::setHoverInfo(HoverInfo* new_info)
-{
-  hover_info = new_info;
-  update();
-}
-
-/*
- * Description: Sets the combined hover status and hover information.
- *
- * Inputs: bool hover - is it being hovered on?
- *         bool hover_invalid - is the hovering tile un-setable (default false)
- *         HoverInfo* new_info - a struct with the hover information
- * Output: none
- */
-void EditorTile::setHoverInfo(bool hover, bool hover_invalid,
-                              HoverInfo* new_info)
-{
-  setHover(hover, hover_invalid);
-  setHoverInfo(new_info);
-}
-
 /*
  * Description: Sets the io sprite pointer, stored within the class.
  *
@@ -1840,313 +1498,18 @@ void EditorTile::setTileIcons(TileIcons* icons)
 }
 
 /*
- * Description: Sets the visiblity based on the layer and visible status.
- *
- * Inputs: EditorEnumDb::Layer layer - the layer to modify visibility
- *         bool visible - is the layer visible?
- * Output: none
- */
-void EditorTile::setVisibility(EditorEnumDb::Layer layer, bool visible)
-{
-  if(layer == EditorEnumDb::BASE)
-    setVisibilityBase(visible);
-  else if(layer == EditorEnumDb::ENHANCER)
-    setVisibilityEnhancer(visible);
-  else if(layer == EditorEnumDb::LOWER1)
-    setVisibilityLower(0, visible);
-  else if(layer == EditorEnumDb::LOWER2)
-    setVisibilityLower(1, visible);
-  else if(layer == EditorEnumDb::LOWER3)
-    setVisibilityLower(2, visible);
-  else if(layer == EditorEnumDb::LOWER4)
-    setVisibilityLower(3, visible);
-  else if(layer == EditorEnumDb::LOWER5)
-    setVisibilityLower(4, visible);
-  else if(layer == EditorEnumDb::THING)
-    setVisibilityThing(visible);
-  else if(layer == EditorEnumDb::IO)
-    setVisibilityIO(visible);
-  else if(layer == EditorEnumDb::ITEM)
-    setVisibilityItems(visible);
-  else if(layer == EditorEnumDb::PERSON)
-    setVisibilityPerson(visible);
-  else if(layer == EditorEnumDb::NPC)
-    setVisibilityNPC(visible);
-  else if(layer == EditorEnumDb::UPPER1)
-    setVisibilityUpper(0, visible);
-  else if(layer == EditorEnumDb::UPPER2)
-    setVisibilityUpper(1, visible);
-  else if(layer == EditorEnumDb::UPPER3)
-    setVisibilityUpper(2, visible);
-  else if(layer == EditorEnumDb::UPPER4)
-    setVisibilityUpper(3, visible);
-  else if(layer == EditorEnumDb::UPPER5)
-    setVisibilityUpper(4, visible);
-}
-
-/*
- * Description: Sets the base layer visibility
- *
- * Input: Visibility toggle
- */
-void EditorTile::setVisibilityBase(bool toggle)
-{
-  layer_base.visible = toggle;
-  update();
-}
-
-/*
- * Description: Sets the enhancer layer visibility
- *
- * Input: Visibility toggle
- */
-void EditorTile::setVisibilityEnhancer(bool toggle)
-{
-  layer_enhancer.visible = toggle;
-  update();
-}
-
-/* Description: Sets the event notifier visibility.
- *
- * Inputs: bool toggle - notifier visibility
- * Output: none
- */
-void EditorTile::setVisibilityEvents(bool toggle)
-{
-  visible_events = toggle;
-  update();
-}
-
-/*
- * Description: Sets the visibility of all layers of the ios.
+ * Description: Sets the visibility information, shared by all tiles in the
+ *              map and read when painting.
  *
- * Inputs: bool visible - true if the io layers are visible
+ * Inputs: VisibilityInfo* new_info - a struct with the visibility information
  * Output: none
  */
-void EditorTile::setVisibilityIO(bool visible)
+void EditorTile::setVisibilityInfo(VisibilityInfo* new_info)
 {
-  for(int i = 0; i < ios.size(); i++)
-    ios[i].visible = visible;
+  visibility_info = new_info;
   update();
 }
 
-/*
- * Description: Sets the visibility of the render level of the io in tile.
- *
- * Inputs: int render_level - the render level to modify the visibility
- *         bool visible - true if the render level should be visible
- * Output: bool - true if the visibility was set
- */
-bool EditorTile::setVisibilityIO(int render_level, bool visible)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-  {
-    ios[render_level].visible = visible;
-    return true;
-  }
-  return false;
-}
-
-/*
- * Description: Sets the grid visibility
- *
- * Input: Visibility toggle
- * Output: none
- */
-void EditorTile::setVisibilityGrid(bool toggle)
-{
-  visible_grid = toggle;
-  update();
-}
-
-/*
- * Description: Sets the visibility of the stack of npcs.
- *
- * Inputs: bool visible - true if the item stack is visible
- * Output: none
- */
-void EditorTile::setVisibilityItems(bool visible)
-{
-  for(int i = 0; i < items.size(); i++)
-    items[i].visible = visible;
-  update();
-}
-
-/*
- * Description: Sets the lower layer visibility as per the index
- *
- * Input: Visibility toggle
- * Output: bool - success if set
- */
-bool EditorTile::setVisibilityLower(int index, bool toggle)
-{
-  if(index >= 0 && index < kLOWER_COUNT_MAX)
-  {
-    layers_lower[index].visible = toggle;
-    update();
-    return true;
-  }
-  return false;
-}
-
-/*
- * Description: Sets the visibility of all layers of the npcs.
- *
- * Inputs: bool visible - true if the npc layers are visible
- * Output: none
- */
-void EditorTile::setVisibilityNPC(bool visible)
-{
-  for(int i = 0; i < npcs.size(); i++)
-    npcs[i].visible = visible;
-  update();
-}
-
-/*
- * Description: Sets the visibility of the render level of the npc in tile.
- *
- * Inputs: int render_level - the render level to modify the visibility
- *         bool visible - true if the render level should be visible
- * Output: bool - true if the visibility was set
- */
-bool EditorTile::setVisibilityNPC(int render_level, bool visible)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-  {
-    npcs[render_level].visible = visible;
-    return true;
-  }
-  return false;
-}
-
-/*
- * Description: Sets the passability visibility
- *
- * Input: bool toggle - Visibility toggle
- * Output: none
- */
-void EditorTile::setVisibilityPass(bool toggle)
-{
-  visible_passability = toggle;
-  update();
-}
-
-/*
- * Description: Sets the visibility of all layers of the persons.
- *
- * Inputs: bool visible - true if the person layers are visible
- * Output: none
- */
-void EditorTile::setVisibilityPerson(bool visible)
-{
-  for(int i = 0; i < persons.size(); i++)
-    persons[i].visible = visible;
-  update();
-}
-
-/*
- * Description: Sets the visibility of the render level of the person in tile.
- *
- * Inputs: int render_level - the render level to modify the visibility
- *         bool visible - true if the render level should be visible
- * Output: bool - true if the visibility was set
- */
-bool EditorTile::setVisibilityPerson(int render_level, bool visible)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-  {
-    persons[render_level].visible = visible;
-    return true;
-  }
-  return false;
-}
-
-/*
- * Description: Sets the visibility of all layers of the thing.
- *
- * Inputs: bool visible - true if the thing layers are visible
- * Output: none
- */
-void EditorTile::setVisibilityThing(bool visible)
-{
-  for(int i = 0; i < things.size(); i++)
-    things[i].visible = visible;
-  update();
-}
-
-/*
- * Description: Sets the visibility of the render level of the things in tile.
- *
- * Inputs: int render_level - the render level to modify the visibility
- *         bool visible - true if the render level should be visible
- * Output: bool - true if the visibility was set
- */
-bool EditorTile::setVisibilityThing(int render_level, bool visible)
-{
-  if(render_level >= 0 && render_level < Helpers::getRenderDepth())
-  {
-    things[render_level].visible = visible;
-    return true;
-  }
-  return false;
-}
-
-/*
- * Description: Sets the visibility to mirror all the information in said
- *              reference tile.
- *
- * Inputs: EditorTile* ref - the reference to extract the information from
- * Output: none
- */
-void EditorTile::setVisibilityTile(EditorTile* ref)
-{
-  if(ref != nullptr)
-  {
-    /* Tile based visibility */
-    layer_base.visible = ref->layer_base.visible;
-    layer_enhancer.visible = ref->layer_enhancer.visible;
-    for(int i = 0; i < layers_lower.size(); i++)
-      layers_lower[i].visible = ref->layers_lower.front().visible;
-    for(int i = 0; i < layers_upper.size(); i++)
-      layers_upper[i].visible = ref->layers_upper.front().visible;
-    for(int i = 0; i < ios.size(); i++)
-      ios[i].visible = ref->ios.front().visible;
-    for(int i = 0; i < items.size(); i++)
-      items[i].visible = ref->items.front().visible;
-    for(int i = 0; i < npcs.size(); i++)
-      npcs[i].visible = ref->npcs.front().visible;
-    for(int i = 0; i < persons.size(); i++)
-      persons[i].visible = ref->persons.front().visible;
-    for(int i = 0; i < things.size(); i++)
-      things[i].visible = ref->things.front().visible;
-
-    /* Interface based visibility */
-    visible_events = ref->visible_events;
-    visible_grid = ref->visible_grid;
-    visible_passability = ref->visible_passability;
-
-    /* Finally update */
-    update();
-  }
-}
-
-/*
- * Description: Sets the upper layer visibility as per the index
- *
- * Input: Visibility toggle
- * Output: bool - success if set
- */
-bool EditorTile::setVisibilityUpper(int index, bool toggle)
-{
-  if(index >= 0 && index < kUPPER_COUNT_MAX)
-  {
-    layers_upper[index].visible = toggle;
-    update();
-    return true;
-  }
-  return false;
-}
-
 /*
  * Description: Removes the currently selected sprite onto the active map layer
  *
@@ -258,37 +258,12 @@ void EditorTileSprite::paint(QPainter* painter,
   if(visible_passability && tile_icons != NULL &&
      getRenderDepth() == 0 && frameCount() > 0 && !isAllNull())
   {
-    /* North Passability */
-    if(getPassability(core::Direction::NORTH))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passN);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassN);
-
-    /* East Passability */
-    if(getPassability(core::Direction::EAST))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passE);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassE);
-
-    /* South Passability */
-    if(getPassability(core::Direction::SOUTH))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passS);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassS);
-
-    /* West Passability */
-    if(getPassability(core::Direction::WEST))
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->passW);
-    else
-      painter->drawPixmap(x_pos * size, y_pos * size, size, size,
-                          *tile_icons->nopassW);
+    int pass_num = EditorHelpers::getPassabilityNum(
+                                  getPassability(core::Direction::NORTH),
+                                  getPassability(core::Direction::EAST),
+                                  getPassability(core::Direction::SOUTH),
+                                  getPassability(core::Direction::WEST));
+    EditorHelpers::paintPassability(painter, tile_icons, bound, pass_num);
   }
 
   /* Render the render depth value */
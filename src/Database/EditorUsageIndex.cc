@@ -0,0 +1,172 @@
+/*******************************************************************************
+ * Class Name: EditorUsageIndex
+ * Date Created: October 19, 2026
+ * Inheritance: none
+ * Description: Reverse reference index of the game objects (items, maps,
+ *              sounds, etc) to the referrers that use them (maps and parties).
+ *              Each referrer is replaced on its own when it changes, so the
+ *              index never needs to search the other referrers to stay current.
+ ******************************************************************************/
+#include "Database/EditorUsageIndex.h"
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The index is empty.
+ *
+ * Inputs: none
+ */
+EditorUsageIndex::EditorUsageIndex()
+{
+}
+
+/*
+ * Description: Destructor function
+ */
+EditorUsageIndex::~EditorUsageIndex()
+{
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Clears all referrers and references from the index.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void EditorUsageIndex::clear()
+{
+  names.clear();
+  references.clear();
+  users.clear();
+}
+
+/*
+ * Description: Returns the IDs of all referrers of the one view category (such
+ *              as maps) that use the object.
+ *
+ * Inputs: EditorEnumDb::UsageType type - the type of the used object
+ *         int id - the ID of the used object
+ *         EditorEnumDb::ViewMode view - the category of the referrers
+ * Output: QList<int> - the referrer IDs, in ascending order
+ */
+QList<int> EditorUsageIndex::getReferrers(EditorEnumDb::UsageType type, int id,
+                                          EditorEnumDb::ViewMode view) const
+{
+  QList<int> referrers;
+  QList<QPair<int,int>> keys = users.value(QPair<int,int>(type, id)).keys();
+  for(int i = 0; i < keys.size(); i++)
+    if(keys[i].first == view)
+      referrers.push_back(keys[i].second);
+  return referrers;
+}
+
+/*
+ * Description: Returns every place the object is used, as "referrer - where"
+ *              strings, grouped by referrer.
+ *
+ * Inputs: EditorEnumDb::UsageType type - the type of the used object
+ *         int id - the ID of the used object
+ *         int map_id - only this map, for map local IDs such as things. -1
+ *                      for all referrers
+ * Output: QStringList - the places used. Empty if unused
+ */
+QStringList EditorUsageIndex::getUsage(EditorEnumDb::UsageType type, int id,
+                                       int map_id) const
+{
+  QStringList usage;
+  QMap<QPair<int,int>, QStringList> found =
+                                        users.value(QPair<int,int>(type, id));
+
+  for(auto it = found.constBegin(); it != found.constEnd(); it++)
+  {
+    if(map_id < 0 || it.key() == QPair<int,int>(EditorEnumDb::MAPVIEW, map_id))
+    {
+      QString name = names.value(it.key());
+      for(int i = 0; i < it.value().size(); i++)
+        usage.push_back(name + " - " + it.value()[i]);
+    }
+  }
+
+  return usage;
+}
+
+/*
+ * Description: Returns if the object is used by any referrer.
+ *
+ * Inputs: EditorEnumDb::UsageType type - the type of the used object
+ *         int id - the ID of the used object
+ * Output: bool - true if used
+ */
+bool EditorUsageIndex::isUsed(EditorEnumDb::UsageType type, int id) const
+{
+  return users.contains(QPair<int,int>(type, id));
+}
+
+/*
+ * Description: Removes the referrer and all of its references. Only the
+ *              objects the referrer used are touched.
+ *
+ * Inputs: EditorEnumDb::ViewMode view - the category of the referrer
+ *         int id - the ID of the referrer
+ * Output: none
+ */
+void EditorUsageIndex::removeReferrer(EditorEnumDb::ViewMode view, int id)
+{
+  QPair<int,int> key(view, id);
+  QList<EditorUsage> old_usages = references.take(key);
+
+  for(int i = 0; i < old_usages.size(); i++)
+  {
+    auto found = users.find(QPair<int,int>(old_usages[i].type,
+                                           old_usages[i].id));
+    if(found != users.end())
+    {
+      found->remove(key);
+      if(found->isEmpty())
+        users.erase(found);
+    }
+  }
+
+  names.remove(key);
+}
+
+/*
+ * Description: Replaces the references of the referrer with the new set. The
+ *              old references are removed first, then the new ones added, so
+ *              the rest of the index is left as is. References to unset IDs
+ *              (less than 0) are dropped.
+ *
+ * Inputs: EditorEnumDb::ViewMode view - the category of the referrer
+ *         int id - the ID of the referrer
+ *         QString name - the display name of the referrer
+ *         QList<EditorUsage> usages - every reference of the referrer
+ * Output: none
+ */
+void EditorUsageIndex::setReferrer(EditorEnumDb::ViewMode view, int id,
+                                   QString name, QList<EditorUsage> usages)
+{
+  removeReferrer(view, id);
+
+  QPair<int,int> key(view, id);
+  for(int i = 0; i < usages.size(); i++)
+  {
+    if(usages[i].id < 0)
+    {
+      usages.removeAt(i--);
+    }
+    else
+    {
+      users[QPair<int,int>(usages[i].type, usages[i].id)][key]
+                                                .push_back(usages[i].where);
+    }
+  }
+
+  names.insert(key, name);
+  references.insert(key, usages);
+}
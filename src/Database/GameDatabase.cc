@@ -7,6 +7,9 @@
 #include "Database/GameDatabase.h"
 //#include <QDebug>
 
+/* Constant Implementation - see header file for descriptions */
+const int GameDatabase::kJOURNAL_DELAY = 1000;
+
 GameDatabase::GameDatabase(QWidget *parent) : QWidget(parent)
 {
   //setSizePolicy(QSizePolicy::MinimumExpanding, QSizePolicy::Preferred);
@@ -32,6 +35,7 @@ GameDatabase::GameDatabase(QWidget *parent) : QWidget(parent)
           this, SLOT(listMusicUpdated()));
   connect(data_sounds, SIGNAL(changedSoundList()),
           this, SLOT(listSoundUpdated()));
+  connect(data_sounds, SIGNAL(dataSaved()), this, SLOT(journalChange()));
 
   /* Top view set-up */
   view_top = new QListWidget(this);
@@ -66,10 +70,12 @@ GameDatabase::GameDatabase(QWidget *parent) : QWidget(parent)
   button_delete = new QPushButton("Delete",this);
   button_import = new QPushButton("Import",this);
   button_duplicate = new QPushButton("Duplicate",this);
+  button_usage = new QPushButton("Where Used",this);
   connect(button_new, SIGNAL(clicked()), this, SLOT(createNewResource()));
   connect(button_delete, SIGNAL(clicked()), this, SLOT(deleteResource()));
   connect(button_import, SIGNAL(clicked()), this, SLOT(importResource()));
   connect(button_duplicate, SIGNAL(clicked()), this, SLOT(duplicateResource()));
+  connect(button_usage, SIGNAL(clicked()), this, SLOT(showUsage()));
 
   /* Save all button */
   QPushButton* button_saveall = new QPushButton("Process All", this);
@@ -90,6 +96,7 @@ GameDatabase::GameDatabase(QWidget *parent) : QWidget(parent)
   layout->addWidget(button_delete);
   layout->addWidget(button_duplicate);
   layout->addWidget(button_import);
+  layout->addWidget(button_usage);
   //layout->setSizeConstraint(QLayout::SetMinimumSize);
 
   /* Update the bottom list */
@@ -105,6 +112,11 @@ GameDatabase::GameDatabase(QWidget *parent) : QWidget(parent)
   tile_icons.nopassS = new QPixmap(":/images/nopass_S.png");
   tile_icons.nopassW = new QPixmap(":/images/nopass_W.png");
 
+  /* Checkpoint the core objects in the edit journal, once changes settle */
+  journal_timer.setInterval(kJOURNAL_DELAY);
+  journal_timer.setSingleShot(true);
+  connect(&journal_timer, SIGNAL(timeout()), this, SLOT(journalCore()));
+
   /* Create start objects */
   createStartObjects();
 }
@@ -233,6 +245,7 @@ void GameDatabase::addParty(EditorParty* party)
   /* If not inserted, insert at tail */
   if(!inserted)
     data_party.push_back(party);
+  connect(party, SIGNAL(usageChange(int)), this, SLOT(partyUsageChange(int)));
 }
 
 /* Add object in the correct spot in the array */
@@ -944,7 +957,7 @@ bool GameDatabase::isObjectProtected()
 }
 
 /* Called to load action data */
-void GameDatabase::loadAction(XmlData data, int index)
+void GameDatabase::loadAction(XmlData &data, int index)
 {
   /* Parse depending on the data */
   int id = -1;
@@ -974,7 +987,7 @@ void GameDatabase::loadAction(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadBattleScene(XmlData data, int index)
+void GameDatabase::loadBattleScene(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -994,7 +1007,7 @@ void GameDatabase::loadBattleScene(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadClass(XmlData data, int index)
+void GameDatabase::loadClass(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1014,7 +1027,7 @@ void GameDatabase::loadClass(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadItem(XmlData data, int index)
+void GameDatabase::loadItem(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1034,7 +1047,7 @@ void GameDatabase::loadItem(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadParty(XmlData data, int index)
+void GameDatabase::loadParty(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1054,7 +1067,7 @@ void GameDatabase::loadParty(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadPerson(XmlData data, int index)
+void GameDatabase::loadPerson(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1074,7 +1087,7 @@ void GameDatabase::loadPerson(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadRace(XmlData data, int index)
+void GameDatabase::loadRace(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1094,7 +1107,7 @@ void GameDatabase::loadRace(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadSkill(XmlData data, int index)
+void GameDatabase::loadSkill(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1114,7 +1127,7 @@ void GameDatabase::loadSkill(XmlData data, int index)
 }
 
 /* Called to load object data */
-void GameDatabase::loadSkillSet(XmlData data, int index)
+void GameDatabase::loadSkillSet(XmlData &data, int index)
 {
   int id = -1;
   if(!data.getKeyValue(index).empty())
@@ -1196,12 +1209,93 @@ void GameDatabase::loadFinish()
 
   /* Update music and sound */
   emit updatedMusic(data_sounds->getListMusic());
-  emit updatedSounds(data_sounds->getListSound());
+  updateSoundObjects();
 
   /* Update battle scenes */
   updateBattleSceneObjects();
 }
 
+/* Writes the core objects, within the game data */
+void GameDatabase::saveCore(FileHandler* fh, QProgressDialog* dialog,
+                            bool game_only)
+{
+  fh->writeXmlElement("core");
+
+  /* Battle Scenes */
+  for(int i = 0; i < data_battlescene.size(); i++)
+  {
+    data_battlescene[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Actions */
+  for(int i = 0; i < data_action.size(); i++)
+  {
+    data_action[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Skills */
+  for(int i = 0; i < data_skill.size(); i++)
+  {
+    data_skill[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Skill Sets */
+  for(int i = 0; i < data_skillset.size(); i++)
+  {
+    data_skillset[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Classes */
+  for(int i = 0; i < data_battleclass.size(); i++)
+  {
+    data_battleclass[i]->save(fh, game_only, "class");
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Races */
+  for(int i = 0; i < data_race.size(); i++)
+  {
+    data_race[i]->save(fh, game_only, "race");
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Items */
+  for(int i = 0; i < data_item.size(); i++)
+  {
+    data_item[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Persons */
+  for(int i = 0; i < data_person.size(); i++)
+  {
+    data_person[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  /* Parties */
+  for(int i = 0; i < data_party.size(); i++)
+  {
+    data_party[i]->save(fh, game_only);
+    if(dialog != nullptr)
+      dialog->setValue(dialog->value() + 1);
+  }
+
+  fh->writeXmlElementEnd();
+}
+
 /* Update calls for objects (to fill in information required from others) */
 void GameDatabase::updateClasses()
 {
@@ -1253,6 +1347,23 @@ void GameDatabase::updateSkillSets()
     data_skillset[i]->updateSkills(data_skill);
 }
 
+/* Replaces the references of the map in the usage index */
+void GameDatabase::updateUsage(EditorMap* map)
+{
+  if(map != nullptr)
+    usage_index.setReferrer(EditorEnumDb::MAPVIEW, map->getID(),
+                            "Map " + map->getNameList(), map->getUsages());
+}
+
+/* Replaces the references of the party in the usage index */
+void GameDatabase::updateUsage(EditorParty* party)
+{
+  if(party != nullptr)
+    usage_index.setReferrer(EditorEnumDb::PARTYVIEW, party->getID(),
+                            "Party " + party->getNameList(),
+                            party->getUsages());
+}
+
 /*============================================================================
  * PUBLIC SLOT FUNCTIONS
  *===========================================================================*/
@@ -1308,6 +1419,8 @@ void GameDatabase::createNewResource()
                          new EditorParty(data_party.last()->getID() + 1, name));
       else
         data_party.push_back(new EditorParty(0, name));
+      connect(data_party.last(), SIGNAL(usageChange(int)),
+              this, SLOT(partyUsageChange(int)));
       data_party.last()->updateItems(data_item, false);
       data_party.last()->updatePersons(data_person);
       break;
@@ -1429,6 +1542,7 @@ void GameDatabase::createNewResource()
   modifyBottomList(view_top->currentRow());
   if(view_top->currentRow() != 0)
     view_bottom->setCurrentRow(view_bottom->count() - 1);
+  journalChange();
 }
 
 // TODO: Comment
@@ -1453,10 +1567,26 @@ void GameDatabase::deleteResource()
       QMessageBox msg_box;
       msg_box.setText("Deleting \"" + name + "\" from " + category + ".");
       if(view_top->currentRow() == EditorEnumDb::ITEMVIEW)
-        msg_box.setInformativeText(
-              "This will also delete ALL connected map items. Are you sure?");
+      {
+        updateUsage(current_map);
+        QStringList usage = usage_index.getUsage(EditorEnumDb::USE_ITEM,
+                                                 data_item[index]->getID());
+        if(usage.isEmpty())
+        {
+          msg_box.setInformativeText("It is not used. Are you sure?");
+        }
+        else
+        {
+          msg_box.setInformativeText("It is used in " +
+                    QString::number(usage.size()) + " places. This will also " +
+                    "delete ALL connected map items. Are you sure?");
+          msg_box.setDetailedText(usage.join("\n"));
+        }
+      }
       else
+      {
         msg_box.setInformativeText("Are you sure?");
+      }
       msg_box.setStandardButtons(QMessageBox::Yes | QMessageBox::No);
       if(msg_box.exec() == QMessageBox::Yes)
       {
@@ -1470,6 +1600,9 @@ void GameDatabase::deleteResource()
               emit changeMap(nullptr);
               current_map = nullptr;
             }
+            maps_item_sync.remove(data_map[index]->getID());
+            usage_index.removeReferrer(EditorEnumDb::MAPVIEW,
+                                       data_map[index]->getID());
             delete data_map[index];
             data_map.remove(index);
             break;
@@ -1477,6 +1610,8 @@ void GameDatabase::deleteResource()
           case EditorEnumDb::PARTYVIEW:
             if(data_party[index] == current_party)
               changeParty(-1, true);
+            usage_index.removeReferrer(EditorEnumDb::PARTYVIEW,
+                                       data_party[index]->getID());
             delete data_party[index];
             data_party.remove(index);
             break;
@@ -1490,14 +1625,35 @@ void GameDatabase::deleteResource()
             break;
           /* -- ITEM -- */
           case EditorEnumDb::ITEMVIEW:
+          {
+            QList<int> used_maps = usage_index.getReferrers(
+                                        EditorEnumDb::USE_ITEM,
+                                        data_item[index]->getID(),
+                                        EditorEnumDb::MAPVIEW);
             if(data_item[index] == current_item)
               changeItem(-1, true);
             delete data_item[index];
             data_item.remove(index);
-            itemDataChange();
+
+            /* Only maps using the item are updated now. The rest only hold
+             * the base item, which is dropped on the next open */
+            for(int i = 0; i < data_map.size(); i++)
+            {
+              int map_id = data_map[i]->getID();
+              if(used_maps.contains(map_id) || data_map[i] == current_map)
+              {
+                itemDataChange(map_id);
+                updateUsage(data_map[i]);
+              }
+              else
+              {
+                maps_item_sync.insert(map_id);
+              }
+            }
             updateParties();
             updatePersons();
             break;
+          }
           /* -- ACTION -- */
           case EditorEnumDb::ACTIONVIEW:
             if(data_action[index] == current_action)
@@ -1588,6 +1744,7 @@ void GameDatabase::deleteResource()
     QMessageBox::information(this, "Delete Failed",
                              "No core object selected to delete");
   }
+  journalChange();
 }
 
 void GameDatabase::duplicateResource()
@@ -1611,12 +1768,16 @@ void GameDatabase::duplicateResource()
         *data_map.last() = *data_map[index];
         data_map.last()->setID(id);
         data_map.last()->setTileIcons(data_map[index]->getTileIcons());
+        if(maps_item_sync.contains(data_map[index]->getID()))
+          maps_item_sync.insert(id);
+        updateUsage(data_map.last());
         break;
       /* -- PARTY -- */
       case EditorEnumDb::PARTYVIEW:
         id = data_party.last()->getID();
         *data_party.last() = *data_party[index];
         data_party.last()->setID(id);
+        updateUsage(data_party.last());
         break;
       /* -- PERSON -- */
       case EditorEnumDb::PERSONVIEW:
@@ -1685,6 +1846,76 @@ void GameDatabase::duplicateResource()
     /* Update list */
     modifyBottomList(view_top->currentRow());
     view_bottom->setCurrentRow(view_bottom->count() - 1);
+    journalChange();
+  }
+}
+
+/* Finds duplicate images and remaps references to them -> file menu */
+void GameDatabase::findDuplicateImages()
+{
+  /* Every image file referenced by the project, once per reference */
+  QStringList referenced = getImagePaths();
+
+  /* Scan the sprite tree and the referenced files */
+  bool cancelled = false;
+  QList<QStringList> groups = EditorImageScan::findDuplicates(
+         EditorImageScan::getImageFiles(EditorHelpers::getSpriteDir()) +
+         referenced, referenced, this, &cancelled);
+  if(cancelled)
+    return;
+  if(groups.isEmpty())
+  {
+    QMessageBox::information(this, "Duplicate Images",
+                             "No duplicate images found");
+    return;
+  }
+
+  /* Count the references that would move to a canonical file */
+  QHash<QString,QString> remap = EditorImageScan::getRemap(groups);
+  int remap_count = 0;
+  for(int i = 0; i < referenced.size(); i++)
+    if(remap.contains(QDir::fromNativeSeparators(
+                     EditorImageStore::splitRegionPath(referenced[i]))))
+      remap_count++;
+
+  /* Create the panel */
+  QDialog dup_dialog(this);
+  dup_dialog.setWindowTitle("Duplicate Images");
+  QVBoxLayout* dup_layout = new QVBoxLayout(&dup_dialog);
+  QLabel* lbl_dup = new QLabel(QString::number(groups.size()) +
+                               " images have identical copies. " +
+                               QString::number(remap_count) +
+                               " references use a copy", &dup_dialog);
+  dup_layout->addWidget(lbl_dup);
+  QListWidget* list_dup = new QListWidget(&dup_dialog);
+  for(int i = 0; i < groups.size(); i++)
+  {
+    list_dup->addItem(EditorHelpers::trimPath(groups[i].first()));
+    for(int j = 1; j < groups[i].size(); j++)
+      list_dup->addItem("    = " + EditorHelpers::trimPath(groups[i][j]));
+  }
+  list_dup->setMinimumWidth(500);
+  dup_layout->addWidget(list_dup);
+  QPushButton* btn_remap = new QPushButton("Remap References", &dup_dialog);
+  btn_remap->setEnabled(remap_count > 0);
+  connect(btn_remap, SIGNAL(clicked()), &dup_dialog, SLOT(accept()));
+  dup_layout->addWidget(btn_remap);
+  QPushButton* btn_close = new QPushButton("Close", &dup_dialog);
+  connect(btn_close, SIGNAL(clicked()), &dup_dialog, SLOT(reject()));
+  dup_layout->addWidget(btn_close);
+
+  /* Remap all references in one batch */
+  if(dup_dialog.exec() == QDialog::Accepted)
+  {
+    int count = EditorSprite::remapLivePaths(remap);
+    for(int i = 0; i < data_map.size(); i++)
+      count += data_map[i]->remapLayPaths(remap);
+    for(int i = 0; i < data_battlescene.size(); i++)
+      count += data_battlescene[i]->remapLayPaths(remap);
+
+    QMessageBox::information(this, "Duplicate Images",
+                             "Remapped " + QString::number(count) +
+                             " references. Save to keep the changes");
   }
 }
 
@@ -1730,6 +1961,47 @@ void GameDatabase::itemDataChange(ItemData data)
     data_map[i]->setItems(data_set, false);
 }
 
+/* Schedules a core checkpoint in the edit journal, after an object change */
+void GameDatabase::journalChange()
+{
+  if(EditorJournal::getShared()->isRecording())
+    journal_timer.start();
+}
+
+/* Checkpoints the core objects in the edit journal, if changed since last */
+void GameDatabase::journalCore()
+{
+  EditorJournal* journal = EditorJournal::getShared();
+  if(journal->isRecording())
+  {
+    /* Stage the app and core data through the file handler */
+    QString scratch = EditorJournal::getScratchPath(journal->getBasePath());
+    FileHandler fh(scratch.toStdString(), true, true);
+    if(fh.start())
+    {
+      fh.writeXmlElement("app");
+      data_sounds->save(&fh, nullptr);
+      fh.writeXmlElementEnd();
+      fh.writeXmlElement("game");
+      saveCore(&fh, nullptr, false);
+      fh.writeXmlElementEnd();
+      fh.stop();
+
+      /* Only record if changed, after the first (the journal start) */
+      QFile file(scratch);
+      if(file.open(QIODevice::ReadOnly))
+      {
+        QByteArray data = file.readAll();
+        QByteArray hash = QCryptographicHash::hash(data,
+                                                   QCryptographicHash::Sha1);
+        if(!journal_core.isEmpty() && hash != journal_core)
+          journal->appendCore(data);
+        journal_core = hash;
+      }
+    }
+  }
+}
+
 /* Right click list menu on bottom list */
 void GameDatabase::listMenuRequested(const QPoint & pos)
 {
@@ -1744,13 +2016,14 @@ void GameDatabase::listMusicUpdated()
 {
   if(data_sounds != nullptr)
     emit updatedMusic(data_sounds->getListMusic());
+  journalChange();
 }
 
 /* List updates, from widgets */
 void GameDatabase::listSoundUpdated()
 {
-  if(data_sounds != nullptr)
-    emit updatedSounds(data_sounds->getListSound());
+  updateSoundObjects();
+  journalChange();
 }
 
 /* Double click on an element */
@@ -1764,7 +2037,11 @@ void GameDatabase::modifySelection(QListWidgetItem* item)
   {
     /* -- MAP -- */
     case EditorEnumDb::MAPVIEW:
+      if(current_map != data_map[index])
+        updateUsage(current_map);
       current_map = data_map[index];
+      if(maps_item_sync.remove(current_map->getID()))
+        itemDataChange(current_map->getID());
       emit changeMap(current_map);
       break;
     /* -- PARTY -- */
@@ -1820,6 +2097,14 @@ void GameDatabase::modifySelection(QListWidgetItem* item)
   modifyBottomList(view_top->currentRow());
 }
 
+/* Party saved with changed items or persons -> updates usage index */
+void GameDatabase::partyUsageChange(int id)
+{
+  for(int i = 0; i < data_party.size(); i++)
+    if(data_party[i]->getID() == id)
+      updateUsage(data_party[i]);
+}
+
 /* Renames the selected map */
 void GameDatabase::renameMap()
 {
@@ -1835,6 +2120,7 @@ void GameDatabase::renameMap()
     if(ok && !text.isEmpty())
     {
       data_map[row_index]->setName(text);
+      updateUsage(data_map[row_index]);
       modifyBottomList(view_top->currentRow());
     }
   }
@@ -1852,6 +2138,11 @@ void GameDatabase::rowChange(int index)
                      index == (int)EditorEnumDb::AUDIOVIEW);
   button_new->setEnabled(!is_invalid);
   button_import->setEnabled(!is_invalid);
+  button_usage->setEnabled(index == (int)EditorEnumDb::MAPVIEW ||
+                           index == (int)EditorEnumDb::PERSONVIEW ||
+                           index == (int)EditorEnumDb::ITEMVIEW ||
+                           index == (int)EditorEnumDb::AUDIOVIEW ||
+                           index == (int)EditorEnumDb::BATTLESCENEVIEW);
   view_bottom->setEnabled(!is_invalid);
 }
 
@@ -1913,9 +2204,88 @@ void GameDatabase::saveAll()
 
     /* Fix back to visible row */
     rowChange(view_top->currentRow());
+    journalChange();
   }
 }
 
+/* Shows where the selected object is used -> where used button */
+void GameDatabase::showUsage()
+{
+  EditorEnumDb::UsageType type = EditorEnumDb::USE_MAP;
+  int id = -1;
+  int index = view_bottom->currentRow();
+  QString name;
+
+  /* Get the selected object */
+  switch(view_top->currentRow())
+  {
+    /* -- MAP -- */
+    case EditorEnumDb::MAPVIEW:
+      if(index >= 0)
+        id = data_map[index]->getID();
+      break;
+    /* -- PERSON -- */
+    case EditorEnumDb::PERSONVIEW:
+      type = EditorEnumDb::USE_PERSON;
+      if(index >= 0)
+        id = data_person[index]->getID();
+      break;
+    /* -- ITEM -- */
+    case EditorEnumDb::ITEMVIEW:
+      type = EditorEnumDb::USE_ITEM;
+      if(index >= 0)
+        id = data_item[index]->getID();
+      break;
+    /* -- SOUND / MUSIC -- */
+    case EditorEnumDb::AUDIOVIEW:
+    {
+      bool is_music = false;
+      id = data_sounds->getSelectedID(&is_music);
+      type = is_music ? EditorEnumDb::USE_MUSIC : EditorEnumDb::USE_SOUND;
+      name = (is_music ? "Music " : "Sound ") + QString::number(id);
+      break;
+    }
+    /* -- BATTLE SCENE -- */
+    case EditorEnumDb::BATTLESCENEVIEW:
+      type = EditorEnumDb::USE_BATTLESCENE;
+      if(index >= 0)
+        id = data_battlescene[index]->getID();
+      break;
+    default:
+      break;
+  }
+
+  if(id < 0)
+  {
+    QMessageBox::information(this, "Where Used",
+                             "No object selected to find the usage of");
+    return;
+  }
+  if(name.isEmpty())
+    name = view_bottom->currentItem()->text();
+
+  /* The open map is edited live, so bring it up to date first */
+  updateUsage(current_map);
+  QStringList usage = usage_index.getUsage(type, id);
+
+  /* Create the panel */
+  QDialog usage_dialog(this);
+  usage_dialog.setWindowTitle("Where Used");
+  QVBoxLayout* usage_layout = new QVBoxLayout(&usage_dialog);
+  QLabel* lbl_usage = new QLabel("\"" + name + "\" is used in " +
+                                 QString::number(usage.size()) + " places",
+                                 &usage_dialog);
+  usage_layout->addWidget(lbl_usage);
+  QListWidget* list_usage = new QListWidget(&usage_dialog);
+  list_usage->addItems(usage);
+  list_usage->setMinimumWidth(400);
+  usage_layout->addWidget(list_usage);
+  QPushButton* btn_close = new QPushButton("Close", &usage_dialog);
+  connect(btn_close, SIGNAL(clicked()), &usage_dialog, SLOT(accept()));
+  usage_layout->addWidget(btn_close);
+  usage_dialog.exec();
+}
+
 // TODO: Comment
 void GameDatabase::updateBottomListName(QString str)
 {
@@ -1973,14 +2343,28 @@ void GameDatabase::updateEventObjects()
 {
   /* List of items */
   QList<QString> item_list;
+  QList<EditorListEntry> item_entries;
   for(int i = 0; i < data_item.size(); i++)
-    item_list.push_back(data_item[i]->getNameList());
+  {
+    EditorListEntry entry = {data_item[i]->getID(), data_item[i]->getName(),
+                             data_item[i]->getNameList()};
+    item_list.push_back(entry.text);
+    item_entries.push_back(entry);
+  }
+  EditorListModel::getShared(EditorEnumDb::ITEM_LIST)->setEntries(item_entries);
   emit updatedItems(item_list);
 
   /* List of maps */
   QList<QString> map_list;
+  QList<EditorListEntry> map_entries;
   for(int i = 0; i < data_map.size(); i++)
-    map_list.push_back(data_map[i]->getNameList());
+  {
+    EditorListEntry entry = {data_map[i]->getID(), data_map[i]->getName(),
+                             data_map[i]->getNameList()};
+    map_list.push_back(entry.text);
+    map_entries.push_back(entry);
+  }
+  EditorListModel::getShared(EditorEnumDb::MAP_LIST)->setEntries(map_entries);
   emit updatedMaps(map_list);
 
   /* List of parties */
@@ -2003,7 +2387,11 @@ void GameDatabase::updateMusicObjects()
 void GameDatabase::updateSoundObjects()
 {
   if(data_sounds != nullptr)
-    emit updatedSounds(data_sounds->getListSound());
+  {
+    QList<QString> sound_list = data_sounds->getListSound();
+    EditorListModel::getShared(EditorEnumDb::SOUND_LIST)->setList(sound_list);
+    emit updatedSounds(sound_list);
+  }
 }
 
 /*============================================================================
@@ -2032,6 +2420,8 @@ void GameDatabase::deleteAll()
   for(int i = 0; i < data_map.size(); i++)
     delete data_map[i];
   data_map.clear();
+  maps_item_sync.clear();
+  usage_index.clear();
 
   /* Party clean-up */
   changeParty(-1, true);
@@ -2148,6 +2538,33 @@ EditorMap* GameDatabase::getCurrentMap()
   return current_map;
 }
 
+/* Returns the image files a game export writes, once each, for the atlas */
+QStringList GameDatabase::getExportPaths()
+{
+  QStringList paths;
+  for(int i = 0; i < data_item.size(); i++)
+    paths += data_item[i]->getImagePaths();
+  for(int i = 0; i < data_map.size(); i++)
+    paths += data_map[i]->getImagePaths();
+  for(int i = 0; i < data_person.size(); i++)
+    paths += data_person[i]->getImagePaths();
+  for(int i = 0; i < data_skill.size(); i++)
+    paths += data_skill[i]->getImagePaths();
+  paths.removeDuplicates();
+  return paths;
+}
+
+/* Returns every image path used by the project, once per reference */
+QStringList GameDatabase::getImagePaths()
+{
+  QStringList paths = EditorSprite::getLivePaths();
+  for(int i = 0; i < data_map.size(); i++)
+    paths += data_map[i]->getLayPaths();
+  for(int i = 0; i < data_battlescene.size(); i++)
+    paths += data_battlescene[i]->getLayPaths();
+  return paths;
+}
+
 /* Returns the audio view, for connection */
 EditorSoundDb* GameDatabase::getSoundDatabase()
 {
@@ -2155,13 +2572,22 @@ EditorSoundDb* GameDatabase::getSoundDatabase()
 }
 
 /* Load the game */
-void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog)
+void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog,
+                        bool skip_core)
 {
+  /* Loaded data is not an edit */
+  if(EditorJournal::getShared()->isRecording())
+    stopJournal();
+
+  /* Sprite frames only record their paths while parsing */
+  EditorImageStore::getShared()->beginDeferred();
+
   if(fh != NULL)
   {
     XmlData data;
     bool done = false;
     bool first_map = true;
+    int map_index = -1;
     bool read_success = true;
     bool success = true;
 
@@ -2173,46 +2599,66 @@ void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog)
       success &= read_success;
 
       /* Only validate if wrapped within game and successful read */
-      if(success && data.getElement(0) == "app")
+      EditorEnumDb::XmlTag wrapper = EditorEnumDb::XML_NONE;
+      if(success)
+        wrapper = EditorHelpers::getXmlTag(data.getElement(0));
+
+      if(wrapper == EditorEnumDb::XML_APP && !skip_core)
       {
         /* Music and Sound */
-        if(data.getElement(1) == "music" ||
-           data.getElement(1) == "sound")
+        EditorEnumDb::XmlTag section =
+                                EditorHelpers::getXmlTag(data.getElement(1));
+        if(section == EditorEnumDb::XML_MUSIC ||
+           section == EditorEnumDb::XML_SOUND)
         {
           data_sounds->load(data, 1);
         }
       }
-      else if(success && data.getElement(0) == "game")
+      else if(wrapper == EditorEnumDb::XML_GAME)
       {
         /* If core game data, parse */
-        if(data.getElement(1) == "core")
+        EditorEnumDb::XmlTag section =
+                                EditorHelpers::getXmlTag(data.getElement(1));
+        if(section == EditorEnumDb::XML_CORE && !skip_core)
         {
-          /* Action */
-          if(data.getElement(2) == "action")
-            loadAction(data, 2);
-          else if(data.getElement(2) == "battlescene")
-            loadBattleScene(data, 2);
-          else if(data.getElement(2) == "class")
-            loadClass(data, 2);
-          else if(data.getElement(2) == "item")
-            loadItem(data, 2);
-          else if(data.getElement(2) == "party")
-            loadParty(data, 2);
-          else if(data.getElement(2) == "person")
-            loadPerson(data, 2);
-          else if(data.getElement(2) == "race")
-            loadRace(data, 2);
-          else if(data.getElement(2) == "skill")
-            loadSkill(data, 2);
-          else if(data.getElement(2) == "skillset")
-            loadSkillSet(data, 2);
+          switch(EditorHelpers::getXmlTag(data.getElement(2)))
+          {
+            case EditorEnumDb::XML_ACTION:
+              loadAction(data, 2);
+              break;
+            case EditorEnumDb::XML_BATTLESCENE:
+              loadBattleScene(data, 2);
+              break;
+            case EditorEnumDb::XML_CLASS:
+              loadClass(data, 2);
+              break;
+            case EditorEnumDb::XML_ITEM:
+              loadItem(data, 2);
+              break;
+            case EditorEnumDb::XML_PARTY:
+              loadParty(data, 2);
+              break;
+            case EditorEnumDb::XML_PERSON:
+              loadPerson(data, 2);
+              break;
+            case EditorEnumDb::XML_RACE:
+              loadRace(data, 2);
+              break;
+            case EditorEnumDb::XML_SKILL:
+              loadSkill(data, 2);
+              break;
+            case EditorEnumDb::XML_SKILLSET:
+              loadSkillSet(data, 2);
+              break;
+            default:
+              break;
+          }
         }
         /* If map element, add new map if it doesn't exist; then send
          * new information to map */
-        else if(data.getElement(1) == "map" && data.getKey(1) == "id")
+        else if(section == EditorEnumDb::XML_MAP && data.getKey(1) == "id")
         {
           int map_id = QString::fromStdString(data.getKeyValue(1)).toInt();
-          int map_index = -1;
 
           /* If first map call, clean up items for use in map side */
           if(first_map)
@@ -2222,10 +2668,15 @@ void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog)
             first_map = false;
           }
 
-          /* Try and find map index */
-          for(int i = 0; i < data_map.size(); i++)
-            if(data_map[i]->getID() == map_id)
-              map_index = i;
+          /* Try and find map index. Lines of a map are together, so the
+           * last map is checked first */
+          if(map_index < 0 || data_map[map_index]->getID() != map_id)
+          {
+            map_index = -1;
+            for(int i = 0; i < data_map.size(); i++)
+              if(data_map[i]->getID() == map_id)
+                map_index = i;
+          }
 
           /* Create the map if it doesn't exist */
           if(map_index == -1)
@@ -2244,6 +2695,12 @@ void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog)
     } while(!done);
   }
 
+  /* Decode all the recorded frame images at once, on the thread pool, and
+   * attach them to the sprites before the cache can evict any */
+  EditorImageStore::getShared()->endDeferred(dialog);
+  EditorSprite::resolveLiveFrames();
+  EditorImageStore::getShared()->releasePinned();
+
   /* Clean up core data */
   loadFinish();
 
@@ -2259,6 +2716,13 @@ void GameDatabase::load(FileHandler* fh, QProgressDialog* dialog)
     data_map[i]->tilesIOAdd(true);
   }
 
+  /* Build the usage index */
+  usage_index.clear();
+  for(int i = 0; i < data_map.size(); i++)
+    updateUsage(data_map[i]);
+  for(int i = 0; i < data_party.size(); i++)
+    updateUsage(data_party[i]);
+
   /* Update the view */
   int index = view_top->currentRow();
   if(index == 0)
@@ -2422,12 +2886,34 @@ void GameDatabase::modifyBottomList(int index)
   }
 }
 
+/* Replays the map records of the edit journal. Returns the count replayed */
+int GameDatabase::replayJournal(QList<EditorJournalRecord> records)
+{
+  int count = 0;
+
+  for(int i = 0; i < records.size(); i++)
+    if(records[i].type != EditorEnumDb::JOURNAL_CORE)
+      for(int j = 0; j < data_map.size(); j++)
+        if(data_map[j]->getID() == records[i].map_id &&
+           data_map[j]->replayJournal(records[i]))
+          count++;
+
+  /* The replayed things change the map references */
+  for(int i = 0; i < data_map.size(); i++)
+    updateUsage(data_map[i]);
+
+  return count;
+}
+
 /* Save the game */
 void GameDatabase::save(FileHandler* fh, QProgressDialog* dialog,
                         bool game_only, bool selected_map, int sub_index)
 {
   if(fh != nullptr && dialog != nullptr)
   {
+    /* The open map is edited live, so index it as saved */
+    updateUsage(current_map);
+
     /* -- Write application data -- */
     fh->writeXmlElement("app");
 
@@ -2441,72 +2927,7 @@ void GameDatabase::save(FileHandler* fh, QProgressDialog* dialog,
     fh->writeXmlElement("game");
 
     /* Core data */
-    fh->writeXmlElement("core");
-
-    /* Battle Scenes */
-    for(int i = 0; i < data_battlescene.size(); i++)
-    {
-      data_battlescene[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Actions */
-    for(int i = 0; i < data_action.size(); i++)
-    {
-      data_action[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Skills */
-    for(int i = 0; i < data_skill.size(); i++)
-    {
-      data_skill[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Skill Sets */
-    for(int i = 0; i < data_skillset.size(); i++)
-    {
-      data_skillset[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Classes */
-    for(int i = 0; i < data_battleclass.size(); i++)
-    {
-      data_battleclass[i]->save(fh, game_only, "class");
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Races */
-    for(int i = 0; i < data_race.size(); i++)
-    {
-      data_race[i]->save(fh, game_only, "race");
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Items */
-    for(int i = 0; i < data_item.size(); i++)
-    {
-      data_item[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Persons */
-    for(int i = 0; i < data_person.size(); i++)
-    {
-      data_person[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    /* Parties */
-    for(int i = 0; i < data_party.size(); i++)
-    {
-      data_party[i]->save(fh, game_only);
-      dialog->setValue(dialog->value() + 1);
-    }
-
-    fh->writeXmlElementEnd();
+    saveCore(fh, dialog, game_only);
 
     /* Maps */
     /* If not the selected map, save all the maps */
@@ -2531,3 +2952,27 @@ QSize GameDatabase::sizeHint() const
 {
   return minimumSizeHint();
 }
+
+/* Starts recording edits to the saved project, from the starting records */
+bool GameDatabase::startJournal(QString base_path,
+                                QList<EditorJournalRecord> records)
+{
+  journal_timer.stop();
+  journal_core.clear();
+
+  if(EditorJournal::getShared()->open(base_path, records))
+  {
+    /* Take the core baseline, to compare the checkpoints to */
+    journalCore();
+    return true;
+  }
+  return false;
+}
+
+/* Stops recording edits and removes the journal */
+void GameDatabase::stopJournal()
+{
+  journal_timer.stop();
+  journal_core.clear();
+  EditorJournal::getShared()->close();
+}
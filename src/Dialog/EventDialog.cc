@@ -745,28 +745,17 @@ LockView* EventDialog::getViewLock()
 }
 
 /*
- * Description: Sets the list of items, used for event creation
+ * Description: Sets the list of items, used for the lock. The event view binds
+ *              to the shared item model instead.
  *
- * Inputs: QList<QString> - list of all items (for give item event)
+ * Inputs: QList<QString> - list of all items (for item locks)
  * Output: none
  */
 void EventDialog::setListItems(QList<QString> items)
 {
-  view_event->setListItems(items);
   view_lock->setListItems(items);
 }
 
-/*
- * Description: Sets the list of maps, used for event creation
- *
- * Inputs: QList<QString> - list of all maps (for change map event)
- * Output: none
- */
-void EventDialog::setListMaps(QList<QString> maps)
-{
-  view_event->setListMaps(maps);
-}
-
 /*
  * Description: Sets the list of things, ios, items, persons, npcs, used for
  *              event creation.
@@ -787,18 +776,6 @@ void EventDialog::setListMapThings(QList<QString> things,
   view_event->setListMapThings(things, ios, items, persons, npcs);
 }
 
-/*
- * Description: Sets the list of sounds, to be used within the event dialog for
- *              the drop down selection and within the event.
- *
- * Inputs: QList<QString> sounds - the sound string list
- * Output: none
- */
-void EventDialog::setListSounds(QList<QString> sounds)
-{
-  view_event->setListSounds(sounds);
-}
-
 /*
  * Description: Sets the list of sub-maps, used for event creation.
  *
@@ -144,6 +144,7 @@ void IODialog::createLayout(bool instance)
   QLabel* lbl_sound = new QLabel("Sound:", this);
   layout->addWidget(lbl_sound, 6, 0);
   combo_sound = new QComboBox(this);
+  combo_sound->setModel(EditorListModel::getShared(EditorEnumDb::SOUND_LIST));
   connect(combo_sound, SIGNAL(currentIndexChanged(QString)),
           this, SLOT(changedSound(QString)));
   layout->addWidget(combo_sound, 6, 1, 1, 3);
@@ -285,11 +286,9 @@ void IODialog::editEventSet(EditorEventSet* set, QString window_title)
   {
     event_dialog = new EventDialog(set, this, window_title);
     event_dialog->setListItems(list_items);
-    event_dialog->setListMaps(list_maps);
     event_dialog->setListMapThings(list_map_things, list_map_ios,
                                    list_map_items, list_map_persons,
                                    list_map_npcs);
-    event_dialog->setListSounds(list_sounds);
     event_dialog->setListSubmaps(list_submaps);
     connect(event_dialog, SIGNAL(selectTile()),
             this, SLOT(selectTile()));
@@ -340,24 +339,18 @@ void IODialog::updateData()
   combo_state->blockSignals(false);
 
   /* Sound data - find index */
-  int index = -1;
-  for(int i = 0; i < list_sounds.size(); i++)
-  {
-    QStringList str_split = list_sounds[i].split(':');
-    if(str_split.size() >= 2)
-      if(str_split.front().toInt() == io_working->getSoundID())
-        index = i;
-  }
+  EditorListModel* sounds = EditorListModel::getShared(EditorEnumDb::SOUND_LIST);
+  int index = sounds->getRow(io_working->getSoundID());
 
   /* Lock data */
   lbl_lock_data->setText(io_working->getLock()->getTextSummary(""));
 
-  /* Sound data - load into combo */
+  /* Sound data - select in the shared combo */
   combo_sound->blockSignals(true);
-  combo_sound->clear();
-  combo_sound->addItems(QStringList(list_sounds));
   if(index >= 0)
     combo_sound->setCurrentIndex(index);
+  else
+    combo_sound->setCurrentIndex(0);
   combo_sound->blockSignals(false);
 }
 
@@ -859,21 +852,19 @@ void IODialog::changedName(QString name)
  */
 void IODialog::changedSound(const QString &text)
 {
-  QStringList str_list = text.split(':');
+  (void)text;
 
-  /* Close the event pop-up if open */
-  buttonLockCancel();
-  editEventSet(nullptr);
-
-  /* If the list is two long, it is proper format - 001: Sound Example */
-  if(str_list.size() >= 2)
+  /* The row ID - unset (-1) for the "None" row. The shared rows can shift
+   * under the combo, so only act on an actual change */
+  EditorListModel* sounds = EditorListModel::getShared(EditorEnumDb::SOUND_LIST);
+  int id = sounds->getID(combo_sound->currentIndex());
+  if(id != io_working->getSoundID())
   {
-    io_working->setSoundID(str_list.front().toInt());
-  }
-  /* Otherwise, unset the sound ID */
-  else
-  {
-    io_working->setSoundID(-1);
+    /* Close the event pop-up if open */
+    buttonLockCancel();
+    editEventSet(nullptr);
+
+    io_working->setSoundID(id);
   }
 }
 
@@ -1099,10 +1090,6 @@ void IODialog::setListItems(QList<QString> items)
 void IODialog::setListMaps(QList<QString> maps)
 {
   list_maps = maps;
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListMaps(maps);
 }
 
 /*
@@ -1145,10 +1132,6 @@ void IODialog::setListSounds(QList<QString> sounds)
   /* Base data */
   list_sounds = sounds;
   updateData();
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListSounds(sounds);
 }
 
 /*
@@ -1583,11 +1583,9 @@ void InstanceDialog::editEventSet(EditorEventSet* set,
     event_dialog = new EventDialog(set, this, window_title,
                                    EventClassifier::NOEVENT, view_only);
     event_dialog->setListItems(list_items);
-    event_dialog->setListMaps(list_maps);
     event_dialog->setListMapThings(list_map_things, list_map_ios,
                                    list_map_items, list_map_persons,
                                    list_map_npcs);
-    event_dialog->setListSounds(list_sounds);
     event_dialog->setListSubmaps(list_submaps);
     connect(event_dialog, SIGNAL(selectTile()),
             this, SLOT(selectTile()));
@@ -1924,10 +1922,6 @@ void InstanceDialog::setListItems(QList<QString> items)
 void InstanceDialog::setListMaps(QList<QString> maps)
 {
   list_maps = maps;
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListMaps(maps);
 }
 
 /*
@@ -1994,10 +1988,6 @@ void InstanceDialog::setListSounds(QList<QString> sounds)
   /* If item thing, update data */
   if(thing_type == EditorEnumDb::ITEM)
     updateData();
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListSounds(sounds);
 }
 
 /*
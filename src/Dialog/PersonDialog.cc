@@ -173,6 +173,7 @@ void PersonDialog::createLayout(bool instance)
   QLabel* lbl_sound = new QLabel("Sound:", this);
   layout->addWidget(lbl_sound, 2, 4);
   combo_sound = new QComboBox(this);
+  combo_sound->setModel(EditorListModel::getShared(EditorEnumDb::SOUND_LIST));
   connect(combo_sound, SIGNAL(currentIndexChanged(QString)),
           this, SLOT(changedSound(QString)));
   layout->addWidget(combo_sound, 2, 5, 1, 2);
@@ -238,21 +239,15 @@ void PersonDialog::updateData()
   matrix_view->setEnabled(enabled);
 
   /* Sound data - find index */
-  int index = -1;
-  for(int i = 0; i < list_sounds.size(); i++)
-  {
-    QStringList str_split = list_sounds[i].split(':');
-    if(str_split.size() >= 2)
-      if(str_split.front().toInt() == person_working->getSoundID())
-        index = i;
-  }
+  EditorListModel* sounds = EditorListModel::getShared(EditorEnumDb::SOUND_LIST);
+  int index = sounds->getRow(person_working->getSoundID());
 
-  /* Sound data - load into combo */
+  /* Sound data - select in the shared combo */
   combo_sound->blockSignals(true);
-  combo_sound->clear();
-  combo_sound->addItems(QStringList(list_sounds));
   if(index >= 0)
     combo_sound->setCurrentIndex(index);
+  else
+    combo_sound->setCurrentIndex(0);
   combo_sound->blockSignals(false);
 
   /* Event view */
@@ -371,18 +366,11 @@ void PersonDialog::changedName(QString name)
  */
 void PersonDialog::changedSound(const QString &text)
 {
-  QStringList str_list = text.split(':');
+  (void)text;
 
-  /* If the list is two long, it is proper format - 001: Sound Example */
-  if(str_list.size() >= 2)
-  {
-    person_working->setSoundID(str_list.front().toInt());
-  }
-  /* Otherwise, unset the sound ID */
-  else
-  {
-    person_working->setSoundID(-1);
-  }
+  /* The row ID - unset (-1) for the "None" row */
+  EditorListModel* sounds = EditorListModel::getShared(EditorEnumDb::SOUND_LIST);
+  person_working->setSoundID(sounds->getID(combo_sound->currentIndex()));
 }
 
 /*
@@ -430,11 +418,9 @@ void PersonDialog::editEventSet(EditorEventSet* set)
   {
     event_dialog = new EventDialog(set, this);
     event_dialog->setListItems(list_items);
-    event_dialog->setListMaps(list_maps);
     event_dialog->setListMapThings(list_map_things, list_map_ios,
                                    list_map_items, list_map_persons,
                                    list_map_npcs);
-    event_dialog->setListSounds(list_sounds);
     event_dialog->setListSubmaps(list_submaps);
     connect(event_dialog, SIGNAL(selectTile()),
             this, SLOT(selectTile()));
@@ -668,10 +654,6 @@ void PersonDialog::setListItems(QList<QString> items)
 void PersonDialog::setListMaps(QList<QString> maps)
 {
   list_maps = maps;
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListMaps(maps);
 }
 
 /*
@@ -714,10 +696,6 @@ void PersonDialog::setListSounds(QList<QString> sounds)
   /* Base data */
   list_sounds = sounds;
   updateData();
-
-  /* Event dialog data */
-  if(event_dialog != nullptr)
-    event_dialog->setListSounds(sounds);
 }
 
 /*
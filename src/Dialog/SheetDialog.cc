@@ -0,0 +1,402 @@
+/*******************************************************************************
+ * Class Name: SheetDialog
+ * Date Created: October 19, 2026
+ * Inheritance: QDialog
+ * Description: The sprite sheet dialog, which handles slicing a single sprite
+ *              sheet into the frames of a matrix, by cell size and frame
+ *              layout. The slices reference the one decoded sheet. Used for
+ *              matrix placing of files outside the Univursa naming convention.
+ ******************************************************************************/
+#include "Dialog/SheetDialog.h"
+
+/* Constant Implementation - see header file for descriptions */
+const int SheetDialog::kSCENE_SIZE = 320;
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function
+ *
+ * Inputs: QString path - the sprite sheet path initially chosen
+ *         QWidget* parent - the parent class of the dialog
+ */
+SheetDialog::SheetDialog(QString path, QWidget* parent) : QDialog(parent)
+{
+  if(!path.isEmpty() && path.endsWith(".png"))
+  {
+    /* Initial variables */
+    path = QDir::toNativeSeparators(path);
+    QStringList path_set = path.split(QDir::separator());
+    initial_filename = path_set.last();
+    initial_path = path.remove(initial_filename);
+    frame_num = 0;
+
+    /* Decode the sheet once. The previews and the place all share it */
+    sheet_size = EditorImageStore::getShared()->getImage(getSheetPath()).size();
+
+    /* Matrix config */
+    matrix.setVisibilityGrid(false);
+    matrix.setVisibilityPass(false);
+    matrix.setVisibilityRender(false);
+
+    /* Set up the view objects */
+    createDialog();
+    updateFrames();
+
+    /* Finally, update the scene */
+    updateScene();
+  }
+}
+
+/*
+ * Description: Destructor Function
+ */
+SheetDialog::~SheetDialog()
+{
+
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Creates the dialog and fills it with objects with the correct
+ *              configuration. Only called once on initial construction and
+ *              necessary for the dialog to work.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::createDialog()
+{
+  /* Layout setup */
+  QGridLayout* layout = new QGridLayout(this);
+  layout->setSizeConstraint(QLayout::SetFixedSize);
+
+  /* Image label */
+  lbl_scene = new QLabel(this);
+  QImage scene_img(kSCENE_SIZE, kSCENE_SIZE, QImage::Format_ARGB32);
+  lbl_scene->setPixmap(QPixmap::fromImage(scene_img));
+  lbl_scene->setStyleSheet("border: 2px solid black");
+  lbl_scene->setMinimumWidth(kSCENE_SIZE);
+  lbl_scene->setMinimumHeight(kSCENE_SIZE);
+  lbl_scene->setAlignment(Qt::AlignCenter);
+  layout->addWidget(lbl_scene, 0, 0, 7, 3);
+
+  /* Scene control */
+  button_prev = new QPushButton("<", this);
+  button_prev->setMaximumWidth(kSCENE_SIZE / 10);
+  connect(button_prev, SIGNAL(clicked()), this, SLOT(buttonPreviousFrame()));
+  layout->addWidget(button_prev, 7, 0, Qt::AlignRight);
+  lbl_frame_num = new QLabel(QString::number(frame_num), this);
+  layout->addWidget(lbl_frame_num, 7, 1, Qt::AlignCenter);
+  button_next = new QPushButton(">", this);
+  button_next->setMaximumWidth(kSCENE_SIZE / 10);
+  connect(button_next, SIGNAL(clicked()), this, SLOT(buttonNextFrame()));
+  layout->addWidget(button_next, 7, 2, Qt::AlignLeft);
+
+  /* Path label */
+  QLabel* lbl_initial = new QLabel("Filename: " + initial_filename + " (" +
+                                   QString::number(sheet_size.width()) + "x" +
+                                   QString::number(sheet_size.height()) + ")",
+                                   this);
+  lbl_initial->setWordWrap(true);
+  layout->addWidget(lbl_initial, 0, 3, 1, 4);
+
+  /* Cell size control */
+  QLabel* lbl_cell = new QLabel("Cell Size", this);
+  layout->addWidget(lbl_cell, 1, 3);
+  spin_cell_w = new QSpinBox(this);
+  spin_cell_w->setMinimum(1);
+  spin_cell_w->setMaximum(qMax(1, sheet_size.width()));
+  spin_cell_w->setValue(qMin(EditorHelpers::getTileSize(),
+                             spin_cell_w->maximum()));
+  connect(spin_cell_w, SIGNAL(valueChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(spin_cell_w, 1, 4);
+  QLabel* lbl_cell_x = new QLabel("X", this);
+  layout->addWidget(lbl_cell_x, 1, 5, Qt::AlignHCenter);
+  spin_cell_h = new QSpinBox(this);
+  spin_cell_h->setMinimum(1);
+  spin_cell_h->setMaximum(qMax(1, sheet_size.height()));
+  spin_cell_h->setValue(qMin(EditorHelpers::getTileSize(),
+                             spin_cell_h->maximum()));
+  connect(spin_cell_h, SIGNAL(valueChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(spin_cell_h, 1, 6);
+
+  /* Tiles per frame control */
+  QLabel* lbl_tiles = new QLabel("Tiles per Frame", this);
+  layout->addWidget(lbl_tiles, 2, 3);
+  spin_tiles_w = new QSpinBox(this);
+  spin_tiles_w->setMinimum(1);
+  spin_tiles_w->setMaximum(26);
+  connect(spin_tiles_w, SIGNAL(valueChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(spin_tiles_w, 2, 4);
+  QLabel* lbl_tiles_x = new QLabel("X", this);
+  layout->addWidget(lbl_tiles_x, 2, 5, Qt::AlignHCenter);
+  spin_tiles_h = new QSpinBox(this);
+  spin_tiles_h->setMinimum(1);
+  spin_tiles_h->setMaximum(26);
+  connect(spin_tiles_h, SIGNAL(valueChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(spin_tiles_h, 2, 6);
+
+  /* Frame order control */
+  QLabel* lbl_order = new QLabel("Frame Order", this);
+  layout->addWidget(lbl_order, 3, 3, 1, 2);
+  cbox_order = new QComboBox(this);
+  cbox_order->addItem("Across, then Down");
+  cbox_order->addItem("Down, then Across");
+  connect(cbox_order, SIGNAL(currentIndexChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(cbox_order, 3, 5, 1, 2);
+
+  /* Scene flipping control */
+  button_flip_h = new QPushButton("Horizontal Flip", this);
+  button_flip_h->setCheckable(true);
+  connect(button_flip_h, SIGNAL(clicked()), this, SLOT(buttonFlip()));
+  layout->addWidget(button_flip_h, 4, 3, 1, 2);
+  button_flip_v = new QPushButton("Vertical Flip", this);
+  button_flip_v->setCheckable(true);
+  connect(button_flip_v, SIGNAL(clicked()), this, SLOT(buttonFlip()));
+  layout->addWidget(button_flip_v, 4, 5, 1, 2);
+
+  /* Number of frames */
+  QLabel* lbl_num = new QLabel("Number of Frames", this);
+  layout->addWidget(lbl_num, 5, 3, 1, 2);
+  spin_frames = new QSpinBox(this);
+  spin_frames->setMinimum(1);
+  spin_frames->setMaximum(1);
+  connect(spin_frames, SIGNAL(valueChanged(int)),
+          this, SLOT(editObjectChanged(int)));
+  layout->addWidget(spin_frames, 5, 5, 1, 2);
+
+  /* Result label */
+  lbl_result = new QLabel("Result:", this);
+  layout->addWidget(lbl_result, 6, 3, 1, 4);
+
+  /* Buttons at bottom */
+  QPushButton* button_ok = new QPushButton("Ok", this);
+  button_ok->setDefault(true);
+  connect(button_ok, SIGNAL(clicked()), this, SLOT(buttonOk()));
+  layout->addWidget(button_ok, 7, 5);
+  QPushButton* button_cancel = new QPushButton("Cancel", this);
+  connect(button_cancel, SIGNAL(clicked()), this, SLOT(buttonCancel()));
+  layout->addWidget(button_cancel, 7, 6);
+
+  /* Dialog control */
+  setLayout(layout);
+  setWindowTitle("Sprite Sheet Edit");
+}
+
+/*
+ * Description: Updates the number of frames spinner to the count of frames
+ *              that fit in the sheet with the layout, and the frame buttons
+ *              to the frame number in range. The first time, all frames that
+ *              fit are selected.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::updateFrames()
+{
+  /* Limit the frame count to what fits in the sheet */
+  EditorSheetLayout layout = getLayout();
+  bool all = (spin_frames->value() == spin_frames->maximum());
+  layout.frames = 0;
+  int max_frames = qMax(1, EditorMatrix::getSheetFrames(sheet_size, layout));
+
+  spin_frames->blockSignals(true);
+  spin_frames->setMaximum(max_frames);
+  if(all)
+    spin_frames->setValue(max_frames);
+  spin_frames->blockSignals(false);
+
+  /* Update the frame buttons */
+  if(frame_num >= spin_frames->value())
+    frame_num = spin_frames->value() - 1;
+  button_prev->setEnabled(frame_num > 0);
+  button_next->setEnabled(frame_num < (spin_frames->value() - 1));
+  lbl_frame_num->setText(QString::number(frame_num));
+}
+
+/*
+ * Description: Updates the scene matrix and prints an image of it for
+ *              rendering in the dialog.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::updateScene()
+{
+  /* Slice the sheet into the scene */
+  EditorSheetLayout layout = getLayout();
+  bool valid = matrix.addSheet(getSheetPath(), layout, 0, 0,
+                               isFlipHorizontal(), isFlipVertical(), true);
+  matrix.setActiveFrame(frame_num);
+
+  /* Paint the image */
+  lbl_scene->setPixmap(matrix.getSnapshot(kSCENE_SIZE, kSCENE_SIZE));
+
+  /* Update result string */
+  if(valid)
+    lbl_result->setText("Result: " + QString::number(layout.frames) +
+                        " frame(s) of " + QString::number(layout.tiles_w) +
+                        "x" + QString::number(layout.tiles_h) + " tiles");
+  else
+    lbl_result->setText("Result: Cells do not fit in the sheet");
+
+  /* Update dialog */
+  update();
+}
+
+/*============================================================================
+ * PUBLIC SLOT FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Button trigger called on cancel click. Only closes the dialog.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::buttonCancel()
+{
+  close();
+}
+
+/*
+ * Description: Button trigger called on a flip click (horizontal or vertical).
+ *              Updates the scene for the new flip.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::buttonFlip()
+{
+  updateScene();
+}
+
+/*
+ * Description: Button trigger called on next frame click. Shifts the viewing
+ *              frame of the matrix to the next one, if within range of the
+ *              spin box.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::buttonNextFrame()
+{
+  if(frame_num < (spin_frames->value() - 1))
+  {
+    frame_num++;
+    updateFrames();
+    updateScene();
+  }
+}
+
+/*
+ * Description: Button trigger called on ok click. Emits sheetPlace signal
+ *              with the layout and then closes the dialog.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::buttonOk()
+{
+  emit sheetPlace(getSheetPath(), getLayout(), isFlipHorizontal(),
+                  isFlipVertical());
+  close();
+}
+
+/*
+ * Description: Button trigger called on prev frame click. Shifts the viewing
+ *              frame of the matrix to the previous one, if greater than 0.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SheetDialog::buttonPreviousFrame()
+{
+  if(frame_num > 0)
+  {
+    frame_num--;
+    updateFrames();
+    updateScene();
+  }
+}
+
+/*
+ * Description: Fires if any of the layout edit objects change (the spinners
+ *              or the order). Updates the frame limits and the scene.
+ *
+ * Inputs: int - not used
+ * Output: none
+ */
+void SheetDialog::editObjectChanged(int)
+{
+  updateFrames();
+  updateScene();
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Is the matrix flipped horizontally?
+ *
+ * Inputs: none
+ * Output: bool - true if the matrix is flipped horizontally
+ */
+bool SheetDialog::isFlipHorizontal()
+{
+  return button_flip_h->isChecked();
+}
+
+/*
+ * Description: Is the matrix flipped vertically?
+ *
+ * Inputs: none
+ * Output: bool - true if the matrix is flipped vertically
+ */
+bool SheetDialog::isFlipVertical()
+{
+  return button_flip_v->isChecked();
+}
+
+/*
+ * Description: Returns the cell layout of the sheet, from the edit objects.
+ *              This can be passed into EditorMatrix to slice the sheet.
+ *
+ * Inputs: none
+ * Output: EditorSheetLayout - the cell layout
+ */
+EditorSheetLayout SheetDialog::getLayout()
+{
+  EditorSheetLayout layout;
+  layout.cell_height = spin_cell_h->value();
+  layout.cell_width = spin_cell_w->value();
+  layout.frames = spin_frames->value();
+  layout.frames_down = (cbox_order->currentIndex() == 1);
+  layout.tiles_h = spin_tiles_h->value();
+  layout.tiles_w = spin_tiles_w->value();
+  return layout;
+}
+
+/*
+ * Description: Returns the path and file of the sprite sheet appended
+ *              together.
+ *
+ * Inputs: none
+ * Output: QString - the sheet path with file name
+ */
+QString SheetDialog::getSheetPath()
+{
+  return initial_path + initial_filename;
+}
@@ -490,6 +490,23 @@ QString EditorHelpers::getProjectDir()
   return project_dir;
 }
 
+/*
+ * Description: Returns the full path of a path trimmed to the project
+ *              directory (see trimPath()), with native separators. Paths that
+ *              are already absolute are returned as is.
+ *
+ * Inputs: QString path - the trimmed path
+ * Output: QString - the full path. Empty if the path is empty
+ */
+QString EditorHelpers::getProjectPath(QString path)
+{
+  if(path.isEmpty())
+    return path;
+  if(QDir::isAbsolutePath(path))
+    return QDir::toNativeSeparators(path);
+  return QDir::toNativeSeparators(getProjectDir() + "/" + path);
+}
+
 /*
  * Description: Returns the sprite directory, based on the location in the
  *              Univursa project folder.
@@ -577,6 +594,104 @@ QList<QString> EditorHelpers::getValidFileSplit(QString file, bool* base)
   return stack;
 }
 
+/*
+ * Description: Returns the interned tag of the save file element, so loaders
+ *              dispatch on the tag with a switch instead of a chain of string
+ *              compares. The table is built on first use and looked up
+ *              without copying the element.
+ *
+ * Inputs: const std::string &element - the element name
+ * Output: EditorEnumDb::XmlTag - the tag. XML_NONE if not a known element
+ */
+EditorEnumDb::XmlTag EditorHelpers::getXmlTag(const std::string &element)
+{
+  static const QHash<QByteArray,EditorEnumDb::XmlTag> tags =
+  {
+    {"action", EditorEnumDb::XML_ACTION},
+    {"active", EditorEnumDb::XML_ACTIVE},
+    {"activetime", EditorEnumDb::XML_ACTIVETIME},
+    {"animation", EditorEnumDb::XML_ANIMATION},
+    {"app", EditorEnumDb::XML_APP},
+    {"base", EditorEnumDb::XML_BASE},
+    {"battlescene", EditorEnumDb::XML_BATTLESCENE},
+    {"brightness", EditorEnumDb::XML_BRIGHTNESS},
+    {"class", EditorEnumDb::XML_CLASS},
+    {"color_b", EditorEnumDb::XML_COLOR_B},
+    {"color_g", EditorEnumDb::XML_COLOR_G},
+    {"color_r", EditorEnumDb::XML_COLOR_R},
+    {"core", EditorEnumDb::XML_CORE},
+    {"core_id", EditorEnumDb::XML_CORE_ID},
+    {"delay", EditorEnumDb::XML_DELAY},
+    {"description", EditorEnumDb::XML_DESCRIPTION},
+    {"enhancer", EditorEnumDb::XML_ENHANCER},
+    {"enter", EditorEnumDb::XML_ENTER},
+    {"enterset", EditorEnumDb::XML_ENTERSET},
+    {"event", EditorEnumDb::XML_EVENT},
+    {"eventset", EditorEnumDb::XML_EVENTSET},
+    {"exit", EditorEnumDb::XML_EXIT},
+    {"exitset", EditorEnumDb::XML_EXITSET},
+    {"forcedinteraction", EditorEnumDb::XML_FORCEDINTERACTION},
+    {"forward", EditorEnumDb::XML_FORWARD},
+    {"game", EditorEnumDb::XML_GAME},
+    {"game_id", EditorEnumDb::XML_GAME_ID},
+    {"height", EditorEnumDb::XML_HEIGHT},
+    {"image", EditorEnumDb::XML_IMAGE},
+    {"item", EditorEnumDb::XML_ITEM},
+    {"lock", EditorEnumDb::XML_LOCK},
+    {"lockevent", EditorEnumDb::XML_LOCKEVENT},
+    {"lower", EditorEnumDb::XML_LOWER},
+    {"main", EditorEnumDb::XML_MAIN},
+    {"map", EditorEnumDb::XML_MAP},
+    {"mapio", EditorEnumDb::XML_MAPIO},
+    {"mapitem", EditorEnumDb::XML_MAPITEM},
+    {"mapnpc", EditorEnumDb::XML_MAPNPC},
+    {"mapperson", EditorEnumDb::XML_MAPPERSON},
+    {"mapthing", EditorEnumDb::XML_MAPTHING},
+    {"music", EditorEnumDb::XML_MUSIC},
+    {"name", EditorEnumDb::XML_NAME},
+    {"node", EditorEnumDb::XML_NODE},
+    {"nodestate", EditorEnumDb::XML_NODESTATE},
+    {"opacity", EditorEnumDb::XML_OPACITY},
+    {"overlay", EditorEnumDb::XML_OVERLAY},
+    {"party", EditorEnumDb::XML_PARTY},
+    {"passability", EditorEnumDb::XML_PASSABILITY},
+    {"path", EditorEnumDb::XML_PATH},
+    {"person", EditorEnumDb::XML_PERSON},
+    {"race", EditorEnumDb::XML_RACE},
+    {"rendermatrix", EditorEnumDb::XML_RENDERMATRIX},
+    {"rotation", EditorEnumDb::XML_ROTATION},
+    {"section", EditorEnumDb::XML_SECTION},
+    {"skill", EditorEnumDb::XML_SKILL},
+    {"skillset", EditorEnumDb::XML_SKILLSET},
+    {"sound", EditorEnumDb::XML_SOUND},
+    {"sound_id", EditorEnumDb::XML_SOUND_ID},
+    {"sprite", EditorEnumDb::XML_SPRITE},
+    {"sprite_id", EditorEnumDb::XML_SPRITE_ID},
+    {"sprites", EditorEnumDb::XML_SPRITES},
+    {"startnode", EditorEnumDb::XML_STARTNODE},
+    {"startpoint", EditorEnumDb::XML_STARTPOINT},
+    {"tileevent", EditorEnumDb::XML_TILEEVENT},
+    {"trackmax", EditorEnumDb::XML_TRACKMAX},
+    {"trackmin", EditorEnumDb::XML_TRACKMIN},
+    {"trackrun", EditorEnumDb::XML_TRACKRUN},
+    {"tracking", EditorEnumDb::XML_TRACKING},
+    {"underlay", EditorEnumDb::XML_UNDERLAY},
+    {"unlockevent", EditorEnumDb::XML_UNLOCKEVENT},
+    {"unlockparse", EditorEnumDb::XML_UNLOCKPARSE},
+    {"upper", EditorEnumDb::XML_UPPER},
+    {"visible", EditorEnumDb::XML_VISIBLE},
+    {"weather", EditorEnumDb::XML_WEATHER},
+    {"width", EditorEnumDb::XML_WIDTH},
+    {"x", EditorEnumDb::XML_X},
+    {"xyflip", EditorEnumDb::XML_XYFLIP},
+    {"y", EditorEnumDb::XML_Y}
+  };
+
+  return tags.value(QByteArray::fromRawData(element.data(),
+                                            static_cast<int>(element.size())),
+                    EditorEnumDb::XML_NONE);
+}
+
 /*
  * Description: Takes a reference ID and a list of strings and returns the index
  *              of the found connected string. If none found, -1 is returned.
@@ -700,6 +815,64 @@ QList<QPair<QString,QString>> EditorHelpers::optimizePoints(
   return return_set;
 }
 
+/*
+ * Description: Paints the passability state into the bound with one blit. All
+ *              16 combinations of the directional icons are composed once per
+ *              device pixel size (so once per zoom level) into a sheet that is
+ *              indexed by the passability number (see getPassabilityNum()).
+ *
+ * Inputs: QPainter* painter - the painter to render with
+ *         TileIcons* icons - the icon set, which holds the cached sheets
+ *         const QRect &bound - the tile bound, in painter coordinates
+ *         int passability_num - the passability number (0 - 15)
+ * Output: none
+ */
+void EditorHelpers::paintPassability(QPainter* painter, TileIcons* icons,
+                                     const QRect &bound, int passability_num)
+{
+  const int kSHEET_MAX = 256;
+  const int kSTATES = 16;
+
+  if(painter != nullptr && icons != nullptr && icons->passN != nullptr &&
+     passability_num >= 0 && passability_num < kSTATES)
+  {
+    /* Determine the device pixel size of the tile */
+    qreal scale = painter->worldTransform().mapRect(QRectF(bound)).width();
+    if(painter->device() != nullptr)
+      scale *= painter->device()->devicePixelRatioF();
+    int size = qBound(1, qRound(scale), kSHEET_MAX);
+
+    /* Compose the sheet, if not available at this size */
+    if(!icons->pass_sheets.contains(size))
+    {
+      QPixmap sheet(size * kSTATES, size);
+      sheet.fill(Qt::transparent);
+
+      QPainter sheet_painter(&sheet);
+      sheet_painter.setRenderHint(QPainter::SmoothPixmapTransform);
+      for(int i = 0; i < kSTATES; i++)
+      {
+        QRect cell(i * size, 0, size, size);
+        sheet_painter.drawPixmap(cell, (i & 8) ? *icons->passN
+                                               : *icons->nopassN);
+        sheet_painter.drawPixmap(cell, (i & 4) ? *icons->passE
+                                               : *icons->nopassE);
+        sheet_painter.drawPixmap(cell, (i & 2) ? *icons->passS
+                                               : *icons->nopassS);
+        sheet_painter.drawPixmap(cell, (i & 1) ? *icons->passW
+                                               : *icons->nopassW);
+      }
+      sheet_painter.end();
+
+      icons->pass_sheets.insert(size, sheet);
+    }
+
+    /* Single blit of the state */
+    painter->drawPixmap(bound, icons->pass_sheets[size],
+                        QRect(passability_num * size, 0, size, size));
+  }
+}
+
 /*
  * Description: Rectilinear split of the points to rectangle sets that can
  *              be stored within the file.
@@ -754,6 +754,7 @@ void BattleSceneView::btnSave()
     scene_base->setChanged(false);
     if(changed_name)
       emit nameChange(scene_base->getNameList());
+    emit dataSaved();
   }
 }
 
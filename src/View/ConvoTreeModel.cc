@@ -0,0 +1,494 @@
+/*******************************************************************************
+ * Class Name: ConvoTreeModel
+ * Date Created: October 19, 2026
+ * Inheritance: QAbstractItemModel
+ * Description: The item model of the conversation tree in the event view. The
+ *              tree mirrors the conversation, with straight runs kept at one
+ *              level and options nested below the entry that offers them.
+ *              Children are only read from the conversation once their parent
+ *              is expanded and edits are merged into the loaded nodes, so only
+ *              the rows that changed are inserted, removed or repainted.
+ ******************************************************************************/
+#include "View/ConvoTreeModel.h"
+
+/*============================================================================
+ * CONSTRUCTORS / DESTRUCTORS
+ *===========================================================================*/
+
+/*
+ * Description: Constructor function. The tree is empty until a conversation
+ *              is set.
+ *
+ * Inputs: QObject* parent - the parent object
+ */
+ConvoTreeModel::ConvoTreeModel(QObject* parent) : QAbstractItemModel(parent)
+{
+  root = new ConvoNode;
+  root->convo = nullptr;
+  root->fetched = true;
+  root->has_children = false;
+  root->option = false;
+  root->parent = nullptr;
+  root->row = 0;
+}
+
+/*
+ * Description: Destructor function
+ */
+ConvoTreeModel::~ConvoTreeModel()
+{
+  deleteNode(root);
+}
+
+/*============================================================================
+ * PRIVATE FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Creates a node for the entry. Entries with nothing below them
+ *              are created as fetched, so any children added later are merged
+ *              in as inserted rows.
+ *
+ * Inputs: const ConvoEntry &entry - the conversation entry
+ *         ConvoNode* parent - the parent node
+ *         int row - the row below the parent
+ * Output: ConvoNode* - the new node
+ */
+ConvoNode* ConvoTreeModel::createNode(const ConvoEntry &entry,
+                                      ConvoNode* parent, int row)
+{
+  ConvoNode* node = new ConvoNode;
+  node->parent = parent;
+  node->row = row;
+  setNodeEntry(node, entry);
+  node->fetched = !node->has_children;
+  return node;
+}
+
+/*
+ * Description: Deletes the node and all loaded children.
+ *
+ * Inputs: ConvoNode* node - the node to delete
+ * Output: none
+ */
+void ConvoTreeModel::deleteNode(ConvoNode* node)
+{
+  for(int i = 0; i < node->children.size(); i++)
+    deleteNode(node->children[i]);
+  delete node;
+}
+
+/*
+ * Description: Returns the entries shown below the conversation entry. An
+ *              entry with more than one next has them as options. An option
+ *              with one next has the straight run that follows it. Anything
+ *              else continues on its own level.
+ *
+ * Inputs: Conversation* convo - the conversation entry
+ *         bool option - true if the entry is an option
+ * Output: QList<ConvoEntry> - the entries below
+ */
+QList<ConvoEntry> ConvoTreeModel::getChildEntries(Conversation* convo,
+                                                  bool option)
+{
+  QList<ConvoEntry> entries;
+
+  if(convo != nullptr)
+  {
+    if(convo->next.size() > 1)
+    {
+      for(uint32_t i = 0; i < convo->next.size(); i++)
+      {
+        ConvoEntry entry;
+        entry.convo = &convo->next[i];
+        entry.option = true;
+        entries.append(entry);
+      }
+    }
+    else if(option && convo->next.size() == 1)
+    {
+      entries = getRun(&convo->next[0]);
+    }
+  }
+
+  return entries;
+}
+
+/*
+ * Description: Returns the node of the model index.
+ *
+ * Inputs: const QModelIndex &index - the model index
+ * Output: ConvoNode* - the node. The root if the index is invalid
+ */
+ConvoNode* ConvoTreeModel::getNode(const QModelIndex &index) const
+{
+  if(index.isValid())
+    return static_cast<ConvoNode*>(index.internalPointer());
+  return root;
+}
+
+/*
+ * Description: Returns the display text of the entry. Options show their
+ *              text and others the speaking thing ID and text. Entries that
+ *              trigger an event are prefixed with an '@'.
+ *
+ * Inputs: const ConvoEntry &entry - the conversation entry
+ * Output: QString - the display text
+ */
+QString ConvoTreeModel::getText(const ConvoEntry &entry)
+{
+  QString text = "";
+  if(entry.convo->action_event.classification != EventClassifier::NOEVENT)
+    text += "@";
+  if(entry.option)
+    return text + QString::fromStdString(entry.convo->text);
+  return text + QString::number(entry.convo->thing_id) + ": " +
+         QString::fromStdString(entry.convo->text);
+}
+
+/*
+ * Description: Returns the entries of the straight run starting at the entry.
+ *              The run follows single nexts and ends on the first entry with
+ *              none or with options.
+ *
+ * Inputs: Conversation* convo - the first entry of the run
+ * Output: QList<ConvoEntry> - the entries of the run
+ */
+QList<ConvoEntry> ConvoTreeModel::getRun(Conversation* convo)
+{
+  QList<ConvoEntry> entries;
+
+  while(convo != nullptr)
+  {
+    ConvoEntry entry;
+    entry.convo = convo;
+    entry.option = false;
+    entries.append(entry);
+
+    if(convo->next.size() == 1)
+      convo = &convo->next[0];
+    else
+      convo = nullptr;
+  }
+
+  return entries;
+}
+
+/*
+ * Description: Merges the new entries into the loaded children of the node.
+ *              Rows that are unchanged at the front and back are kept. If the
+ *              rows in between are the same count, they were edited in place
+ *              and are repainted. Otherwise they are removed and the new rows
+ *              inserted. Loaded children of every row are merged in turn.
+ *              Nodes are never read for their old entry, since an edit may
+ *              have moved the conversation in memory.
+ *
+ * Inputs: ConvoNode* node - the node to merge into
+ *         const QModelIndex &index - the model index of the node
+ *         QList<ConvoEntry> entries - the new entries below the node
+ * Output: none
+ */
+void ConvoTreeModel::mergeNode(ConvoNode* node, const QModelIndex &index,
+                               QList<ConvoEntry> entries)
+{
+  if(!node->fetched)
+    return;
+
+  QList<ConvoNode*> &rows = node->children;
+  int old_total = rows.size();
+  int new_total = entries.size();
+
+  /* Match the unchanged rows at the front and back */
+  int front = 0;
+  while(front < old_total && front < new_total &&
+        rows[front]->option == entries[front].option &&
+        rows[front]->text == getText(entries[front]))
+    front++;
+  int back = 0;
+  while(back < old_total - front && back < new_total - front &&
+        rows[old_total - back - 1]->option ==
+                                    entries[new_total - back - 1].option &&
+        rows[old_total - back - 1]->text ==
+                                    getText(entries[new_total - back - 1]))
+    back++;
+  int old_middle = old_total - front - back;
+  int new_middle = new_total - front - back;
+
+  /* Edited in place */
+  if(old_middle == new_middle)
+  {
+    for(int i = front; i < front + new_middle; i++)
+      setNodeEntry(rows[i], entries[i]);
+    if(new_middle > 0)
+      emit dataChanged(this->index(front, 0, index),
+                       this->index(front + new_middle - 1, 0, index));
+  }
+  /* Rows removed or inserted */
+  else
+  {
+    if(old_middle > 0)
+    {
+      beginRemoveRows(index, front, front + old_middle - 1);
+      for(int i = 0; i < old_middle; i++)
+        deleteNode(rows.takeAt(front));
+      endRemoveRows();
+    }
+
+    if(new_middle > 0)
+    {
+      beginInsertRows(index, front, front + new_middle - 1);
+      for(int i = front; i < front + new_middle; i++)
+        rows.insert(i, createNode(entries[i], node, i));
+      endInsertRows();
+    }
+  }
+
+  /* Refresh the rows and merge the loaded children */
+  for(int i = 0; i < rows.size(); i++)
+  {
+    rows[i]->row = i;
+    setNodeEntry(rows[i], entries[i]);
+    if(rows[i]->fetched)
+      mergeNode(rows[i], this->index(i, 0, index),
+                getChildEntries(rows[i]->convo, rows[i]->option));
+  }
+}
+
+/*
+ * Description: Updates the node to the new entry. The loaded children are
+ *              left as is, for the merge to update.
+ *
+ * Inputs: ConvoNode* node - the node to update
+ *         const ConvoEntry &entry - the new conversation entry
+ * Output: none
+ */
+void ConvoTreeModel::setNodeEntry(ConvoNode* node, const ConvoEntry &entry)
+{
+  node->convo = entry.convo;
+  node->option = entry.option;
+  node->text = getText(entry);
+  node->has_children = (entry.convo->next.size() > 1 ||
+                        (entry.option && entry.convo->next.size() == 1));
+}
+
+/*============================================================================
+ * PUBLIC FUNCTIONS
+ *===========================================================================*/
+
+/*
+ * Description: Returns if the children of the parent are still to be read.
+ *
+ * Inputs: const QModelIndex &parent - the parent index
+ * Output: bool - true if there are children to fetch
+ */
+bool ConvoTreeModel::canFetchMore(const QModelIndex &parent) const
+{
+  ConvoNode* node = getNode(parent);
+  return (!node->fetched && node->has_children);
+}
+
+/*
+ * Description: Returns the number of columns. The tree has one.
+ *
+ * Inputs: const QModelIndex &parent - not used
+ * Output: int - the column count
+ */
+int ConvoTreeModel::columnCount(const QModelIndex &parent) const
+{
+  (void)parent;
+  return 1;
+}
+
+/*
+ * Description: Returns the display text of the index.
+ *
+ * Inputs: const QModelIndex &index - the model index
+ *         int role - the data role
+ * Output: QVariant - the text for the display role. Invalid otherwise
+ */
+QVariant ConvoTreeModel::data(const QModelIndex &index, int role) const
+{
+  if(index.isValid() && role == Qt::DisplayRole)
+    return getNode(index)->text;
+  return QVariant();
+}
+
+/*
+ * Description: Reads the children of the parent from the conversation. Called
+ *              by the view as the parent is expanded.
+ *
+ * Inputs: const QModelIndex &parent - the parent index
+ * Output: none
+ */
+void ConvoTreeModel::fetchMore(const QModelIndex &parent)
+{
+  ConvoNode* node = getNode(parent);
+  if(node->fetched)
+    return;
+
+  QList<ConvoEntry> entries = getChildEntries(node->convo, node->option);
+  if(entries.size() > 0)
+  {
+    beginInsertRows(parent, 0, entries.size() - 1);
+    for(int i = 0; i < entries.size(); i++)
+      node->children.append(createNode(entries[i], node, i));
+    node->fetched = true;
+    endInsertRows();
+  }
+  else
+  {
+    node->fetched = true;
+  }
+}
+
+/*
+ * Description: Returns the number of children of the index, whether they are
+ *              fetched or not.
+ *
+ * Inputs: const QModelIndex &index - the model index
+ * Output: int - the child count
+ */
+int ConvoTreeModel::getChildTotal(const QModelIndex &index) const
+{
+  ConvoNode* node = getNode(index);
+  if(node->fetched)
+    return node->children.size();
+  return getChildEntries(node->convo, node->option).size();
+}
+
+/*
+ * Description: Returns the conversation entry of the index.
+ *
+ * Inputs: const QModelIndex &index - the model index
+ * Output: Conversation* - the entry. NULL if invalid
+ */
+Conversation* ConvoTreeModel::getConvo(const QModelIndex &index) const
+{
+  if(index.isValid())
+    return getNode(index)->convo;
+  return nullptr;
+}
+
+/*
+ * Description: Returns the model index of the path. Rows are followed down
+ *              from the top, fetching any parent not yet read. Opposite call
+ *              of getPath().
+ *
+ * Inputs: const EditorConvoPath &path - the conversation path
+ * Output: QModelIndex - the model index. Invalid if not found
+ */
+QModelIndex ConvoTreeModel::getIndex(const EditorConvoPath &path)
+{
+  QVector<int> rows = path.getSteps();
+  QModelIndex found;
+  ConvoNode* node = root;
+  for(int i = 0; i < rows.size(); i++)
+  {
+    int row = rows[i] - 1;
+    if(!node->fetched)
+      fetchMore(found);
+    if(row < 0 || row >= node->children.size())
+      return QModelIndex();
+
+    found = index(row, 0, found);
+    node = node->children[row];
+  }
+
+  return found;
+}
+
+/*
+ * Description: Returns the conversation path of the model index, found by
+ *              walking up the parents. Opposite call of getIndex().
+ *
+ * Inputs: const QModelIndex &index - the model index
+ * Output: EditorConvoPath - the path. Empty if invalid
+ */
+EditorConvoPath ConvoTreeModel::getPath(const QModelIndex &index) const
+{
+  QVector<int> rows;
+  for(ConvoNode* node = getNode(index); node != root; node = node->parent)
+    rows.prepend(node->row + 1);
+
+  EditorConvoPath path;
+  for(int i = 0; i < rows.size(); i++)
+    path.append(rows[i]);
+  return path;
+}
+
+/*
+ * Description: Returns if the parent has children, whether they are fetched
+ *              or not. Allows the view to show the expand control without
+ *              reading the children.
+ *
+ * Inputs: const QModelIndex &parent - the parent index
+ * Output: bool - true if there are children
+ */
+bool ConvoTreeModel::hasChildren(const QModelIndex &parent) const
+{
+  ConvoNode* node = getNode(parent);
+  if(node->fetched)
+    return !node->children.isEmpty();
+  return node->has_children;
+}
+
+/*
+ * Description: Returns the model index of the row below the parent.
+ *
+ * Inputs: int row - the row
+ *         int column - the column
+ *         const QModelIndex &parent - the parent index
+ * Output: QModelIndex - the model index. Invalid if out of range
+ */
+QModelIndex ConvoTreeModel::index(int row, int column,
+                                  const QModelIndex &parent) const
+{
+  if(!hasIndex(row, column, parent))
+    return QModelIndex();
+  return createIndex(row, column, getNode(parent)->children[row]);
+}
+
+/*
+ * Description: Returns the parent of the model index, from the node parent.
+ *
+ * Inputs: const QModelIndex &index - the model index
+ * Output: QModelIndex - the parent. Invalid if top level
+ */
+QModelIndex ConvoTreeModel::parent(const QModelIndex &index) const
+{
+  if(!index.isValid())
+    return QModelIndex();
+
+  ConvoNode* parent_node = getNode(index)->parent;
+  if(parent_node == nullptr || parent_node == root)
+    return QModelIndex();
+  return createIndex(parent_node->row, 0, parent_node);
+}
+
+/*
+ * Description: Returns the number of fetched children of the parent.
+ *
+ * Inputs: const QModelIndex &parent - the parent index
+ * Output: int - the row count
+ */
+int ConvoTreeModel::rowCount(const QModelIndex &parent) const
+{
+  if(parent.column() > 0)
+    return 0;
+  return getNode(parent)->children.size();
+}
+
+/*
+ * Description: Sets the conversation to show. It is merged into the loaded
+ *              tree, so after an edit only the changed rows are signalled and
+ *              the expanded state of the rest is kept. Must be called after
+ *              every edit of the conversation, before the tree is used again.
+ *
+ * Inputs: Conversation* convo - the conversation. NULL to clear
+ * Output: none
+ */
+void ConvoTreeModel::setConversation(Conversation* convo)
+{
+  root->convo = convo;
+  mergeNode(root, QModelIndex(), getRun(convo));
+}
@@ -30,8 +30,11 @@ EventView::EventView(EditorEvent* event, QWidget* parent,
   this->event = nullptr;
   this->limiter = limiter;
   pop_convo = nullptr;
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
   this->view_only = view_only;
+  model_items = EditorListModel::getShared(EditorEnumDb::ITEM_LIST);
+  model_maps = EditorListModel::getShared(EditorEnumDb::MAP_LIST);
+  model_sounds = EditorListModel::getShared(EditorEnumDb::SOUND_LIST);
   waiting_tile_convo = false;
   waiting_tile_event = false;
   waiting_tile = false;
@@ -149,19 +152,21 @@ void EventView::createLayout()
     else if(available_events[i] == EventClassifier::CONVERSATION)
     {
       QWidget* widget_convo = new QWidget(this);
-      convo_tree = new QTreeWidget(this);
+      convo_model = new ConvoTreeModel(this);
+      convo_tree = new QTreeView(this);
+      convo_tree->setModel(convo_model);
       convo_tree->setContextMenuPolicy(Qt::CustomContextMenu);
       //convo_tree->setMinimumWidth(320);
       convo_tree->setHorizontalScrollBarPolicy(Qt::ScrollBarAsNeeded);
       convo_tree->header()->hide();
-      connect(convo_tree, SIGNAL(itemCollapsed(QTreeWidgetItem*)),
-              this, SLOT(resizeTree(QTreeWidgetItem*)));
-      connect(convo_tree, SIGNAL(itemExpanded(QTreeWidgetItem*)),
-              this, SLOT(resizeTree(QTreeWidgetItem*)));
+      connect(convo_tree, SIGNAL(collapsed(QModelIndex)),
+              this, SLOT(resizeTree(QModelIndex)));
+      connect(convo_tree, SIGNAL(expanded(QModelIndex)),
+              this, SLOT(resizeTree(QModelIndex)));
       connect(convo_tree, SIGNAL(customContextMenuRequested(QPoint)),
               this, SLOT(convoMenuRequested(QPoint)));
-      connect(convo_tree, SIGNAL(itemDoubleClicked(QTreeWidgetItem*,int)),
-              this, SLOT(convoDoubleClick(QTreeWidgetItem*,int)));
+      connect(convo_tree, SIGNAL(doubleClicked(QModelIndex)),
+              this, SLOT(convoDoubleClick(QModelIndex)));
       QVBoxLayout* layout_convo = new QVBoxLayout(widget_convo);
       layout_convo->addWidget(convo_tree);
       view_stack->addWidget(widget_convo);
@@ -174,6 +179,7 @@ void EventView::createLayout()
       QLabel* lbl_give_count = new QLabel("Count:", this);
       QLabel* lbl_give_chance = new QLabel("Chance:", this);
       item_name = new QComboBox(this);
+      item_name->setModel(model_items);
       EditorHelpers::comboBoxOptimize(item_name);
       item_name->setMinimumWidth(200);
       connect(item_name, SIGNAL(currentIndexChanged(int)),
@@ -215,6 +221,7 @@ void EventView::createLayout()
       QLabel* lbl_take_item = new QLabel("Item:", this);
       QLabel* lbl_take_count = new QLabel("Count:", this);
       take_name = new QComboBox(this);
+      take_name->setModel(model_items);
       EditorHelpers::comboBoxOptimize(take_name);
       take_name->setMinimumWidth(200);
       connect(take_name, SIGNAL(currentIndexChanged(int)),
@@ -240,6 +247,7 @@ void EventView::createLayout()
       QWidget* widget_map = new QWidget(this);
       QLabel* lbl_map_name = new QLabel("Map:");
       map_name = new QComboBox(this);
+      map_name->setModel(model_maps);
       EditorHelpers::comboBoxOptimize(map_name);
       map_name->setMinimumWidth(200);
       connect(map_name, SIGNAL(currentIndexChanged(int)),
@@ -788,6 +796,7 @@ void EventView::createLayout()
   QLabel* lbl_sound_2 = new QLabel("Sound:", this);
   sound_layout->addWidget(lbl_sound_2);
   combo_sound = new QComboBox(this);
+  combo_sound->setModel(model_sounds);
   EditorHelpers::comboBoxOptimize(combo_sound);
   combo_sound->setDisabled(true);
   connect(combo_sound, SIGNAL(currentIndexChanged(QString)),
@@ -873,9 +882,6 @@ void EventView::editConversation(Conversation* convo, bool is_option)
     pop_convo = new ConvoDialog(convo, is_option, limiter, this);
     pop_convo->setListMapThings(list_map_things, list_map_ios, list_map_items,
                                 list_map_persons, list_map_npcs);
-    pop_convo->getEventView()->setListItems(list_items);
-    pop_convo->getEventView()->setListMaps(list_maps);
-    pop_convo->getEventView()->setListSounds(list_sounds);
     pop_convo->getEventView()->setListSubmaps(list_submaps);
     connect(pop_convo->getEventView(), SIGNAL(selectTile()),
             this, SLOT(selectTileConvo()));
@@ -930,12 +936,9 @@ void EventView::editEvent(Event* edit_event)
 
     pop_event_view = new EventView(nullptr, pop_event,
                                    (EventClassifier)limit_int);
-    pop_event_view->setListItems(list_items);
-    pop_event_view->setListMaps(list_maps);
     pop_event_view->setListMapThings(list_map_things, list_map_ios,
                                      list_map_items, list_map_persons,
                                      list_map_npcs);
-    pop_event_view->setListSounds(list_sounds);
     pop_event_view->setListSubmaps(list_submaps);
     connect(pop_event_view, SIGNAL(selectTile()),
             this, SLOT(selectTileEvent()));
@@ -949,85 +952,26 @@ void EventView::editEvent(Event* edit_event)
 }
 
 /*
- * Description: Returns the conversation item based on the base index. This
- *              parses the tree to find the item. The base index is in the
- *              form: 1.5.7, not 1.5.1.1.1.1.1.1.1.
+ * Description: Returns the conversation model index based on the path.
  *
- * Inputs: QString base_index - the base index representation of the segment
- * Output: QTreeWidgetItem* - the found corresponding item. NULL if failed.
+ * Inputs: const EditorConvoPath &path - the path of the segment
+ * Output: QModelIndex - the found corresponding index. Invalid if failed.
  */
-QTreeWidgetItem* EventView::getConvo(QString base_index)
+QModelIndex EventView::getConvo(const EditorConvoPath &path)
 {
-  QTreeWidgetItem* item = NULL;
-
-  if(!base_index.isEmpty())
-  {
-    QStringList list = base_index.split(".");
-    QTreeWidgetItem* ref = NULL;
-
-    for(int i = 0; i < list.size(); i++)
-    {
-      if(ref == NULL && i == 0)
-        ref = convo_tree->topLevelItem(list[i].toInt() - 1);
-      else if(ref != NULL && i != 0)
-        ref = ref->child(list[i].toInt() - 1);
-    }
-
-    item = ref;
-  }
-
-  return item;
+  return convo_model->getIndex(path);
 }
 
 /*
- * Description: Returns the conversation index of the reference item
- *              corresponding to the parent item. This is a recursive call and
- *              by taking an item in the widget, and NULL parent, it searches
- *              the entire tree and returns the base index of the item. Opposite
+ * Description: Returns the conversation path of the model index. Opposite
  *              call of getConvo().
  *
- * Inputs: QTreeWidgetItem* ref - the reference searching for
- *         QTreeWidgetItem* parent - the previous call reference
- * Output: QString - the resulting base index
+ * Inputs: const QModelIndex &ref - the model index of the segment
+ * Output: EditorConvoPath - the resulting path
  */
-QString EventView::getConvoIndex(QTreeWidgetItem* ref, QTreeWidgetItem* parent)
+EditorConvoPath EventView::getConvoPath(const QModelIndex &ref)
 {
-  /* If parent is NULL, start at head element of list */
-  if(parent == NULL)
-  {
-    for(int i = 0; i < convo_tree->topLevelItemCount(); i++)
-    {
-      if(convo_tree->topLevelItem(i) == ref)
-      {
-        return QString::number(i+1);
-      }
-      else
-      {
-        QString result = getConvoIndex(ref, convo_tree->topLevelItem(i));
-        if(!result.isEmpty())
-          return (QString::number(i+1) + result);
-      }
-    }
-  }
-  /* Otherwise, use parent tree widget item */
-  else
-  {
-    for(int i = 0; i < parent->childCount(); i++)
-    {
-      if(parent->child(i) == ref)
-      {
-        return ("." + QString::number(i+1));
-      }
-      else
-      {
-        QString result = getConvoIndex(ref, parent->child(i));
-        if(!result.isEmpty())
-          return ("." + QString::number(i+1) + result);
-      }
-    }
-  }
-
-  return "";
+  return convo_model->getPath(ref);
 }
 
 /*
@@ -1107,20 +1051,9 @@ void EventView::setLayoutData()
     /* -- CONVERSATION -- */
     else if(event->getEventType() == EventClassifier::CONVERSATION)
     {
-      /* Clear the tree */
-      convo_tree->clear();
-
-      /* Conversation reference */
-      QTreeWidgetItem* parent = NULL;
-      Conversation* ref = event->getConversation();
-
-      /* Proceed if not null */
-      if(ref != NULL)
-      {
-        /* Recursive add */
-        updateConvoTree(ref, parent);
-        convo_tree->resizeColumnToContents(0);
-      }
+      /* Merge the conversation into the tree */
+      convo_model->setConversation(event->getConversation());
+      convo_tree->resizeColumnToContents(0);
     }
     /* -- ITEM GIVE -- */
     else if(event->getEventType() == EventClassifier::ITEMGIVE)
@@ -1135,25 +1068,16 @@ void EventView::setLayoutData()
       item_drop->setChecked(auto_drop);
 
       /* Attempt to find the item name in the combo box */
-      int index = -1;
-      for(int i = 0; i < list_items.size(); i++)
+      int index = model_items->getRow(event->getGiveItemID());
+      if(index >= 0)
       {
-        QStringList set = list_items[i].split(":");
-        if(set.size() == 2)
-        {
-          if(set.front().toInt() == event->getGiveItemID())
-          {
-            item_name->setCurrentIndex(i);
-            index = i;
-          }
-        }
+        item_name->setCurrentIndex(index);
       }
-
       /* If index < 0 (not found), set to first */
-      if(index < 0)
+      else
       {
         item_name->setCurrentIndex(0);
-        if(list_items.size() > 0)
+        if(model_items->rowCount() > 0)
           giveItemChanged(0);
       }
     }
@@ -1163,25 +1087,16 @@ void EventView::setLayoutData()
       take_count->setValue(event->getTakeItemCount());
 
       /* Attempt to find the item name in the combo box */
-      int index = -1;
-      for(int i = 0; i < list_items.size(); i++)
+      int index = model_items->getRow(event->getTakeItemID());
+      if(index >= 0)
       {
-        QStringList set = list_items[i].split(":");
-        if(set.size() == 2)
-        {
-          if(set.front().toInt() == event->getTakeItemID())
-          {
-            take_name->setCurrentIndex(i);
-            index = i;
-          }
-        }
+        take_name->setCurrentIndex(index);
       }
-
       /* If index < 0 (not found), set to first */
-      if(index < 0)
+      else
       {
         take_name->setCurrentIndex(0);
-        if(list_items.size() > 0)
+        if(model_items->rowCount() > 0)
           takeItemChanged(0);
       }
     }
@@ -1189,25 +1104,16 @@ void EventView::setLayoutData()
     else if(event->getEventType() == EventClassifier::MAPSWITCH)
     {
       /* Attempt to find the map name in the combo box */
-      int index = -1;
-      for(int i = 0; i < list_maps.size(); i++)
+      int index = model_maps->getRow(event->getStartMapID());
+      if(index >= 0)
       {
-        QStringList set = list_maps[i].split(":");
-        if(set.size() == 2)
-        {
-          if(set.front().toInt() == event->getStartMapID())
-          {
-            map_name->setCurrentIndex(i);
-            index = i;
-          }
-        }
+        map_name->setCurrentIndex(index);
       }
-
       /* If index < 0 (not found), set to first */
-      if(index < 0)
+      else
       {
         map_name->setCurrentIndex(0);
-        if(list_maps.size() > 0)
+        if(model_maps->rowCount() > 0)
           changeMapChanged(0);
       }
     }
@@ -1496,19 +1402,11 @@ void EventView::setLayoutData()
 
     /* Data for sounds */
     if(event->getEventType() != EventClassifier::NOEVENT &&
-       list_sounds.size() > 0)
+       model_sounds->rowCount() > 0)
     {
       int index = -1;
       if(event->getSoundID() >= 0)
-      {
-        for(int i = 0; i < list_sounds.size(); i++)
-        {
-          QStringList str_list = list_sounds[i].split(':');
-          if(str_list.size() >= 2)
-            if(str_list.front().toInt() == event->getSoundID())
-              index = i;
-        }
-      }
+        index = model_sounds->getRow(event->getSoundID());
 
       if(index >= 0)
       {
@@ -1517,8 +1415,7 @@ void EventView::setLayoutData()
       else
       {
         combo_sound->setCurrentIndex(0);
-        if(list_sounds.size() > 0)
-          event->setSoundID(-1);
+        event->setSoundID(-1);
       }
     }
 
@@ -1537,62 +1434,6 @@ void EventView::setLayoutData()
   setDisabled(view_only);
 }
 
-/*
- * Description: Updates the convo tree with the new conversation reference,
- *              a parent widget item, and if this convo should be an option.
- *
- * Inputs: Conversation* ref - the reference conversation to update
- *         QTreeWidgetItem* parent - the parent widget that the item is being
- *                                   added to.
- *         bool option - true if the convo is an option
- * Output: none
- */
-void EventView::updateConvoTree(Conversation* ref, QTreeWidgetItem* parent,
-                                bool option)
-{
-  bool is_option = false;
-
-  /* Create the item */
-  QTreeWidgetItem* item;
-  if(parent != NULL)
-    item = new QTreeWidgetItem(parent);
-  else
-    item = new QTreeWidgetItem(convo_tree);
-
-  /* This will be used for flattening once new HTML tags are used */
-  //QString s = "<i>Test:</i><img src=\"blah.png\" /><br> A test case";
-  //s.remove(QRegExp("<[^>]*>"));
-  // // s == "Test: A test case"
-  /* End test */
-
-  /* Generate the text */
-  QString text = "";
-  if(ref->action_event.classification != EventClassifier::NOEVENT)
-    text += "@";
-  if(option)
-    item->setText(0, text + QString::fromStdString(ref->text));
-  else
-    item->setText(0, text + QString::number(ref->thing_id) + ": " +
-                     QString::fromStdString(ref->text));
-
-  /* Change the parent, if relevant for the next */
-  if(ref->next.size() > 1)
-  {
-    parent = item;
-    is_option = true;
-  }
-  else if(option)
-  {
-    parent = item;
-  }
-
-  /* Loop through and add next convos */
-  for(uint32_t i = 0; i < ref->next.size(); i++)
-  {
-    updateConvoTree(&ref->next[i], parent, is_option);
-  }
-}
-
 /*
  * Description: Updates the property list within the event set. This is based
  *              on the current type.
@@ -1951,14 +1792,12 @@ void EventView::categoryChanged(int index)
  */
 void EventView::changeMapChanged(int index)
 {
-  if(index >= 0 && index < list_maps.size())
-  {
-    QStringList list = list_maps[index].split(":");
-    if(list.size() == 2)
-    {
-      event->setEventStartMap(list.front().toInt(), event->getSoundID());
-    }
-  }
+  /* Rows of the shared model can shift under the combo, so only apply to a
+   * map switch event */
+  int id = model_maps->getID(index);
+  if(event != nullptr && event->getEventType() == EventClassifier::MAPSWITCH &&
+     id != EditorListModel::kNO_ID)
+    event->setEventStartMap(id, event->getSoundID());
 }
 
 /*
@@ -1981,34 +1820,26 @@ void EventView::changedOneShot(int state)
  */
 void EventView::changedSound(const QString & text)
 {
-  QStringList str_list = text.split(':');
+  (void)text;
 
-  /* If the list is two long, it is proper format - 001: Sound Example */
-  if(str_list.size() >= 2)
-  {
-    event->setSoundID(str_list.front().toInt());
-  }
-  /* Otherwise, unset the sound ID */
-  else
-  {
-    event->setSoundID(-1);
-  }
+  /* The row ID - unset (-1) for the "None" row */
+  if(event != nullptr)
+    event->setSoundID(model_sounds->getID(combo_sound->currentIndex()));
 }
 
 /*
  * Description: Slot which triggers when a conversation segment is double
  *              clicked. Initializes the edit of the segment (ConvoDialog).
  *
- * Inputs: QTreeWidgetItem* - not used
- *         int - not used
+ * Inputs: QModelIndex - not used
  * Output: none
  */
-void EventView::convoDoubleClick(QTreeWidgetItem*, int)
+void EventView::convoDoubleClick(QModelIndex)
 {
-  QTreeWidgetItem* selected = convo_tree->currentItem();
-  if(selected != NULL)
+  QModelIndex selected = convo_tree->currentIndex();
+  if(selected.isValid())
   {
-    rightclick_index = getConvoIndex(selected);
+    rightclick_path = getConvoPath(selected);
     rightClickEdit();
   }
 }
@@ -2022,28 +1853,28 @@ void EventView::convoDoubleClick(QTreeWidgetItem*, int)
  */
 void EventView::convoMenuRequested(QPoint point)
 {
-  QTreeWidgetItem* clicked_item = convo_tree->itemAt(point);
-  if(clicked_item != NULL)
+  QModelIndex clicked_item = convo_tree->indexAt(point);
+  if(clicked_item.isValid())
   {
     closeAllPopups();
 
-    /* Get the index */
-    QString base_index = getConvoIndex(clicked_item);
-    QString item_index = EditorEvent::convertConversationIndex(base_index);
-    if(!item_index.isEmpty())
+    /* Get the path */
+    EditorConvoPath path = getConvoPath(clicked_item);
+    if(!path.isEmpty())
     {
       /* Enable/disable actions */
-      if(item_index != "1")
+      if(!path.isStart())
         action_delete->setEnabled(true);
       else
         action_delete->setDisabled(true);
-      if(EditorEvent::couldBeOption(base_index, clicked_item->childCount()))
+      if(EditorEvent::couldBeOption(path,
+                                    convo_model->getChildTotal(clicked_item)))
         action_option->setEnabled(true);
       else
         action_option->setDisabled(true);
 
       /* Execute the cursor */
-      rightclick_index = base_index;
+      rightclick_path = path;
       rightclick_menu->exec(QCursor::pos());
     }
   }
@@ -2110,15 +1941,13 @@ void EventView::giveCountChanged(int count)
  */
 void EventView::giveItemChanged(int index)
 {
-  if(index >= 0 && index < list_items.size())
+  int id = model_items->getID(index);
+  if(event != nullptr && event->getEventType() == EventClassifier::ITEMGIVE &&
+     id != EditorListModel::kNO_ID)
   {
-    QStringList list = list_items[index].split(":");
-    if(list.size() == 2)
-    {
-      event->setEventGiveItem(list.front().toInt(), event->getGiveItemCount(),
-                              event->getGiveItemFlags(),
-                              event->getGiveItemChance(), event->getSoundID());
-    }
+    event->setEventGiveItem(id, event->getGiveItemCount(),
+                            event->getGiveItemFlags(),
+                            event->getGiveItemChance(), event->getSoundID());
   }
 }
 
@@ -2344,7 +2173,7 @@ void EventView::notificationBtnItem()
 {
   /* Create input dialog to get selected thing */
   QInputDialog input_dialog;
-  input_dialog.setComboBoxItems(list_items);
+  input_dialog.setComboBoxItems(model_items->getList());
   input_dialog.setWindowTitle("Item Name Select");
   input_dialog.setLabelText("Select Item Name to Insert:");
   if(input_dialog.exec() == QDialog::Accepted)
@@ -2385,7 +2214,8 @@ void EventView::notificationBtnPreview()
   /* Handle conversion */
   QString render_text = EditorHelpers::convertXml(
                                             notification_edit->toPlainText(),
-                                            list_things, list_items);
+                                            list_things,
+                                            model_items->getList());
 
   /* Insert warning */
   QString info_text = QString("<font color=\"#900\">* Overlap nested color ") +
@@ -3172,10 +3002,10 @@ void EventView::propertyVisibleVal(int state)
  *              Forces an auto resize on the widget to make the conversation
  *              scrollable.
  *
- * Inputs: QTreeWidgetItem* - not used
+ * Inputs: QModelIndex - not used
  * Output: none
  */
-void EventView::resizeTree(QTreeWidgetItem*)
+void EventView::resizeTree(QModelIndex)
 {
   convo_tree->resizeColumnToContents(0);
 }
@@ -3190,7 +3020,7 @@ void EventView::resizeTree(QTreeWidgetItem*)
  */
 void EventView::rightClickDelete()
 {
-  if(!rightclick_index.isEmpty())
+  if(!rightclick_path.isEmpty())
   {
     /* Message box - warning of change */
     QMessageBox msg_box;
@@ -3203,48 +3033,15 @@ void EventView::rightClickDelete()
     /* Parse the return value */
     if(ret == QMessageBox::Yes)
     {
-      QString index = EditorEvent::convertConversationIndex(rightclick_index);
-      QString new_index = event->deleteConversation(index);
+      event->deleteConversation(rightclick_path);
       setLayoutData();
 
-      /* Determine the modified index */
-      QString modified_index = "";
-      QStringList mod_list_1 = index.split(".");
-      QStringList mod_list_2 = new_index.split(".");
-      QStringList right_list = rightclick_index.split(".");
-      for(int i = 0; i < right_list.size() - 1; i++)
-        modified_index += right_list[i] + ".";
-      if(mod_list_1.size() > mod_list_2.size())
-      {
-        if(right_list.last().toInt() > 1)
-          modified_index += QString::number(right_list.last().toInt() - 1);
-        else
-          modified_index.chop(1);
-      }
-      else if(mod_list_1.last().toInt() != mod_list_2.last().toInt())
-      {
-        if(right_list.last().toInt() > 1)
-          modified_index += QString::number(right_list.last().toInt() - 1);
-        else
-          modified_index.chop(1);
-      }
-      else if(index == new_index)
-      {
-        if(right_list.size() == 1)
-          modified_index = QString::number(right_list.last().toInt() + 1);
-        else
-        {
-          modified_index.chop(1);
-        }
-      }
-
       /* Select the closest item */
-      QTreeWidgetItem* new_select = getConvo(modified_index);
-      convo_tree->setCurrentItem(new_select);
+      convo_tree->setCurrentIndex(getConvo(rightclick_path.getPrevious()));
     }
   }
 
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
 }
 
 /*
@@ -3257,23 +3054,14 @@ void EventView::rightClickDelete()
  */
 void EventView::rightClickEdit()
 {
-  if(!rightclick_index.isEmpty())
+  if(!rightclick_path.isEmpty())
   {
-    QString index = EditorEvent::convertConversationIndex(rightclick_index);
-    Conversation* ref = event->getConversation(index);
+    Conversation* ref = event->getConversation(rightclick_path);
     if(ref != NULL)
-    {
-      /* Determine if it's an option */
-      bool is_option = false;
-      QStringList list = rightclick_index.split(".");
-      if(list.size() % 2 == 0)
-        is_option = true;
-
-      editConversation(ref, is_option);
-    }
+      editConversation(ref, rightclick_path.isOption());
   }
 
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
 }
 
 /*
@@ -3286,22 +3074,29 @@ void EventView::rightClickEdit()
  */
 void EventView::rightClickInsertAfter()
 {
-  if(!rightclick_index.isEmpty())
+  if(!rightclick_path.isEmpty())
   {
     Conversation after = EventSet::createBlankConversation();
     after.text = "New Entry - After";
-    QString index = EditorEvent::convertConversationIndex(rightclick_index);
-    QString new_index = event->insertConversationAfter(index, after);
+
+    /* After an option is the start of its run, otherwise the next in line */
+    EditorConvoPath after_path = rightclick_path.getNext();
+    if(rightclick_path.isOption())
+    {
+      after_path = rightclick_path;
+      after_path.append(1);
+    }
+    event->insertConversation(after_path, after);
     setLayoutData();
 
     /* Select the previously selected item */
-    QTreeWidgetItem* new_select = getConvo(rightclick_index);
-    convo_tree->setCurrentItem(new_select);
-    if(new_select->childCount() > 0)
-      new_select->setExpanded(true);
+    QModelIndex new_select = getConvo(rightclick_path);
+    convo_tree->setCurrentIndex(new_select);
+    if(convo_model->getChildTotal(new_select) > 0)
+      convo_tree->expand(new_select);
   }
 
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
 }
 
 /*
@@ -3314,20 +3109,18 @@ void EventView::rightClickInsertAfter()
  */
 void EventView::rightClickInsertBefore()
 {
-  if(!rightclick_index.isEmpty())
+  if(!rightclick_path.isEmpty())
   {
     Conversation before = EventSet::createBlankConversation();
     before.text = "New Entry - Before";
-    QString index = EditorEvent::convertConversationIndex(rightclick_index);
-    QString new_index = event->insertConversationBefore(index, before);
+    event->insertConversation(rightclick_path, before);
     setLayoutData();
 
     /* Select the previously selected item */
-    QTreeWidgetItem* new_select = getConvo(rightclick_index);
-    convo_tree->setCurrentItem(new_select);
+    convo_tree->setCurrentIndex(getConvo(rightclick_path));
   }
 
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
 }
 
 /*
@@ -3341,38 +3134,26 @@ void EventView::rightClickInsertBefore()
  */
 void EventView::rightClickInsertOption()
 {
-  if(!rightclick_index.isEmpty())
+  if(!rightclick_path.isEmpty())
   {
-    QString index = EditorEvent::convertConversationIndex(rightclick_index);
-    QStringList list = index.split('.');
-    QStringList orig_list = rightclick_index.split('.');
-    if(list.last() == "1")
+    if(!rightclick_path.isOption() && rightclick_path.last() > 1)
     {
-      /* Set-up new index for insertion */
-      QString new_index = "";
-      for(int i = 0; i < list.size() - 1; i++)
-        new_index += list[i] + ".";
-      new_index += "2";
+      /* The entry becomes the second option of the one before it */
+      EditorConvoPath option_path = rightclick_path.getPrevious();
+      option_path.append(2);
 
       /* Set the new conversation option */
       Conversation option = EventSet::createBlankConversation();
       option.text = "New Entry - Option";
-      event->setConversation(new_index, option);
+      event->setConversation(option_path, option);
       setLayoutData();
 
-      /* Set-up new index for selection */
-      QString select_index = "";
-      for(int i = 0; i < orig_list.size() - 1; i++)
-        select_index += orig_list[i] + ".";
-      select_index += QString::number(orig_list.last().toInt() - 1) + ".2";
-
       /* Select the previously selected (now an option) */
-      QTreeWidgetItem* new_select = getConvo(select_index);
-      convo_tree->setCurrentItem(new_select);
+      convo_tree->setCurrentIndex(getConvo(option_path));
     }
   }
 
-  rightclick_index = "";
+  rightclick_path = EditorConvoPath();
 }
 
 /*
@@ -3432,13 +3213,11 @@ void EventView::takeCountChanged(int index)
  */
 void EventView::takeItemChanged(int index)
 {
-  if(index >= 0 && index < list_items.size())
-  {
-    QStringList list = list_items[index].split(":");
-    if(list.size() == 2)
-      event->setEventTakeItem(list.front().toInt(), event->getTakeItemCount(),
-                              event->getSoundID());
-  }
+  int id = model_items->getID(index);
+  if(event != nullptr && event->getEventType() == EventClassifier::ITEMTAKE &&
+     id != EditorListModel::kNO_ID)
+    event->setEventTakeItem(id, event->getTakeItemCount(),
+                            event->getSoundID());
 }
 
 /*
@@ -3951,9 +3730,9 @@ void EventView::updateConversation()
 {
   if(event->getEventType() == EventClassifier::CONVERSATION)
   {
-    QString index = getConvoIndex(convo_tree->currentItem());
+    EditorConvoPath path = getConvoPath(convo_tree->currentIndex());
     setLayoutData();
-    convo_tree->setCurrentItem(getConvo(index));
+    convo_tree->setCurrentIndex(getConvo(path));
   }
 }
 
@@ -4019,7 +3798,7 @@ EditorEvent* EventView::getEvent()
  */
 QList<QString> EventView::getListItems()
 {
-  return list_items;
+  return model_items->getList();
 }
 
 /*
@@ -4030,7 +3809,7 @@ QList<QString> EventView::getListItems()
  */
 QList<QString> EventView::getListMaps()
 {
-  return list_maps;
+  return model_maps->getList();
 }
 
 /*
@@ -4096,7 +3875,7 @@ QList<QString> EventView::getListMapThings()
  */
 QList<QString> EventView::getListSounds()
 {
-  return list_sounds;
+  return model_sounds->getList();
 }
 
 /*
@@ -4129,51 +3908,6 @@ void EventView::setEvent(EditorEvent* event)
   setLayoutData();
 }
 
-/*
- * Description: Sets the list of items, used for event creation
- *
- * Inputs: QList<QString> - list of all items (for give item event)
- * Output: none
- */
-void EventView::setListItems(QList<QString> items)
-{
-  /* Set new data */
-  list_items = items;
-
-  /* Block signals */
-  item_name->blockSignals(true);
-  take_name->blockSignals(true);
-
-  /* Give Items */
-  item_name->clear();
-  item_name->addItems(list_items);
-
-  /* Take Items */
-  take_name->clear();
-  take_name->addItems(list_items);
-
-  /* Update and unblock */
-  setLayoutData();
-  item_name->blockSignals(false);
-  take_name->blockSignals(false);
-}
-
-/*
- * Description: Sets the list of maps, used for event creation
- *
- * Inputs: QList<QString> - list of all maps (for change map event)
- * Output: none
- */
-void EventView::setListMaps(QList<QString> maps)
-{
-  list_maps = maps;
-  map_name->blockSignals(true);
-  map_name->clear();
-  map_name->addItems(list_maps);
-  setLayoutData();
-  map_name->blockSignals(false);
-}
-
 /*
  * Description: Sets the list of map IOs, used for event creation
  *
@@ -4259,22 +3993,6 @@ void EventView::setListMapThings(QList<QString> things,
   updateLists(true, true, true, true, true);
 }
 
-/*
- * Description: Sets the list of sounds, used for event creation
- *
- * Inputs: QList<QString> - list of all sounds (for all valid events)
- * Output: none
- */
-void EventView::setListSounds(QList<QString> sounds)
-{
-  list_sounds = sounds;
-  combo_sound->blockSignals(true);
-  combo_sound->clear();
-  combo_sound->addItems(list_sounds);
-  setLayoutData();
-  combo_sound->blockSignals(false);
-}
-
 /*
  * Description: Sets the list of sub-maps, used for event creation.
  *
@@ -96,6 +96,7 @@ GameView::GameView(QWidget* parent) : QStackedWidget(parent)
   view_battlescene = new BattleSceneView(this);
   connect(view_battlescene, SIGNAL(nameChange(QString)),
           this, SIGNAL(nameChange(QString)));
+  connect(view_battlescene, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   addWidget(view_battlescene);
 
   /* Styling, as required */
@@ -182,6 +183,7 @@ void GameView::setActionView(EditorAction *action)
   /* Disconnect the old view */
   disconnect(view_action,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  disconnect(view_action, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   if(action == NULL)
     action = null_action;
 
@@ -190,6 +192,7 @@ void GameView::setActionView(EditorAction *action)
   view_action = action;
   connect(view_action,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  connect(view_action, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Battle Scene View */
@@ -206,6 +209,7 @@ void GameView::setClassView(EditorCategory* class_cat)
   /* Disconnect the old view */
   disconnect(view_battleclass, SIGNAL(nameChange(QString)),
              this, SIGNAL(nameChange(QString)));
+  disconnect(view_battleclass, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 
   /* Set up the new view */
   if(class_cat == NULL)
@@ -214,6 +218,7 @@ void GameView::setClassView(EditorCategory* class_cat)
   view_battleclass = class_cat;
   connect(view_battleclass, SIGNAL(nameChange(QString)),
           this, SIGNAL(nameChange(QString)));
+  connect(view_battleclass, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Skill View */
@@ -222,6 +227,7 @@ void GameView::setItemView(EditorItem *item)
   /* Disconnect the old view */
   disconnect(view_item,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  disconnect(view_item, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   if(item == NULL)
     item = null_item;
 
@@ -230,6 +236,7 @@ void GameView::setItemView(EditorItem *item)
   view_item = item;
   connect(view_item,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  connect(view_item, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Party View */
@@ -238,6 +245,7 @@ void GameView::setPartyView(EditorParty* party)
   /* Disconnect the old view */
   disconnect(view_party, SIGNAL(nameChange(QString)),
              this, SIGNAL(nameChange(QString)));
+  disconnect(view_party, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 
   /* Set up the new view */
   if(party == NULL)
@@ -246,6 +254,7 @@ void GameView::setPartyView(EditorParty* party)
   view_party = party;
   connect(view_party, SIGNAL(nameChange(QString)),
           this, SIGNAL(nameChange(QString)));
+  connect(view_party, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Person View */
@@ -254,6 +263,7 @@ void GameView::setPersonView(EditorPerson* person)
   /* Disconnect the old view */
   disconnect(view_person, SIGNAL(nameChange(QString)),
              this, SIGNAL(nameChange(QString)));
+  disconnect(view_person, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 
   /* Set up the new view */
   if(person == NULL)
@@ -262,6 +272,7 @@ void GameView::setPersonView(EditorPerson* person)
   view_person = person;
   connect(view_person, SIGNAL(nameChange(QString)),
           this, SIGNAL(nameChange(QString)));
+  connect(view_person, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Race Category View */
@@ -270,6 +281,7 @@ void GameView::setRaceView(EditorCategory* class_race)
   /* Disconnect the old view */
   disconnect(view_race, SIGNAL(nameChange(QString)),
              this, SIGNAL(nameChange(QString)));
+  disconnect(view_race, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 
   /* Set up the new view */
   if(class_race == NULL)
@@ -278,6 +290,7 @@ void GameView::setRaceView(EditorCategory* class_race)
   view_race = class_race;
   connect(view_race, SIGNAL(nameChange(QString)),
           this, SIGNAL(nameChange(QString)));
+  connect(view_race, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Skill View */
@@ -286,6 +299,7 @@ void GameView::setSkillView(EditorSkill *skill)
   /* Disconnect the old view */
   disconnect(view_skill,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  disconnect(view_skill, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   if(skill == NULL)
     skill = null_skill;
 
@@ -294,6 +308,7 @@ void GameView::setSkillView(EditorSkill *skill)
   view_skill = skill;
   connect(view_skill,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  connect(view_skill, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 }
 
 /* Sets the Editor Skillset View */
@@ -302,6 +317,7 @@ void GameView::setSkillsetView(EditorSkillset *skillset)
   /* Disconnect the old skillset view */
   disconnect(view_skillset,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  disconnect(view_skillset, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
   if(skillset == NULL)
     skillset = null_skillset;
 
@@ -310,6 +326,7 @@ void GameView::setSkillsetView(EditorSkillset *skillset)
   view_skillset = skillset;
   connect(view_skillset,SIGNAL(nameChange(QString)),
           this,SIGNAL(nameChange(QString)));
+  connect(view_skillset, SIGNAL(dataSaved()), this, SIGNAL(dataSaved()));
 //  view_action->getEditedAction();
 }
 
@@ -45,6 +45,20 @@ MapControl::MapControl(QWidget *parent): QWidget(parent)
   //main_layout->addLayout(button_layout2);
   main_layout->addWidget(events_toggle);
 
+  /* Sets up the reachability overlay toggle */
+  reach_toggle = new QPushButton("Reachability", this);
+  reach_toggle->setCheckable(true);
+  connect(reach_toggle, SIGNAL(toggled(bool)),
+          this, SLOT(toggleReach(bool)));
+  main_layout->addWidget(reach_toggle);
+
+  /* Sets up the animated preview toggle */
+  animate_toggle = new QPushButton("Animate", this);
+  animate_toggle->setCheckable(true);
+  connect(animate_toggle, SIGNAL(toggled(bool)),
+          this, SLOT(toggleAnimate(bool)));
+  main_layout->addWidget(animate_toggle);
+
   /* Sets up the active layer actions, makes them checkable and adds them to
      an action group which allows only one to be active at a time */
   list_top = new QListWidget(this);
@@ -391,6 +405,13 @@ void MapControl::selectSubMap(QListWidgetItem* item)
   selectSubMap(row);
 }
 
+/* Toggles the animated preview */
+void MapControl::toggleAnimate(bool visible)
+{
+  if(editing_map != NULL)
+    editing_map->setVisibilityAnimate(visible);
+}
+
 /* Toggles the event notifier visibility */
 void MapControl::toggleEvents(bool visible)
 {
@@ -412,6 +433,13 @@ void MapControl::togglePassability(bool visible)
     editing_map->setVisibilityPass(visible);
 }
 
+/* Toggles the reachability overlay */
+void MapControl::toggleReach(bool visible)
+{
+  if(editing_map != NULL)
+    editing_map->setVisibilityReach(visible);
+}
+
 /* Update map row on bottom list */
 void MapControl::updateBottomRow(int current_row)
 {
@@ -451,6 +479,12 @@ int MapControl::getCurrentMapIndex()
   return list_bottom->currentRow();
 }
 
+/* Returns animated preview toggle status */
+bool MapControl::getAnimateToggle()
+{
+  return animate_toggle->isChecked();
+}
+
 /* Returns event notifier toggle status */
 bool MapControl::getEventsToggle()
 {
@@ -475,6 +509,12 @@ bool MapControl::getPassabilityToggle()
   return passability_toggle->isChecked();
 }
 
+/* Gets the status of the reachability toggle */
+bool MapControl::getReachToggle()
+{
+  return reach_toggle->isChecked();
+}
+
 /* Gets the top list widget */
 QListWidget* MapControl::getTopList()
 {
@@ -507,9 +547,11 @@ void MapControl::setMapEditor(EditorMap* editor)
   if(editing_map != NULL)
   {
     /* Update visibility of grid and passability */
+    editing_map->setVisibilityAnimate(getAnimateToggle());
     editing_map->setVisibilityEvents(getEventsToggle());
     editing_map->setVisibilityGrid(getGridToggle());
     editing_map->setVisibilityPass(getPassabilityToggle());
+    editing_map->setVisibilityReach(getReachToggle());
 
     /* Update layer */
     editing_map->setHoverLayer(getSelectedLayer());
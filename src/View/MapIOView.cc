@@ -251,7 +251,9 @@ void MapIOView::updateInfo()
       /* If matrix is valid, set the remaining info */
       if(io->getMatrix() != NULL)
       {
-        lbl_image->setPixmap(io->getMatrix()->getSnapshot(200, 200));
+        connect(io->getMatrix(), SIGNAL(snapshotReady()),
+                this, SLOT(updateSnapshot()), Qt::UniqueConnection);
+        lbl_image->setPixmap(io->getMatrix()->requestSnapshot(200, 200));
         lbl_size->setText("Size: " +
                       QString::number(io->getMatrix()->getWidth()) +
                       "W x " +
@@ -531,6 +533,20 @@ void MapIOView::updateList()
   update();
 }
 
+/*
+ * Description: Updates the snapshot image of the selected IO. Triggered when
+ *              a background snapshot render finishes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapIOView::updateSnapshot()
+{
+  EditorMapIO* io = getSelected();
+  if(io != NULL && io->getMatrix() != NULL)
+    lbl_image->setPixmap(io->getMatrix()->requestSnapshot(200, 200));
+}
+
 /*
  * Description: Slot which triggers to update a IO upon completion by the
  *              IO dialog (on ok()). This will also update all instances of
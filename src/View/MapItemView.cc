@@ -244,7 +244,9 @@ void MapItemView::updateInfo()
       /* If matrix is valid, set the image */
       if(item->getMatrix() != NULL)
       {
-        lbl_image->setPixmap(item->getMatrix()->getSnapshot(200, 200));
+        connect(item->getMatrix(), SIGNAL(snapshotReady()),
+                this, SLOT(updateSnapshot()), Qt::UniqueConnection);
+        lbl_image->setPixmap(item->getMatrix()->requestSnapshot(200, 200));
       }
 
       /* Walkover info */
@@ -533,6 +535,20 @@ void MapItemView::updateList()
   update();
 }
 
+/*
+ * Description: Updates the snapshot image of the selected item. Triggered when
+ *              a background snapshot render finishes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapItemView::updateSnapshot()
+{
+  EditorMapItem* item = getSelected();
+  if(item != NULL && item->getMatrix() != NULL)
+    lbl_image->setPixmap(item->getMatrix()->requestSnapshot(200, 200));
+}
+
 /*
  * Description: Slot which triggers to update a item upon completion by the
  *              item dialog (on ok()). This will also update all instances of
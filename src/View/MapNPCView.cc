@@ -110,6 +110,11 @@ void MapNPCView::createLayout()
           this, SLOT(instanceDoubleClicked(QListWidgetItem*)));
   layout->addWidget(npc_instances, 1);
 
+  /* The path check of the selected instance */
+  lbl_path = new QLabel("", this);
+  lbl_path->setWordWrap(true);
+  layout->addWidget(lbl_path, 0);
+
   /* Right click menu control */
   rightclick_menu = new QMenu("NPC Edit", this);
   QAction* edit_thing = new QAction("Edit", rightclick_menu);
@@ -229,6 +234,58 @@ void MapNPCView::editNPC(EditorMapNPC* sub_npc)
   emit fillWithData(EditorEnumDb::NPC_VIEW);
 }
 
+/*
+ * Description: Returns the readable text of a npc path check. Lists each
+ *              blocked walk with the tile it stops at and the way around it,
+ *              or the cycle time if the path is clear.
+ *
+ * Inputs: PathCheck check - the npc path check
+ * Output: QString - the text. Blank if the path is not walked
+ */
+QString MapNPCView::getPathCheckText(PathCheck check)
+{
+  QString text = "";
+
+  if(check.segments.size() > 0)
+  {
+    if(check.blocked_count > 0)
+    {
+      for(int i = 0; i < check.segments.size(); i++)
+      {
+        PathSegmentCheck segment = check.segments[i];
+        if(segment.blocked)
+        {
+          if(!text.isEmpty())
+            text += "\n";
+          text += "Blocked ";
+          if(segment.from < 0)
+            text += "S";
+          else
+            text += QString::number(segment.from);
+          text += " -> " + QString::number(segment.to) + " at (" +
+                  QString::number(segment.block_tile.x()) + "," +
+                  QString::number(segment.block_tile.y()) + ")";
+          if(segment.detour >= 0)
+            text += ", detour " + QString::number(segment.detour) + " tiles";
+          else
+            text += ", no way around";
+        }
+      }
+    }
+    else if(check.cycle_ms >= 0)
+    {
+      text = "Path clear. Cycle: " +
+             QString::number(check.cycle_ms / 1000.0, 'f', 1) + " s";
+    }
+    else
+    {
+      text = "Path clear";
+    }
+  }
+
+  return text;
+}
+
 /*
  * Description: Updates the info in the QT widgets within the view.
  *
@@ -255,7 +312,9 @@ void MapNPCView::updateInfo()
       /* If matrix is valid, set the remaining info */
       if(npc->getMatrix() != NULL)
       {
-        lbl_image->setPixmap(npc->getMatrix()->getSnapshot(200, 200));
+        connect(npc->getMatrix(), SIGNAL(snapshotReady()),
+                this, SLOT(updateSnapshot()), Qt::UniqueConnection);
+        lbl_image->setPixmap(npc->getMatrix()->requestSnapshot(200, 200));
         lbl_size->setText("Size: " +
                     QString::number(npc->getMatrix()->getWidth()) +
                     "W x " +
@@ -444,6 +503,8 @@ void MapNPCView::instanceRowChanged(int index, bool lock_viewport)
       }
     }
   }
+
+  updatePathChecks();
 }
 
 /*
@@ -505,6 +566,7 @@ void MapNPCView::npcInstanceUpdate(QString name_list)
   }
 
   npc_instances->blockSignals(false);
+  updatePathChecks();
 }
 
 /*
@@ -535,6 +597,20 @@ void MapNPCView::updateList()
   update();
 }
 
+/*
+ * Description: Updates the snapshot image of the selected npc. Triggered when
+ *              a background snapshot render finishes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapNPCView::updateSnapshot()
+{
+  EditorMapNPC* npc = getSelected();
+  if(npc != NULL && npc->getMatrix() != NULL)
+    lbl_image->setPixmap(npc->getMatrix()->requestSnapshot(200, 200));
+}
+
 /*
  * Description: Slot which triggers to update a npc upon completion by the
  *              person dialog (on ok()). This will also update all instances of
@@ -557,6 +633,46 @@ void MapNPCView::updateNPCs()
   updateList();
 }
 
+/*
+ * Description: Re-checks the paths of all npc instances on the sub-map
+ *              against the tile passability. Blocked instances are marked in
+ *              the list, with the details in the tool tip, and the check of
+ *              the selected instance is shown below the list. Triggered on
+ *              instance changes and when the tile passability changes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapNPCView::updatePathChecks()
+{
+  lbl_path->setText("");
+
+  if(editor_map != nullptr && editor_map->getCurrentMapIndex() >= 0)
+  {
+    int sub_index = editor_map->getCurrentMapIndex();
+    for(int i = 0; i < npc_instances->count(); i++)
+    {
+      QListWidgetItem* item = npc_instances->item(i);
+      EditorMapNPC* npc = editor_map->getNPC(
+                           MapThingView::getInstanceID(item->text()), sub_index);
+      if(npc != nullptr)
+      {
+        PathCheck check = editor_map->getPathCheck(npc);
+        QString text = getPathCheckText(check);
+
+        item->setToolTip(text);
+        if(check.blocked_count > 0)
+          item->setForeground(QColor(200, 0, 0));
+        else
+          item->setForeground(npc_instances->palette().text());
+
+        if(item == npc_instances->currentItem())
+          lbl_path->setText(text);
+      }
+    }
+  }
+}
+
 /*============================================================================
  * PUBLIC FUNCTIONS
  *===========================================================================*/
@@ -695,6 +811,8 @@ void MapNPCView::setEditorMap(EditorMap* map)
   {
     disconnect(editor_map, SIGNAL(npcInstanceChanged(QString)),
                this, SLOT(npcInstanceUpdate(QString)));
+    disconnect(editor_map, SIGNAL(passabilityChanged()),
+               this, SLOT(updatePathChecks()));
   }
 
   editor_map = map;
@@ -704,6 +822,10 @@ void MapNPCView::setEditorMap(EditorMap* map)
   {
     connect(editor_map, SIGNAL(npcInstanceChanged(QString)),
             this, SLOT(npcInstanceUpdate(QString)));
+
+    /* Signalled once the tile edit is done */
+    connect(editor_map, SIGNAL(passabilityChanged()),
+            this, SLOT(updatePathChecks()));
   }
 
   /* Finally, update list */
@@ -813,6 +935,7 @@ void MapNPCView::updatePathFinished()
 {
   if(instance_dialog != NULL)
     instance_dialog->updatePathFinished();
+  updatePathChecks();
 }
 
 /*
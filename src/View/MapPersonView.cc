@@ -251,7 +251,9 @@ void MapPersonView::updateInfo()
       /* If matrix is valid, set the remaining info */
       if(person->getMatrix() != NULL)
       {
-        lbl_image->setPixmap(person->getMatrix()->getSnapshot(200, 200));
+        connect(person->getMatrix(), SIGNAL(snapshotReady()),
+                this, SLOT(updateSnapshot()), Qt::UniqueConnection);
+        lbl_image->setPixmap(person->getMatrix()->requestSnapshot(200, 200));
         lbl_size->setText("Size: " +
                     QString::number(person->getMatrix()->getWidth()) +
                     "W x " +
@@ -534,6 +536,20 @@ void MapPersonView::updateList()
   update();
 }
 
+/*
+ * Description: Updates the snapshot image of the selected person. Triggered when
+ *              a background snapshot render finishes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapPersonView::updateSnapshot()
+{
+  EditorMapPerson* person = getSelected();
+  if(person != NULL && person->getMatrix() != NULL)
+    lbl_image->setPixmap(person->getMatrix()->requestSnapshot(200, 200));
+}
+
 /*
  * Description: Slot which triggers to update a person upon completion by the
  *              person dialog (on ok()). This will also update all instances of
@@ -6,6 +6,7 @@
  *              to make changes to the map from.
  ******************************************************************************/
 #include "View/MapRender.h"
+#include <QtMath>
 
 /* Constant Implementation - see header file for descriptions */
 //const int Map::kELEMENT_DATA = 0;
@@ -24,9 +25,13 @@ MapRender::MapRender(QWidget* parent)
          : QGraphicsScene(parent)
 {
   /* Data init */
+  animating = false;
+  animate_time = 0;
+  clipboard = NULL;
   editing_map = NULL;
   middleclick_menu = NULL;
   path_edit = NULL;
+  sprites_edited = false;
   tile_select = false;
 }
 
@@ -43,6 +48,31 @@ MapRender::~MapRender()
  * PRIVATE FUNCTIONS
  *===========================================================================*/
 
+/* Returns if a trigger with the active cursor and layer changes sprites */
+bool MapRender::isSpriteEdit()
+{
+  EditorEnumDb::CursorMode cursor = editing_map->getHoverInfo()->active_cursor;
+  EditorEnumDb::Layer layer = editing_map->getHoverInfo()->active_layer;
+
+  /* The stamp places the clipboard sprites on any layer */
+  if(cursor == EditorEnumDb::REGION_STAMP)
+    return true;
+
+  /* Otherwise, only placement cursors on a sprite layer */
+  if(layer == EditorEnumDb::BASE || layer == EditorEnumDb::ENHANCER ||
+     layer == EditorEnumDb::LOWER1 || layer == EditorEnumDb::LOWER2 ||
+     layer == EditorEnumDb::LOWER3 || layer == EditorEnumDb::LOWER4 ||
+     layer == EditorEnumDb::LOWER5 || layer == EditorEnumDb::UPPER1 ||
+     layer == EditorEnumDb::UPPER2 || layer == EditorEnumDb::UPPER3 ||
+     layer == EditorEnumDb::UPPER4 || layer == EditorEnumDb::UPPER5)
+  {
+    return (cursor == EditorEnumDb::BASIC || cursor == EditorEnumDb::ERASER ||
+            cursor == EditorEnumDb::FILL ||
+            cursor == EditorEnumDb::BLOCKPLACE);
+  }
+  return false;
+}
+
 /* Menu adding for tile click */
 bool MapRender::menuIOs(EditorTile* t, QMenu* menu)
 {
@@ -366,6 +396,7 @@ bool MapRender::mouseEvent(QGraphicsSceneMouseEvent* event)
       }
     }
 
+    updateClipboardPreview();
     return new_hover;
   }
   return false;
@@ -409,6 +440,38 @@ void MapRender::pathClickRight(int x, int y)
   }
 }
 
+/*
+ * Description: Stamps the region clipboard with the top left at the given
+ *              tile. A single click always stamps and sets the drag origin.
+ *              While dragging, only tiles on the grid of the region size,
+ *              relative to that origin, are stamped so the region tiles
+ *              instead of smearing. Shift pastes the full region, clearing
+ *              layers that are empty in the clipboard.
+ *
+ * Inputs: int x - the tile x
+ *         int y - the tile y
+ *         bool single - true if triggered by a click, false if by a drag
+ * Output: none
+ */
+void MapRender::stampClipboard(int x, int y, bool single)
+{
+  if(clipboard != NULL && !clipboard->isEmpty() &&
+     editing_map->getCurrentMap() != NULL)
+  {
+    if(single)
+      stamp_origin = QPoint(x, y);
+
+    if(single || ((x - stamp_origin.x()) % clipboard->getWidth() == 0 &&
+                  (y - stamp_origin.y()) % clipboard->getHeight() == 0))
+    {
+      bool stamp =
+              !(QGuiApplication::keyboardModifiers() & Qt::ShiftModifier);
+      clipboard->paste(editing_map, editing_map->getCurrentMap(),
+                       x, y, stamp);
+    }
+  }
+}
+
 /* Right click menu initialize */
 // TODO: Comment
 void MapRender::tileClickInit()
@@ -470,6 +533,10 @@ void MapRender::tileClickInit()
       action_exit->setFont(font_bold);
     connect(action_exit, SIGNAL(triggered()), this, SIGNAL(tileEventExit()));
 
+    /* Reachability */
+    QAction* action_reach = new QAction("Reach From Here", middleclick_menu);
+    connect(action_reach, SIGNAL(triggered()), this, SLOT(reachStart()));
+
     /* Add sub-menus */
     middleclick_menu->addMenu(menu_sprites);
     middleclick_menu->addMenu(menu_things);
@@ -480,12 +547,44 @@ void MapRender::tileClickInit()
     middleclick_menu->addSeparator();
     middleclick_menu->addAction(action_enter);
     middleclick_menu->addAction(action_exit);
+    middleclick_menu->addSeparator();
+    middleclick_menu->addAction(action_reach);
 
     /* Execute menu */
     middleclick_menu->exec(QCursor::pos());
   }
 }
 
+/* Holds or releases the animation clock to match the map visibility */
+void MapRender::updateAnimation()
+{
+  bool animate = (editing_map != NULL &&
+                  editing_map->getVisibilityInfo()->animate);
+
+  if(animate != animating)
+  {
+    EditorAnimationClock* clock = EditorAnimationClock::getShared();
+    animating = animate;
+
+    if(animating)
+    {
+      animate_time = clock->getTime();
+      connect(clock, SIGNAL(tick(qint64)), this, SLOT(animationTick(qint64)));
+      clock->acquire();
+    }
+    else
+    {
+      disconnect(clock, SIGNAL(tick(qint64)),
+                 this, SLOT(animationTick(qint64)));
+      clock->release();
+    }
+  }
+
+  /* Paint the new map at the same time as the last tick */
+  if(animating)
+    editing_map->setAnimationTime(animate_time);
+}
+
 /*============================================================================
  * PROTECTED FUNCTIONS
  *===========================================================================*/
@@ -522,6 +621,7 @@ bool MapRender::event(QEvent *event)
          x_ref <= ref_min || y_ref <= ref_min)
       {
         editing_map->setHoverTile(NULL);
+        updateClipboardPreview();
         emit sendCurrentPosition(-1, -1);
 
         /* Clean up path edit */
@@ -605,13 +705,31 @@ void MapRender::mouseMoveEvent(QGraphicsSceneMouseEvent *event)
   if(editing_map != NULL)
   {
     bool new_hover = mouseEvent(event);
+    EditorEnumDb::CursorMode cursor =
+                                   editing_map->getHoverInfo()->active_cursor;
 
     /* If a new hover tile, execute the click */
     if(new_hover && path_edit == NULL && (event->buttons() & Qt::LeftButton ||
                                           event->buttons() & Qt::RightButton) &&
-       editing_map->getHoverInfo()->active_cursor != EditorEnumDb::BLOCKPLACE)
+       cursor != EditorEnumDb::BLOCKPLACE &&
+       cursor != EditorEnumDb::REGION_COPY)
     {
-      editing_map->clickTrigger(false, event->buttons() & Qt::RightButton);
+      if(isSpriteEdit())
+        sprites_edited = true;
+
+      /* Stamp drag */
+      if(cursor == EditorEnumDb::REGION_STAMP)
+      {
+        if(event->buttons() & Qt::LeftButton)
+        {
+          EditorTile* tile = editing_map->getHoverInfo()->hover_tile;
+          stampClipboard(tile->getX(), tile->getY(), false);
+        }
+      }
+      else
+      {
+        editing_map->clickTrigger(false, event->buttons() & Qt::RightButton);
+      }
     }
   }
 
@@ -668,17 +786,29 @@ void MapRender::mousePressEvent(QGraphicsSceneMouseEvent *event)
       {
         editing_map->ctrlClickTrigger();
       }
-      /* Block place */
+      /* Block place and region copy */
       else if(editing_map->getHoverInfo()->active_cursor ==
-                                                       EditorEnumDb::BLOCKPLACE)
+                                                     EditorEnumDb::BLOCKPLACE ||
+              editing_map->getHoverInfo()->active_cursor ==
+                                                    EditorEnumDb::REGION_COPY)
       {
         block_origin = event->scenePos().toPoint();
         block_erase = false;
       }
+      /* Region stamp */
+      else if(editing_map->getHoverInfo()->active_cursor ==
+                                                   EditorEnumDb::REGION_STAMP)
+      {
+        EditorTile* tile = editing_map->getHoverInfo()->hover_tile;
+        stampClipboard(tile->getX(), tile->getY(), true);
+        sprites_edited = true;
+      }
       /* All other placement */
       else
       {
         editing_map->clickTrigger();
+        if(isSpriteEdit())
+          sprites_edited = true;
       }
     }
     else if(event->button() == Qt::RightButton)
@@ -691,6 +821,8 @@ void MapRender::mousePressEvent(QGraphicsSceneMouseEvent *event)
       else
       {
         editing_map->clickTrigger(true, true);
+        if(isSpriteEdit())
+          sprites_edited = true;
       }
     }
   }
@@ -724,17 +856,48 @@ void MapRender::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
         QList<EditorTile*> tile_set;
         for(int i = 0; i < item_set.size(); i++)
         {
-          if(item_set[i]->boundingRect().width() == 64 &&
-             item_set[i]->boundingRect().height() == 64)
+          if(item_set[i]->type() == EditorTile::Type_TileRender)
           {
             tile_set.push_back((EditorTile*)item_set[i]);
           }
         }
         editing_map->clickTrigger(tile_set, block_erase);
+        if(isSpriteEdit())
+          sprites_edited = true;
+      }
+    }
+    /* If click release, and region copy, copy the selected tiles */
+    else if(editing_map->getHoverInfo()->active_cursor ==
+                                                     EditorEnumDb::REGION_COPY)
+    {
+      if(event->button() == Qt::LeftButton && clipboard != NULL)
+      {
+        QRectF rect = EditorHelpers::normalizePoints(block_origin,
+                                                     event->scenePos());
+        int tile_size = EditorHelpers::getTileSize();
+        QPoint top_left(qFloor(rect.left() / tile_size),
+                        qFloor(rect.top() / tile_size));
+
+        /* The end is the last pixel covered, so a drag ending on a tile
+         * edge does not take the next tile */
+        QPoint bottom_right(
+             qMax(top_left.x(),
+                  qFloor((rect.x() + rect.width() - 1) / tile_size)),
+             qMax(top_left.y(),
+                  qFloor((rect.y() + rect.height() - 1) / tile_size)));
+        clipboard->copy(editing_map, editing_map->getCurrentMap(),
+                        QRect(top_left, bottom_right));
       }
     }
   }
 
+  /* Only rebuild the animated index if the click or drag changed sprites */
+  if(sprites_edited)
+  {
+    resetAnimatedTiles();
+    sprites_edited = false;
+  }
+
   //QGraphicsScene::mouseReleaseEvent(event);
 }
 
@@ -742,6 +905,28 @@ void MapRender::mouseReleaseEvent(QGraphicsSceneMouseEvent *event)
  * PUBLIC SLOT FUNCTIONS
  *===========================================================================*/
 
+/* Animation clock tick - repaints the tiles with a changed frame */
+void MapRender::animationTick(qint64 time)
+{
+  if(animating && editing_map != NULL && editing_map->getCurrentMap() != NULL)
+  {
+    SubMapInfo* map = editing_map->getCurrentMap();
+    QVector<QPoint> tiles = editing_map->getAnimatedTiles(map);
+
+    /* Only the tiles with a new frame are dirtied */
+    editing_map->setAnimationTime(time);
+    for(int i = 0; i < tiles.size(); i++)
+    {
+      int x = tiles[i].x();
+      int y = tiles[i].y();
+      if(x < map->tiles.size() && y < map->tiles[x].size() &&
+         map->tiles[x][y]->isAnimationChanged(animate_time, time))
+        map->tiles[x][y]->update();
+    }
+    animate_time = time;
+  }
+}
+
 /* NPC Path Add/Remove control */
 void MapRender::npcPathAdd(EditorNPCPath* path)
 {
@@ -776,6 +961,21 @@ void MapRender::pathEditTrigger(EditorNPCPath* path)
   }
 }
 
+/* Floods the reachability from the hover tile */
+void MapRender::reachStart()
+{
+  EditorTile* t = editing_map->getHoverInfo()->hover_tile;
+  if(t != NULL)
+    editing_map->setReachStart(t->getX(), t->getY());
+}
+
+/* Resets the animated tile index of the rendering sub-map */
+void MapRender::resetAnimatedTiles()
+{
+  if(editing_map != NULL)
+    editing_map->resetAnimatedTiles(editing_map->getCurrentMap());
+}
+
 /* Select a tile trigger */
 void MapRender::selectTile()
 {
@@ -859,6 +1059,7 @@ void MapRender::tileThing9() { emit tileThing(9); }
 /* Update the entire scene */
 void MapRender::updateAll()
 {
+  updateAnimation();
   update(sceneRect());
 }
 
@@ -875,16 +1076,30 @@ void MapRender::updateRenderingMap()
   if(editing_map != NULL && editing_map->getCurrentMap() != NULL)
   {
     SubMapInfo* map = editing_map->getCurrentMap();
+    editing_map->resetAnimatedTiles(map);
 
     /* Add tiles */
     for(int i = 0; i < map->tiles.size(); i++)
       for(int j = 0; j < map->tiles[i].size(); j++)
         addItem(map->tiles[i][j]);
 
+    /* Add the hover preview */
+    addItem(editing_map->getHoverItem());
+
+    /* Add the reachability overlay */
+    addItem(editing_map->getReachItem());
+
     /* Add npc paths */
     for(int i = 0; i < map->npcs.size(); i++)
       addItem(map->npcs[i]->getPath());
 
+    /* Add the clipboard preview */
+    if(clipboard != NULL)
+    {
+      addItem(clipboard);
+      updateClipboardPreview();
+    }
+
     /* Set the size of the map scene */
     if(map->tiles.size() > 0)
       setSceneRect(0, 0, map->tiles.size() * EditorHelpers::getTileSize(),
@@ -933,6 +1148,28 @@ int MapRender::getMapWidth()
   return 0;
 }
 
+/*
+ * Description: Sets the region clipboard used by the copy and stamp cursors.
+ *              The clipboard is not owned by the render and doubles as the
+ *              paste preview item within the scene.
+ *
+ * Inputs: EditorMapClipboard* clipboard - the clipboard to use
+ * Output: none
+ */
+void MapRender::setClipboard(EditorMapClipboard* clipboard)
+{
+  if(this->clipboard != NULL && this->clipboard->scene() == this)
+    removeItem(this->clipboard);
+
+  this->clipboard = clipboard;
+  if(clipboard != NULL && editing_map != NULL &&
+     editing_map->getCurrentMap() != NULL)
+  {
+    addItem(clipboard);
+    updateClipboardPreview();
+  }
+}
+
 /* Sets the map being edited */
 void MapRender::setMapEditor(EditorMap* editor)
 {
@@ -945,13 +1182,26 @@ void MapRender::setMapEditor(EditorMap* editor)
                this, SLOT(npcPathAdd(EditorNPCPath*)));
     disconnect(editing_map, SIGNAL(npcPathRemove(EditorNPCPath*)),
                this, SLOT(npcPathRemove(EditorNPCPath*)));
+    disconnect(editing_map, SIGNAL(visibilityChanged()),
+               this, SLOT(updateAll()));
+    disconnect(editing_map, SIGNAL(ioInstanceChanged(QString)),
+               this, SLOT(resetAnimatedTiles()));
+    disconnect(editing_map, SIGNAL(itemInstanceChanged(QString)),
+               this, SLOT(resetAnimatedTiles()));
+    disconnect(editing_map, SIGNAL(npcInstanceChanged(QString)),
+               this, SLOT(resetAnimatedTiles()));
+    disconnect(editing_map, SIGNAL(personInstanceChanged(QString)),
+               this, SLOT(resetAnimatedTiles()));
+    disconnect(editing_map, SIGNAL(thingInstanceChanged(QString)),
+               this, SLOT(resetAnimatedTiles()));
   }
 
   /* Set the map */
   editing_map = editor;
 
-  /* Update the rendering map */
+  /* Update the rendering map and the animation clock hold */
   updateRenderingMap();
+  updateAnimation();
 
   /* Signal re-connection */
   if(editing_map != NULL)
@@ -962,5 +1212,46 @@ void MapRender::setMapEditor(EditorMap* editor)
             this, SLOT(npcPathAdd(EditorNPCPath*)));
     connect(editing_map, SIGNAL(npcPathRemove(EditorNPCPath*)),
             this, SLOT(npcPathRemove(EditorNPCPath*)));
+    connect(editing_map, SIGNAL(visibilityChanged()),
+            this, SLOT(updateAll()));
+    connect(editing_map, SIGNAL(ioInstanceChanged(QString)),
+            this, SLOT(resetAnimatedTiles()));
+    connect(editing_map, SIGNAL(itemInstanceChanged(QString)),
+            this, SLOT(resetAnimatedTiles()));
+    connect(editing_map, SIGNAL(npcInstanceChanged(QString)),
+            this, SLOT(resetAnimatedTiles()));
+    connect(editing_map, SIGNAL(personInstanceChanged(QString)),
+            this, SLOT(resetAnimatedTiles()));
+    connect(editing_map, SIGNAL(thingInstanceChanged(QString)),
+            this, SLOT(resetAnimatedTiles()));
+  }
+}
+
+/*
+ * Description: Updates the clipboard preview. It follows the hover tile while
+ *              the stamp cursor is active and is hidden otherwise.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapRender::updateClipboardPreview()
+{
+  if(clipboard != NULL)
+  {
+    EditorTile* hover_tile = NULL;
+    if(editing_map != NULL && path_edit == NULL &&
+       editing_map->getHoverInfo()->active_cursor ==
+                                                   EditorEnumDb::REGION_STAMP)
+      hover_tile = editing_map->getHoverInfo()->hover_tile;
+
+    if(hover_tile != NULL && !clipboard->isEmpty())
+    {
+      clipboard->setPreviewTile(hover_tile->getX(), hover_tile->getY());
+      clipboard->setVisible(true);
+    }
+    else
+    {
+      clipboard->setVisible(false);
+    }
   }
 }
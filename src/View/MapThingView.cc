@@ -251,7 +251,9 @@ void MapThingView::updateInfo()
       /* If matrix is valid, set the remaining info */
       if(thing->getMatrix() != NULL)
       {
-        lbl_image->setPixmap(thing->getMatrix()->getSnapshot(200, 200));
+        connect(thing->getMatrix(), SIGNAL(snapshotReady()),
+                this, SLOT(updateSnapshot()), Qt::UniqueConnection);
+        lbl_image->setPixmap(thing->getMatrix()->requestSnapshot(200, 200));
         lbl_size->setText("Size: " +
                       QString::number(thing->getMatrix()->getWidth()) +
                       "W x " +
@@ -531,6 +533,20 @@ void MapThingView::updateList()
   update();
 }
 
+/*
+ * Description: Updates the snapshot image of the selected thing. Triggered when
+ *              a background snapshot render finishes.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void MapThingView::updateSnapshot()
+{
+  EditorMapThing* thing = getSelected();
+  if(thing != NULL && thing->getMatrix() != NULL)
+    lbl_image->setPixmap(thing->getMatrix()->requestSnapshot(200, 200));
+}
+
 /*
  * Description: Slot which triggers to update a thing upeon completion by the
  *              thing dialog (on ok()). This will also update all instances of
@@ -32,6 +32,7 @@ MapView::MapView(QWidget* parent)
   event_exit = false;
   event_external = false;
   event_tile = nullptr;
+  map_clipboard = new EditorMapClipboard();
 
   /* Calls all setup functions */
   setupLeftBar();
@@ -50,6 +51,11 @@ MapView::MapView(QWidget* parent)
 MapView::~MapView()
 {
   editEventSet(nullptr);
+
+  /* Clean up the clipboard */
+  map_render->setClipboard(nullptr);
+  delete map_clipboard;
+  map_clipboard = nullptr;
 }
 
 /*============================================================================
@@ -123,6 +129,7 @@ void MapView::setupMapView()//int x, int y)
 {
   /* Sets up the main map view widget */
   map_render = new MapRender(this);
+  map_render->setClipboard(map_clipboard);
 
   /* Set up the view - scroller */
   map_render_view = new QGraphicsView(map_render, this);
@@ -221,7 +228,11 @@ void MapView::buttonEventOk()
   {
     /* Update tile if ok hit */
     if(event_tile != nullptr)
+    {
       event_tile->update();
+      if(editing_map != nullptr)
+        editing_map->updateEventTile(event_tile->getX(), event_tile->getY());
+    }
 
     /* Clear out the event control and view class */
     editEventSet(nullptr);
@@ -390,6 +401,8 @@ void MapView::tileEventEnter()
   EditorTile* curr_tile = editing_map->getHoverInfo()->hover_tile;
   if(curr_tile != nullptr)
   {
+    editing_map->detachTiles(editing_map->getCurrentMap(), curr_tile->getX(),
+                             curr_tile->getY());
     editEventSet(curr_tile->getEventEnter(), "Tile Enter Event Edit");
     event_enter = true;
     event_tile = curr_tile;
@@ -407,6 +420,8 @@ void MapView::tileEventExit()
   EditorTile* curr_tile = editing_map->getHoverInfo()->hover_tile;
   if(curr_tile != nullptr)
   {
+    editing_map->detachTiles(editing_map->getCurrentMap(), curr_tile->getX(),
+                             curr_tile->getY());
     editEventSet(curr_tile->getEventExit(), "Tile Exit Event Edit");
     event_exit = true;
     event_tile = curr_tile;
@@ -452,8 +467,6 @@ void MapView::updatedMaps(QList<QString> maps)
 {
   if(data_db)
     map_database->updatedMaps(maps);
-  else if(event_dialog != nullptr)
-    event_dialog->setListMaps(maps);
 }
 
 /* Updated data to pass into map database */
@@ -477,8 +490,6 @@ void MapView::updatedSounds(QList<QString> sound_list)
 {
   if(data_db)
     map_database->updatedSounds(sound_list);
-  else if(event_dialog != nullptr)
-    event_dialog->setListSounds(sound_list);
 }
 
 /*============================================================================
@@ -511,10 +522,11 @@ void MapView::setCursorMode(EditorEnumDb::CursorMode mode)
     editing_map->setHoverCursor(mode);
 
   /* Update the map render, with the appropriate settings */
-  if(mode == EditorEnumDb::BLOCKPLACE)
+  if(mode == EditorEnumDb::BLOCKPLACE || mode == EditorEnumDb::REGION_COPY)
     map_render_view->setDragMode(QGraphicsView::RubberBandDrag);
   else
     map_render_view->setDragMode(QGraphicsView::NoDrag);
+  map_render->updateClipboardPreview();
 
   /* Pass along to scene */
   //map_render->setCursorMode(mode); // TODO: REMOVE
@@ -8,6 +8,9 @@
 #include "View/MatrixView.h"
 #include <QDebug>
 
+/* Constant Implementation - see header file for descriptions */
+const int MatrixView::kPLAY_INTERVAL = 150;
+
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
  *===========================================================================*/
@@ -29,6 +32,7 @@ MatrixView::MatrixView(EditorMatrix* matrix, QWidget* parent, bool no_grow)
   matrix_dialog = NULL;
   this->no_grow = no_grow;
   playing = false;
+  sheet_dialog = NULL;
   sprite_dialog = NULL;
   int icon_size = 24;
   int button_size = icon_size + 6;
@@ -38,6 +42,11 @@ MatrixView::MatrixView(EditorMatrix* matrix, QWidget* parent, bool no_grow)
   playing_timer->setSingleShot(false);
   connect(playing_timer, SIGNAL(timeout()), this, SLOT(animateNext()));
 
+  /* Set up the playback scene */
+  playing_index = 0;
+  playing_scene = new QGraphicsScene(this);
+  playing_item = playing_scene->addPixmap(QPixmap());
+
   /* Layout setup */
   QGridLayout* layout = new QGridLayout(this);
   layout->setSizeConstraint(QLayout::SetFixedSize);
@@ -509,21 +518,18 @@ void MatrixView::actionSpriteView()
 
 /*
  * Description: Animate to the next frame. Loops around when it reaches the
- *              end.
+ *              end. Each step, including the wrap, is a single composite.
  *
  * Inputs: none
  * Output: none
  */
 void MatrixView::animateNext()
 {
-  if(button_frame_next->isEnabled())
+  if(playing && playing_frames.size() > 0)
   {
-    buttonFrameNext();
-  }
-  else
-  {
-    while(button_frame_prev->isEnabled())
-      buttonFramePrev();
+    playing_index = (playing_index + 1) % playing_frames.size();
+    playing_item->setPixmap(playing_frames[playing_index]);
+    lbl_frame_num->setText(QString::number(playing_index));
   }
 }
 
@@ -537,7 +543,11 @@ void MatrixView::animateNext()
 void MatrixView::buttonFrameNext()
 {
   if(matrix != NULL)
+  {
+    if(playing)
+      stopAnimation();
     setActiveFrame(matrix->getActiveFrameIndex() + 1);
+  }
 }
 
 /*
@@ -550,7 +560,11 @@ void MatrixView::buttonFrameNext()
 void MatrixView::buttonFramePrev()
 {
   if(matrix != NULL)
+  {
+    if(playing)
+      stopAnimation();
     setActiveFrame(matrix->getActiveFrameIndex() - 1);
+  }
 }
 
 /*
@@ -767,7 +781,8 @@ void MatrixView::buttonWidthIncrease()
 
 /*
  * Description: Initializes a matrix place dialog at the given selected tile
- *              with the path from the QFileDialog.
+ *              with the path from the QFileDialog. Files outside the naming
+ *              convention open the sprite sheet dialog instead.
  *
  * Inputs: none
  * Output: none
@@ -791,10 +806,10 @@ void MatrixView::initMatrixPlace()
     {
       matrix->matrixPlace(QDir::toNativeSeparators(path), false, false);
     }
-    /* Otherwise, send to matrix dialog */
+    /* Otherwise, send to matrix or sheet dialog */
     else
     {
-      /* Close and delete the dialog if button pressed */
+      /* Close and delete the dialogs if button pressed */
       if(matrix_dialog != NULL)
       {
         matrix_dialog->hide();
@@ -803,12 +818,37 @@ void MatrixView::initMatrixPlace()
         delete matrix_dialog;
         matrix_dialog = NULL;
       }
+      if(sheet_dialog != NULL)
+      {
+        sheet_dialog->hide();
+        disconnect(sheet_dialog,
+                 SIGNAL(sheetPlace(QString, EditorSheetLayout, bool, bool)),
+                 matrix,
+                 SLOT(sheetPlace(QString, EditorSheetLayout, bool, bool)));
+        delete sheet_dialog;
+        sheet_dialog = NULL;
+      }
 
-      /* Open the matrix dialog and connect it */
-      matrix_dialog = new MatrixDialog(path, this);
-      connect(matrix_dialog, SIGNAL(matrixPlace(QString, bool, bool)),
-              matrix, SLOT(matrixPlace(QString, bool, bool)));
-      matrix_dialog->show();
+      /* Files named by convention are matrices. Others are sprite sheets */
+      QString file_name = QFileInfo(path).fileName();
+      if(!EditorHelpers::getValidFileSplit(file_name).isEmpty())
+      {
+        /* Open the matrix dialog and connect it */
+        matrix_dialog = new MatrixDialog(path, this);
+        connect(matrix_dialog, SIGNAL(matrixPlace(QString, bool, bool)),
+                matrix, SLOT(matrixPlace(QString, bool, bool)));
+        matrix_dialog->show();
+      }
+      else
+      {
+        /* Open the sheet dialog and connect it */
+        sheet_dialog = new SheetDialog(path, this);
+        connect(sheet_dialog,
+                SIGNAL(sheetPlace(QString, EditorSheetLayout, bool, bool)),
+                matrix,
+                SLOT(sheetPlace(QString, EditorSheetLayout, bool, bool)));
+        sheet_dialog->show();
+      }
     }
   }
 }
@@ -878,22 +918,41 @@ void MatrixView::rightClickTrigger(EditorTileSprite* sprite)
 
 /*
  * Description: Starts the animation of the matrix. Triggered by play button.
+ *              Every frame is composited once up front (and cached by the
+ *              matrix content), then played in its own scene at the matrix
+ *              frame time.
  *
  * Inputs: none
  * Output: none
  */
 void MatrixView::startAnimation()
 {
-  if(matrix != NULL && matrix->getSprite(0, 0) != NULL && !no_grow)
+  /* Only play if any cell in the matrix has a frame set */
+  int last_frame = -1;
+  if(matrix != NULL)
+    last_frame = matrix->getTrimFrames();
+
+  if(last_frame >= 0 && !no_grow)
   {
+    /* Set back to base */
+    if(button_frame_prev->isEnabled())
+      setActiveFrame(0);
+
+    /* Composite the frames */
+    playing_frames = matrix->getFrameSnapshots(last_frame + 1);
+    playing_index = 0;
+    playing_item->setPixmap(playing_frames.first());
+    playing_scene->setBackgroundBrush(matrix->backgroundBrush());
+    playing_scene->setSceneRect(matrix->sceneRect());
+    matrix_view->setScene(playing_scene);
+
     playing = true;
     button_play->setIcon(QIcon(":/images/icons/32_stop.png"));
 
-    /* Set back to base */
-    while(button_frame_prev->isEnabled())
-      buttonFramePrev();
-
-    playing_timer->start(matrix->getSprite(0, 0)->getAnimationTime().toInt());
+    int interval = matrix->getAnimationTime();
+    if(interval <= 0)
+      interval = kPLAY_INTERVAL;
+    playing_timer->start(interval);
   }
 }
 
@@ -912,9 +971,14 @@ void MatrixView::stopAnimation()
     button_play->setIcon(QIcon(":/images/icons/32_play.png"));
     playing_timer->stop();
 
+    /* Back to the matrix scene */
+    if(matrix_view->scene() != matrix)
+      matrix_view->setScene(matrix);
+    playing_frames.clear();
+
     /* Set back to base */
-    while(button_frame_prev->isEnabled())
-      buttonFramePrev();
+    if(button_frame_prev->isEnabled())
+      setActiveFrame(0);
   }
 }
 
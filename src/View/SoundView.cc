@@ -10,6 +10,8 @@
 
 /* Constant Implementation - see header file for descriptions */
 const int SoundView::kFADE_INTERVAL = 25;
+const int SoundView::kWAVE_HEIGHT = 48;
+const int SoundView::kWAVE_WIDTH = 320;
 
 /*============================================================================
  * CONSTRUCTORS / DESTRUCTORS
@@ -24,6 +26,7 @@ const int SoundView::kFADE_INTERVAL = 25;
 SoundView::SoundView(QWidget* parent) : QWidget(parent)
 {
   changed = false;
+  pcm_output = nullptr;
   sound_base = nullptr;
   sound_curr = new EditorSound();
   timer_fade.setSingleShot(false);
@@ -159,6 +162,16 @@ void SoundView::createLayout()
           this, SLOT(changedFadeTime(int)));
   layout->addWidget(spin_fade, 4, 2);
 
+  /* Sound Info - length and loudness */
+  lbl_info = new QLabel(this);
+  layout->addWidget(lbl_info, 4, 3, 1, 3);
+
+  /* Waveform */
+  lbl_wave = new QLabel(this);
+  lbl_wave->setFixedSize(kWAVE_WIDTH, kWAVE_HEIGHT);
+  lbl_wave->setStyleSheet("border: 1px solid #afafaf");
+  layout->addWidget(lbl_wave, 5, 1, 1, 3);
+
   /* Horizontal Separator */
   QFrame* frm_separator1 = new QFrame(this);
   frm_separator1->setFrameShape(QFrame::VLine);
@@ -215,6 +228,8 @@ void SoundView::createLayout()
           this, SLOT(playerStateChanged(QMediaPlayer::State)));
   connect(&timer_fade, SIGNAL(timeout()), this, SLOT(playerFadeIn()));
   connect(&timer_replay, SIGNAL(timeout()), this, SLOT(playerRepeat()));
+  connect(EditorSoundCache::getShared(), SIGNAL(infoReady(QString)),
+          this, SLOT(soundInfoReady(QString)));
 }
 
 /*
@@ -263,6 +278,7 @@ void SoundView::loadWorkingInfo()
     if(!sound_curr->getFileName().isEmpty())
       player.setMedia(QUrl::fromLocalFile(EditorHelpers::getProjectDir() +
                                           "/" + sound_curr->getFileName()));
+    updateWaveform();
 
     /* Volume */
     slid_vol->setValue(sound_curr->getVolume());
@@ -281,6 +297,80 @@ void SoundView::loadWorkingInfo()
   }
 }
 
+/*
+ * Description: Starts playing the sound. Short sounds with decoded samples in
+ *              the sound cache are played straight from memory, so there is
+ *              no decode delay (and replays start instantly). Everything else
+ *              is played through the media player.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SoundView::play()
+{
+  const EditorSoundPcm* pcm =
+           EditorSoundCache::getShared()->getPcm(sound_curr->getFileNameFull());
+
+  if(pcm != nullptr &&
+     QAudioDeviceInfo::defaultOutputDevice().isFormatSupported(pcm->format))
+  {
+    /* Output is only recreated when the sample format changes */
+    if(pcm_output == nullptr || pcm_output->format() != pcm->format)
+    {
+      delete pcm_output;
+      pcm_output = new QAudioOutput(pcm->format, this);
+      connect(pcm_output, SIGNAL(stateChanged(QAudio::State)),
+              this, SLOT(outputStateChanged(QAudio::State)));
+    }
+
+    pcm_buffer.close();
+    pcm_buffer.setData(pcm->data);
+    pcm_buffer.open(QIODevice::ReadOnly);
+    pcm_output->setVolume(player.volume() / 100.0);
+    pcm_output->start(&pcm_buffer);
+  }
+  else
+  {
+    player.play();
+  }
+}
+
+/*
+ * Description: Handles the end of a play, from either the media player or the
+ *              sample output. Triggers the repeat timer if enabled, otherwise
+ *              stops.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SoundView::playEnded()
+{
+  /* If repeat is enabled, repeat */
+  if(btn_repeat->isChecked())
+  {
+    timer_replay.start(spin_margin->value());
+  }
+  /* Otherwise, no repeat */
+  else
+  {
+    stop();
+  }
+}
+
+/*
+ * Description: Sets the play volume of both the media player and the sample
+ *              output.
+ *
+ * Inputs: int volume - the volume, as a percent (0-100)
+ * Output: none
+ */
+void SoundView::setPlayerVolume(int volume)
+{
+  player.setVolume(volume);
+  if(pcm_output != nullptr)
+    pcm_output->setVolume(volume / 100.0);
+}
+
 /*
  * Description: Triggers the sound player to stop and handles all visual
  *              results of the stop.
@@ -293,11 +383,64 @@ void SoundView::stop()
   /* Stop playing */
   timer_fade.stop();
   player.stop();
+  if(pcm_output != nullptr)
+    pcm_output->stop();
   timer_replay.stop();
   btn_play->setIcon(QIcon(QPixmap(":/images/sound_play.png")));
   enableEditWidgets(true);
 }
 
+/*
+ * Description: Updates the length, loudness and waveform strip of the sound
+ *              file from the sound cache. If the analysis is not ready, the
+ *              file is queued and the strip is redrawn once it is. Short
+ *              sounds also get their samples decoded ahead of the first play.
+ *
+ * Inputs: none
+ * Output: none
+ */
+void SoundView::updateWaveform()
+{
+  QString file = sound_curr->getFileNameFull();
+  EditorSoundInfo info;
+  QPixmap wave(kWAVE_WIDTH, kWAVE_HEIGHT);
+  wave.fill(Qt::white);
+
+  if(file.isEmpty())
+  {
+    lbl_info->setText("");
+  }
+  else if(EditorSoundCache::getShared()->getInfo(file, &info))
+  {
+    lbl_info->setText(EditorSoundCache::getInfoString(info));
+
+    /* Peak envelope, mirrored around the center line */
+    QPainter painter(&wave);
+    int mid = kWAVE_HEIGHT / 2;
+    painter.setPen(QColor(175, 175, 175));
+    painter.drawLine(0, mid, kWAVE_WIDTH, mid);
+    int points = info.waveform.size();
+    for(int i = 0; i < points; i++)
+    {
+      int x = i * kWAVE_WIDTH / points;
+      int width = qMax(1, (i + 1) * kWAVE_WIDTH / points - x);
+      int half = info.waveform[i] * mid / 255;
+      if(half > 0)
+        painter.fillRect(x, mid - half, width, half * 2, QColor(60, 110, 180));
+    }
+
+    /* Decode the samples of short sounds ahead of play */
+    if(info.duration >= 0 && info.duration <= EditorSoundCache::kPCM_MAX_LENGTH)
+      EditorSoundCache::getShared()->getPcm(file);
+  }
+  else
+  {
+    lbl_info->setText(tr("Analyzing..."));
+  }
+
+  lbl_wave->setPixmap(wave);
+}
+
 /*============================================================================
  * PUBLIC SLOTS
  *===========================================================================*/
@@ -323,6 +466,7 @@ void SoundView::btnFileSelect()
       lbl_file_name->setText(sound_curr->getFileName());
       player.setMedia(QUrl::fromLocalFile(EditorHelpers::getProjectDir() +
                                           "/" + sound_curr->getFileName()));
+      updateWaveform();
       changed = true;
     }
   }
@@ -339,22 +483,22 @@ void SoundView::btnFileSelect()
 void SoundView::btnPlay()
 {
   /* Is Stopped - Can trigger a play */
-  if(player.state() == QMediaPlayer::StoppedState && !timer_replay.isActive())
+  if(!isPlaying())
   {
     /* If the file name is set, trigger sound */
     if(!sound_curr->getFileName().isEmpty())
     {
       /* Set volume */
       if(spin_fade->value() == 0)
-        player.setVolume(sound_curr->getVolumePercent());
+        setPlayerVolume(sound_curr->getVolumePercent());
       else
-        player.setVolume(0);
+        setPlayerVolume(0);
 
       /* Trigger play */
-      player.play();
+      play();
 
       /* If volume is at 0, start fading timer */
-      if(player.volume() == 0)
+      if(spin_fade->value() != 0)
       {
         vol_ref = 0.0;
         timer_fade.start(kFADE_INTERVAL);
@@ -420,6 +564,7 @@ void SoundView::btnSave()
     if(name_diff)
       emit nameChange(sound_base->getName());
     changed = false;
+    emit dataSaved();
   }
 }
 
@@ -454,6 +599,31 @@ void SoundView::changedName(QString name)
   }
 }
 
+/*
+ * Description: Slot trigger when the sample output state changes. Mirrors the
+ *              media player visuals while active, and stops the output once
+ *              all samples are played.
+ *
+ * Inputs: QAudio::State state - the new output state
+ * Output: none
+ */
+void SoundView::outputStateChanged(QAudio::State state)
+{
+  if(state == QAudio::ActiveState)
+  {
+    btn_play->setIcon(QIcon(QPixmap(":/images/sound_stop.png")));
+    enableEditWidgets(false);
+  }
+  else if(state == QAudio::IdleState)
+  {
+    pcm_output->stop();
+  }
+  else if(state == QAudio::StoppedState)
+  {
+    playEnded();
+  }
+}
+
 /*
  * Description: Slot trigger when the fade in timer is triggered and increments
  *              the volume. Used to simulate a fade in. Will not fade out on
@@ -476,7 +646,7 @@ void SoundView::playerFadeIn()
   }
 
   /* Change volume */
-  player.setVolume((int)vol_ref);
+  setPlayerVolume((int)vol_ref);
 
   /* Stop timer, if relevant */
   if(finished)
@@ -493,7 +663,7 @@ void SoundView::playerFadeIn()
  */
 void SoundView::playerRepeat()
 {
-  player.play();
+  play();
 }
 
 /*
@@ -512,19 +682,23 @@ void SoundView::playerStateChanged(QMediaPlayer::State state)
   }
   else
   {
-    /* If repeat is enabled, repeat */
-    if(btn_repeat->isChecked())
-    {
-      timer_replay.start(spin_margin->value());
-    }
-    /* Otherwise, no repeat */
-    else
-    {
-      stop();
-    }
+    playEnded();
   }
 }
 
+/*
+ * Description: Slot triggered when the sound cache finishes analyzing a file.
+ *              Redraws the waveform if it is the file being edited.
+ *
+ * Inputs: QString file - the full path of the analyzed file
+ * Output: none
+ */
+void SoundView::soundInfoReady(QString file)
+{
+  if(sound_base != nullptr && file == sound_curr->getFileNameFull())
+    updateWaveform();
+}
+
 /*
  * Description: Slot triggered when the volume slider is modified. This will
  *              occur prior to releasing the click, updates the label, and
@@ -574,6 +748,8 @@ bool SoundView::isChanged()
 bool SoundView::isPlaying()
 {
   return (player.state() == QMediaPlayer::PlayingState ||
+          (pcm_output != nullptr &&
+           pcm_output->state() == QAudio::ActiveState) ||
           timer_replay.isActive());
 }
 